@@ -1,4 +1,4 @@
-import { createAccount, login } from "@/lib/api";
+import { createAccount, login, logout } from "@/lib/api";
 import { ErrorId } from "@/lib/apiTypes";
 import fetchMock from "jest-fetch-mock";
 
@@ -123,4 +123,20 @@ describe("api", () => {
     expect(fetchMock).toBeCalledTimes(1);
     expect(res).toStrictEqual({ type: errorId });
   });
+
+  test("logout", async () => {
+    // Mock setup
+    fetchMock.mockIf("/api/logout", async (req) => {
+      expect(req.method).toEqual("POST");
+      return {
+        status: 204,
+      };
+    });
+
+    // Call the function
+    await logout();
+
+    // Validate
+    expect(fetchMock).toBeCalledTimes(1);
+  });
 });
@@ -2,6 +2,7 @@ import React, { useState, useEffect } from "react";
 import Image from "next/image";
 import boostLogo from "@/public/boost.jpg";
 import { clearHasAuth } from "@/lib/hasAuth";
+import { logout } from "@/lib/api";
 
 interface HeaderProps {
   onCreateRoom?: () => void;
@@ -15,8 +16,9 @@ export default function Header({ onCreateRoom, currentUserId, username, pageType
   const [showModal, setShowModal] = useState<{type: string, content: string} | null>(null);
 
   // 处理退出按钮点击事件
-  const handleLogout = () => {
+  const handleLogout = async () => {
     console.log("退出登录");
+    await logout();
     alert("退出登录成功！");
     clearHasAuth();
     window.location.href = "/login";
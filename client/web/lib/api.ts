@@ -84,3 +84,12 @@ export async function createAccount({
     ]);
   }
 }
+
+// Best effort: the server revokes the session and clears the cookie
+export async function logout(): Promise<void> {
+  try {
+    await sendRequest({ method: "POST", path: "logout", body: {} });
+  } catch (err) {
+    console.error("Logout request failed", err);
+  }
+}
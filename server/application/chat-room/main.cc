@@ -9,15 +9,21 @@
 #include <thread>
 #include <grpcpp/grpcpp.h>
 #include "muduo/net/TcpServer.h"
+#include "muduo/net/EventLoopThreadPool.h"
 #include "muduo/net/TcpConnection.h"
-#include "muduo/base/ThreadPool.h"
 #include "muduo/net/EventLoop.h"
 #include "muduo/base/Logging.h"
 #include "config_file_reader.h"
+#include "session_token.h"
 #include "http_handler.h"
 #include "service/pub_sub_service.h"
+#include "service/conn_shard.h"
 #include "service/logic_config.h"
 #include "service/logic_client.h"
+#include "service/logic_http_pool.h"
+#include "service/logic_rpc_client.h"
+#include "service/websocket_simd.h"
+#include "service/backpressure.h"
 #include "rpc/comet_service.h"
 
 using namespace muduo;
@@ -31,6 +37,7 @@ namespace {
     constexpr const char* DEFAULT_BIND_IP = "0.0.0.0";
     constexpr uint16_t DEFAULT_HTTP_PORT = 8080;
     constexpr const char* DEFAULT_GRPC_ADDRESS = "0.0.0.0:50051";
+    constexpr double STATS_LOG_INTERVAL_SECONDS = 60.0;
 }
 
 // WebSocket and http connection Manager 
@@ -73,9 +80,19 @@ struct ServerConfig {
     uint16_t http_port = DEFAULT_HTTP_PORT;
     std::string grpc_bind_ip = "0.0.0.0";
     uint16_t grpc_port = 50051;
+    int grpc_cq_threads = 2;    // completion queue threads of the comet gRPC service
     int num_event_loops = 0;    // number of event loops
+    bool reuseport_acceptors = false;   // one SO_REUSEPORT acceptor per io loop
+    bool io_uring = false;              // io_uring poller instead of epoll for every loop
+    bool edge_triggered = false;        // EPOLLET client connections, drained on every event
+    size_t edge_triggered_budget = TcpConnection::kDefaultEdgeBudget;  // bytes per connection per event
     int num_threads = DEFAULT_THREAD_POOL_SIZE; 
     int timeout_ms = 1000;
+    size_t ws_max_frame_size = CWebSocketDecoder::kDefaultMaxFrameSize;
+    PerMessageDeflateConfig ws_deflate;
+    BackpressureConfig backpressure;
+    int ws_idle_timeout_seconds = 90;       // 0 disables idle reaping
+    int ws_ping_interval_seconds = 30;      // 0 disables server ping
     Logger::LogLevel log_level = Logger::INFO;
 
     bool loadFromFile(const std::string& config_path) {
@@ -91,6 +108,21 @@ struct ServerConfig {
                 num_event_loops = atoi(str_num_event_loops);
             }
 
+            if (char* str_reuseport_acceptors = config_file.GetConfigName("reuseport_acceptors")) {
+                reuseport_acceptors = atoi(str_reuseport_acceptors) != 0;
+            }
+
+            if (char* str_io_uring = config_file.GetConfigName("io_uring")) {
+                io_uring = atoi(str_io_uring) != 0;
+            }
+
+            if (char* str_edge_triggered = config_file.GetConfigName("edge_triggered")) {
+                edge_triggered = atoi(str_edge_triggered) != 0;
+            }
+            if (char* str_edge_triggered_budget = config_file.GetConfigName("edge_triggered_budget")) {
+                edge_triggered_budget = static_cast<size_t>(atoll(str_edge_triggered_budget));
+            }
+
             if (char* str_num_threads = config_file.GetConfigName("num_threads")) {
                 num_threads = atoi(str_num_threads);
             }
@@ -106,10 +138,49 @@ struct ServerConfig {
             if (char* str_grpc_bind_port = config_file.GetConfigName("grpc_bind_port")) {
                 grpc_port = static_cast<uint16_t>(atoi(str_grpc_bind_port));
             }
+            if (char* str_grpc_cq_threads = config_file.GetConfigName("grpc_cq_threads")) {
+                grpc_cq_threads = atoi(str_grpc_cq_threads);
+            }
 
             if (char* str_timeout_ms = config_file.GetConfigName("timeout_ms")) {
                 timeout_ms = atoi(str_timeout_ms);
             }
+
+            if (char* str_ws_max_frame_size = config_file.GetConfigName("ws_max_frame_size")) {
+                ws_max_frame_size = static_cast<size_t>(atoll(str_ws_max_frame_size));
+            }
+
+            // permessage-deflate
+            if (char* str_ws_permessage_deflate = config_file.GetConfigName("ws_permessage_deflate")) {
+                ws_deflate.enabled = atoi(str_ws_permessage_deflate) != 0;
+            }
+            if (char* str_ws_deflate_level = config_file.GetConfigName("ws_deflate_level")) {
+                ws_deflate.level = atoi(str_ws_deflate_level);
+            }
+            if (char* str_ws_deflate_min_size = config_file.GetConfigName("ws_deflate_min_size")) {
+                ws_deflate.min_size = static_cast<size_t>(atoll(str_ws_deflate_min_size));
+            }
+
+            // slow consumer backpressure
+            if (char* str_ws_high_water_mark = config_file.GetConfigName("ws_high_water_mark")) {
+                backpressure.high_water_mark = static_cast<size_t>(atoll(str_ws_high_water_mark));
+            }
+            if (char* str_ws_slow_consumer_policy = config_file.GetConfigName("ws_slow_consumer_policy")) {
+                if (!Backpressure::ParsePolicy(str_ws_slow_consumer_policy, &backpressure.policy)) {
+                    LOG_WARN << "unknown ws_slow_consumer_policy: " << str_ws_slow_consumer_policy << ", use drop_oldest";
+                }
+            }
+            if (char* str_ws_slow_consumer_close_seconds = config_file.GetConfigName("ws_slow_consumer_close_seconds")) {
+                backpressure.close_after_seconds = atof(str_ws_slow_consumer_close_seconds);
+            }
+
+            // heartbeat
+            if (char* str_ws_idle_timeout_seconds = config_file.GetConfigName("ws_idle_timeout_seconds")) {
+                ws_idle_timeout_seconds = atoi(str_ws_idle_timeout_seconds);
+            }
+            if (char* str_ws_ping_interval_seconds = config_file.GetConfigName("ws_ping_interval_seconds")) {
+                ws_ping_interval_seconds = atoi(str_ws_ping_interval_seconds);
+            }
             return true;
         } catch (const std::exception& e) {
             LOG_ERROR << "Failed to load config: " << e.what();
@@ -123,7 +194,8 @@ public:
     HttpServer(EventLoop* loop, const InetAddress& addr, const std::string& name, 
                const ServerConfig& config)
         : m_loop(loop)
-        , m_server(loop, addr, name)
+        , m_server(loop, addr, name,
+                   config.reuseport_acceptors ? TcpServer::kReusePortPerLoop : TcpServer::kNoReusePort)
         , m_config(config)
         , m_connection_manager(std::make_unique<ConnectionManager>())
     {
@@ -136,6 +208,9 @@ public:
             std::bind(&HttpServer::OnWriteComplete, this, std::placeholders::_1));
 
         m_server.setThreadNum(m_config.num_event_loops);
+        if (m_config.edge_triggered) {
+            m_server.setEdgeTriggered(true, m_config.edge_triggered_budget);
+        }
     }
 
     ~HttpServer() {
@@ -147,7 +222,14 @@ public:
             if (m_config.num_threads > 0) {
                 CWebSocketConn::InitThreadPool(m_config.num_threads);
             }
+            CWebSocketConn::SetMaxFrameSize(m_config.ws_max_frame_size);
+            SetPerMessageDeflateConfig(m_config.ws_deflate);
+            Backpressure::GetInstance().SetConfig(m_config.backpressure);
+            LOG_INFO << "websocket simd kernels: " << WsSimdKernelName();
             m_server.start();
+            // one conn shard per io loop
+            ConnShardManager::GetInstance().Init(m_server.threadPool()->getAllLoops(),
+                m_config.ws_idle_timeout_seconds, m_config.ws_ping_interval_seconds);
             LOG_INFO << "HttpServer started successfully";
             return true;
         } catch (const std::exception& e) {
@@ -177,6 +259,10 @@ private:
                          << ", Total connections: " << this->GetConnectionCount();
             } else {
                 auto conn_id = std::any_cast<uint32_t>(conn->getContext());
+                HttpHandlerPtr http_handler = m_connection_manager->GetConnection(conn_id);
+                if (http_handler) {
+                    http_handler->OnClose();
+                }
                 m_connection_manager->RemoveConnection(conn_id);
                 
                 LOG_INFO << "Connection closed, ID: " << conn_id 
@@ -199,13 +285,9 @@ private:
 
             LOG_DEBUG << "Processing message for connection ID: " << conn_id;
 
-            if (m_config.num_threads > 0) {
-                // threadpool
-                m_thread_pool.run(std::bind(&HttpHandler::OnRead, http_handler, buf));
-            } else {
-                // IO thread
-                http_handler->OnRead(buf);
-            }
+            // parse in the IO thread, buf belongs to it and the next read appends to it;
+            // the business work of a websocket frame goes on to the conn's strand with its own copy
+            http_handler->OnRead(buf);
         } catch (const std::exception& e) {
             LOG_ERROR << "Error in onMessage: " << e.what();
         }
@@ -220,7 +302,6 @@ private:
     TcpServer m_server;
     ServerConfig m_config;
     std::unique_ptr<ConnectionManager> m_connection_manager;
-    ThreadPool m_thread_pool;
 };
 
 // 房间订阅管理
@@ -234,53 +315,20 @@ public:
         LogicConfig& logic_config = LogicConfig::getInstance();
         string logic_server_url = logic_config.getLogicServerUrl();
         
-        Json::Value request_json;
-        request_json["type"] = "getAllRooms";
-        
-        Json::FastWriter writer;
-        string post_data = writer.write(request_json);
-        
-        // 发送HTTP请求到Logic层
+        // 从Logic层获取房间列表
         LogicClient logic_client(logic_server_url);
-        string response_json;
-        string url = logic_server_url + "/logic/rooms";
-        
-        if (!logic_client.sendHttpRequest(url, post_data, response_json)) {
+        std::vector<LogicRoom> rooms;
+        if (logic_client.getAllRooms(rooms) < 0) {
             LOG_ERROR << "Failed to get room list from Logic layer";
             return -1;
         }
-        
-        // 解析Logic层返回的房间列表
-        Json::Reader reader;
-        Json::Value logic_response;
-        if (!reader.parse(response_json, logic_response)) {
-            LOG_ERROR << "Failed to parse room list response from Logic layer";
-            return -1;
-        }
-        
-
-        if (logic_response.isMember("rooms") && logic_response.isMember("status") && 
-            logic_response["status"].asString() == "success") {
-            Json::Value rooms = logic_response["rooms"];
-            for (int i = 0; i < rooms.size(); ++i) {
-                Json::Value room = rooms[i];
-                if (room.isMember("id") && room.isMember("name")) {
-                    string room_id = room["id"].asString();
-                    string room_name = room["name"].asString();
-                    
-                    pubSubService.AddRoomTopic(room_id, room_name, "1");
-                    LOG_DEBUG << "Room subscription initialized: " << room_id << ", name: " << room_name;
-                }
-            }
-
-            LOG_INFO << "Room subscription manager initialized, total rooms: " << rooms.size();
-
-        } else {
-
-            LOG_WARN << "No rooms found in Logic layer response or request failed";
-            return -1;
 
+        for (const auto& room : rooms) {
+            pubSubService.AddRoomTopic(room.room_id, room.room_name, "1");
+            LOG_DEBUG << "Room subscription initialized: " << room.room_id << ", name: " << room.room_name;
         }
+
+        LOG_INFO << "Room subscription manager initialized, total rooms: " << rooms.size();
         
         return 0;
     }
@@ -308,6 +356,12 @@ public:
             }
             Logger::setLogLevel(m_config.log_level);
 
+            // muduo 在创建每个 EventLoop 时按环境变量选择 poller, 必须在第一个 loop 之前设置;
+            // 内核不支持时退回 epoll
+            if (m_config.io_uring) {
+                setenv("MUDUO_USE_URING", "1", 1);
+            }
+
             if (!InitializeLogicConfig()) {
                 return -1;
             }
@@ -350,43 +404,63 @@ private:
             return false;
         }
         LOG_INFO << "Logic config initialized successfully";
+
+        // keep-alive conns to logic on their own loop thread
+        LogicHttpPoolConfig pool_config;
+        pool_config.conns_per_endpoint = logic_config.getPoolConnections();
+        pool_config.max_pipeline_depth = logic_config.getPipelineDepth();
+        pool_config.connect_timeout = logic_config.getConnectTimeout();
+        pool_config.request_timeout = logic_config.getRequestTimeout();
+        CLogicHttpPool::GetInstance().Init(pool_config);
+
+        // login/register stay on http, the rest goes through ChatRoom.Logic
+        if (logic_config.useGrpc()) {
+            CLogicRpcClient::GetInstance().Init(logic_config.getLogicRpcTarget(),
+                logic_config.getPoolConnections(), logic_config.getRequestTimeout());
+        }
+
+        // 握手时本地校验会话 token, 只有不认识的 kid 才问 logic
+        if (logic_config.sessionTokenEnabled() &&
+            !CSessionTokenCodec::GetInstance().Init(logic_config.getSessionTokenKeys(), "", 0)) {
+            LOG_ERROR << "Failed to initialize session token";
+            return false;
+        }
         return true;
     }
 
     // start servers
     int StartServers() {
 
-        // start gRPC server
-        std::string grpc_server_address = m_config.grpc_bind_ip + ":" + std::to_string(m_config.grpc_port);
-        ChatRoom::CometServiceImpl comet_service;
-
-        grpc::ServerBuilder builder;
-        builder.AddListeningPort(grpc_server_address, grpc::InsecureServerCredentials());
-        builder.RegisterService(&comet_service);
-        std::unique_ptr<grpc::Server> grpc_server(builder.BuildAndStart());
-        LOG_INFO << "gRPC Server listening on " << grpc_server_address;
-
         EventLoop loop;
         InetAddress addr(m_config.bind_ip, m_config.http_port);
         LOG_INFO << "Starting HTTP server on " << m_config.bind_ip 
                  << ":" << m_config.http_port;
         HttpServer server(&loop, addr, "ChatRoomServer", m_config);
 
+        // conn shards must be ready before gRPC broadcasts arrive
         if (!server.Start()) {
             return -1;
         }
 
-        // handle HTTP and gRPC requests concurrently
-        std::thread grpc_thread([&grpc_server]() {
-            grpc_server->Wait();
-            });
+        // start gRPC server
+        std::string grpc_server_address = m_config.grpc_bind_ip + ":" + std::to_string(m_config.grpc_port);
+        ChatRoom::CometServiceImpl comet_service;
+
+        // gRPC calls are served on their own cq threads, concurrently with HTTP
+        if (!comet_service.Start(grpc_server_address, m_config.grpc_cq_threads)) {
+            return -1;
+        }
 
         LOG_INFO << "ChatRoom server is running...";
 
+        // export backpressure counters
+        loop.runEvery(STATS_LOG_INTERVAL_SECONDS, []() {
+            LOG_INFO << "backpressure stats, " << Backpressure::GetInstance().StatsString();
+        });
+
         loop.loop(m_config.timeout_ms);     // 1000ms
         
-        grpc_server->Shutdown();
-        grpc_thread.join();
+        comet_service.Shutdown();
 
         return 0;
     }
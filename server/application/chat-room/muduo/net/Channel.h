@@ -63,7 +63,12 @@ class Channel : noncopyable
   void disableReading() { events_ &= ~kReadEvent; update(); }
   void enableWriting() { events_ |= kWriteEvent; update(); }
   void disableWriting() { events_ &= ~kWriteEvent; update(); }
+  void enableReadingAndWriting() { events_ |= kReadEvent | kWriteEvent; update(); }
   void disableAll() { events_ = kNoneEvent; update(); }
+  /// registered with EPOLLET by EPollPoller, set before enabling any event.
+  /// the owner must drain the fd on every event.
+  void setEdgeTriggered(bool on) { edgeTriggered_ = on; }
+  bool isEdgeTriggered() const { return edgeTriggered_; }
   bool isWriting() const { return events_ & kWriteEvent; }
   bool isReading() const { return events_ & kReadEvent; }
 
@@ -96,6 +101,7 @@ class Channel : noncopyable
   int        revents_; // it's the received event types of epoll or poll
   int        index_; // used by Poller.
   bool       logHup_;
+  bool       edgeTriggered_;
 
   std::weak_ptr<void> tie_;
   bool tied_;
@@ -16,6 +16,7 @@
 #include "muduo/net/SocketsOps.h"
 
 #include <errno.h>
+#include <sys/uio.h>
 
 using namespace muduo;
 using namespace muduo::net;
@@ -48,7 +49,13 @@ TcpConnection::TcpConnection(EventLoop* loop,
     channel_(new Channel(loop, sockfd)),
     localAddr_(localAddr),
     peerAddr_(peerAddr),
-    highWaterMark_(64*1024*1024)
+    highWaterMark_(64*1024*1024),
+    sharedOutputOffset_(0),
+    sharedOutputBytes_(0),
+    sendSubmitted_(false),
+    edgeTriggered_(false),
+    edgeBudget_(kDefaultEdgeBudget),
+    awaitingWrite_(false)
 {
   channel_->setReadCallback(
       std::bind(&TcpConnection::handleRead, this, _1));
@@ -131,6 +138,24 @@ void TcpConnection::send(Buffer* buf)
   }
 }
 
+void TcpConnection::send(const SharedBytesPtr& message)
+{
+  if (state_ == kConnected && message && !message->empty())
+  {
+    if (loop_->isInLoopThread())
+    {
+      sendSharedInLoop(message);
+    }
+    else
+    {
+      loop_->runInLoop(
+          std::bind(&TcpConnection::sendSharedInLoop,
+                    this,     // FIXME
+                    message));
+    }
+  }
+}
+
 void TcpConnection::sendInLoop(const StringPiece& message)
 {
   sendInLoop(message.data(), message.size());
@@ -148,7 +173,7 @@ void TcpConnection::sendInLoop(const void* data, size_t len)
     return;
   }
   // if no thing in output queue, try writing directly
-  if (!channel_->isWriting() && outputBuffer_.readableBytes() == 0)
+  if (!isWritingOutput() && pendingOutputBytes() == 0)
   {
     nwrote = sockets::write(channel_->fd(), data, len);
     if (nwrote >= 0)
@@ -176,21 +201,235 @@ void TcpConnection::sendInLoop(const void* data, size_t len)
   assert(remaining <= len);
   if (!faultError && remaining > 0)
   {
-    size_t oldLen = outputBuffer_.readableBytes();
+    size_t oldLen = pendingOutputBytes();
     if (oldLen + remaining >= highWaterMark_
         && oldLen < highWaterMark_
         && highWaterMarkCallback_)
     {
       loop_->queueInLoop(std::bind(highWaterMarkCallback_, shared_from_this(), oldLen + remaining));
     }
-    outputBuffer_.append(static_cast<const char*>(data)+nwrote, remaining);
-    if (!channel_->isWriting())
+    if (sharedOutput_.empty())
+    {
+      outputBuffer_.append(static_cast<const char*>(data)+nwrote, remaining);
+    }
+    else
+    {
+      // keep the order, queue it behind the shared messages
+      SharedOutput output = { std::make_shared<const string>(static_cast<const char*>(data)+nwrote, remaining), false };
+      sharedOutput_.push_back(std::move(output));
+      sharedOutputBytes_ += remaining;
+    }
+    if (!isWritingOutput() && !sendSubmitted_)
+    {
+      startWritingOutput();
+    }
+  }
+}
+
+void TcpConnection::sendSharedInLoop(const SharedBytesPtr& message)
+{
+  loop_->assertInLoopThread();
+  ssize_t nwrote = 0;
+  size_t len = message->size();
+  size_t remaining = len;
+  bool faultError = false;
+  if (state_ == kDisconnected)
+  {
+    LOG_WARN << this << "disconnected, give up writing";
+    return;
+  }
+  // if no thing in output queue, try writing directly
+  if (!isWritingOutput() && pendingOutputBytes() == 0)
+  {
+    // or let the poller batch it with the other sends of this round,
+    // the message stays in the queue until handleSendComplete()
+    if (loop_->submitSend(channel_->fd(), message->data(), len, shared_from_this()))
+    {
+      SharedOutput output = { message, true };
+      sharedOutput_.push_back(std::move(output));
+      sharedOutputOffset_ = 0;
+      sharedOutputBytes_ += len;
+      sendSubmitted_ = true;
+      return;
+    }
+    nwrote = sockets::write(channel_->fd(), message->data(), len);
+    if (nwrote >= 0)
+    {
+      remaining = len - nwrote;
+      if (remaining == 0 && writeCompleteCallback_)
+      {
+        loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+      }
+    }
+    else // nwrote < 0
+    {
+      nwrote = 0;
+      if (errno != EWOULDBLOCK)
+      {
+        LOG_SYSERR << "TcpConnection::sendSharedInLoop";
+        if (errno == EPIPE || errno == ECONNRESET) // FIXME: any others?
+        {
+          faultError = true;
+        }
+      }
+    }
+  }
+
+  assert(remaining <= len);
+  if (!faultError && remaining > 0)
+  {
+    size_t oldLen = pendingOutputBytes();
+    if (oldLen + remaining >= highWaterMark_
+        && oldLen < highWaterMark_
+        && highWaterMarkCallback_)
+    {
+      loop_->queueInLoop(std::bind(highWaterMarkCallback_, shared_from_this(), oldLen + remaining));
+    }
+    // no copy, just hold a reference
+    if (sharedOutput_.empty())
+    {
+      sharedOutputOffset_ = nwrote;
+    }
+    SharedOutput output = { message, true };
+    sharedOutput_.push_back(std::move(output));
+    sharedOutputBytes_ += remaining;
+    if (!isWritingOutput() && !sendSubmitted_)
+    {
+      startWritingOutput();
+    }
+  }
+}
+
+// gather outputBuffer_ and the shared output queue into one writev()
+ssize_t TcpConnection::writeOutput()
+{
+  const int kMaxIov = 64;
+  struct iovec vec[kMaxIov];
+  int iovcnt = 0;
+  if (outputBuffer_.readableBytes() > 0)
+  {
+    vec[iovcnt].iov_base = const_cast<char*>(outputBuffer_.peek());
+    vec[iovcnt].iov_len = outputBuffer_.readableBytes();
+    ++iovcnt;
+  }
+  size_t offset = sharedOutputOffset_;
+  for (auto it = sharedOutput_.begin();
+       it != sharedOutput_.end() && iovcnt < kMaxIov;
+       ++it)
+  {
+    vec[iovcnt].iov_base = const_cast<char*>(it->data->data()) + offset;
+    vec[iovcnt].iov_len = it->data->size() - offset;
+    ++iovcnt;
+    offset = 0;
+  }
+
+  ssize_t n = iovcnt == 1
+              ? sockets::write(channel_->fd(), vec[0].iov_base, vec[0].iov_len)
+              : sockets::writev(channel_->fd(), vec, iovcnt);
+  if (n > 0)
+  {
+    retrieveOutput(static_cast<size_t>(n));
+  }
+  return n;
+}
+
+void TcpConnection::retrieveOutput(size_t n)
+{
+  size_t left = n;
+  size_t fromBuffer = std::min(left, outputBuffer_.readableBytes());
+  outputBuffer_.retrieve(fromBuffer);
+  left -= fromBuffer;
+  sharedOutputBytes_ -= left;
+  while (left > 0)
+  {
+    size_t chunk = sharedOutput_.front().data->size() - sharedOutputOffset_;
+    if (left < chunk)
+    {
+      sharedOutputOffset_ += left;
+      break;
+    }
+    left -= chunk;
+    sharedOutput_.pop_front();
+    sharedOutputOffset_ = 0;
+  }
+}
+
+void TcpConnection::handleSendComplete(ssize_t n)
+{
+  loop_->assertInLoopThread();
+  assert(sendSubmitted_);
+  sendSubmitted_ = false;
+  bool faultError = false;
+  if (n > 0)
+  {
+    retrieveOutput(static_cast<size_t>(n));
+  }
+  else if (n < 0 && n != -EAGAIN)
+  {
+    errno = static_cast<int>(-n);
+    LOG_SYSERR << "TcpConnection::handleSendComplete";
+    faultError = true;
+  }
+  if (state_ == kDisconnected)
+  {
+    return;
+  }
+
+  if (pendingOutputBytes() == 0)
+  {
+    if (writeCompleteCallback_)
+    {
+      loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+    }
+    if (state_ == kDisconnecting)
+    {
+      shutdownInLoop();
+    }
+  }
+  else if (!faultError)
+  {
+    // queued while the send was in flight, keep submitting while the socket
+    // takes whole messages, once it is full the rest goes out on POLLOUT
+    const SharedBytesPtr& front = sharedOutput_.front().data;
+    bool full = n <= 0 || sharedOutputOffset_ > 0;
+    if (!full && outputBuffer_.readableBytes() == 0
+        && loop_->submitSend(channel_->fd(), front->data(), front->size(), shared_from_this()))
+    {
+      sendSubmitted_ = true;
+    }
+    else if (!isWritingOutput())
     {
-      channel_->enableWriting();
+      startWritingOutput();
     }
   }
 }
 
+size_t TcpConnection::discardQueuedSharedOutput(size_t maxPendingBytes)
+{
+  loop_->assertInLoopThread();
+  size_t dropped = 0;
+  // the front message may be partially written or being sent, keep it
+  auto it = sharedOutput_.begin();
+  if (it != sharedOutput_.end() && (sharedOutputOffset_ > 0 || sendSubmitted_))
+  {
+    ++it;
+  }
+  while (it != sharedOutput_.end() && pendingOutputBytes() > maxPendingBytes)
+  {
+    if (it->discardable)
+    {
+      sharedOutputBytes_ -= it->data->size();
+      it = sharedOutput_.erase(it);
+      ++dropped;
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  return dropped;
+}
+
 void TcpConnection::shutdown()
 {
   // FIXME: use compare and swap
@@ -205,7 +444,7 @@ void TcpConnection::shutdown()
 void TcpConnection::shutdownInLoop()
 {
   loop_->assertInLoopThread();
-  if (!channel_->isWriting())
+  if (!isWritingOutput() && !sendSubmitted_)
   {
     // we are not writing
     socket_->shutdownWrite();
@@ -326,7 +565,21 @@ void TcpConnection::connectEstablished()
   assert(state_ == kConnecting);
   setState(kConnected);
   channel_->tie(shared_from_this());
-  channel_->enableReading();
+  // poll(2) and io_uring pollers stay level-triggered
+  if (edgeTriggered_ && !loop_->supportsEdgeTriggered())
+  {
+    edgeTriggered_ = false;
+  }
+  if (edgeTriggered_)
+  {
+    // registered once, queued output doesn't need an epoll_ctl()
+    channel_->setEdgeTriggered(true);
+    channel_->enableReadingAndWriting();
+  }
+  else
+  {
+    channel_->enableReading();
+  }
 
   connectionCallback_(shared_from_this());
 }
@@ -348,6 +601,11 @@ void TcpConnection::connectDestroyed()
 void TcpConnection::handleRead(Timestamp receiveTime)
 {
   loop_->assertInLoopThread();
+  if (edgeTriggered_)
+  {
+    handleReadEdge(receiveTime);
+    return;
+  }
   int savedErrno = 0;
   ssize_t n = inputBuffer_.readFd(channel_->fd(), &savedErrno);
   if (n > 0)
@@ -369,17 +627,20 @@ void TcpConnection::handleRead(Timestamp receiveTime)
 void TcpConnection::handleWrite()
 {
   loop_->assertInLoopThread();
+  if (edgeTriggered_)
+  {
+    handleWriteEdge();
+    return;
+  }
   if (channel_->isWriting())
   {
-    ssize_t n = sockets::write(channel_->fd(),
-                               outputBuffer_.peek(),
-                               outputBuffer_.readableBytes());
+    // writeOutput() retrieves the written bytes itself
+    ssize_t n = writeOutput();
     if (n > 0)
     {
-      outputBuffer_.retrieve(n);
-      if (outputBuffer_.readableBytes() == 0)
+      if (pendingOutputBytes() == 0)
       {
-        channel_->disableWriting();
+        stopWritingOutput();
         if (writeCompleteCallback_)
         {
           loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
@@ -406,6 +667,162 @@ void TcpConnection::handleWrite()
   }
 }
 
+void TcpConnection::handleReadEdge(Timestamp receiveTime)
+{
+  // no more event until new data arrives, read until EAGAIN or a short read
+  size_t total = 0;
+  bool drained = false;
+  while (!drained && total < edgeBudget_)
+  {
+    int savedErrno = 0;
+    const size_t capacity = inputBuffer_.readFdCapacity();
+    ssize_t n = inputBuffer_.readFd(channel_->fd(), &savedErrno);
+    if (n > 0)
+    {
+      total += n;
+      drained = implicit_cast<size_t>(n) < capacity;
+    }
+    else if (n == 0)
+    {
+      if (total > 0)
+      {
+        messageCallback_(shared_from_this(), &inputBuffer_, receiveTime);
+      }
+      if (state_ == kConnected || state_ == kDisconnecting)
+      {
+        handleClose();
+      }
+      return;
+    }
+    else if (savedErrno == EAGAIN || savedErrno == EWOULDBLOCK)
+    {
+      drained = true;
+    }
+    else if (savedErrno != EINTR)
+    {
+      // no other edge will report it, close like a level-triggered loop would
+      errno = savedErrno;
+      LOG_SYSERR << "TcpConnection::handleReadEdge";
+      handleError();
+      if (state_ == kConnected || state_ == kDisconnecting)
+      {
+        handleClose();
+      }
+      return;
+    }
+  }
+  if (total > 0)
+  {
+    messageCallback_(shared_from_this(), &inputBuffer_, receiveTime);
+  }
+  if (!drained && state_ != kDisconnected)
+  {
+    // budget used up, the rest after the other ready connections
+    loop_->queueInLoop(std::bind(&TcpConnection::resumeRead, shared_from_this()));
+  }
+}
+
+void TcpConnection::handleWriteEdge()
+{
+  if (!awaitingWrite_)
+  {
+    // writable, but nothing is queued
+    return;
+  }
+  size_t total = 0;
+  while (pendingOutputBytes() > 0 && total < edgeBudget_)
+  {
+    ssize_t n = writeOutput();
+    if (n > 0)
+    {
+      total += n;
+    }
+    else if (n < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    else if (n == 0 || errno == EWOULDBLOCK || errno == EAGAIN)
+    {
+      // the next edge comes when the socket has room again
+      return;
+    }
+    else
+    {
+      // EPIPE, ECONNRESET...: no other edge will report it, close like handleReadEdge
+      LOG_SYSERR << "TcpConnection::handleWriteEdge";
+      handleError();
+      if (state_ == kConnected || state_ == kDisconnecting)
+      {
+        handleClose();
+      }
+      return;
+    }
+  }
+  if (pendingOutputBytes() == 0)
+  {
+    awaitingWrite_ = false;
+    if (writeCompleteCallback_)
+    {
+      loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+    }
+    if (state_ == kDisconnecting)
+    {
+      shutdownInLoop();
+    }
+  }
+  else
+  {
+    loop_->queueInLoop(std::bind(&TcpConnection::resumeWrite, shared_from_this()));
+  }
+}
+
+void TcpConnection::resumeRead()
+{
+  loop_->assertInLoopThread();
+  if (state_ != kDisconnected && channel_->isReading())
+  {
+    handleReadEdge(loop_->pollReturnTime());
+  }
+}
+
+void TcpConnection::resumeWrite()
+{
+  loop_->assertInLoopThread();
+  if (state_ != kDisconnected)
+  {
+    handleWriteEdge();
+  }
+}
+
+bool TcpConnection::isWritingOutput() const
+{
+  return edgeTriggered_ ? awaitingWrite_ : channel_->isWriting();
+}
+
+void TcpConnection::startWritingOutput()
+{
+  if (edgeTriggered_)
+  {
+    awaitingWrite_ = true;
+  }
+  else
+  {
+    channel_->enableWriting();
+  }
+}
+
+void TcpConnection::stopWritingOutput()
+{
+  if (edgeTriggered_)
+  {
+    awaitingWrite_ = false;
+  }
+  else
+  {
+    channel_->disableWriting();
+  }
+}
+
 void TcpConnection::handleClose()
 {
   loop_->assertInLoopThread();
@@ -6,9 +6,11 @@
 
 // Author: Shuo Chen (chenshuo at chenshuo dot com)
 
+#include "muduo/base/Logging.h"
 #include "muduo/net/Poller.h"
 #include "muduo/net/poller/PollPoller.h"
 #include "muduo/net/poller/EPollPoller.h"
+#include "muduo/net/poller/UringPoller.h"
 
 #include <stdlib.h>
 
@@ -20,6 +22,16 @@ Poller* Poller::newDefaultPoller(EventLoop* loop)
   {
     return new PollPoller(loop);
   }
+  else if (::getenv("MUDUO_USE_URING"))
+  {
+    Poller* poller = UringPoller::create(loop);
+    if (poller)
+    {
+      return poller;
+    }
+    LOG_WARN << "io_uring is not available, fall back to epoll";
+    return new EPollPoller(loop);
+  }
   else
   {
     return new EPollPoller(loop);
@@ -0,0 +1,471 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/poller/UringPoller.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/Channel.h"
+#include "muduo/net/TcpConnection.h"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+const int kNew = -1;
+const int kAdded = 1;
+const int kDeleted = 2;
+
+// user_data: kind in the top 2 bits,
+// poll: fd << 32 | generation, send: index in sendSlots_
+const int kKindShift = 62;
+const uint64_t kPollKind = 0;
+const uint64_t kSendKind = 1;
+const uint64_t kIgnoreKind = 2;
+
+uint64_t pollData(int fd, uint32_t gen)
+{
+  return (kPollKind << kKindShift) | (static_cast<uint64_t>(fd) << 32) | gen;
+}
+
+// no liburing, the three syscalls are all we need
+int sysSetup(unsigned entries, struct io_uring_params* params)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sysEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags,
+             const void* arg, size_t argSize)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete,
+                                    flags, arg, argSize));
+}
+
+template<typename T>
+T* ringAt(void* ring, unsigned offset)
+{
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+}
+
+UringPoller* UringPoller::create(EventLoop* loop)
+{
+  struct io_uring_params params;
+  memZero(&params, sizeof params);
+  params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  params.cq_entries = kCqEntries;
+  int ringFd = sysSetup(kSqEntries, &params);
+  if (ringFd < 0)
+  {
+    LOG_SYSERR << "io_uring_setup";
+    return nullptr;
+  }
+  // timed waits need IORING_ENTER_EXT_ARG (5.11), which implies POLL_ADD and SEND
+  if (!(params.features & IORING_FEAT_EXT_ARG))
+  {
+    LOG_ERROR << "io_uring without IORING_FEAT_EXT_ARG";
+    ::close(ringFd);
+    return nullptr;
+  }
+
+  UringPoller* poller = new UringPoller(loop, ringFd);
+  if (!poller->init(params))
+  {
+    delete poller;
+    return nullptr;
+  }
+  LOG_INFO << "UringPoller sq_entries = " << params.sq_entries
+           << " cq_entries = " << params.cq_entries;
+  return poller;
+}
+
+UringPoller::UringPoller(EventLoop* loop, int ringFd)
+  : Poller(loop),
+    loop_(loop),
+    ringFd_(ringFd),
+    sqRing_(MAP_FAILED),
+    sqRingSize_(0),
+    cqRing_(MAP_FAILED),
+    cqRingSize_(0),
+    sqes_(static_cast<struct io_uring_sqe*>(MAP_FAILED)),
+    sqesSize_(0),
+    sqHead_(nullptr),
+    sqTail_(nullptr),
+    sqMask_(0),
+    sqEntries_(0),
+    sqLocalTail_(0),
+    cqHead_(nullptr),
+    cqTail_(nullptr),
+    cqMask_(0),
+    cqes_(nullptr)
+{
+}
+
+bool UringPoller::init(const struct io_uring_params& params)
+{
+  sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (singleMmap)
+  {
+    sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+  }
+  sqRing_ = ::mmap(NULL, sqRingSize_, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ringFd_, IORING_OFF_SQ_RING);
+  if (sqRing_ == MAP_FAILED)
+  {
+    LOG_SYSERR << "mmap IORING_OFF_SQ_RING";
+    return false;
+  }
+  if (singleMmap)
+  {
+    cqRing_ = sqRing_;
+  }
+  else
+  {
+    cqRing_ = ::mmap(NULL, cqRingSize_, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ringFd_, IORING_OFF_CQ_RING);
+    if (cqRing_ == MAP_FAILED)
+    {
+      LOG_SYSERR << "mmap IORING_OFF_CQ_RING";
+      return false;
+    }
+  }
+  sqesSize_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  sqes_ = static_cast<struct io_uring_sqe*>(
+      ::mmap(NULL, sqesSize_, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ringFd_, IORING_OFF_SQES));
+  if (sqes_ == MAP_FAILED)
+  {
+    LOG_SYSERR << "mmap IORING_OFF_SQES";
+    return false;
+  }
+
+  sqHead_ = ringAt<unsigned>(sqRing_, params.sq_off.head);
+  sqTail_ = ringAt<unsigned>(sqRing_, params.sq_off.tail);
+  sqMask_ = *ringAt<unsigned>(sqRing_, params.sq_off.ring_mask);
+  sqEntries_ = params.sq_entries;
+  sqLocalTail_ = *sqTail_;
+  cqHead_ = ringAt<unsigned>(cqRing_, params.cq_off.head);
+  cqTail_ = ringAt<unsigned>(cqRing_, params.cq_off.tail);
+  cqMask_ = *ringAt<unsigned>(cqRing_, params.cq_off.ring_mask);
+  cqes_ = ringAt<struct io_uring_cqe>(cqRing_, params.cq_off.cqes);
+  // SQEs are submitted in order, so ring slot i always carries sqes_[i]
+  unsigned* sqArray = ringAt<unsigned>(sqRing_, params.sq_off.array);
+  for (unsigned i = 0; i < params.sq_entries; ++i)
+  {
+    sqArray[i] = i;
+  }
+  return true;
+}
+
+UringPoller::~UringPoller()
+{
+  if (sqes_ != MAP_FAILED)
+  {
+    ::munmap(sqes_, sqesSize_);
+  }
+  if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_)
+  {
+    ::munmap(cqRing_, cqRingSize_);
+  }
+  if (sqRing_ != MAP_FAILED)
+  {
+    ::munmap(sqRing_, sqRingSize_);
+  }
+  // closing the ring cancels what is still in flight
+  ::close(ringFd_);
+}
+
+Timestamp UringPoller::poll(int timeoutMs, ChannelList* activeChannels)
+{
+  armAll();
+  // don't block if a submission in the last round of handlers reaped something
+  enter(ready_.empty() && completedSends_.empty(), timeoutMs);
+  Timestamp now(Timestamp::now());
+  if (!ready_.empty())
+  {
+    LOG_TRACE << ready_.size() << " events happened";
+  }
+  for (const Ready& ready : ready_)
+  {
+    FdState& state = states_[ready.fd];
+    if (ready.gen != state.gen || state.channel == NULL)
+    {
+      // removed after the completion was reaped
+      continue;
+    }
+    state.channel->set_revents(ready.revents);
+    activeChannels->push_back(state.channel);
+    // re-armed after the handlers run, epoll would report it again if still ready
+    if (!state.queued)
+    {
+      state.queued = true;
+      toArm_.push_back(ready.fd);
+    }
+  }
+  ready_.clear();
+  deliverSends();
+  return now;
+}
+
+void UringPoller::updateChannel(Channel* channel)
+{
+  Poller::assertInLoopThread();
+  const int index = channel->index();
+  int fd = channel->fd();
+  LOG_TRACE << "fd = " << fd
+    << " events = " << channel->events() << " index = " << index;
+  if (index == kNew)
+  {
+    assert(channels_.find(fd) == channels_.end());
+    channels_[fd] = channel;
+    stateOf(fd).channel = channel;
+  }
+  else
+  {
+    assert(channels_.find(fd) != channels_.end());
+    assert(channels_[fd] == channel);
+  }
+  channel->set_index(channel->isNoneEvent() ? kDeleted : kAdded);
+  sync(channel);
+}
+
+void UringPoller::removeChannel(Channel* channel)
+{
+  Poller::assertInLoopThread();
+  int fd = channel->fd();
+  LOG_TRACE << "fd = " << fd;
+  assert(channels_.find(fd) != channels_.end());
+  assert(channels_[fd] == channel);
+  assert(channel->isNoneEvent());
+  int index = channel->index();
+  assert(index == kAdded || index == kDeleted);
+  (void)index;
+  size_t n = channels_.erase(fd);
+  (void)n;
+  assert(n == 1);
+
+  FdState& state = stateOf(fd);
+  if (state.armed)
+  {
+    cancel(fd, state);
+  }
+  // drops the reaped but not yet delivered events
+  ++state.gen;
+  state.channel = NULL;
+  channel->set_index(kNew);
+}
+
+bool UringPoller::submitSend(int fd, const void* data, size_t len,
+                             const TcpConnectionPtr& conn)
+{
+  Poller::assertInLoopThread();
+  // may submit and reap, so take it before a slot
+  struct io_uring_sqe* sqe = getSqe();
+  uint32_t slot;
+  if (freeSlots_.empty())
+  {
+    slot = static_cast<uint32_t>(sendSlots_.size());
+    sendSlots_.emplace_back();
+  }
+  else
+  {
+    slot = freeSlots_.back();
+    freeSlots_.pop_back();
+  }
+  sendSlots_[slot] = conn;
+
+  sqe->opcode = IORING_OP_SEND;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(data);
+  // a short send is completed by writeOutput() on POLLOUT
+  sqe->len = static_cast<uint32_t>(std::min<size_t>(len, 1 << 30));
+  // never park in the kernel, a full socket goes back to the readiness path
+  sqe->msg_flags = MSG_NOSIGNAL | MSG_DONTWAIT;
+  sqe->user_data = (kSendKind << kKindShift) | slot;
+  return true;
+}
+
+UringPoller::FdState& UringPoller::stateOf(int fd)
+{
+  assert(fd >= 0);
+  if (static_cast<size_t>(fd) >= states_.size())
+  {
+    states_.resize(std::max(static_cast<size_t>(fd) + 1, states_.size() * 2));
+  }
+  return states_[fd];
+}
+
+void UringPoller::sync(Channel* channel)
+{
+  int fd = channel->fd();
+  FdState& state = stateOf(fd);
+  uint32_t events = channel->isNoneEvent() ? 0 : channel->events();
+  if (state.armed && state.armedEvents != events)
+  {
+    cancel(fd, state);
+  }
+  if (!state.armed && events != 0 && !state.queued)
+  {
+    state.queued = true;
+    toArm_.push_back(fd);
+  }
+}
+
+void UringPoller::cancel(int fd, FdState& state)
+{
+  struct io_uring_sqe* sqe = getSqe();
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = pollData(fd, state.gen);
+  sqe->user_data = kIgnoreKind << kKindShift;
+  // the -ECANCELED completion of the old poll is ignored by its generation
+  ++state.gen;
+  state.armed = false;
+}
+
+void UringPoller::armAll()
+{
+  // reap() never queues, so getSqe() is safe in the loop
+  for (int fd : toArm_)
+  {
+    FdState& state = states_[fd];
+    state.queued = false;
+    if (state.armed || state.channel == NULL || state.channel->isNoneEvent())
+    {
+      continue;
+    }
+    uint32_t events = state.channel->events();
+    struct io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = events;
+    sqe->user_data = pollData(fd, state.gen);
+    state.armed = true;
+    state.armedEvents = events;
+  }
+  toArm_.clear();
+}
+
+struct io_uring_sqe* UringPoller::getSqe()
+{
+  if (sqLocalTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) >= sqEntries_)
+  {
+    enter(false, 0);
+    if (sqLocalTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) >= sqEntries_)
+    {
+      LOG_FATAL << "io_uring submission queue is stuck";
+    }
+  }
+  struct io_uring_sqe* sqe = &sqes_[sqLocalTail_ & sqMask_];
+  memZero(sqe, sizeof *sqe);
+  ++sqLocalTail_;
+  return sqe;
+}
+
+void UringPoller::enter(bool wait, int timeoutMs)
+{
+  struct __kernel_timespec ts;
+  ts.tv_sec = timeoutMs / 1000;
+  ts.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000 * 1000;
+  struct io_uring_getevents_arg arg;
+  memZero(&arg, sizeof arg);
+  arg.ts = timeoutMs >= 0 ? reinterpret_cast<uint64_t>(&ts) : 0;
+
+  __atomic_store_n(sqTail_, sqLocalTail_, __ATOMIC_RELEASE);
+  while (true)
+  {
+    unsigned toSubmit = sqLocalTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+    // GETEVENTS also flushes the completions overflowed from a full CQ ring
+    int ret = sysEnter(ringFd_, toSubmit, wait ? 1 : 0,
+                       IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                       &arg, sizeof arg);
+    int savedErrno = errno;
+    reap();
+    if (ret < 0 && (savedErrno == EBUSY || savedErrno == EAGAIN))
+    {
+      // too many completions pending, reaped, submit the rest
+      wait = false;
+      continue;
+    }
+    if (ret < 0 && savedErrno != ETIME && savedErrno != EINTR)
+    {
+      errno = savedErrno;
+      LOG_SYSERR << "UringPoller::enter()";
+    }
+    break;
+  }
+}
+
+void UringPoller::reap()
+{
+  unsigned head = *cqHead_;
+  unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+  for (; head != tail; ++head)
+  {
+    const struct io_uring_cqe* cqe = &cqes_[head & cqMask_];
+    uint64_t data = cqe->user_data;
+    uint64_t kind = data >> kKindShift;
+    if (kind == kPollKind)
+    {
+      int fd = static_cast<int>((data >> 32) & 0x3fffffff);
+      uint32_t gen = static_cast<uint32_t>(data);
+      FdState& state = states_[fd];
+      if (gen != state.gen || !state.armed)
+      {
+        continue;
+      }
+      state.armed = false;
+      int revents = cqe->res;
+      if (revents < 0)
+      {
+        LOG_ERROR << "IORING_OP_POLL_ADD fd = " << fd << " " << strerror_tl(-revents);
+        revents = POLLERR;
+      }
+      Ready ready = { fd, gen, revents };
+      ready_.push_back(ready);
+    }
+    else if (kind == kSendKind)
+    {
+      uint32_t slot = static_cast<uint32_t>(data);
+      completedSends_.emplace_back(std::move(sendSlots_[slot]), cqe->res);
+      freeSlots_.push_back(slot);
+    }
+  }
+  __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+}
+
+void UringPoller::deliverSends()
+{
+  if (completedSends_.empty())
+  {
+    return;
+  }
+  // run with the pending functors of this round, after the channel handlers
+  std::vector<std::pair<TcpConnectionPtr, int>> sends;
+  sends.swap(completedSends_);
+  loop_->queueInLoop([sends = std::move(sends)]()
+  {
+    for (const auto& send : sends)
+    {
+      send.first->handleSendComplete(send.second);
+    }
+  });
+}
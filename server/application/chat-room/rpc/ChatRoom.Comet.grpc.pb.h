@@ -60,7 +60,15 @@ class Comet final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomReply>> PrepareAsyncBroadcastRoom(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomReply>>(PrepareAsyncBroadcastRoomRaw(context, request, cq));
     }
-    // Rooms get all rooms
+    // BroadcastRoomBatch broadcast to many rooms, one fan-out pass per room
+    virtual ::grpc::Status BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomBatchReply>> AsyncBroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomBatchReply>>(AsyncBroadcastRoomBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomBatchReply>> PrepareAsyncBroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomBatchReply>>(PrepareAsyncBroadcastRoomBatchRaw(context, request, cq));
+    }
+    // Rooms get the rooms with members, see RoomsReq.wait_ms
     virtual ::grpc::Status Rooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::ChatRoom::Comet::RoomsReply* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::RoomsReply>> AsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::RoomsReply>>(AsyncRoomsRaw(context, request, cq));
@@ -68,6 +76,24 @@ class Comet final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::RoomsReply>> PrepareAsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::RoomsReply>>(PrepareAsyncRoomsRaw(context, request, cq));
     }
+    // Users connect/disconnect changes of the comet, for the user -> comet registry of the job
+    virtual ::grpc::Status Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::ChatRoom::Comet::UsersReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::UsersReply>> AsyncUsers(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::UsersReply>>(AsyncUsersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::UsersReply>> PrepareAsyncUsers(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::UsersReply>>(PrepareAsyncUsersRaw(context, request, cq));
+    }
+    // PushStream one long-lived stream per job, batches of room/broadcast pushes, acked in order
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>> PushStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>>(PushStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>> AsyncPushStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>>(AsyncPushStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>> PrepareAsyncPushStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>>(PrepareAsyncPushStreamRaw(context, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -80,9 +106,17 @@ class Comet final {
       // BroadcastRoom broadcast to one room
       virtual void BroadcastRoom(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq* request, ::ChatRoom::Comet::BroadcastRoomReply* response, std::function<void(::grpc::Status)>) = 0;
       virtual void BroadcastRoom(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq* request, ::ChatRoom::Comet::BroadcastRoomReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      // Rooms get all rooms
+      // BroadcastRoomBatch broadcast to many rooms, one fan-out pass per room
+      virtual void BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Rooms get the rooms with members, see RoomsReq.wait_ms
       virtual void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq* request, ::ChatRoom::Comet::RoomsReply* response, std::function<void(::grpc::Status)>) = 0;
       virtual void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq* request, ::ChatRoom::Comet::RoomsReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Users connect/disconnect changes of the comet, for the user -> comet registry of the job
+      virtual void Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // PushStream one long-lived stream per job, batches of room/broadcast pushes, acked in order
+      virtual void PushStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::ChatRoom::Comet::PushBatch,::ChatRoom::Comet::PushAck>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -94,8 +128,15 @@ class Comet final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastReply>* PrepareAsyncBroadcastRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomReply>* AsyncBroadcastRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomReply>* PrepareAsyncBroadcastRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomBatchReply>* AsyncBroadcastRoomBatchRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::BroadcastRoomBatchReply>* PrepareAsyncBroadcastRoomBatchRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::RoomsReply>* AsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::RoomsReply>* PrepareAsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::UsersReply>* AsyncUsersRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Comet::UsersReply>* PrepareAsyncUsersRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* PushStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* AsyncPushStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* PrepareAsyncPushStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -121,6 +162,13 @@ class Comet final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomReply>> PrepareAsyncBroadcastRoom(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomReply>>(PrepareAsyncBroadcastRoomRaw(context, request, cq));
     }
+    ::grpc::Status BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>> AsyncBroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>>(AsyncBroadcastRoomBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>> PrepareAsyncBroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>>(PrepareAsyncBroadcastRoomBatchRaw(context, request, cq));
+    }
     ::grpc::Status Rooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::ChatRoom::Comet::RoomsReply* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::RoomsReply>> AsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::RoomsReply>>(AsyncRoomsRaw(context, request, cq));
@@ -128,6 +176,22 @@ class Comet final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::RoomsReply>> PrepareAsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::RoomsReply>>(PrepareAsyncRoomsRaw(context, request, cq));
     }
+    ::grpc::Status Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::ChatRoom::Comet::UsersReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>> AsyncUsers(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>>(AsyncUsersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>> PrepareAsyncUsers(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>>(PrepareAsyncUsersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>> PushStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>>(PushStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>> AsyncPushStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>>(AsyncPushStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>> PrepareAsyncPushStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>>(PrepareAsyncPushStreamRaw(context, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -137,8 +201,13 @@ class Comet final {
       void Broadcast(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastReq* request, ::ChatRoom::Comet::BroadcastReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void BroadcastRoom(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq* request, ::ChatRoom::Comet::BroadcastRoomReply* response, std::function<void(::grpc::Status)>) override;
       void BroadcastRoom(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq* request, ::ChatRoom::Comet::BroadcastRoomReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response, std::function<void(::grpc::Status)>) override;
+      void BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq* request, ::ChatRoom::Comet::RoomsReply* response, std::function<void(::grpc::Status)>) override;
       void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq* request, ::ChatRoom::Comet::RoomsReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response, std::function<void(::grpc::Status)>) override;
+      void Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void PushStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::ChatRoom::Comet::PushBatch,::ChatRoom::Comet::PushAck>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -156,12 +225,22 @@ class Comet final {
     ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastReply>* PrepareAsyncBroadcastRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomReply>* AsyncBroadcastRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomReply>* PrepareAsyncBroadcastRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>* AsyncBroadcastRoomBatchRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>* PrepareAsyncBroadcastRoomBatchRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::RoomsReply>* AsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::RoomsReply>* PrepareAsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>* AsyncUsersRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>* PrepareAsyncUsersRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* PushStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* AsyncPushStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* PrepareAsyncPushStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_PushMsg_;
     const ::grpc::internal::RpcMethod rpcmethod_Broadcast_;
     const ::grpc::internal::RpcMethod rpcmethod_BroadcastRoom_;
+    const ::grpc::internal::RpcMethod rpcmethod_BroadcastRoomBatch_;
     const ::grpc::internal::RpcMethod rpcmethod_Rooms_;
+    const ::grpc::internal::RpcMethod rpcmethod_Users_;
+    const ::grpc::internal::RpcMethod rpcmethod_PushStream_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -175,8 +254,14 @@ class Comet final {
     virtual ::grpc::Status Broadcast(::grpc::ServerContext* context, const ::ChatRoom::Comet::BroadcastReq* request, ::ChatRoom::Comet::BroadcastReply* response);
     // BroadcastRoom broadcast to one room
     virtual ::grpc::Status BroadcastRoom(::grpc::ServerContext* context, const ::ChatRoom::Comet::BroadcastRoomReq* request, ::ChatRoom::Comet::BroadcastRoomReply* response);
-    // Rooms get all rooms
+    // BroadcastRoomBatch broadcast to many rooms, one fan-out pass per room
+    virtual ::grpc::Status BroadcastRoomBatch(::grpc::ServerContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response);
+    // Rooms get the rooms with members, see RoomsReq.wait_ms
     virtual ::grpc::Status Rooms(::grpc::ServerContext* context, const ::ChatRoom::Comet::RoomsReq* request, ::ChatRoom::Comet::RoomsReply* response);
+    // Users connect/disconnect changes of the comet, for the user -> comet registry of the job
+    virtual ::grpc::Status Users(::grpc::ServerContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response);
+    // PushStream one long-lived stream per job, batches of room/broadcast pushes, acked in order
+    virtual ::grpc::Status PushStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* stream);
   };
   template <class BaseClass>
   class WithAsyncMethod_PushMsg : public BaseClass {
@@ -239,12 +324,32 @@ class Comet final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_BroadcastRoomBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_BroadcastRoomBatch() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_BroadcastRoomBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BroadcastRoomBatch(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomBatchReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBroadcastRoomBatch(::grpc::ServerContext* context, ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Comet::BroadcastRoomBatchReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_Rooms : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_Rooms() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(4);
     }
     ~WithAsyncMethod_Rooms() override {
       BaseClassMustBeDerivedFromService(this);
@@ -255,10 +360,50 @@ class Comet final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestRooms(::grpc::ServerContext* context, ::ChatRoom::Comet::RoomsReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Comet::RoomsReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_PushMsg<WithAsyncMethod_Broadcast<WithAsyncMethod_BroadcastRoom<WithAsyncMethod_Rooms<Service > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_Users : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Users() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_Users() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Users(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::UsersReq* /*request*/, ::ChatRoom::Comet::UsersReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUsers(::grpc::ServerContext* context, ::ChatRoom::Comet::UsersReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Comet::UsersReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_PushStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_PushStream() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_PushStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PushStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPushStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(6, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_PushMsg<WithAsyncMethod_Broadcast<WithAsyncMethod_BroadcastRoom<WithAsyncMethod_BroadcastRoomBatch<WithAsyncMethod_Rooms<WithAsyncMethod_Users<WithAsyncMethod_PushStream<Service > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_PushMsg : public BaseClass {
    private:
@@ -341,18 +486,45 @@ class Comet final {
       ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomReply* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_BroadcastRoomBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_BroadcastRoomBatch() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response) { return this->BroadcastRoomBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_BroadcastRoomBatch(
+        ::grpc::MessageAllocator< ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_BroadcastRoomBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BroadcastRoomBatch(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomBatchReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* BroadcastRoomBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomBatchReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomBatchReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_Rooms : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_Rooms() {
-      ::grpc::Service::MarkMethodCallback(3,
+      ::grpc::Service::MarkMethodCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Comet::RoomsReq, ::ChatRoom::Comet::RoomsReply>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::ChatRoom::Comet::RoomsReq* request, ::ChatRoom::Comet::RoomsReply* response) { return this->Rooms(context, request, response); }));}
     void SetMessageAllocatorFor_Rooms(
         ::grpc::MessageAllocator< ::ChatRoom::Comet::RoomsReq, ::ChatRoom::Comet::RoomsReply>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Comet::RoomsReq, ::ChatRoom::Comet::RoomsReply>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -367,7 +539,57 @@ class Comet final {
     virtual ::grpc::ServerUnaryReactor* Rooms(
       ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Comet::RoomsReq* /*request*/, ::ChatRoom::Comet::RoomsReply* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_PushMsg<WithCallbackMethod_Broadcast<WithCallbackMethod_BroadcastRoom<WithCallbackMethod_Rooms<Service > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_Users : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Users() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response) { return this->Users(context, request, response); }));}
+    void SetMessageAllocatorFor_Users(
+        ::grpc::MessageAllocator< ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Users() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Users(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::UsersReq* /*request*/, ::ChatRoom::Comet::UsersReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Users(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Comet::UsersReq* /*request*/, ::ChatRoom::Comet::UsersReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_PushStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_PushStream() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackBidiHandler< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->PushStream(context); }));
+    }
+    ~WithCallbackMethod_PushStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PushStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* PushStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef WithCallbackMethod_PushMsg<WithCallbackMethod_Broadcast<WithCallbackMethod_BroadcastRoom<WithCallbackMethod_BroadcastRoomBatch<WithCallbackMethod_Rooms<WithCallbackMethod_Users<WithCallbackMethod_PushStream<Service > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_PushMsg : public BaseClass {
@@ -421,12 +643,29 @@ class Comet final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_BroadcastRoomBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_BroadcastRoomBatch() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_BroadcastRoomBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BroadcastRoomBatch(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomBatchReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_Rooms : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_Rooms() {
-      ::grpc::Service::MarkMethodGeneric(3);
+      ::grpc::Service::MarkMethodGeneric(4);
     }
     ~WithGenericMethod_Rooms() override {
       BaseClassMustBeDerivedFromService(this);
@@ -438,6 +677,40 @@ class Comet final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_Users : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Users() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_Users() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Users(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::UsersReq* /*request*/, ::ChatRoom::Comet::UsersReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_PushStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_PushStream() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_PushStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PushStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_PushMsg : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -498,12 +771,32 @@ class Comet final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_BroadcastRoomBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_BroadcastRoomBatch() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_BroadcastRoomBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BroadcastRoomBatch(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomBatchReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBroadcastRoomBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Rooms : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_Rooms() {
-      ::grpc::Service::MarkMethodRaw(3);
+      ::grpc::Service::MarkMethodRaw(4);
     }
     ~WithRawMethod_Rooms() override {
       BaseClassMustBeDerivedFromService(this);
@@ -514,7 +807,47 @@ class Comet final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestRooms(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Users : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Users() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_Users() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Users(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::UsersReq* /*request*/, ::ChatRoom::Comet::UsersReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUsers(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_PushStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_PushStream() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_PushStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PushStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPushStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(6, context, stream, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -584,12 +917,34 @@ class Comet final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_BroadcastRoomBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_BroadcastRoomBatch() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->BroadcastRoomBatch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_BroadcastRoomBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BroadcastRoomBatch(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomBatchReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* BroadcastRoomBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Rooms : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_Rooms() {
-      ::grpc::Service::MarkMethodRawCallback(3,
+      ::grpc::Service::MarkMethodRawCallback(4,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Rooms(context, request, response); }));
@@ -606,6 +961,51 @@ class Comet final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_Users : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Users() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Users(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Users() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Users(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::UsersReq* /*request*/, ::ChatRoom::Comet::UsersReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Users(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_PushStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_PushStream() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->PushStream(context); }));
+    }
+    ~WithRawCallbackMethod_PushStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PushStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* PushStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_PushMsg : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -687,12 +1087,39 @@ class Comet final {
     virtual ::grpc::Status StreamedBroadcastRoom(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Comet::BroadcastRoomReq,::ChatRoom::Comet::BroadcastRoomReply>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_BroadcastRoomBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_BroadcastRoomBatch() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply>* streamer) {
+                       return this->StreamedBroadcastRoomBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_BroadcastRoomBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status BroadcastRoomBatch(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::BroadcastRoomBatchReq* /*request*/, ::ChatRoom::Comet::BroadcastRoomBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedBroadcastRoomBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Comet::BroadcastRoomBatchReq,::ChatRoom::Comet::BroadcastRoomBatchReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Rooms : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_Rooms() {
-      ::grpc::Service::MarkMethodStreamed(3,
+      ::grpc::Service::MarkMethodStreamed(4,
         new ::grpc::internal::StreamedUnaryHandler<
           ::ChatRoom::Comet::RoomsReq, ::ChatRoom::Comet::RoomsReply>(
             [this](::grpc::ServerContext* context,
@@ -713,9 +1140,36 @@ class Comet final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedRooms(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Comet::RoomsReq,::ChatRoom::Comet::RoomsReply>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_PushMsg<WithStreamedUnaryMethod_Broadcast<WithStreamedUnaryMethod_BroadcastRoom<WithStreamedUnaryMethod_Rooms<Service > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Users : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Users() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply>* streamer) {
+                       return this->StreamedUsers(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Users() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Users(::grpc::ServerContext* /*context*/, const ::ChatRoom::Comet::UsersReq* /*request*/, ::ChatRoom::Comet::UsersReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedUsers(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Comet::UsersReq,::ChatRoom::Comet::UsersReply>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_PushMsg<WithStreamedUnaryMethod_Broadcast<WithStreamedUnaryMethod_BroadcastRoom<WithStreamedUnaryMethod_BroadcastRoomBatch<WithStreamedUnaryMethod_Rooms<WithStreamedUnaryMethod_Users<Service > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_PushMsg<WithStreamedUnaryMethod_Broadcast<WithStreamedUnaryMethod_BroadcastRoom<WithStreamedUnaryMethod_Rooms<Service > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_PushMsg<WithStreamedUnaryMethod_Broadcast<WithStreamedUnaryMethod_BroadcastRoom<WithStreamedUnaryMethod_BroadcastRoomBatch<WithStreamedUnaryMethod_Rooms<WithStreamedUnaryMethod_Users<Service > > > > > > StreamedService;
 };
 
 }  // namespace Comet
@@ -1,8 +1,10 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: ChatRoom.Comet.proto
-#include <algorithm>
+
 #include "ChatRoom.Comet.pb.h"
 
+#include <algorithm>
+
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/extension_set.h>
 #include <google/protobuf/wire_format_lite.h>
@@ -14,139 +16,235 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace ChatRoom {
-  namespace Comet {
-    constexpr PushMsgReq::PushMsgReq(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-      : keys_()
-      , proto_(nullptr)
-      , protoop_(0) {    
-}
-    struct PushMsgReqDefaultTypeInternal {
-      constexpr PushMsgReqDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {      
-}
-      ~PushMsgReqDefaultTypeInternal() {}
-      union {
-        PushMsgReq _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PushMsgReqDefaultTypeInternal _PushMsgReq_default_instance_;
-    constexpr PushMsgReply::PushMsgReply(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized) {
-    }
-    struct PushMsgReplyDefaultTypeInternal {
-      constexpr PushMsgReplyDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {      
-}
-      ~PushMsgReplyDefaultTypeInternal() {}
-      union {
-        PushMsgReply _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PushMsgReplyDefaultTypeInternal _PushMsgReply_default_instance_;
-    constexpr BroadcastReq::BroadcastReq(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-      : proto_(nullptr)
-      , protoop_(0)
-      , speed_(0) {
-    }
-    struct BroadcastReqDefaultTypeInternal {
-      constexpr BroadcastReqDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {
-      }
-      ~BroadcastReqDefaultTypeInternal() {}
-      union {
-        BroadcastReq _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BroadcastReqDefaultTypeInternal _BroadcastReq_default_instance_;
-    constexpr BroadcastReply::BroadcastReply(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized) {
-    }
-    struct BroadcastReplyDefaultTypeInternal {
-      constexpr BroadcastReplyDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {
-      }
-      ~BroadcastReplyDefaultTypeInternal() {}
-      union {
-        BroadcastReply _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BroadcastReplyDefaultTypeInternal _BroadcastReply_default_instance_;
-    constexpr BroadcastRoomReq::BroadcastRoomReq(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-      : roomid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-      , proto_(nullptr) {
-    }
-    struct BroadcastRoomReqDefaultTypeInternal {
-      constexpr BroadcastRoomReqDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {
-      }
-      ~BroadcastRoomReqDefaultTypeInternal() {}
-      union {
-        BroadcastRoomReq _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BroadcastRoomReqDefaultTypeInternal _BroadcastRoomReq_default_instance_;
-    constexpr BroadcastRoomReply::BroadcastRoomReply(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized) {
-    }
-    struct BroadcastRoomReplyDefaultTypeInternal {
-      constexpr BroadcastRoomReplyDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {
-      }
-      ~BroadcastRoomReplyDefaultTypeInternal() {}
-      union {
-        BroadcastRoomReply _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BroadcastRoomReplyDefaultTypeInternal _BroadcastRoomReply_default_instance_;
-    constexpr RoomsReq::RoomsReq(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized) {
-    }
-    struct RoomsReqDefaultTypeInternal {
-      constexpr RoomsReqDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {      
-}
-      ~RoomsReqDefaultTypeInternal() {}
-      union {
-        RoomsReq _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RoomsReqDefaultTypeInternal _RoomsReq_default_instance_;
-    constexpr RoomsReply_RoomsEntry_DoNotUse::RoomsReply_RoomsEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized) {    
-}
-    struct RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal {
-      constexpr RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {
-      }
-      ~RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal() {}
-      union {
-        RoomsReply_RoomsEntry_DoNotUse _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal _RoomsReply_RoomsEntry_DoNotUse_default_instance_;
-    constexpr RoomsReply::RoomsReply(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-      : rooms_(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {    
-}
-    struct RoomsReplyDefaultTypeInternal {
-      constexpr RoomsReplyDefaultTypeInternal()
-        : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {
-      }
-      ~RoomsReplyDefaultTypeInternal() {}
-      union {
-        RoomsReply _instance;
-      };
-    };
-    PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RoomsReplyDefaultTypeInternal _RoomsReply_default_instance_;
-  }  // namespace Comet
+namespace Comet {
+PROTOBUF_CONSTEXPR PushMsgReq::PushMsgReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.proto_)*/nullptr
+  , /*decltype(_impl_.protoop_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PushMsgReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PushMsgReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PushMsgReqDefaultTypeInternal() {}
+  union {
+    PushMsgReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PushMsgReqDefaultTypeInternal _PushMsgReq_default_instance_;
+PROTOBUF_CONSTEXPR PushMsgReply::PushMsgReply(
+    ::_pbi::ConstantInitialized) {}
+struct PushMsgReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PushMsgReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PushMsgReplyDefaultTypeInternal() {}
+  union {
+    PushMsgReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PushMsgReplyDefaultTypeInternal _PushMsgReply_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastReq::BroadcastReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.proto_)*/nullptr
+  , /*decltype(_impl_.protoop_)*/0
+  , /*decltype(_impl_.speed_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BroadcastReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastReqDefaultTypeInternal() {}
+  union {
+    BroadcastReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastReqDefaultTypeInternal _BroadcastReq_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastReply::BroadcastReply(
+    ::_pbi::ConstantInitialized) {}
+struct BroadcastReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastReplyDefaultTypeInternal() {}
+  union {
+    BroadcastReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastReplyDefaultTypeInternal _BroadcastReply_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastRoomReq::BroadcastRoomReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.roomid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.proto_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BroadcastRoomReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastRoomReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastRoomReqDefaultTypeInternal() {}
+  union {
+    BroadcastRoomReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastRoomReqDefaultTypeInternal _BroadcastRoomReq_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastRoomReply::BroadcastRoomReply(
+    ::_pbi::ConstantInitialized) {}
+struct BroadcastRoomReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastRoomReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastRoomReplyDefaultTypeInternal() {}
+  union {
+    BroadcastRoomReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastRoomReplyDefaultTypeInternal _BroadcastRoomReply_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastRoomBatchReq::BroadcastRoomBatchReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BroadcastRoomBatchReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastRoomBatchReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastRoomBatchReqDefaultTypeInternal() {}
+  union {
+    BroadcastRoomBatchReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastRoomBatchReqDefaultTypeInternal _BroadcastRoomBatchReq_default_instance_;
+PROTOBUF_CONSTEXPR BroadcastRoomBatchReply::BroadcastRoomBatchReply(
+    ::_pbi::ConstantInitialized) {}
+struct BroadcastRoomBatchReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BroadcastRoomBatchReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BroadcastRoomBatchReplyDefaultTypeInternal() {}
+  union {
+    BroadcastRoomBatchReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BroadcastRoomBatchReplyDefaultTypeInternal _BroadcastRoomBatchReply_default_instance_;
+PROTOBUF_CONSTEXPR PushItem::PushItem(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.roomid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.proto_)*/nullptr
+  , /*decltype(_impl_.speed_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PushItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PushItemDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PushItemDefaultTypeInternal() {}
+  union {
+    PushItem _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PushItemDefaultTypeInternal _PushItem_default_instance_;
+PROTOBUF_CONSTEXPR PushBatch::PushBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.items_)*/{}
+  , /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PushBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PushBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PushBatchDefaultTypeInternal() {}
+  union {
+    PushBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PushBatchDefaultTypeInternal _PushBatch_default_instance_;
+PROTOBUF_CONSTEXPR PushAck::PushAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.failed_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PushAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PushAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PushAckDefaultTypeInternal() {}
+  union {
+    PushAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PushAckDefaultTypeInternal _PushAck_default_instance_;
+PROTOBUF_CONSTEXPR RoomsReq::RoomsReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.wait_ms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomsReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomsReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomsReqDefaultTypeInternal() {}
+  union {
+    RoomsReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomsReqDefaultTypeInternal _RoomsReq_default_instance_;
+PROTOBUF_CONSTEXPR RoomsReply_RoomsEntry_DoNotUse::RoomsReply_RoomsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    RoomsReply_RoomsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal _RoomsReply_RoomsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR RoomsReply::RoomsReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomsReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomsReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomsReplyDefaultTypeInternal() {}
+  union {
+    RoomsReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomsReplyDefaultTypeInternal _RoomsReply_default_instance_;
+PROTOBUF_CONSTEXPR UsersReq::UsersReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.since_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UsersReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UsersReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UsersReqDefaultTypeInternal() {}
+  union {
+    UsersReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UsersReqDefaultTypeInternal _UsersReq_default_instance_;
+PROTOBUF_CONSTEXPR UsersReply::UsersReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.online_)*/{}
+  , /*decltype(_impl_.offline_)*/{}
+  , /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.full_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UsersReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UsersReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UsersReplyDefaultTypeInternal() {}
+  union {
+    UsersReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UsersReplyDefaultTypeInternal _UsersReply_default_instance_;
+}  // namespace Comet
 }  // namespace ChatRoom
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_ChatRoom_2eComet_2eproto[9];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_ChatRoom_2eComet_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_ChatRoom_2eComet_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_ChatRoom_2eComet_2eproto[16];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ChatRoom_2eComet_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ChatRoom_2eComet_2eproto = nullptr;
 
 const uint32_t TableStruct_ChatRoom_2eComet_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
@@ -155,9 +253,9 @@ const uint32_t TableStruct_ChatRoom_2eComet_2eproto::offsets[] PROTOBUF_SECTION_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushMsgReq, keys_),
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushMsgReq, protoop_),
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushMsgReq, proto_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushMsgReq, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushMsgReq, _impl_.protoop_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushMsgReq, _impl_.proto_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushMsgReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -170,9 +268,9 @@ const uint32_t TableStruct_ChatRoom_2eComet_2eproto::offsets[] PROTOBUF_SECTION_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastReq, protoop_),
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastReq, proto_),
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastReq, speed_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastReq, _impl_.protoop_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastReq, _impl_.proto_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastReq, _impl_.speed_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -185,8 +283,8 @@ const uint32_t TableStruct_ChatRoom_2eComet_2eproto::offsets[] PROTOBUF_SECTION_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomReq, roomid_),
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomReq, proto_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomReq, _impl_.roomid_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomReq, _impl_.proto_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -194,11 +292,54 @@ const uint32_t TableStruct_ChatRoom_2eComet_2eproto::offsets[] PROTOBUF_SECTION_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomBatchReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomBatchReq, _impl_.rooms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::BroadcastRoomBatchReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushItem, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushItem, _impl_.roomid_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushItem, _impl_.proto_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushItem, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushItem, _impl_.speed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushBatch, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushBatch, _impl_.items_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushBatch, _impl_.epoch_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushAck, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::PushAck, _impl_.failed_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReq, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReq, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReq, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReq, _impl_.wait_ms_),
   PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -215,1296 +356,3146 @@ const uint32_t TableStruct_ChatRoom_2eComet_2eproto::offsets[] PROTOBUF_SECTION_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReply, rooms_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReply, _impl_.rooms_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReply, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::RoomsReply, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReq, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReq, _impl_.since_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReply, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReply, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReply, _impl_.full_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReply, _impl_.online_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Comet::UsersReply, _impl_.offline_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::ChatRoom::Comet::PushMsgReq)},
   { 9, -1, -1, sizeof(::ChatRoom::Comet::PushMsgReply)},
   { 15, -1, -1, sizeof(::ChatRoom::Comet::BroadcastReq)},
   { 24, -1, -1, sizeof(::ChatRoom::Comet::BroadcastReply)},
   { 30, -1, -1, sizeof(::ChatRoom::Comet::BroadcastRoomReq)},
   { 38, -1, -1, sizeof(::ChatRoom::Comet::BroadcastRoomReply)},
-  { 44, -1, -1, sizeof(::ChatRoom::Comet::RoomsReq)},
-  { 50, 58, -1, sizeof(::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse)},
-  { 60, -1, -1, sizeof(::ChatRoom::Comet::RoomsReply)},
+  { 44, -1, -1, sizeof(::ChatRoom::Comet::BroadcastRoomBatchReq)},
+  { 51, -1, -1, sizeof(::ChatRoom::Comet::BroadcastRoomBatchReply)},
+  { 57, -1, -1, sizeof(::ChatRoom::Comet::PushItem)},
+  { 67, -1, -1, sizeof(::ChatRoom::Comet::PushBatch)},
+  { 76, -1, -1, sizeof(::ChatRoom::Comet::PushAck)},
+  { 84, -1, -1, sizeof(::ChatRoom::Comet::RoomsReq)},
+  { 93, 101, -1, sizeof(::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse)},
+  { 103, -1, -1, sizeof(::ChatRoom::Comet::RoomsReply)},
+  { 112, -1, -1, sizeof(::ChatRoom::Comet::UsersReq)},
+  { 120, -1, -1, sizeof(::ChatRoom::Comet::UsersReply)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const* const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_PushMsgReq_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_PushMsgReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_BroadcastReq_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_BroadcastReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_BroadcastRoomReq_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_BroadcastRoomReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_RoomsReq_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_RoomsReply_RoomsEntry_DoNotUse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::ChatRoom::Comet::_RoomsReply_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ChatRoom::Comet::_PushMsgReq_default_instance_._instance,
+  &::ChatRoom::Comet::_PushMsgReply_default_instance_._instance,
+  &::ChatRoom::Comet::_BroadcastReq_default_instance_._instance,
+  &::ChatRoom::Comet::_BroadcastReply_default_instance_._instance,
+  &::ChatRoom::Comet::_BroadcastRoomReq_default_instance_._instance,
+  &::ChatRoom::Comet::_BroadcastRoomReply_default_instance_._instance,
+  &::ChatRoom::Comet::_BroadcastRoomBatchReq_default_instance_._instance,
+  &::ChatRoom::Comet::_BroadcastRoomBatchReply_default_instance_._instance,
+  &::ChatRoom::Comet::_PushItem_default_instance_._instance,
+  &::ChatRoom::Comet::_PushBatch_default_instance_._instance,
+  &::ChatRoom::Comet::_PushAck_default_instance_._instance,
+  &::ChatRoom::Comet::_RoomsReq_default_instance_._instance,
+  &::ChatRoom::Comet::_RoomsReply_RoomsEntry_DoNotUse_default_instance_._instance,
+  &::ChatRoom::Comet::_RoomsReply_default_instance_._instance,
+  &::ChatRoom::Comet::_UsersReq_default_instance_._instance,
+  &::ChatRoom::Comet::_UsersReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_ChatRoom_2eComet_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-"\n\024ChatRoom.Comet.proto\022\016ChatRoom.Comet\032\027"
-"ChatRoom.Protocol.proto\"T\n\nPushMsgReq\022\014\n"
-"\004keys\030\001 \003(\t\022\017\n\007protoOp\030\003 \001(\005\022\'\n\005proto\030\002 "
-"\001(\0132\030.ChatRoom.Protocol.Proto\"\016\n\014PushMsg"
-"Reply\"W\n\014BroadcastReq\022\017\n\007protoOp\030\001 \001(\005\022\'"
-"\n\005proto\030\002 \001(\0132\030.ChatRoom.Protocol.Proto\022"
-"\r\n\005speed\030\003 \001(\005\"\020\n\016BroadcastReply\"K\n\020Broa"
-"dcastRoomReq\022\016\n\006roomID\030\001 \001(\t\022\'\n\005proto\030\002 "
-"\001(\0132\030.ChatRoom.Protocol.Proto\"\024\n\022Broadca"
-"stRoomReply\"\n\n\010RoomsReq\"p\n\nRoomsReply\0224\n"
-"\005rooms\030\001 \003(\0132%.ChatRoom.Comet.RoomsReply"
-".RoomsEntry\032,\n\nRoomsEntry\022\013\n\003key\030\001 \001(\t\022\r"
-"\n\005value\030\002 \001(\010:\0028\0012\255\002\n\005Comet\022C\n\007PushMsg\022\032"
-".ChatRoom.Comet.PushMsgReq\032\034.ChatRoom.Co"
-"met.PushMsgReply\022I\n\tBroadcast\022\034.ChatRoom"
-".Comet.BroadcastReq\032\036.ChatRoom.Comet.Bro"
-"adcastReply\022U\n\rBroadcastRoom\022 .ChatRoom."
-"Comet.BroadcastRoomReq\032\".ChatRoom.Comet."
-"BroadcastRoomReply\022=\n\005Rooms\022\030.ChatRoom.C"
-"omet.RoomsReq\032\032.ChatRoom.Comet.RoomsRepl"
-"yb\006proto3"
-;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* const descriptor_table_ChatRoom_2eComet_2eproto_deps[1] = {
+  "\n\024ChatRoom.Comet.proto\022\016ChatRoom.Comet\032\027"
+  "ChatRoom.Protocol.proto\"T\n\nPushMsgReq\022\014\n"
+  "\004keys\030\001 \003(\t\022\017\n\007protoOp\030\003 \001(\005\022\'\n\005proto\030\002 "
+  "\001(\0132\030.ChatRoom.Protocol.Proto\"\016\n\014PushMsg"
+  "Reply\"W\n\014BroadcastReq\022\017\n\007protoOp\030\001 \001(\005\022\'"
+  "\n\005proto\030\002 \001(\0132\030.ChatRoom.Protocol.Proto\022"
+  "\r\n\005speed\030\003 \001(\005\"\020\n\016BroadcastReply\"K\n\020Broa"
+  "dcastRoomReq\022\016\n\006roomID\030\001 \001(\t\022\'\n\005proto\030\002 "
+  "\001(\0132\030.ChatRoom.Protocol.Proto\"\024\n\022Broadca"
+  "stRoomReply\"H\n\025BroadcastRoomBatchReq\022/\n\005"
+  "rooms\030\001 \003(\0132 .ChatRoom.Comet.BroadcastRo"
+  "omReq\"\031\n\027BroadcastRoomBatchReply\"`\n\010Push"
+  "Item\022\016\n\006roomID\030\001 \001(\t\022\'\n\005proto\030\002 \001(\0132\030.Ch"
+  "atRoom.Protocol.Proto\022\014\n\004keys\030\003 \003(\t\022\r\n\005s"
+  "peed\030\004 \001(\005\"P\n\tPushBatch\022\013\n\003seq\030\001 \001(\004\022\'\n\005"
+  "items\030\002 \003(\0132\030.ChatRoom.Comet.PushItem\022\r\n"
+  "\005epoch\030\003 \001(\004\"&\n\007PushAck\022\013\n\003seq\030\001 \001(\004\022\016\n\006"
+  "failed\030\002 \001(\005\";\n\010RoomsReq\022\r\n\005epoch\030\001 \001(\004\022"
+  "\017\n\007version\030\002 \001(\004\022\017\n\007wait_ms\030\003 \001(\005\"\220\001\n\nRo"
+  "omsReply\0224\n\005rooms\030\001 \003(\0132%.ChatRoom.Comet"
+  ".RoomsReply.RoomsEntry\022\r\n\005epoch\030\002 \001(\004\022\017\n"
+  "\007version\030\003 \001(\004\032,\n\nRoomsEntry\022\013\n\003key\030\001 \001("
+  "\t\022\r\n\005value\030\002 \001(\010:\0028\001\"(\n\010UsersReq\022\r\n\005epoc"
+  "h\030\001 \001(\004\022\r\n\005since\030\002 \001(\004\"[\n\nUsersReply\022\r\n\005"
+  "epoch\030\001 \001(\004\022\017\n\007version\030\002 \001(\004\022\014\n\004full\030\003 \001"
+  "(\010\022\016\n\006online\030\004 \003(\t\022\017\n\007offline\030\005 \003(\t2\230\004\n\005"
+  "Comet\022C\n\007PushMsg\022\032.ChatRoom.Comet.PushMs"
+  "gReq\032\034.ChatRoom.Comet.PushMsgReply\022I\n\tBr"
+  "oadcast\022\034.ChatRoom.Comet.BroadcastReq\032\036."
+  "ChatRoom.Comet.BroadcastReply\022U\n\rBroadca"
+  "stRoom\022 .ChatRoom.Comet.BroadcastRoomReq"
+  "\032\".ChatRoom.Comet.BroadcastRoomReply\022d\n\022"
+  "BroadcastRoomBatch\022%.ChatRoom.Comet.Broa"
+  "dcastRoomBatchReq\032\'.ChatRoom.Comet.Broad"
+  "castRoomBatchReply\022=\n\005Rooms\022\030.ChatRoom.C"
+  "omet.RoomsReq\032\032.ChatRoom.Comet.RoomsRepl"
+  "y\022=\n\005Users\022\030.ChatRoom.Comet.UsersReq\032\032.C"
+  "hatRoom.Comet.UsersReply\022D\n\nPushStream\022\031"
+  ".ChatRoom.Comet.PushBatch\032\027.ChatRoom.Com"
+  "et.PushAck(\0010\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ChatRoom_2eComet_2eproto_deps[1] = {
   &::descriptor_table_ChatRoom_2eProtocol_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_ChatRoom_2eComet_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ChatRoom_2eComet_2eproto = {
-  false, false, 809, descriptor_table_protodef_ChatRoom_2eComet_2eproto, "ChatRoom.Comet.proto",
-  &descriptor_table_ChatRoom_2eComet_2eproto_once, descriptor_table_ChatRoom_2eComet_2eproto_deps, 1, 9,
-  schemas, file_default_instances, TableStruct_ChatRoom_2eComet_2eproto::offsets,
-  file_level_metadata_ChatRoom_2eComet_2eproto, file_level_enum_descriptors_ChatRoom_2eComet_2eproto, file_level_service_descriptors_ChatRoom_2eComet_2eproto,
+static ::_pbi::once_flag descriptor_table_ChatRoom_2eComet_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ChatRoom_2eComet_2eproto = {
+    false, false, 1582, descriptor_table_protodef_ChatRoom_2eComet_2eproto,
+    "ChatRoom.Comet.proto",
+    &descriptor_table_ChatRoom_2eComet_2eproto_once, descriptor_table_ChatRoom_2eComet_2eproto_deps, 1, 16,
+    schemas, file_default_instances, TableStruct_ChatRoom_2eComet_2eproto::offsets,
+    file_level_metadata_ChatRoom_2eComet_2eproto, file_level_enum_descriptors_ChatRoom_2eComet_2eproto,
+    file_level_service_descriptors_ChatRoom_2eComet_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_ChatRoom_2eComet_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ChatRoom_2eComet_2eproto_getter() {
   return &descriptor_table_ChatRoom_2eComet_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_ChatRoom_2eComet_2eproto(&descriptor_table_ChatRoom_2eComet_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ChatRoom_2eComet_2eproto(&descriptor_table_ChatRoom_2eComet_2eproto);
 namespace ChatRoom {
-  namespace Comet {
-
-    // ===================================================================
+namespace Comet {
 
-    class PushMsgReq::_Internal {
-    public:
-      static const ::ChatRoom::Protocol::Proto& proto(const PushMsgReq* msg);
-    };
+// ===================================================================
 
-    const ::ChatRoom::Protocol::Proto&
-      PushMsgReq::_Internal::proto(const PushMsgReq* msg) {
-      return *msg->proto_;
-    }
-    void PushMsgReq::clear_proto() {
-      if (GetArenaForAllocation() == nullptr && proto_ != nullptr) {
-        delete proto_;
-      }
-      proto_ = nullptr;
-    }
-    PushMsgReq::PushMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-      keys_(arena) {
-      SharedCtor();
-      if (!is_message_owned) {
-        RegisterArenaDtor(arena);
-      }
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.PushMsgReq)
-    }
-    PushMsgReq::PushMsgReq(const PushMsgReq& from)
-      : ::PROTOBUF_NAMESPACE_ID::Message(),
-      keys_(from.keys_) {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      if (from._internal_has_proto()) {
-        proto_ = new ::ChatRoom::Protocol::Proto(*from.proto_);
-      }
-      else {
-        proto_ = nullptr;
-      }
-      protoop_ = from.protoop_;
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.PushMsgReq)
-    }
+class PushMsgReq::_Internal {
+ public:
+  static const ::ChatRoom::Protocol::Proto& proto(const PushMsgReq* msg);
+};
 
-    inline void PushMsgReq::SharedCtor() {
-      ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-        reinterpret_cast<char*>(&proto_) - reinterpret_cast<char*>(this)),
-        0, static_cast<size_t>(reinterpret_cast<char*>(&protoop_) -
-          reinterpret_cast<char*>(&proto_)) + sizeof(protoop_));
-    }
+const ::ChatRoom::Protocol::Proto&
+PushMsgReq::_Internal::proto(const PushMsgReq* msg) {
+  return *msg->_impl_.proto_;
+}
+void PushMsgReq::clear_proto() {
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+}
+PushMsgReq::PushMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.PushMsgReq)
+}
+PushMsgReq::PushMsgReq(const PushMsgReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PushMsgReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.proto_){nullptr}
+    , decltype(_impl_.protoop_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_proto()) {
+    _this->_impl_.proto_ = new ::ChatRoom::Protocol::Proto(*from._impl_.proto_);
+  }
+  _this->_impl_.protoop_ = from._impl_.protoop_;
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.PushMsgReq)
+}
 
-    PushMsgReq::~PushMsgReq() {
-      // @@protoc_insertion_point(destructor:ChatRoom.Comet.PushMsgReq)
-      if (GetArenaForAllocation() != nullptr) return;
-      SharedDtor();
-      _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+inline void PushMsgReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , decltype(_impl_.proto_){nullptr}
+    , decltype(_impl_.protoop_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
-    inline void PushMsgReq::SharedDtor() {
-      GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-      if (this != internal_default_instance()) delete proto_;
-    }
+PushMsgReq::~PushMsgReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.PushMsgReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-    void PushMsgReq::ArenaDtor(void* object) {
-      PushMsgReq* _this = reinterpret_cast<PushMsgReq*>(object);
-      (void)_this;
-    }
-    void PushMsgReq::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-    }
-    void PushMsgReq::SetCachedSize(int size) const {
-      _cached_size_.Set(size);
-    }
+inline void PushMsgReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.proto_;
+}
 
-    void PushMsgReq::Clear() {
-      // @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.PushMsgReq)
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
+void PushMsgReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-      keys_.Clear();
-      if (GetArenaForAllocation() == nullptr && proto_ != nullptr) {
-        delete proto_;
-      }
-      proto_ = nullptr;
-      protoop_ = 0;
-      _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+void PushMsgReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.PushMsgReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+  _impl_.protoop_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    const char* PushMsgReq::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PushMsgReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-      while (!ctx->Done(&ptr)) {
-        uint32_t tag;
-        ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-        switch (tag >> 3) {
-          // repeated string keys = 1;
-        case 1:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-            ptr -= 1;
-            do {
-              ptr += 1;
-              auto str = _internal_add_keys();
-              ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-              CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "ChatRoom.Comet.PushMsgReq.keys"));
-              CHK_(ptr);
-              if (!ctx->DataAvailable(ptr)) break;
-            } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-          }
-          else
-            goto handle_unusual;
-          continue;
-          // .ChatRoom.Protocol.Proto proto = 2;
-        case 2:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-            ptr = ctx->ParseMessage(_internal_mutable_proto(), ptr);
-            CHK_(ptr);
-          }
-          else
-            goto handle_unusual;
-          continue;
-          // int32 protoOp = 3;
-        case 3:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-            protoop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
-          }
-          else
-            goto handle_unusual;
-          continue;
-        default:
+            CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Comet.PushMsgReq.keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }  // switch
-      handle_unusual:
-        if ((tag == 0) || ((tag & 7) == 4)) {
-          CHK_(ptr);
-          ctx->SetLastTag(tag);
-          goto message_done;
-        }
-        ptr = UnknownFieldParse(
-          tag,
-          _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-          ptr, ctx);
-        CHK_(ptr != nullptr);
-      }  // while
-    message_done:
-      return ptr;
-    failure:
-      ptr = nullptr;
-      goto message_done;
-#undef CHK_
-    }
-
-    uint8_t* PushMsgReq::_InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-      // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.PushMsgReq)
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
-
-      // repeated string keys = 1;
-      for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
-        const auto& s = this->_internal_keys(i);
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-          s.data(), static_cast<int>(s.length()),
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-          "ChatRoom.Comet.PushMsgReq.keys");
-        target = stream->WriteString(1, s, target);
-      }
-
-      // .ChatRoom.Protocol.Proto proto = 2;
-      if (this->_internal_has_proto()) {
-        target = stream->EnsureSpace(target);
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-          InternalWriteMessage(
-            2, _Internal::proto(this), target, stream);
-      }
-
-      // int32 protoOp = 3;
-      if (this->_internal_protoop() != 0) {
-        target = stream->EnsureSpace(target);
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_protoop(), target);
-      }
-
-      if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-          _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-      }
-      // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.PushMsgReq)
-      return target;
-    }
-
-    size_t PushMsgReq::ByteSizeLong() const {
-      // @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.PushMsgReq)
-      size_t total_size = 0;
-
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
-
-      // repeated string keys = 1;
-      total_size += 1 *
-        ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(keys_.size());
-      for (int i = 0, n = keys_.size(); i < n; i++) {
-        total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          keys_.Get(i));
-      }
-
+        continue;
       // .ChatRoom.Protocol.Proto proto = 2;
-      if (this->_internal_has_proto()) {
-        total_size += 1 +
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-            *proto_);
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_proto(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // int32 protoOp = 3;
-      if (this->_internal_protoop() != 0) {
-        total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_protoop());
-      }
-
-      return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-    }
-
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushMsgReq::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-        PushMsgReq::MergeImpl
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* PushMsgReq::GetClassData() const { return &_class_data_; }
-
-    void PushMsgReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-      static_cast<PushMsgReq*>(to)->MergeFrom(
-        static_cast<const PushMsgReq&>(from));
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.protoop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
+uint8_t* PushMsgReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.PushMsgReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Comet.PushMsgReq.keys");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::proto(this),
+        _Internal::proto(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 protoOp = 3;
+  if (this->_internal_protoop() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_protoop(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.PushMsgReq)
+  return target;
+}
 
-    void PushMsgReq::MergeFrom(const PushMsgReq& from) {
-      // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.PushMsgReq)
-      GOOGLE_DCHECK_NE(&from, this);
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
-
-      keys_.MergeFrom(from.keys_);
-      if (from._internal_has_proto()) {
-        _internal_mutable_proto()->::ChatRoom::Protocol::Proto::MergeFrom(from._internal_proto());
-      }
-      if (from._internal_protoop() != 0) {
-        _internal_set_protoop(from._internal_protoop());
-      }
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-    }
+size_t PushMsgReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.PushMsgReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.proto_);
+  }
+
+  // int32 protoOp = 3;
+  if (this->_internal_protoop() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_protoop());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-    void PushMsgReq::CopyFrom(const PushMsgReq& from) {
-      // @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.PushMsgReq)
-      if (&from == this) return;
-      Clear();
-      MergeFrom(from);
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushMsgReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PushMsgReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PushMsgReq::GetClassData() const { return &_class_data_; }
+
+
+void PushMsgReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PushMsgReq*>(&to_msg);
+  auto& from = static_cast<const PushMsgReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.PushMsgReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (from._internal_has_proto()) {
+    _this->_internal_mutable_proto()->::ChatRoom::Protocol::Proto::MergeFrom(
+        from._internal_proto());
+  }
+  if (from._internal_protoop() != 0) {
+    _this->_internal_set_protoop(from._internal_protoop());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-    bool PushMsgReq::IsInitialized() const {
-      return true;
-    }
+void PushMsgReq::CopyFrom(const PushMsgReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.PushMsgReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-    void PushMsgReq::InternalSwap(PushMsgReq* other) {
-      using std::swap;
-      _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-      keys_.InternalSwap(&other->keys_);
-      ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-        PROTOBUF_FIELD_OFFSET(PushMsgReq, protoop_)
-        + sizeof(PushMsgReq::protoop_)
-        - PROTOBUF_FIELD_OFFSET(PushMsgReq, proto_)>(
-          reinterpret_cast<char*>(&proto_),
-          reinterpret_cast<char*>(&other->proto_));
-    }
+bool PushMsgReq::IsInitialized() const {
+  return true;
+}
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata PushMsgReq::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[0]);
-    }
+void PushMsgReq::InternalSwap(PushMsgReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PushMsgReq, _impl_.protoop_)
+      + sizeof(PushMsgReq::_impl_.protoop_)
+      - PROTOBUF_FIELD_OFFSET(PushMsgReq, _impl_.proto_)>(
+          reinterpret_cast<char*>(&_impl_.proto_),
+          reinterpret_cast<char*>(&other->_impl_.proto_));
+}
 
-    // ===================================================================
+::PROTOBUF_NAMESPACE_ID::Metadata PushMsgReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[0]);
+}
 
-    class PushMsgReply::_Internal {
-    public:
-    };
+// ===================================================================
 
-    PushMsgReply::PushMsgReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.PushMsgReply)
-    }
-    PushMsgReply::PushMsgReply(const PushMsgReply& from)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.PushMsgReply)
-    }
+class PushMsgReply::_Internal {
+ public:
+};
 
+PushMsgReply::PushMsgReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.PushMsgReply)
+}
+PushMsgReply::PushMsgReply(const PushMsgReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PushMsgReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.PushMsgReply)
+}
 
 
 
 
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushMsgReply::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* PushMsgReply::GetClassData() const { return &_class_data_; }
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushMsgReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PushMsgReply::GetClassData() const { return &_class_data_; }
 
 
 
 
 
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata PushMsgReply::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[1]);
-    }
 
-    // ===================================================================
+::PROTOBUF_NAMESPACE_ID::Metadata PushMsgReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[1]);
+}
 
-    class BroadcastReq::_Internal {
-    public:
-      static const ::ChatRoom::Protocol::Proto& proto(const BroadcastReq* msg);
-    };
+// ===================================================================
 
-    const ::ChatRoom::Protocol::Proto&
-      BroadcastReq::_Internal::proto(const BroadcastReq* msg) {
-      return *msg->proto_;
-    }
-    void BroadcastReq::clear_proto() {
-      if (GetArenaForAllocation() == nullptr && proto_ != nullptr) {
-        delete proto_;
-      }
-      proto_ = nullptr;
-    }
-    BroadcastReq::BroadcastReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-      SharedCtor();
-      if (!is_message_owned) {
-        RegisterArenaDtor(arena);
-      }
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastReq)
-    }
-    BroadcastReq::BroadcastReq(const BroadcastReq& from)
-      : ::PROTOBUF_NAMESPACE_ID::Message() {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      if (from._internal_has_proto()) {
-        proto_ = new ::ChatRoom::Protocol::Proto(*from.proto_);
-      }
-      else {
-        proto_ = nullptr;
-      }
-      ::memcpy(&protoop_, &from.protoop_,
-        static_cast<size_t>(reinterpret_cast<char*>(&speed_) -
-          reinterpret_cast<char*>(&protoop_)) + sizeof(speed_));
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastReq)
-    }
+class BroadcastReq::_Internal {
+ public:
+  static const ::ChatRoom::Protocol::Proto& proto(const BroadcastReq* msg);
+};
 
-    inline void BroadcastReq::SharedCtor() {
-      ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-        reinterpret_cast<char*>(&proto_) - reinterpret_cast<char*>(this)),
-        0, static_cast<size_t>(reinterpret_cast<char*>(&speed_) -
-          reinterpret_cast<char*>(&proto_)) + sizeof(speed_));
-    }
+const ::ChatRoom::Protocol::Proto&
+BroadcastReq::_Internal::proto(const BroadcastReq* msg) {
+  return *msg->_impl_.proto_;
+}
+void BroadcastReq::clear_proto() {
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+}
+BroadcastReq::BroadcastReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastReq)
+}
+BroadcastReq::BroadcastReq(const BroadcastReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.proto_){nullptr}
+    , decltype(_impl_.protoop_){}
+    , decltype(_impl_.speed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_proto()) {
+    _this->_impl_.proto_ = new ::ChatRoom::Protocol::Proto(*from._impl_.proto_);
+  }
+  ::memcpy(&_impl_.protoop_, &from._impl_.protoop_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.speed_) -
+    reinterpret_cast<char*>(&_impl_.protoop_)) + sizeof(_impl_.speed_));
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastReq)
+}
 
-    BroadcastReq::~BroadcastReq() {
-      // @@protoc_insertion_point(destructor:ChatRoom.Comet.BroadcastReq)
-      if (GetArenaForAllocation() != nullptr) return;
-      SharedDtor();
-      _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+inline void BroadcastReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.proto_){nullptr}
+    , decltype(_impl_.protoop_){0}
+    , decltype(_impl_.speed_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
-    inline void BroadcastReq::SharedDtor() {
-      GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-      if (this != internal_default_instance()) delete proto_;
-    }
+BroadcastReq::~BroadcastReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.BroadcastReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-    void BroadcastReq::ArenaDtor(void* object) {
-      BroadcastReq* _this = reinterpret_cast<BroadcastReq*>(object);
-      (void)_this;
-    }
-    void BroadcastReq::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-    }
-    void BroadcastReq::SetCachedSize(int size) const {
-      _cached_size_.Set(size);
-    }
+inline void BroadcastReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.proto_;
+}
 
-    void BroadcastReq::Clear() {
-      // @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.BroadcastReq)
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
+void BroadcastReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-      if (GetArenaForAllocation() == nullptr && proto_ != nullptr) {
-        delete proto_;
-      }
-      proto_ = nullptr;
-      ::memset(&protoop_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&speed_) -
-        reinterpret_cast<char*>(&protoop_)) + sizeof(speed_));
-      _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+void BroadcastReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.BroadcastReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+  ::memset(&_impl_.protoop_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.speed_) -
+      reinterpret_cast<char*>(&_impl_.protoop_)) + sizeof(_impl_.speed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    const char* BroadcastReq::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BroadcastReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-      while (!ctx->Done(&ptr)) {
-        uint32_t tag;
-        ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-        switch (tag >> 3) {
-          // int32 protoOp = 1;
-        case 1:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-            protoop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-            CHK_(ptr);
-          }
-          else
-            goto handle_unusual;
-          continue;
-          // .ChatRoom.Protocol.Proto proto = 2;
-        case 2:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-            ptr = ctx->ParseMessage(_internal_mutable_proto(), ptr);
-            CHK_(ptr);
-          }
-          else
-            goto handle_unusual;
-          continue;
-          // int32 speed = 3;
-        case 3:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-            speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-            CHK_(ptr);
-          }
-          else
-            goto handle_unusual;
-          continue;
-        default:
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 protoOp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.protoop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Protocol.Proto proto = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_proto(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }  // switch
-      handle_unusual:
-        if ((tag == 0) || ((tag & 7) == 4)) {
+        continue;
+      // int32 speed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          ctx->SetLastTag(tag);
-          goto message_done;
-        }
-        ptr = UnknownFieldParse(
-          tag,
-          _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-          ptr, ctx);
-        CHK_(ptr != nullptr);
-      }  // while
-    message_done:
-      return ptr;
-    failure:
-      ptr = nullptr;
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
       goto message_done;
-#undef CHK_
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    uint8_t* BroadcastReq::_InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-      // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.BroadcastReq)
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
+uint8_t* BroadcastReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.BroadcastReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 protoOp = 1;
+  if (this->_internal_protoop() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_protoop(), target);
+  }
+
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::proto(this),
+        _Internal::proto(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 speed = 3;
+  if (this->_internal_speed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_speed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.BroadcastReq)
+  return target;
+}
 
-      // int32 protoOp = 1;
-      if (this->_internal_protoop() != 0) {
-        target = stream->EnsureSpace(target);
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_protoop(), target);
-      }
+size_t BroadcastReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.BroadcastReq)
+  size_t total_size = 0;
 
-      // .ChatRoom.Protocol.Proto proto = 2;
-      if (this->_internal_has_proto()) {
-        target = stream->EnsureSpace(target);
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-          InternalWriteMessage(
-            2, _Internal::proto(this), target, stream);
-      }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-      // int32 speed = 3;
-      if (this->_internal_speed() != 0) {
-        target = stream->EnsureSpace(target);
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_speed(), target);
-      }
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.proto_);
+  }
 
-      if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-          _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-      }
-      // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.BroadcastReq)
-      return target;
-    }
+  // int32 protoOp = 1;
+  if (this->_internal_protoop() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_protoop());
+  }
 
-    size_t BroadcastReq::ByteSizeLong() const {
-      // @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.BroadcastReq)
-      size_t total_size = 0;
+  // int32 speed = 3;
+  if (this->_internal_speed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_speed());
+  }
 
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-      // .ChatRoom.Protocol.Proto proto = 2;
-      if (this->_internal_has_proto()) {
-        total_size += 1 +
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-            *proto_);
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastReq::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastReq*>(&to_msg);
+  auto& from = static_cast<const BroadcastReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.BroadcastReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_proto()) {
+    _this->_internal_mutable_proto()->::ChatRoom::Protocol::Proto::MergeFrom(
+        from._internal_proto());
+  }
+  if (from._internal_protoop() != 0) {
+    _this->_internal_set_protoop(from._internal_protoop());
+  }
+  if (from._internal_speed() != 0) {
+    _this->_internal_set_speed(from._internal_speed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-      // int32 protoOp = 1;
-      if (this->_internal_protoop() != 0) {
-        total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_protoop());
-      }
+void BroadcastReq::CopyFrom(const BroadcastReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.BroadcastReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // int32 speed = 3;
-      if (this->_internal_speed() != 0) {
-        total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_speed());
-      }
+bool BroadcastReq::IsInitialized() const {
+  return true;
+}
 
-      return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-    }
+void BroadcastReq::InternalSwap(BroadcastReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BroadcastReq, _impl_.speed_)
+      + sizeof(BroadcastReq::_impl_.speed_)
+      - PROTOBUF_FIELD_OFFSET(BroadcastReq, _impl_.proto_)>(
+          reinterpret_cast<char*>(&_impl_.proto_),
+          reinterpret_cast<char*>(&other->_impl_.proto_));
+}
 
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastReq::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-        BroadcastReq::MergeImpl
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* BroadcastReq::GetClassData() const { return &_class_data_; }
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[2]);
+}
 
-    void BroadcastReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-      static_cast<BroadcastReq*>(to)->MergeFrom(
-        static_cast<const BroadcastReq&>(from));
-    }
+// ===================================================================
 
+class BroadcastReply::_Internal {
+ public:
+};
 
-    void BroadcastReq::MergeFrom(const BroadcastReq& from) {
-      // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.BroadcastReq)
-      GOOGLE_DCHECK_NE(&from, this);
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
+BroadcastReply::BroadcastReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastReply)
+}
+BroadcastReply::BroadcastReply(const BroadcastReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  BroadcastReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastReply)
+}
 
-      if (from._internal_has_proto()) {
-        _internal_mutable_proto()->::ChatRoom::Protocol::Proto::MergeFrom(from._internal_proto());
-      }
-      if (from._internal_protoop() != 0) {
-        _internal_set_protoop(from._internal_protoop());
-      }
-      if (from._internal_speed() != 0) {
-        _internal_set_speed(from._internal_speed());
-      }
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-    }
 
-    void BroadcastReq::CopyFrom(const BroadcastReq& from) {
-      // @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.BroadcastReq)
-      if (&from == this) return;
-      Clear();
-      MergeFrom(from);
-    }
 
-    bool BroadcastReq::IsInitialized() const {
-      return true;
-    }
 
-    void BroadcastReq::InternalSwap(BroadcastReq* other) {
-      using std::swap;
-      _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-      ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-        PROTOBUF_FIELD_OFFSET(BroadcastReq, speed_)
-        + sizeof(BroadcastReq::speed_)
-        - PROTOBUF_FIELD_OFFSET(BroadcastReq, proto_)>(
-          reinterpret_cast<char*>(&proto_),
-          reinterpret_cast<char*>(&other->proto_));
-    }
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata BroadcastReq::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[2]);
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastReply::GetClassData() const { return &_class_data_; }
 
-    // ===================================================================
 
-    class BroadcastReply::_Internal {
-    public:
-    };
 
-    BroadcastReply::BroadcastReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastReply)
-    }
-    BroadcastReply::BroadcastReply(const BroadcastReply& from)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastReply)
-    }
 
 
 
 
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[3]);
+}
 
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastReply::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* BroadcastReply::GetClassData() const { return &_class_data_; }
+// ===================================================================
 
+class BroadcastRoomReq::_Internal {
+ public:
+  static const ::ChatRoom::Protocol::Proto& proto(const BroadcastRoomReq* msg);
+};
 
+const ::ChatRoom::Protocol::Proto&
+BroadcastRoomReq::_Internal::proto(const BroadcastRoomReq* msg) {
+  return *msg->_impl_.proto_;
+}
+void BroadcastRoomReq::clear_proto() {
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+}
+BroadcastRoomReq::BroadcastRoomReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastRoomReq)
+}
+BroadcastRoomReq::BroadcastRoomReq(const BroadcastRoomReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastRoomReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roomid_){}
+    , decltype(_impl_.proto_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_roomid().empty()) {
+    _this->_impl_.roomid_.Set(from._internal_roomid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_proto()) {
+    _this->_impl_.proto_ = new ::ChatRoom::Protocol::Proto(*from._impl_.proto_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastRoomReq)
+}
 
+inline void BroadcastRoomReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roomid_){}
+    , decltype(_impl_.proto_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BroadcastRoomReq::~BroadcastRoomReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.BroadcastRoomReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
+inline void BroadcastRoomReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.roomid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.proto_;
+}
 
+void BroadcastRoomReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
+void BroadcastRoomReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.BroadcastRoomReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.roomid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata BroadcastReply::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[3]);
+const char* BroadcastRoomReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string roomID = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_roomid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Comet.BroadcastRoomReq.roomID"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Protocol.Proto proto = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_proto(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    // ===================================================================
+uint8_t* BroadcastRoomReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.BroadcastRoomReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_roomid().data(), static_cast<int>(this->_internal_roomid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Comet.BroadcastRoomReq.roomID");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_roomid(), target);
+  }
+
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::proto(this),
+        _Internal::proto(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.BroadcastRoomReq)
+  return target;
+}
 
-    class BroadcastRoomReq::_Internal {
-    public:
-      static const ::ChatRoom::Protocol::Proto& proto(const BroadcastRoomReq* msg);
-    };
+size_t BroadcastRoomReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.BroadcastRoomReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_roomid());
+  }
+
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.proto_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-    const ::ChatRoom::Protocol::Proto&
-      BroadcastRoomReq::_Internal::proto(const BroadcastRoomReq* msg) {
-      return *msg->proto_;
-    }
-    void BroadcastRoomReq::clear_proto() {
-      if (GetArenaForAllocation() == nullptr && proto_ != nullptr) {
-        delete proto_;
-      }
-      proto_ = nullptr;
-    }
-    BroadcastRoomReq::BroadcastRoomReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-      SharedCtor();
-      if (!is_message_owned) {
-        RegisterArenaDtor(arena);
-      }
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastRoomReq)
-    }
-    BroadcastRoomReq::BroadcastRoomReq(const BroadcastRoomReq& from)
-      : ::PROTOBUF_NAMESPACE_ID::Message() {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      roomid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-      roomid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-      if (!from._internal_roomid().empty()) {
-        roomid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_roomid(),
-          GetArenaForAllocation());
-      }
-      if (from._internal_has_proto()) {
-        proto_ = new ::ChatRoom::Protocol::Proto(*from.proto_);
-      }
-      else {
-        proto_ = nullptr;
-      }
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastRoomReq)
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRoomReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastRoomReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastRoomReq::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastRoomReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastRoomReq*>(&to_msg);
+  auto& from = static_cast<const BroadcastRoomReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.BroadcastRoomReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_roomid().empty()) {
+    _this->_internal_set_roomid(from._internal_roomid());
+  }
+  if (from._internal_has_proto()) {
+    _this->_internal_mutable_proto()->::ChatRoom::Protocol::Proto::MergeFrom(
+        from._internal_proto());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-    inline void BroadcastRoomReq::SharedCtor() {
-      roomid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-      roomid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-      proto_ = nullptr;
-    }
+void BroadcastRoomReq::CopyFrom(const BroadcastRoomReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.BroadcastRoomReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-    BroadcastRoomReq::~BroadcastRoomReq() {
-      // @@protoc_insertion_point(destructor:ChatRoom.Comet.BroadcastRoomReq)
-      if (GetArenaForAllocation() != nullptr) return;
-      SharedDtor();
-      _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+bool BroadcastRoomReq::IsInitialized() const {
+  return true;
+}
 
-    inline void BroadcastRoomReq::SharedDtor() {
-      GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-      roomid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-      if (this != internal_default_instance()) delete proto_;
-    }
+void BroadcastRoomReq::InternalSwap(BroadcastRoomReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.roomid_, lhs_arena,
+      &other->_impl_.roomid_, rhs_arena
+  );
+  swap(_impl_.proto_, other->_impl_.proto_);
+}
 
-    void BroadcastRoomReq::ArenaDtor(void* object) {
-      BroadcastRoomReq* _this = reinterpret_cast<BroadcastRoomReq*>(object);
-      (void)_this;
-    }
-    void BroadcastRoomReq::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-    }
-    void BroadcastRoomReq::SetCachedSize(int size) const {
-      _cached_size_.Set(size);
-    }
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRoomReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[4]);
+}
 
-    void BroadcastRoomReq::Clear() {
-      // @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.BroadcastRoomReq)
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
+// ===================================================================
 
-      roomid_.ClearToEmpty();
-      if (GetArenaForAllocation() == nullptr && proto_ != nullptr) {
-        delete proto_;
-      }
-      proto_ = nullptr;
-      _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+class BroadcastRoomReply::_Internal {
+ public:
+};
 
-    const char* BroadcastRoomReq::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+BroadcastRoomReply::BroadcastRoomReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastRoomReply)
+}
+BroadcastRoomReply::BroadcastRoomReply(const BroadcastRoomReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  BroadcastRoomReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastRoomReply)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRoomReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastRoomReply::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRoomReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[5]);
+}
+
+// ===================================================================
+
+class BroadcastRoomBatchReq::_Internal {
+ public:
+};
+
+BroadcastRoomBatchReq::BroadcastRoomBatchReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastRoomBatchReq)
+}
+BroadcastRoomBatchReq::BroadcastRoomBatchReq(const BroadcastRoomBatchReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastRoomBatchReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){from._impl_.rooms_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastRoomBatchReq)
+}
+
+inline void BroadcastRoomBatchReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BroadcastRoomBatchReq::~BroadcastRoomBatchReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.BroadcastRoomBatchReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BroadcastRoomBatchReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
+}
+
+void BroadcastRoomBatchReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BroadcastRoomBatchReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.BroadcastRoomBatchReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rooms_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BroadcastRoomBatchReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-      while (!ctx->Done(&ptr)) {
-        uint32_t tag;
-        ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-        switch (tag >> 3) {
-          // string roomID = 1;
-        case 1:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-            auto str = _internal_mutable_roomid();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "ChatRoom.Comet.BroadcastRoomReq.roomID"));
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ChatRoom.Comet.BroadcastRoomReq rooms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rooms(), ptr);
             CHK_(ptr);
-          }
-          else
-            goto handle_unusual;
-          continue;
-          // .ChatRoom.Protocol.Proto proto = 2;
-        case 2:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-            ptr = ctx->ParseMessage(_internal_mutable_proto(), ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BroadcastRoomBatchReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.BroadcastRoomBatchReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Comet.BroadcastRoomReq rooms = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rooms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rooms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.BroadcastRoomBatchReq)
+  return target;
+}
+
+size_t BroadcastRoomBatchReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.BroadcastRoomBatchReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Comet.BroadcastRoomReq rooms = 1;
+  total_size += 1UL * this->_internal_rooms_size();
+  for (const auto& msg : this->_impl_.rooms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRoomBatchReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastRoomBatchReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastRoomBatchReq::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastRoomBatchReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastRoomBatchReq*>(&to_msg);
+  auto& from = static_cast<const BroadcastRoomBatchReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.BroadcastRoomBatchReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BroadcastRoomBatchReq::CopyFrom(const BroadcastRoomBatchReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.BroadcastRoomBatchReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BroadcastRoomBatchReq::IsInitialized() const {
+  return true;
+}
+
+void BroadcastRoomBatchReq::InternalSwap(BroadcastRoomBatchReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRoomBatchReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[6]);
+}
+
+// ===================================================================
+
+class BroadcastRoomBatchReply::_Internal {
+ public:
+};
+
+BroadcastRoomBatchReply::BroadcastRoomBatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastRoomBatchReply)
+}
+BroadcastRoomBatchReply::BroadcastRoomBatchReply(const BroadcastRoomBatchReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  BroadcastRoomBatchReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastRoomBatchReply)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRoomBatchReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastRoomBatchReply::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRoomBatchReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[7]);
+}
+
+// ===================================================================
+
+class PushItem::_Internal {
+ public:
+  static const ::ChatRoom::Protocol::Proto& proto(const PushItem* msg);
+};
+
+const ::ChatRoom::Protocol::Proto&
+PushItem::_Internal::proto(const PushItem* msg) {
+  return *msg->_impl_.proto_;
+}
+void PushItem::clear_proto() {
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+}
+PushItem::PushItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.PushItem)
+}
+PushItem::PushItem(const PushItem& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PushItem* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.roomid_){}
+    , decltype(_impl_.proto_){nullptr}
+    , decltype(_impl_.speed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_roomid().empty()) {
+    _this->_impl_.roomid_.Set(from._internal_roomid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_proto()) {
+    _this->_impl_.proto_ = new ::ChatRoom::Protocol::Proto(*from._impl_.proto_);
+  }
+  _this->_impl_.speed_ = from._impl_.speed_;
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.PushItem)
+}
+
+inline void PushItem::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , decltype(_impl_.roomid_){}
+    , decltype(_impl_.proto_){nullptr}
+    , decltype(_impl_.speed_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PushItem::~PushItem() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.PushItem)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PushItem::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.roomid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.proto_;
+}
+
+void PushItem::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PushItem::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.PushItem)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _impl_.roomid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.proto_ != nullptr) {
+    delete _impl_.proto_;
+  }
+  _impl_.proto_ = nullptr;
+  _impl_.speed_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PushItem::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string roomID = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_roomid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Comet.PushItem.roomID"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Protocol.Proto proto = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_proto(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string keys = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
-          }
-          else
-            goto handle_unusual;
-          continue;
-        default:
+            CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Comet.PushItem.keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
           goto handle_unusual;
-        }  // switch
-      handle_unusual:
-        if ((tag == 0) || ((tag & 7) == 4)) {
+        continue;
+      // int32 speed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          ctx->SetLastTag(tag);
-          goto message_done;
-        }
-        ptr = UnknownFieldParse(
-          tag,
-          _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-          ptr, ctx);
-        CHK_(ptr != nullptr);
-      }  // while
-    message_done:
-      return ptr;
-    failure:
-      ptr = nullptr;
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
       goto message_done;
-#undef CHK_
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    uint8_t* BroadcastRoomReq::_InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-      // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.BroadcastRoomReq)
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
+uint8_t* PushItem::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.PushItem)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_roomid().data(), static_cast<int>(this->_internal_roomid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Comet.PushItem.roomID");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_roomid(), target);
+  }
+
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::proto(this),
+        _Internal::proto(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated string keys = 3;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Comet.PushItem.keys");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // int32 speed = 4;
+  if (this->_internal_speed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_speed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.PushItem)
+  return target;
+}
 
-      // string roomID = 1;
-      if (!this->_internal_roomid().empty()) {
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-          this->_internal_roomid().data(), static_cast<int>(this->_internal_roomid().length()),
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-          "ChatRoom.Comet.BroadcastRoomReq.roomID");
-        target = stream->WriteStringMaybeAliased(
-          1, this->_internal_roomid(), target);
-      }
+size_t PushItem::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.PushItem)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string keys = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_roomid());
+  }
+
+  // .ChatRoom.Protocol.Proto proto = 2;
+  if (this->_internal_has_proto()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.proto_);
+  }
+
+  // int32 speed = 4;
+  if (this->_internal_speed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_speed());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-      // .ChatRoom.Protocol.Proto proto = 2;
-      if (this->_internal_has_proto()) {
-        target = stream->EnsureSpace(target);
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-          InternalWriteMessage(
-            2, _Internal::proto(this), target, stream);
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushItem::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PushItem::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PushItem::GetClassData() const { return &_class_data_; }
+
+
+void PushItem::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PushItem*>(&to_msg);
+  auto& from = static_cast<const PushItem&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.PushItem)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (!from._internal_roomid().empty()) {
+    _this->_internal_set_roomid(from._internal_roomid());
+  }
+  if (from._internal_has_proto()) {
+    _this->_internal_mutable_proto()->::ChatRoom::Protocol::Proto::MergeFrom(
+        from._internal_proto());
+  }
+  if (from._internal_speed() != 0) {
+    _this->_internal_set_speed(from._internal_speed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-      if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-          _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-      }
-      // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.BroadcastRoomReq)
-      return target;
-    }
+void PushItem::CopyFrom(const PushItem& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.PushItem)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-    size_t BroadcastRoomReq::ByteSizeLong() const {
-      // @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.BroadcastRoomReq)
-      size_t total_size = 0;
+bool PushItem::IsInitialized() const {
+  return true;
+}
 
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
+void PushItem::InternalSwap(PushItem* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.roomid_, lhs_arena,
+      &other->_impl_.roomid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PushItem, _impl_.speed_)
+      + sizeof(PushItem::_impl_.speed_)
+      - PROTOBUF_FIELD_OFFSET(PushItem, _impl_.proto_)>(
+          reinterpret_cast<char*>(&_impl_.proto_),
+          reinterpret_cast<char*>(&other->_impl_.proto_));
+}
 
-      // string roomID = 1;
-      if (!this->_internal_roomid().empty()) {
-        total_size += 1 +
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-            this->_internal_roomid());
-      }
+::PROTOBUF_NAMESPACE_ID::Metadata PushItem::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[8]);
+}
 
-      // .ChatRoom.Protocol.Proto proto = 2;
-      if (this->_internal_has_proto()) {
-        total_size += 1 +
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-            *proto_);
-      }
+// ===================================================================
 
-      return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-    }
+class PushBatch::_Internal {
+ public:
+};
 
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRoomReq::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-        BroadcastRoomReq::MergeImpl
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* BroadcastRoomReq::GetClassData() const { return &_class_data_; }
+PushBatch::PushBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.PushBatch)
+}
+PushBatch::PushBatch(const PushBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PushBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){from._impl_.items_}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.epoch_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.epoch_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.epoch_));
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.PushBatch)
+}
 
-    void BroadcastRoomReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-      static_cast<BroadcastRoomReq*>(to)->MergeFrom(
-        static_cast<const BroadcastRoomReq&>(from));
-    }
+inline void PushBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){arena}
+    , decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.epoch_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
+PushBatch::~PushBatch() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.PushBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-    void BroadcastRoomReq::MergeFrom(const BroadcastRoomReq& from) {
-      // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.BroadcastRoomReq)
-      GOOGLE_DCHECK_NE(&from, this);
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
+inline void PushBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.items_.~RepeatedPtrField();
+}
 
-      if (!from._internal_roomid().empty()) {
-        _internal_set_roomid(from._internal_roomid());
-      }
-      if (from._internal_has_proto()) {
-        _internal_mutable_proto()->::ChatRoom::Protocol::Proto::MergeFrom(from._internal_proto());
-      }
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-    }
+void PushBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-    void BroadcastRoomReq::CopyFrom(const BroadcastRoomReq& from) {
-      // @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.BroadcastRoomReq)
-      if (&from == this) return;
-      Clear();
-      MergeFrom(from);
-    }
+void PushBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.PushBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.items_.Clear();
+  ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.epoch_) -
+      reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.epoch_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    bool BroadcastRoomReq::IsInitialized() const {
-      return true;
+const char* PushBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ChatRoom.Comet.PushItem items = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_items(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 epoch = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    void BroadcastRoomReq::InternalSwap(BroadcastRoomReq* other) {
-      using std::swap;
-      auto* lhs_arena = GetArenaForAllocation();
-      auto* rhs_arena = other->GetArenaForAllocation();
-      _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-        &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-        &roomid_, lhs_arena,
-        &other->roomid_, rhs_arena
-      );
-      swap(proto_, other->proto_);
-    }
+uint8_t* PushBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.PushBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_seq(), target);
+  }
+
+  // repeated .ChatRoom.Comet.PushItem items = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_items_size()); i < n; i++) {
+    const auto& repfield = this->_internal_items(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 epoch = 3;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_epoch(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.PushBatch)
+  return target;
+}
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRoomReq::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[4]);
-    }
+size_t PushBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.PushBatch)
+  size_t total_size = 0;
 
-    // ===================================================================
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    class BroadcastRoomReply::_Internal {
-    public:
-    };
+  // repeated .ChatRoom.Comet.PushItem items = 2;
+  total_size += 1UL * this->_internal_items_size();
+  for (const auto& msg : this->_impl_.items_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-    BroadcastRoomReply::BroadcastRoomReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.BroadcastRoomReply)
-    }
-    BroadcastRoomReply::BroadcastRoomReply(const BroadcastRoomReply& from)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.BroadcastRoomReply)
-    }
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
 
+  // uint64 epoch = 3;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+  }
 
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PushBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PushBatch::GetClassData() const { return &_class_data_; }
+
+
+void PushBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PushBatch*>(&to_msg);
+  auto& from = static_cast<const PushBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.PushBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.items_.MergeFrom(from._impl_.items_);
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
+void PushBatch::CopyFrom(const PushBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.PushBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRoomReply::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* BroadcastRoomReply::GetClassData() const { return &_class_data_; }
+bool PushBatch::IsInitialized() const {
+  return true;
+}
+
+void PushBatch::InternalSwap(PushBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.items_.InternalSwap(&other->_impl_.items_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PushBatch, _impl_.epoch_)
+      + sizeof(PushBatch::_impl_.epoch_)
+      - PROTOBUF_FIELD_OFFSET(PushBatch, _impl_.seq_)>(
+          reinterpret_cast<char*>(&_impl_.seq_),
+          reinterpret_cast<char*>(&other->_impl_.seq_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PushBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[9]);
+}
+
+// ===================================================================
 
+class PushAck::_Internal {
+ public:
+};
+
+PushAck::PushAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.PushAck)
+}
+PushAck::PushAck(const PushAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PushAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.seq_){}
+    , decltype(_impl_.failed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.failed_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.failed_));
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.PushAck)
+}
 
+inline void PushAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.failed_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PushAck::~PushAck() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.PushAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
+inline void PushAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
 
+void PushAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
+void PushAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.PushAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.failed_) -
+      reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.failed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRoomReply::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[5]);
+const char* PushAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 failed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.failed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    // ===================================================================
+uint8_t* PushAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.PushAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_seq(), target);
+  }
+
+  // int32 failed = 2;
+  if (this->_internal_failed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_failed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.PushAck)
+  return target;
+}
 
-    class RoomsReq::_Internal {
-    public:
-    };
+size_t PushAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.PushAck)
+  size_t total_size = 0;
 
-    RoomsReq::RoomsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.RoomsReq)
-    }
-    RoomsReq::RoomsReq(const RoomsReq& from)
-      : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.RoomsReq)
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
 
+  // int32 failed = 2;
+  if (this->_internal_failed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_failed());
+  }
 
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PushAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PushAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PushAck::GetClassData() const { return &_class_data_; }
+
+
+void PushAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PushAck*>(&to_msg);
+  auto& from = static_cast<const PushAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.PushAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_failed() != 0) {
+    _this->_internal_set_failed(from._internal_failed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomsReq::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-        ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* RoomsReq::GetClassData() const { return &_class_data_; }
+void PushAck::CopyFrom(const PushAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.PushAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
+bool PushAck::IsInitialized() const {
+  return true;
+}
 
+void PushAck::InternalSwap(PushAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PushAck, _impl_.failed_)
+      + sizeof(PushAck::_impl_.failed_)
+      - PROTOBUF_FIELD_OFFSET(PushAck, _impl_.seq_)>(
+          reinterpret_cast<char*>(&_impl_.seq_),
+          reinterpret_cast<char*>(&other->_impl_.seq_));
+}
 
+::PROTOBUF_NAMESPACE_ID::Metadata PushAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[10]);
+}
 
+// ===================================================================
 
+class RoomsReq::_Internal {
+ public:
+};
 
+RoomsReq::RoomsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.RoomsReq)
+}
+RoomsReq::RoomsReq(const RoomsReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomsReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.epoch_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.wait_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.wait_ms_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.wait_ms_));
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.RoomsReq)
+}
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata RoomsReq::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[6]);
-    }
+inline void RoomsReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.wait_ms_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
-    // ===================================================================
+RoomsReq::~RoomsReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.RoomsReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-    RoomsReply_RoomsEntry_DoNotUse::RoomsReply_RoomsEntry_DoNotUse() {}
-    RoomsReply_RoomsEntry_DoNotUse::RoomsReply_RoomsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-      : SuperType(arena) {
-    }
-    void RoomsReply_RoomsEntry_DoNotUse::MergeFrom(const RoomsReply_RoomsEntry_DoNotUse& other) {
-      MergeFromInternal(other);
-    }
-    ::PROTOBUF_NAMESPACE_ID::Metadata RoomsReply_RoomsEntry_DoNotUse::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[7]);
-    }
+inline void RoomsReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
 
-    // ===================================================================
+void RoomsReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-    class RoomsReply::_Internal {
-    public:
-    };
+void RoomsReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.RoomsReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    RoomsReply::RoomsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-      bool is_message_owned)
-      : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-      rooms_(arena) {
-      SharedCtor();
-      if (!is_message_owned) {
-        RegisterArenaDtor(arena);
-      }
-      // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.RoomsReply)
-    }
-    RoomsReply::RoomsReply(const RoomsReply& from)
-      : ::PROTOBUF_NAMESPACE_ID::Message() {
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-      rooms_.MergeFrom(from.rooms_);
-      // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.RoomsReply)
-    }
+  ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.wait_ms_) -
+      reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.wait_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    inline void RoomsReply::SharedCtor() {
+const char* RoomsReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 epoch = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 wait_ms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.wait_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    RoomsReply::~RoomsReply() {
-      // @@protoc_insertion_point(destructor:ChatRoom.Comet.RoomsReply)
-      if (GetArenaForAllocation() != nullptr) return;
-      SharedDtor();
-      _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+uint8_t* RoomsReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.RoomsReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 epoch = 1;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_epoch(), target);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // int32 wait_ms = 3;
+  if (this->_internal_wait_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_wait_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.RoomsReq)
+  return target;
+}
 
-    inline void RoomsReply::SharedDtor() {
-      GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-    }
+size_t RoomsReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.RoomsReq)
+  size_t total_size = 0;
 
-    void RoomsReply::ArenaDtor(void* object) {
-      RoomsReply* _this = reinterpret_cast<RoomsReply*>(object);
-      (void)_this;
-      _this->rooms_. ~MapField();
-    }
-    inline void RoomsReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena) {
-      if (arena != nullptr) {
-        arena->OwnCustomDestructor(this, &RoomsReply::ArenaDtor);
-      }
-    }
-    void RoomsReply::SetCachedSize(int size) const {
-      _cached_size_.Set(size);
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    void RoomsReply::Clear() {
-      // @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.RoomsReply)
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
+  // uint64 epoch = 1;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+  }
 
-      rooms_.Clear();
-      _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-    }
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // int32 wait_ms = 3;
+  if (this->_internal_wait_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_wait_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomsReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomsReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomsReq::GetClassData() const { return &_class_data_; }
+
+
+void RoomsReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomsReq*>(&to_msg);
+  auto& from = static_cast<const RoomsReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.RoomsReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_wait_ms() != 0) {
+    _this->_internal_set_wait_ms(from._internal_wait_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomsReq::CopyFrom(const RoomsReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.RoomsReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomsReq::IsInitialized() const {
+  return true;
+}
+
+void RoomsReq::InternalSwap(RoomsReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomsReq, _impl_.wait_ms_)
+      + sizeof(RoomsReq::_impl_.wait_ms_)
+      - PROTOBUF_FIELD_OFFSET(RoomsReq, _impl_.epoch_)>(
+          reinterpret_cast<char*>(&_impl_.epoch_),
+          reinterpret_cast<char*>(&other->_impl_.epoch_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomsReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[11]);
+}
+
+// ===================================================================
+
+RoomsReply_RoomsEntry_DoNotUse::RoomsReply_RoomsEntry_DoNotUse() {}
+RoomsReply_RoomsEntry_DoNotUse::RoomsReply_RoomsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void RoomsReply_RoomsEntry_DoNotUse::MergeFrom(const RoomsReply_RoomsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata RoomsReply_RoomsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[12]);
+}
 
-    const char* RoomsReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+// ===================================================================
+
+class RoomsReply::_Internal {
+ public:
+};
+
+RoomsReply::RoomsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &RoomsReply::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.RoomsReply)
+}
+RoomsReply::RoomsReply(const RoomsReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomsReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.rooms_)*/{}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.version_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.version_));
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.RoomsReply)
+}
+
+inline void RoomsReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.rooms_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoomsReply::~RoomsReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.RoomsReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomsReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.Destruct();
+  _impl_.rooms_.~MapField();
+}
+
+void RoomsReply::ArenaDtor(void* object) {
+  RoomsReply* _this = reinterpret_cast< RoomsReply* >(object);
+  _this->_impl_.rooms_.Destruct();
+}
+void RoomsReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomsReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.RoomsReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rooms_.Clear();
+  ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.version_) -
+      reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.version_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomsReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-      while (!ctx->Done(&ptr)) {
-        uint32_t tag;
-        ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-        switch (tag >> 3) {
-          // map<string, bool> rooms = 1;
-        case 1:
-          if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-            ptr -= 1;
-            do {
-              ptr += 1;
-              ptr = ctx->ParseMessage(&rooms_, ptr);
-              CHK_(ptr);
-              if (!ctx->DataAvailable(ptr)) break;
-            } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-          }
-          else
-            goto handle_unusual;
-          continue;
-        default:
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<string, bool> rooms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.rooms_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 epoch = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }  // switch
-      handle_unusual:
-        if ((tag == 0) || ((tag & 7) == 4)) {
+        continue;
+      // uint64 version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          ctx->SetLastTag(tag);
-          goto message_done;
-        }
-        ptr = UnknownFieldParse(
-          tag,
-          _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-          ptr, ctx);
-        CHK_(ptr != nullptr);
-      }  // while
-    message_done:
-      return ptr;
-    failure:
-      ptr = nullptr;
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
       goto message_done;
-#undef CHK_
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-    uint8_t* RoomsReply::_InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-      // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.RoomsReply)
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
+uint8_t* RoomsReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.RoomsReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<string, bool> rooms = 1;
+  if (!this->_internal_rooms().empty()) {
+    using MapType = ::_pb::Map<std::string, bool>;
+    using WireHelper = RoomsReply_RoomsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_rooms();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "ChatRoom.Comet.RoomsReply.RoomsEntry.key");
+    };
 
-      // map<string, bool> rooms = 1;
-      if (!this->_internal_rooms().empty()) {
-        typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >::const_pointer
-          ConstPtr;
-        typedef ConstPtr SortItem;
-        typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
-        struct Utf8Check {
-          static void Check(ConstPtr p) {
-            (void)p;
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-              p->first.data(), static_cast<int>(p->first.length()),
-              ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-              "ChatRoom.Comet.RoomsReply.RoomsEntry.key");
-          }
-        };
-
-        if (stream->IsSerializationDeterministic() &&
-          this->_internal_rooms().size() > 1) {
-          ::std::unique_ptr<SortItem[]> items(
-            new SortItem[this->_internal_rooms().size()]);
-          typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >::size_type size_type;
-          size_type n = 0;
-          for (::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >::const_iterator
-            it = this->_internal_rooms().begin();
-            it != this->_internal_rooms().end(); ++it, ++n) {
-            items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-          }
-          ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-          for (size_type i = 0; i < n; i++) {
-            target = RoomsReply_RoomsEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
-            Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
-          }
-        }
-        else {
-          for (::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >::const_iterator
-            it = this->_internal_rooms().begin();
-            it != this->_internal_rooms().end(); ++it) {
-            target = RoomsReply_RoomsEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
-            Utf8Check::Check(&(*it));
-          }
-        }
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
-
-      if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-        target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-          _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
-      // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.RoomsReply)
-      return target;
     }
+  }
+
+  // uint64 epoch = 2;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_epoch(), target);
+  }
+
+  // uint64 version = 3;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.RoomsReply)
+  return target;
+}
 
-    size_t RoomsReply::ByteSizeLong() const {
-      // @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.RoomsReply)
-      size_t total_size = 0;
+size_t RoomsReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.RoomsReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, bool> rooms = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_rooms_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >::const_iterator
+      it = this->_internal_rooms().begin();
+      it != this->_internal_rooms().end(); ++it) {
+    total_size += RoomsReply_RoomsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // uint64 epoch = 2;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+  }
+
+  // uint64 version = 3;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-      uint32_t cached_has_bits = 0;
-      // Prevent compiler warnings about cached_has_bits being unused
-      (void)cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomsReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomsReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomsReply::GetClassData() const { return &_class_data_; }
+
+
+void RoomsReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomsReply*>(&to_msg);
+  auto& from = static_cast<const RoomsReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.RoomsReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-      // map<string, bool> rooms = 1;
-      total_size += 1 *
-        ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_rooms_size());
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >::const_iterator
-        it = this->_internal_rooms().begin();
-        it != this->_internal_rooms().end(); ++it) {
-        total_size += RoomsReply_RoomsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
-      }
+void RoomsReply::CopyFrom(const RoomsReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.RoomsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-    }
+bool RoomsReply::IsInitialized() const {
+  return true;
+}
 
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomsReply::_class_data_ = {
-        ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-        RoomsReply::MergeImpl
-    };
-    const ::PROTOBUF_NAMESPACE_ID::Message::ClassData* RoomsReply::GetClassData() const { return &_class_data_; }
+void RoomsReply::InternalSwap(RoomsReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomsReply, _impl_.version_)
+      + sizeof(RoomsReply::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(RoomsReply, _impl_.epoch_)>(
+          reinterpret_cast<char*>(&_impl_.epoch_),
+          reinterpret_cast<char*>(&other->_impl_.epoch_));
+}
 
-    void RoomsReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-      static_cast<RoomsReply*>(to)->MergeFrom(
-        static_cast<const RoomsReply&>(from));
-    }
+::PROTOBUF_NAMESPACE_ID::Metadata RoomsReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[13]);
+}
 
+// ===================================================================
 
-    void RoomsReply::MergeFrom(const RoomsReply& from) {
-      // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.RoomsReply)
-      GOOGLE_DCHECK_NE(&from, this);
-      uint32_t cached_has_bits = 0;
-      (void)cached_has_bits;
+class UsersReq::_Internal {
+ public:
+};
 
-      rooms_.MergeFrom(from.rooms_);
-      _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-    }
+UsersReq::UsersReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.UsersReq)
+}
+UsersReq::UsersReq(const UsersReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UsersReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.epoch_){}
+    , decltype(_impl_.since_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.since_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.since_));
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.UsersReq)
+}
 
-    void RoomsReply::CopyFrom(const RoomsReply& from) {
-      // @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.RoomsReply)
-      if (&from == this) return;
-      Clear();
-      MergeFrom(from);
-    }
+inline void UsersReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.since_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
-    bool RoomsReply::IsInitialized() const {
-      return true;
-    }
+UsersReq::~UsersReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.UsersReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UsersReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void UsersReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UsersReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.UsersReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    void RoomsReply::InternalSwap(RoomsReply* other) {
-      using std::swap;
-      _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-      rooms_.InternalSwap(&other->rooms_);
+  ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.since_) -
+      reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.since_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UsersReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 epoch = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 since = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.since_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UsersReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.UsersReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 epoch = 1;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_epoch(), target);
+  }
+
+  // uint64 since = 2;
+  if (this->_internal_since() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_since(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.UsersReq)
+  return target;
+}
+
+size_t UsersReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.UsersReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 epoch = 1;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+  }
+
+  // uint64 since = 2;
+  if (this->_internal_since() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_since());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UsersReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UsersReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UsersReq::GetClassData() const { return &_class_data_; }
+
+
+void UsersReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UsersReq*>(&to_msg);
+  auto& from = static_cast<const UsersReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.UsersReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  if (from._internal_since() != 0) {
+    _this->_internal_set_since(from._internal_since());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UsersReq::CopyFrom(const UsersReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.UsersReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UsersReq::IsInitialized() const {
+  return true;
+}
+
+void UsersReq::InternalSwap(UsersReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UsersReq, _impl_.since_)
+      + sizeof(UsersReq::_impl_.since_)
+      - PROTOBUF_FIELD_OFFSET(UsersReq, _impl_.epoch_)>(
+          reinterpret_cast<char*>(&_impl_.epoch_),
+          reinterpret_cast<char*>(&other->_impl_.epoch_));
+}
 
-    ::PROTOBUF_NAMESPACE_ID::Metadata RoomsReply::GetMetadata() const {
-      return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
-        &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
-        file_level_metadata_ChatRoom_2eComet_2eproto[8]);
+::PROTOBUF_NAMESPACE_ID::Metadata UsersReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[14]);
+}
+
+// ===================================================================
+
+class UsersReply::_Internal {
+ public:
+};
+
+UsersReply::UsersReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Comet.UsersReply)
+}
+UsersReply::UsersReply(const UsersReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UsersReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.online_){from._impl_.online_}
+    , decltype(_impl_.offline_){from._impl_.offline_}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.full_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.full_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.full_));
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Comet.UsersReply)
+}
+
+inline void UsersReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.online_){arena}
+    , decltype(_impl_.offline_){arena}
+    , decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.full_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+UsersReply::~UsersReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Comet.UsersReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UsersReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.online_.~RepeatedPtrField();
+  _impl_.offline_.~RepeatedPtrField();
+}
+
+void UsersReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UsersReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Comet.UsersReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.online_.Clear();
+  _impl_.offline_.Clear();
+  ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.full_) -
+      reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.full_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UsersReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 epoch = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool full = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.full_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string online = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_online();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Comet.UsersReply.online"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string offline = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_offline();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Comet.UsersReply.offline"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UsersReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Comet.UsersReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 epoch = 1;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_epoch(), target);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // bool full = 3;
+  if (this->_internal_full() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_full(), target);
+  }
+
+  // repeated string online = 4;
+  for (int i = 0, n = this->_internal_online_size(); i < n; i++) {
+    const auto& s = this->_internal_online(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Comet.UsersReply.online");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // repeated string offline = 5;
+  for (int i = 0, n = this->_internal_offline_size(); i < n; i++) {
+    const auto& s = this->_internal_offline(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Comet.UsersReply.offline");
+    target = stream->WriteString(5, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Comet.UsersReply)
+  return target;
+}
+
+size_t UsersReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Comet.UsersReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string online = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.online_.size());
+  for (int i = 0, n = _impl_.online_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.online_.Get(i));
+  }
+
+  // repeated string offline = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.offline_.size());
+  for (int i = 0, n = _impl_.offline_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.offline_.Get(i));
+  }
+
+  // uint64 epoch = 1;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // bool full = 3;
+  if (this->_internal_full() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UsersReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UsersReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UsersReply::GetClassData() const { return &_class_data_; }
+
+
+void UsersReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UsersReply*>(&to_msg);
+  auto& from = static_cast<const UsersReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Comet.UsersReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.online_.MergeFrom(from._impl_.online_);
+  _this->_impl_.offline_.MergeFrom(from._impl_.offline_);
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_full() != 0) {
+    _this->_internal_set_full(from._internal_full());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UsersReply::CopyFrom(const UsersReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Comet.UsersReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-    // @@protoc_insertion_point(namespace_scope)
-  }  // namespace Comet
+bool UsersReply::IsInitialized() const {
+  return true;
+}
+
+void UsersReply::InternalSwap(UsersReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.online_.InternalSwap(&other->_impl_.online_);
+  _impl_.offline_.InternalSwap(&other->_impl_.offline_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UsersReply, _impl_.full_)
+      + sizeof(UsersReply::_impl_.full_)
+      - PROTOBUF_FIELD_OFFSET(UsersReply, _impl_.epoch_)>(
+          reinterpret_cast<char*>(&_impl_.epoch_),
+          reinterpret_cast<char*>(&other->_impl_.epoch_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UsersReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eComet_2eproto_getter, &descriptor_table_ChatRoom_2eComet_2eproto_once,
+      file_level_metadata_ChatRoom_2eComet_2eproto[15]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Comet
 }  // namespace ChatRoom
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::PushMsgReq* Arena::CreateMaybeMessage< ::ChatRoom::Comet::PushMsgReq >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::PushMsgReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::PushMsgReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::PushMsgReq >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::PushMsgReply* Arena::CreateMaybeMessage< ::ChatRoom::Comet::PushMsgReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::PushMsgReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::PushMsgReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::PushMsgReply >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::BroadcastReq* Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastReq >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::BroadcastReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::BroadcastReq >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::BroadcastReply* Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::BroadcastReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::BroadcastReply >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::BroadcastRoomReq* Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastRoomReq >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::BroadcastRoomReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastRoomReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::BroadcastRoomReq >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::BroadcastRoomReply* Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastRoomReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::BroadcastRoomReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastRoomReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::BroadcastRoomReply >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::RoomsReq* Arena::CreateMaybeMessage< ::ChatRoom::Comet::RoomsReq >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::BroadcastRoomBatchReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastRoomBatchReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Comet::BroadcastRoomBatchReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::BroadcastRoomBatchReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::BroadcastRoomBatchReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Comet::BroadcastRoomBatchReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::PushItem*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::PushItem >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Comet::PushItem >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::PushBatch*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::PushBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Comet::PushBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::PushAck*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::PushAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Comet::PushAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::RoomsReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::RoomsReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::RoomsReq >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse* Arena::CreateMaybeMessage< ::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse >(arena);
 }
-template<> PROTOBUF_NOINLINE::ChatRoom::Comet::RoomsReply* Arena::CreateMaybeMessage< ::ChatRoom::Comet::RoomsReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::RoomsReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::RoomsReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Comet::RoomsReply >(arena);
 }
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::UsersReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::UsersReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Comet::UsersReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Comet::UsersReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Comet::UsersReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Comet::UsersReply >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -0,0 +1,298 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: ChatRoom.Logic.proto
+
+#include "ChatRoom.Logic.pb.h"
+#include "ChatRoom.Logic.grpc.pb.h"
+
+#include <functional>
+#include <grpcpp/impl/codegen/async_stream.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+#include <grpcpp/impl/codegen/channel_interface.h>
+#include <grpcpp/impl/codegen/client_unary_call.h>
+#include <grpcpp/impl/codegen/client_callback.h>
+#include <grpcpp/impl/codegen/message_allocator.h>
+#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/impl/codegen/rpc_service_method.h>
+#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_context.h>
+#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/impl/codegen/sync_stream.h>
+namespace ChatRoom {
+namespace Logic {
+
+static const char* Logic_method_names[] = {
+  "/ChatRoom.Logic.Logic/Verify",
+  "/ChatRoom.Logic.Logic/Hello",
+  "/ChatRoom.Logic.Logic/Send",
+  "/ChatRoom.Logic.Logic/RoomHistory",
+  "/ChatRoom.Logic.Logic/CreateRoom",
+  "/ChatRoom.Logic.Logic/Rooms",
+};
+
+std::unique_ptr< Logic::Stub> Logic::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< Logic::Stub> stub(new Logic::Stub(channel, options));
+  return stub;
+}
+
+Logic::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_Verify_(Logic_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Hello_(Logic_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Send_(Logic_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_RoomHistory_(Logic_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CreateRoom_(Logic_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Rooms_(Logic_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  {}
+
+::grpc::Status Logic::Stub::Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::ChatRoom::Logic::VerifyReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Verify_, context, request, response);
+}
+
+void Logic::Stub::async::Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Verify_, context, request, response, std::move(f));
+}
+
+void Logic::Stub::async::Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Verify_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>* Logic::Stub::PrepareAsyncVerifyRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Logic::VerifyReply, ::ChatRoom::Logic::VerifyReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Verify_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>* Logic::Stub::AsyncVerifyRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncVerifyRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status Logic::Stub::Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::ChatRoom::Logic::HelloReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Hello_, context, request, response);
+}
+
+void Logic::Stub::async::Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Hello_, context, request, response, std::move(f));
+}
+
+void Logic::Stub::async::Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Hello_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>* Logic::Stub::PrepareAsyncHelloRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Logic::HelloReply, ::ChatRoom::Logic::HelloReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Hello_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>* Logic::Stub::AsyncHelloRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncHelloRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status Logic::Stub::Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::ChatRoom::Logic::SendReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Send_, context, request, response);
+}
+
+void Logic::Stub::async::Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Send_, context, request, response, std::move(f));
+}
+
+void Logic::Stub::async::Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Send_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>* Logic::Stub::PrepareAsyncSendRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Logic::SendReply, ::ChatRoom::Logic::SendReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Send_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>* Logic::Stub::AsyncSendRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSendRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status Logic::Stub::RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::ChatRoom::Logic::RoomHistoryReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RoomHistory_, context, request, response);
+}
+
+void Logic::Stub::async::RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RoomHistory_, context, request, response, std::move(f));
+}
+
+void Logic::Stub::async::RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RoomHistory_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>* Logic::Stub::PrepareAsyncRoomHistoryRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Logic::RoomHistoryReply, ::ChatRoom::Logic::RoomHistoryReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RoomHistory_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>* Logic::Stub::AsyncRoomHistoryRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRoomHistoryRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status Logic::Stub::CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::ChatRoom::Logic::CreateRoomReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_CreateRoom_, context, request, response);
+}
+
+void Logic::Stub::async::CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CreateRoom_, context, request, response, std::move(f));
+}
+
+void Logic::Stub::async::CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CreateRoom_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>* Logic::Stub::PrepareAsyncCreateRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Logic::CreateRoomReply, ::ChatRoom::Logic::CreateRoomReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_CreateRoom_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>* Logic::Stub::AsyncCreateRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncCreateRoomRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status Logic::Stub::Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::ChatRoom::Logic::RoomsReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Rooms_, context, request, response);
+}
+
+void Logic::Stub::async::Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Rooms_, context, request, response, std::move(f));
+}
+
+void Logic::Stub::async::Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Rooms_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>* Logic::Stub::PrepareAsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Logic::RoomsReply, ::ChatRoom::Logic::RoomsReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Rooms_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>* Logic::Stub::AsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRoomsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+Logic::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Logic_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Logic::Service, ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Logic::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Logic::VerifyReq* req,
+             ::ChatRoom::Logic::VerifyReply* resp) {
+               return service->Verify(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Logic_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Logic::Service, ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Logic::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Logic::HelloReq* req,
+             ::ChatRoom::Logic::HelloReply* resp) {
+               return service->Hello(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Logic_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Logic::Service, ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Logic::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Logic::SendReq* req,
+             ::ChatRoom::Logic::SendReply* resp) {
+               return service->Send(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Logic_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Logic::Service, ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Logic::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Logic::RoomHistoryReq* req,
+             ::ChatRoom::Logic::RoomHistoryReply* resp) {
+               return service->RoomHistory(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Logic_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Logic::Service, ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Logic::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Logic::CreateRoomReq* req,
+             ::ChatRoom::Logic::CreateRoomReply* resp) {
+               return service->CreateRoom(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Logic_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Logic::Service, ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Logic::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Logic::RoomsReq* req,
+             ::ChatRoom::Logic::RoomsReply* resp) {
+               return service->Rooms(ctx, req, resp);
+             }, this)));
+}
+
+Logic::Service::~Service() {
+}
+
+::grpc::Status Logic::Service::Verify(::grpc::ServerContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Logic::Service::Hello(::grpc::ServerContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Logic::Service::Send(::grpc::ServerContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Logic::Service::RoomHistory(::grpc::ServerContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Logic::Service::CreateRoom(::grpc::ServerContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Logic::Service::Rooms(::grpc::ServerContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+}  // namespace ChatRoom
+}  // namespace Logic
+
@@ -0,0 +1,4918 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ChatRoom.Logic.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ChatRoom_2eLogic_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ChatRoom_2eLogic_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ChatRoom_2eLogic_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ChatRoom_2eLogic_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ChatRoom_2eLogic_2eproto;
+namespace ChatRoom {
+namespace Logic {
+class ChatMessage;
+struct ChatMessageDefaultTypeInternal;
+extern ChatMessageDefaultTypeInternal _ChatMessage_default_instance_;
+class CreateRoomReply;
+struct CreateRoomReplyDefaultTypeInternal;
+extern CreateRoomReplyDefaultTypeInternal _CreateRoomReply_default_instance_;
+class CreateRoomReq;
+struct CreateRoomReqDefaultTypeInternal;
+extern CreateRoomReqDefaultTypeInternal _CreateRoomReq_default_instance_;
+class HelloReply;
+struct HelloReplyDefaultTypeInternal;
+extern HelloReplyDefaultTypeInternal _HelloReply_default_instance_;
+class HelloReq;
+struct HelloReqDefaultTypeInternal;
+extern HelloReqDefaultTypeInternal _HelloReq_default_instance_;
+class RoomHistoryReply;
+struct RoomHistoryReplyDefaultTypeInternal;
+extern RoomHistoryReplyDefaultTypeInternal _RoomHistoryReply_default_instance_;
+class RoomHistoryReq;
+struct RoomHistoryReqDefaultTypeInternal;
+extern RoomHistoryReqDefaultTypeInternal _RoomHistoryReq_default_instance_;
+class RoomInfo;
+struct RoomInfoDefaultTypeInternal;
+extern RoomInfoDefaultTypeInternal _RoomInfo_default_instance_;
+class RoomMessages;
+struct RoomMessagesDefaultTypeInternal;
+extern RoomMessagesDefaultTypeInternal _RoomMessages_default_instance_;
+class RoomsReply;
+struct RoomsReplyDefaultTypeInternal;
+extern RoomsReplyDefaultTypeInternal _RoomsReply_default_instance_;
+class RoomsReq;
+struct RoomsReqDefaultTypeInternal;
+extern RoomsReqDefaultTypeInternal _RoomsReq_default_instance_;
+class SendReply;
+struct SendReplyDefaultTypeInternal;
+extern SendReplyDefaultTypeInternal _SendReply_default_instance_;
+class SendReq;
+struct SendReqDefaultTypeInternal;
+extern SendReqDefaultTypeInternal _SendReq_default_instance_;
+class User;
+struct UserDefaultTypeInternal;
+extern UserDefaultTypeInternal _User_default_instance_;
+class VerifyReply;
+struct VerifyReplyDefaultTypeInternal;
+extern VerifyReplyDefaultTypeInternal _VerifyReply_default_instance_;
+class VerifyReq;
+struct VerifyReqDefaultTypeInternal;
+extern VerifyReqDefaultTypeInternal _VerifyReq_default_instance_;
+}  // namespace Logic
+}  // namespace ChatRoom
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ChatRoom::Logic::ChatMessage* Arena::CreateMaybeMessage<::ChatRoom::Logic::ChatMessage>(Arena*);
+template<> ::ChatRoom::Logic::CreateRoomReply* Arena::CreateMaybeMessage<::ChatRoom::Logic::CreateRoomReply>(Arena*);
+template<> ::ChatRoom::Logic::CreateRoomReq* Arena::CreateMaybeMessage<::ChatRoom::Logic::CreateRoomReq>(Arena*);
+template<> ::ChatRoom::Logic::HelloReply* Arena::CreateMaybeMessage<::ChatRoom::Logic::HelloReply>(Arena*);
+template<> ::ChatRoom::Logic::HelloReq* Arena::CreateMaybeMessage<::ChatRoom::Logic::HelloReq>(Arena*);
+template<> ::ChatRoom::Logic::RoomHistoryReply* Arena::CreateMaybeMessage<::ChatRoom::Logic::RoomHistoryReply>(Arena*);
+template<> ::ChatRoom::Logic::RoomHistoryReq* Arena::CreateMaybeMessage<::ChatRoom::Logic::RoomHistoryReq>(Arena*);
+template<> ::ChatRoom::Logic::RoomInfo* Arena::CreateMaybeMessage<::ChatRoom::Logic::RoomInfo>(Arena*);
+template<> ::ChatRoom::Logic::RoomMessages* Arena::CreateMaybeMessage<::ChatRoom::Logic::RoomMessages>(Arena*);
+template<> ::ChatRoom::Logic::RoomsReply* Arena::CreateMaybeMessage<::ChatRoom::Logic::RoomsReply>(Arena*);
+template<> ::ChatRoom::Logic::RoomsReq* Arena::CreateMaybeMessage<::ChatRoom::Logic::RoomsReq>(Arena*);
+template<> ::ChatRoom::Logic::SendReply* Arena::CreateMaybeMessage<::ChatRoom::Logic::SendReply>(Arena*);
+template<> ::ChatRoom::Logic::SendReq* Arena::CreateMaybeMessage<::ChatRoom::Logic::SendReq>(Arena*);
+template<> ::ChatRoom::Logic::User* Arena::CreateMaybeMessage<::ChatRoom::Logic::User>(Arena*);
+template<> ::ChatRoom::Logic::VerifyReply* Arena::CreateMaybeMessage<::ChatRoom::Logic::VerifyReply>(Arena*);
+template<> ::ChatRoom::Logic::VerifyReq* Arena::CreateMaybeMessage<::ChatRoom::Logic::VerifyReq>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ChatRoom {
+namespace Logic {
+
+// ===================================================================
+
+class User final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.User) */ {
+ public:
+  inline User() : User(nullptr) {}
+  ~User() override;
+  explicit PROTOBUF_CONSTEXPR User(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  User(const User& from);
+  User(User&& from) noexcept
+    : User() {
+    *this = ::std::move(from);
+  }
+
+  inline User& operator=(const User& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline User& operator=(User&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const User& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const User* internal_default_instance() {
+    return reinterpret_cast<const User*>(
+               &_User_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(User& a, User& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(User* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(User* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<User>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const User& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const User& from) {
+    User::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(User* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.User";
+  }
+  protected:
+  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kUsernameFieldNumber = 2,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string username = 2;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.User)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChatMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.ChatMessage) */ {
+ public:
+  inline ChatMessage() : ChatMessage(nullptr) {}
+  ~ChatMessage() override;
+  explicit PROTOBUF_CONSTEXPR ChatMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChatMessage(const ChatMessage& from);
+  ChatMessage(ChatMessage&& from) noexcept
+    : ChatMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ChatMessage& operator=(const ChatMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChatMessage& operator=(ChatMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChatMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChatMessage* internal_default_instance() {
+    return reinterpret_cast<const ChatMessage*>(
+               &_ChatMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ChatMessage& a, ChatMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChatMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChatMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChatMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChatMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChatMessage& from) {
+    ChatMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChatMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.ChatMessage";
+  }
+  protected:
+  explicit ChatMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kContentFieldNumber = 2,
+    kUserFieldNumber = 3,
+    kTimestampFieldNumber = 4,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string content = 2;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // .ChatRoom.Logic.User user = 3;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::ChatRoom::Logic::User& user() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::User* release_user();
+  ::ChatRoom::Logic::User* mutable_user();
+  void set_allocated_user(::ChatRoom::Logic::User* user);
+  private:
+  const ::ChatRoom::Logic::User& _internal_user() const;
+  ::ChatRoom::Logic::User* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::ChatRoom::Logic::User* user);
+  ::ChatRoom::Logic::User* unsafe_arena_release_user();
+
+  // uint64 timestamp = 4;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.ChatMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::ChatRoom::Logic::User* user_;
+    uint64_t timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.RoomInfo) */ {
+ public:
+  inline RoomInfo() : RoomInfo(nullptr) {}
+  ~RoomInfo() override;
+  explicit PROTOBUF_CONSTEXPR RoomInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomInfo(const RoomInfo& from);
+  RoomInfo(RoomInfo&& from) noexcept
+    : RoomInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomInfo& operator=(const RoomInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomInfo& operator=(RoomInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomInfo* internal_default_instance() {
+    return reinterpret_cast<const RoomInfo*>(
+               &_RoomInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(RoomInfo& a, RoomInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomInfo& from) {
+    RoomInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.RoomInfo";
+  }
+  protected:
+  explicit RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kNameFieldNumber = 2,
+    kCreatorIDFieldNumber = 3,
+    kCreateTimeFieldNumber = 4,
+    kUpdateTimeFieldNumber = 5,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string creatorID = 3;
+  void clear_creatorid();
+  const std::string& creatorid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_creatorid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_creatorid();
+  PROTOBUF_NODISCARD std::string* release_creatorid();
+  void set_allocated_creatorid(std::string* creatorid);
+  private:
+  const std::string& _internal_creatorid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_creatorid(const std::string& value);
+  std::string* _internal_mutable_creatorid();
+  public:
+
+  // string createTime = 4;
+  void clear_createtime();
+  const std::string& createtime() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_createtime(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_createtime();
+  PROTOBUF_NODISCARD std::string* release_createtime();
+  void set_allocated_createtime(std::string* createtime);
+  private:
+  const std::string& _internal_createtime() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_createtime(const std::string& value);
+  std::string* _internal_mutable_createtime();
+  public:
+
+  // string updateTime = 5;
+  void clear_updatetime();
+  const std::string& updatetime() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_updatetime(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_updatetime();
+  PROTOBUF_NODISCARD std::string* release_updatetime();
+  void set_allocated_updatetime(std::string* updatetime);
+  private:
+  const std::string& _internal_updatetime() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_updatetime(const std::string& value);
+  std::string* _internal_mutable_updatetime();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.RoomInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr creatorid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr createtime_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr updatetime_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomMessages final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.RoomMessages) */ {
+ public:
+  inline RoomMessages() : RoomMessages(nullptr) {}
+  ~RoomMessages() override;
+  explicit PROTOBUF_CONSTEXPR RoomMessages(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomMessages(const RoomMessages& from);
+  RoomMessages(RoomMessages&& from) noexcept
+    : RoomMessages() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomMessages& operator=(const RoomMessages& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomMessages& operator=(RoomMessages&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomMessages& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomMessages* internal_default_instance() {
+    return reinterpret_cast<const RoomMessages*>(
+               &_RoomMessages_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RoomMessages& a, RoomMessages& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomMessages* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomMessages* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomMessages* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomMessages>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomMessages& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomMessages& from) {
+    RoomMessages::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomMessages* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.RoomMessages";
+  }
+  protected:
+  explicit RoomMessages(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 3,
+    kRoomFieldNumber = 1,
+    kHasMoreMessagesFieldNumber = 2,
+  };
+  // repeated .ChatRoom.Logic.ChatMessage messages = 3;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::ChatRoom::Logic::ChatMessage* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >*
+      mutable_messages();
+  private:
+  const ::ChatRoom::Logic::ChatMessage& _internal_messages(int index) const;
+  ::ChatRoom::Logic::ChatMessage* _internal_add_messages();
+  public:
+  const ::ChatRoom::Logic::ChatMessage& messages(int index) const;
+  ::ChatRoom::Logic::ChatMessage* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >&
+      messages() const;
+
+  // .ChatRoom.Logic.RoomInfo room = 1;
+  bool has_room() const;
+  private:
+  bool _internal_has_room() const;
+  public:
+  void clear_room();
+  const ::ChatRoom::Logic::RoomInfo& room() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::RoomInfo* release_room();
+  ::ChatRoom::Logic::RoomInfo* mutable_room();
+  void set_allocated_room(::ChatRoom::Logic::RoomInfo* room);
+  private:
+  const ::ChatRoom::Logic::RoomInfo& _internal_room() const;
+  ::ChatRoom::Logic::RoomInfo* _internal_mutable_room();
+  public:
+  void unsafe_arena_set_allocated_room(
+      ::ChatRoom::Logic::RoomInfo* room);
+  ::ChatRoom::Logic::RoomInfo* unsafe_arena_release_room();
+
+  // bool hasMoreMessages = 2;
+  void clear_hasmoremessages();
+  bool hasmoremessages() const;
+  void set_hasmoremessages(bool value);
+  private:
+  bool _internal_hasmoremessages() const;
+  void _internal_set_hasmoremessages(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.RoomMessages)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage > messages_;
+    ::ChatRoom::Logic::RoomInfo* room_;
+    bool hasmoremessages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VerifyReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.VerifyReq) */ {
+ public:
+  inline VerifyReq() : VerifyReq(nullptr) {}
+  ~VerifyReq() override;
+  explicit PROTOBUF_CONSTEXPR VerifyReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VerifyReq(const VerifyReq& from);
+  VerifyReq(VerifyReq&& from) noexcept
+    : VerifyReq() {
+    *this = ::std::move(from);
+  }
+
+  inline VerifyReq& operator=(const VerifyReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VerifyReq& operator=(VerifyReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VerifyReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VerifyReq* internal_default_instance() {
+    return reinterpret_cast<const VerifyReq*>(
+               &_VerifyReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(VerifyReq& a, VerifyReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VerifyReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VerifyReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VerifyReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VerifyReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VerifyReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VerifyReq& from) {
+    VerifyReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VerifyReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.VerifyReq";
+  }
+  protected:
+  explicit VerifyReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCookieFieldNumber = 1,
+  };
+  // string cookie = 1;
+  void clear_cookie();
+  const std::string& cookie() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cookie(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cookie();
+  PROTOBUF_NODISCARD std::string* release_cookie();
+  void set_allocated_cookie(std::string* cookie);
+  private:
+  const std::string& _internal_cookie() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cookie(const std::string& value);
+  std::string* _internal_mutable_cookie();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.VerifyReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cookie_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VerifyReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.VerifyReply) */ {
+ public:
+  inline VerifyReply() : VerifyReply(nullptr) {}
+  ~VerifyReply() override;
+  explicit PROTOBUF_CONSTEXPR VerifyReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VerifyReply(const VerifyReply& from);
+  VerifyReply(VerifyReply&& from) noexcept
+    : VerifyReply() {
+    *this = ::std::move(from);
+  }
+
+  inline VerifyReply& operator=(const VerifyReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VerifyReply& operator=(VerifyReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VerifyReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VerifyReply* internal_default_instance() {
+    return reinterpret_cast<const VerifyReply*>(
+               &_VerifyReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(VerifyReply& a, VerifyReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VerifyReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VerifyReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VerifyReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VerifyReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VerifyReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VerifyReply& from) {
+    VerifyReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VerifyReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.VerifyReply";
+  }
+  protected:
+  explicit VerifyReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEmailFieldNumber = 3,
+    kErrorFieldNumber = 4,
+    kUserFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+  };
+  // string email = 3;
+  void clear_email();
+  const std::string& email() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_email(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_email();
+  PROTOBUF_NODISCARD std::string* release_email();
+  void set_allocated_email(std::string* email);
+  private:
+  const std::string& _internal_email() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(const std::string& value);
+  std::string* _internal_mutable_email();
+  public:
+
+  // string error = 4;
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .ChatRoom.Logic.User user = 2;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::ChatRoom::Logic::User& user() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::User* release_user();
+  ::ChatRoom::Logic::User* mutable_user();
+  void set_allocated_user(::ChatRoom::Logic::User* user);
+  private:
+  const ::ChatRoom::Logic::User& _internal_user() const;
+  ::ChatRoom::Logic::User* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::ChatRoom::Logic::User* user);
+  ::ChatRoom::Logic::User* unsafe_arena_release_user();
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.VerifyReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::ChatRoom::Logic::User* user_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HelloReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.HelloReq) */ {
+ public:
+  inline HelloReq() : HelloReq(nullptr) {}
+  ~HelloReq() override;
+  explicit PROTOBUF_CONSTEXPR HelloReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HelloReq(const HelloReq& from);
+  HelloReq(HelloReq&& from) noexcept
+    : HelloReq() {
+    *this = ::std::move(from);
+  }
+
+  inline HelloReq& operator=(const HelloReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HelloReq& operator=(HelloReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HelloReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HelloReq* internal_default_instance() {
+    return reinterpret_cast<const HelloReq*>(
+               &_HelloReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(HelloReq& a, HelloReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HelloReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HelloReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HelloReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HelloReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HelloReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HelloReq& from) {
+    HelloReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HelloReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.HelloReq";
+  }
+  protected:
+  explicit HelloReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserFieldNumber = 1,
+  };
+  // .ChatRoom.Logic.User user = 1;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::ChatRoom::Logic::User& user() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::User* release_user();
+  ::ChatRoom::Logic::User* mutable_user();
+  void set_allocated_user(::ChatRoom::Logic::User* user);
+  private:
+  const ::ChatRoom::Logic::User& _internal_user() const;
+  ::ChatRoom::Logic::User* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::ChatRoom::Logic::User* user);
+  ::ChatRoom::Logic::User* unsafe_arena_release_user();
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.HelloReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::ChatRoom::Logic::User* user_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HelloReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.HelloReply) */ {
+ public:
+  inline HelloReply() : HelloReply(nullptr) {}
+  ~HelloReply() override;
+  explicit PROTOBUF_CONSTEXPR HelloReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HelloReply(const HelloReply& from);
+  HelloReply(HelloReply&& from) noexcept
+    : HelloReply() {
+    *this = ::std::move(from);
+  }
+
+  inline HelloReply& operator=(const HelloReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HelloReply& operator=(HelloReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HelloReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HelloReply* internal_default_instance() {
+    return reinterpret_cast<const HelloReply*>(
+               &_HelloReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(HelloReply& a, HelloReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HelloReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HelloReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HelloReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HelloReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HelloReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HelloReply& from) {
+    HelloReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HelloReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.HelloReply";
+  }
+  protected:
+  explicit HelloReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomsFieldNumber = 1,
+  };
+  // repeated .ChatRoom.Logic.RoomMessages rooms = 1;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  ::ChatRoom::Logic::RoomMessages* mutable_rooms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomMessages >*
+      mutable_rooms();
+  private:
+  const ::ChatRoom::Logic::RoomMessages& _internal_rooms(int index) const;
+  ::ChatRoom::Logic::RoomMessages* _internal_add_rooms();
+  public:
+  const ::ChatRoom::Logic::RoomMessages& rooms(int index) const;
+  ::ChatRoom::Logic::RoomMessages* add_rooms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomMessages >&
+      rooms() const;
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.HelloReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomMessages > rooms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.SendReq) */ {
+ public:
+  inline SendReq() : SendReq(nullptr) {}
+  ~SendReq() override;
+  explicit PROTOBUF_CONSTEXPR SendReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendReq(const SendReq& from);
+  SendReq(SendReq&& from) noexcept
+    : SendReq() {
+    *this = ::std::move(from);
+  }
+
+  inline SendReq& operator=(const SendReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendReq& operator=(SendReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendReq* internal_default_instance() {
+    return reinterpret_cast<const SendReq*>(
+               &_SendReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SendReq& a, SendReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendReq& from) {
+    SendReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.SendReq";
+  }
+  protected:
+  explicit SendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentsFieldNumber = 3,
+    kRoomIDFieldNumber = 1,
+    kUserFieldNumber = 2,
+  };
+  // repeated string contents = 3;
+  int contents_size() const;
+  private:
+  int _internal_contents_size() const;
+  public:
+  void clear_contents();
+  const std::string& contents(int index) const;
+  std::string* mutable_contents(int index);
+  void set_contents(int index, const std::string& value);
+  void set_contents(int index, std::string&& value);
+  void set_contents(int index, const char* value);
+  void set_contents(int index, const char* value, size_t size);
+  std::string* add_contents();
+  void add_contents(const std::string& value);
+  void add_contents(std::string&& value);
+  void add_contents(const char* value);
+  void add_contents(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contents();
+  private:
+  const std::string& _internal_contents(int index) const;
+  std::string* _internal_add_contents();
+  public:
+
+  // string roomID = 1;
+  void clear_roomid();
+  const std::string& roomid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_roomid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_roomid();
+  PROTOBUF_NODISCARD std::string* release_roomid();
+  void set_allocated_roomid(std::string* roomid);
+  private:
+  const std::string& _internal_roomid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_roomid(const std::string& value);
+  std::string* _internal_mutable_roomid();
+  public:
+
+  // .ChatRoom.Logic.User user = 2;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::ChatRoom::Logic::User& user() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::User* release_user();
+  ::ChatRoom::Logic::User* mutable_user();
+  void set_allocated_user(::ChatRoom::Logic::User* user);
+  private:
+  const ::ChatRoom::Logic::User& _internal_user() const;
+  ::ChatRoom::Logic::User* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::ChatRoom::Logic::User* user);
+  ::ChatRoom::Logic::User* unsafe_arena_release_user();
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.SendReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contents_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr roomid_;
+    ::ChatRoom::Logic::User* user_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.SendReply) */ {
+ public:
+  inline SendReply() : SendReply(nullptr) {}
+  ~SendReply() override;
+  explicit PROTOBUF_CONSTEXPR SendReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendReply(const SendReply& from);
+  SendReply(SendReply&& from) noexcept
+    : SendReply() {
+    *this = ::std::move(from);
+  }
+
+  inline SendReply& operator=(const SendReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendReply& operator=(SendReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendReply* internal_default_instance() {
+    return reinterpret_cast<const SendReply*>(
+               &_SendReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(SendReply& a, SendReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendReply& from) {
+    SendReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.SendReply";
+  }
+  protected:
+  explicit SendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .ChatRoom.Logic.ChatMessage messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::ChatRoom::Logic::ChatMessage* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >*
+      mutable_messages();
+  private:
+  const ::ChatRoom::Logic::ChatMessage& _internal_messages(int index) const;
+  ::ChatRoom::Logic::ChatMessage* _internal_add_messages();
+  public:
+  const ::ChatRoom::Logic::ChatMessage& messages(int index) const;
+  ::ChatRoom::Logic::ChatMessage* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >&
+      messages() const;
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.SendReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomHistoryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.RoomHistoryReq) */ {
+ public:
+  inline RoomHistoryReq() : RoomHistoryReq(nullptr) {}
+  ~RoomHistoryReq() override;
+  explicit PROTOBUF_CONSTEXPR RoomHistoryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomHistoryReq(const RoomHistoryReq& from);
+  RoomHistoryReq(RoomHistoryReq&& from) noexcept
+    : RoomHistoryReq() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomHistoryReq& operator=(const RoomHistoryReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomHistoryReq& operator=(RoomHistoryReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomHistoryReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomHistoryReq* internal_default_instance() {
+    return reinterpret_cast<const RoomHistoryReq*>(
+               &_RoomHistoryReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(RoomHistoryReq& a, RoomHistoryReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomHistoryReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomHistoryReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomHistoryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomHistoryReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomHistoryReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomHistoryReq& from) {
+    RoomHistoryReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomHistoryReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.RoomHistoryReq";
+  }
+  protected:
+  explicit RoomHistoryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomIDFieldNumber = 1,
+    kFirstMessageIDFieldNumber = 2,
+    kUserFieldNumber = 4,
+    kCountFieldNumber = 3,
+  };
+  // string roomID = 1;
+  void clear_roomid();
+  const std::string& roomid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_roomid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_roomid();
+  PROTOBUF_NODISCARD std::string* release_roomid();
+  void set_allocated_roomid(std::string* roomid);
+  private:
+  const std::string& _internal_roomid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_roomid(const std::string& value);
+  std::string* _internal_mutable_roomid();
+  public:
+
+  // string firstMessageID = 2;
+  void clear_firstmessageid();
+  const std::string& firstmessageid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_firstmessageid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_firstmessageid();
+  PROTOBUF_NODISCARD std::string* release_firstmessageid();
+  void set_allocated_firstmessageid(std::string* firstmessageid);
+  private:
+  const std::string& _internal_firstmessageid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_firstmessageid(const std::string& value);
+  std::string* _internal_mutable_firstmessageid();
+  public:
+
+  // .ChatRoom.Logic.User user = 4;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::ChatRoom::Logic::User& user() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::User* release_user();
+  ::ChatRoom::Logic::User* mutable_user();
+  void set_allocated_user(::ChatRoom::Logic::User* user);
+  private:
+  const ::ChatRoom::Logic::User& _internal_user() const;
+  ::ChatRoom::Logic::User* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::ChatRoom::Logic::User* user);
+  ::ChatRoom::Logic::User* unsafe_arena_release_user();
+
+  // int32 count = 3;
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.RoomHistoryReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr roomid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr firstmessageid_;
+    ::ChatRoom::Logic::User* user_;
+    int32_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomHistoryReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.RoomHistoryReply) */ {
+ public:
+  inline RoomHistoryReply() : RoomHistoryReply(nullptr) {}
+  ~RoomHistoryReply() override;
+  explicit PROTOBUF_CONSTEXPR RoomHistoryReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomHistoryReply(const RoomHistoryReply& from);
+  RoomHistoryReply(RoomHistoryReply&& from) noexcept
+    : RoomHistoryReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomHistoryReply& operator=(const RoomHistoryReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomHistoryReply& operator=(RoomHistoryReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomHistoryReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomHistoryReply* internal_default_instance() {
+    return reinterpret_cast<const RoomHistoryReply*>(
+               &_RoomHistoryReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(RoomHistoryReply& a, RoomHistoryReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomHistoryReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomHistoryReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomHistoryReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomHistoryReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomHistoryReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomHistoryReply& from) {
+    RoomHistoryReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomHistoryReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.RoomHistoryReply";
+  }
+  protected:
+  explicit RoomHistoryReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHistoryFieldNumber = 1,
+  };
+  // .ChatRoom.Logic.RoomMessages history = 1;
+  bool has_history() const;
+  private:
+  bool _internal_has_history() const;
+  public:
+  void clear_history();
+  const ::ChatRoom::Logic::RoomMessages& history() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::RoomMessages* release_history();
+  ::ChatRoom::Logic::RoomMessages* mutable_history();
+  void set_allocated_history(::ChatRoom::Logic::RoomMessages* history);
+  private:
+  const ::ChatRoom::Logic::RoomMessages& _internal_history() const;
+  ::ChatRoom::Logic::RoomMessages* _internal_mutable_history();
+  public:
+  void unsafe_arena_set_allocated_history(
+      ::ChatRoom::Logic::RoomMessages* history);
+  ::ChatRoom::Logic::RoomMessages* unsafe_arena_release_history();
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.RoomHistoryReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::ChatRoom::Logic::RoomMessages* history_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateRoomReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.CreateRoomReq) */ {
+ public:
+  inline CreateRoomReq() : CreateRoomReq(nullptr) {}
+  ~CreateRoomReq() override;
+  explicit PROTOBUF_CONSTEXPR CreateRoomReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateRoomReq(const CreateRoomReq& from);
+  CreateRoomReq(CreateRoomReq&& from) noexcept
+    : CreateRoomReq() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateRoomReq& operator=(const CreateRoomReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateRoomReq& operator=(CreateRoomReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateRoomReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateRoomReq* internal_default_instance() {
+    return reinterpret_cast<const CreateRoomReq*>(
+               &_CreateRoomReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CreateRoomReq& a, CreateRoomReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateRoomReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateRoomReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateRoomReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateRoomReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateRoomReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateRoomReq& from) {
+    CreateRoomReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateRoomReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.CreateRoomReq";
+  }
+  protected:
+  explicit CreateRoomReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomNameFieldNumber = 1,
+    kCreatorFieldNumber = 2,
+  };
+  // string roomName = 1;
+  void clear_roomname();
+  const std::string& roomname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_roomname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_roomname();
+  PROTOBUF_NODISCARD std::string* release_roomname();
+  void set_allocated_roomname(std::string* roomname);
+  private:
+  const std::string& _internal_roomname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_roomname(const std::string& value);
+  std::string* _internal_mutable_roomname();
+  public:
+
+  // .ChatRoom.Logic.User creator = 2;
+  bool has_creator() const;
+  private:
+  bool _internal_has_creator() const;
+  public:
+  void clear_creator();
+  const ::ChatRoom::Logic::User& creator() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::User* release_creator();
+  ::ChatRoom::Logic::User* mutable_creator();
+  void set_allocated_creator(::ChatRoom::Logic::User* creator);
+  private:
+  const ::ChatRoom::Logic::User& _internal_creator() const;
+  ::ChatRoom::Logic::User* _internal_mutable_creator();
+  public:
+  void unsafe_arena_set_allocated_creator(
+      ::ChatRoom::Logic::User* creator);
+  ::ChatRoom::Logic::User* unsafe_arena_release_creator();
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.CreateRoomReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr roomname_;
+    ::ChatRoom::Logic::User* creator_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateRoomReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.CreateRoomReply) */ {
+ public:
+  inline CreateRoomReply() : CreateRoomReply(nullptr) {}
+  ~CreateRoomReply() override;
+  explicit PROTOBUF_CONSTEXPR CreateRoomReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateRoomReply(const CreateRoomReply& from);
+  CreateRoomReply(CreateRoomReply&& from) noexcept
+    : CreateRoomReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateRoomReply& operator=(const CreateRoomReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateRoomReply& operator=(CreateRoomReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateRoomReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateRoomReply* internal_default_instance() {
+    return reinterpret_cast<const CreateRoomReply*>(
+               &_CreateRoomReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CreateRoomReply& a, CreateRoomReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateRoomReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateRoomReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateRoomReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateRoomReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateRoomReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateRoomReply& from) {
+    CreateRoomReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateRoomReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.CreateRoomReply";
+  }
+  protected:
+  explicit CreateRoomReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomFieldNumber = 1,
+  };
+  // .ChatRoom.Logic.RoomInfo room = 1;
+  bool has_room() const;
+  private:
+  bool _internal_has_room() const;
+  public:
+  void clear_room();
+  const ::ChatRoom::Logic::RoomInfo& room() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Logic::RoomInfo* release_room();
+  ::ChatRoom::Logic::RoomInfo* mutable_room();
+  void set_allocated_room(::ChatRoom::Logic::RoomInfo* room);
+  private:
+  const ::ChatRoom::Logic::RoomInfo& _internal_room() const;
+  ::ChatRoom::Logic::RoomInfo* _internal_mutable_room();
+  public:
+  void unsafe_arena_set_allocated_room(
+      ::ChatRoom::Logic::RoomInfo* room);
+  ::ChatRoom::Logic::RoomInfo* unsafe_arena_release_room();
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.CreateRoomReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::ChatRoom::Logic::RoomInfo* room_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomsReq final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.RoomsReq) */ {
+ public:
+  inline RoomsReq() : RoomsReq(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR RoomsReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomsReq(const RoomsReq& from);
+  RoomsReq(RoomsReq&& from) noexcept
+    : RoomsReq() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomsReq& operator=(const RoomsReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomsReq& operator=(RoomsReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomsReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomsReq* internal_default_instance() {
+    return reinterpret_cast<const RoomsReq*>(
+               &_RoomsReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(RoomsReq& a, RoomsReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomsReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomsReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomsReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomsReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const RoomsReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const RoomsReq& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.RoomsReq";
+  }
+  protected:
+  explicit RoomsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.RoomsReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomsReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Logic.RoomsReply) */ {
+ public:
+  inline RoomsReply() : RoomsReply(nullptr) {}
+  ~RoomsReply() override;
+  explicit PROTOBUF_CONSTEXPR RoomsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomsReply(const RoomsReply& from);
+  RoomsReply(RoomsReply&& from) noexcept
+    : RoomsReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomsReply& operator=(const RoomsReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomsReply& operator=(RoomsReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomsReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomsReply* internal_default_instance() {
+    return reinterpret_cast<const RoomsReply*>(
+               &_RoomsReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(RoomsReply& a, RoomsReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomsReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomsReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomsReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomsReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomsReply& from) {
+    RoomsReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomsReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Logic.RoomsReply";
+  }
+  protected:
+  explicit RoomsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomsFieldNumber = 1,
+  };
+  // repeated .ChatRoom.Logic.RoomInfo rooms = 1;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  ::ChatRoom::Logic::RoomInfo* mutable_rooms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomInfo >*
+      mutable_rooms();
+  private:
+  const ::ChatRoom::Logic::RoomInfo& _internal_rooms(int index) const;
+  ::ChatRoom::Logic::RoomInfo* _internal_add_rooms();
+  public:
+  const ::ChatRoom::Logic::RoomInfo& rooms(int index) const;
+  ::ChatRoom::Logic::RoomInfo* add_rooms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomInfo >&
+      rooms() const;
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Logic.RoomsReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomInfo > rooms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eLogic_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// User
+
+// string id = 1;
+inline void User::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& User::id() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.User.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.User.id)
+}
+inline std::string* User::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.User.id)
+  return _s;
+}
+inline const std::string& User::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void User::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_id() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.User.id)
+  return _impl_.id_.Release();
+}
+inline void User::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.User.id)
+}
+
+// string username = 2;
+inline void User::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& User::username() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.User.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.User.username)
+}
+inline std::string* User::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.User.username)
+  return _s;
+}
+inline const std::string& User::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void User::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_username() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.User.username)
+  return _impl_.username_.Release();
+}
+inline void User::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.User.username)
+}
+
+// -------------------------------------------------------------------
+
+// ChatMessage
+
+// string id = 1;
+inline void ChatMessage::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& ChatMessage::id() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.ChatMessage.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatMessage::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.ChatMessage.id)
+}
+inline std::string* ChatMessage::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.ChatMessage.id)
+  return _s;
+}
+inline const std::string& ChatMessage::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void ChatMessage::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatMessage::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatMessage::release_id() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.ChatMessage.id)
+  return _impl_.id_.Release();
+}
+inline void ChatMessage::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.ChatMessage.id)
+}
+
+// string content = 2;
+inline void ChatMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& ChatMessage::content() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.ChatMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.ChatMessage.content)
+}
+inline std::string* ChatMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.ChatMessage.content)
+  return _s;
+}
+inline const std::string& ChatMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ChatMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatMessage::release_content() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.ChatMessage.content)
+  return _impl_.content_.Release();
+}
+inline void ChatMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.ChatMessage.content)
+}
+
+// .ChatRoom.Logic.User user = 3;
+inline bool ChatMessage::_internal_has_user() const {
+  return this != internal_default_instance() && _impl_.user_ != nullptr;
+}
+inline bool ChatMessage::has_user() const {
+  return _internal_has_user();
+}
+inline void ChatMessage::clear_user() {
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+}
+inline const ::ChatRoom::Logic::User& ChatMessage::_internal_user() const {
+  const ::ChatRoom::Logic::User* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::User&>(
+      ::ChatRoom::Logic::_User_default_instance_);
+}
+inline const ::ChatRoom::Logic::User& ChatMessage::user() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.ChatMessage.user)
+  return _internal_user();
+}
+inline void ChatMessage::unsafe_arena_set_allocated_user(
+    ::ChatRoom::Logic::User* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.ChatMessage.user)
+}
+inline ::ChatRoom::Logic::User* ChatMessage::release_user() {
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::User* ChatMessage::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.ChatMessage.user)
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::User* ChatMessage::_internal_mutable_user() {
+  
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::User>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::ChatRoom::Logic::User* ChatMessage::mutable_user() {
+  ::ChatRoom::Logic::User* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.ChatMessage.user)
+  return _msg;
+}
+inline void ChatMessage::set_allocated_user(::ChatRoom::Logic::User* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.ChatMessage.user)
+}
+
+// uint64 timestamp = 4;
+inline void ChatMessage::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t ChatMessage::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t ChatMessage::timestamp() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.ChatMessage.timestamp)
+  return _internal_timestamp();
+}
+inline void ChatMessage::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void ChatMessage::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.ChatMessage.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// RoomInfo
+
+// string id = 1;
+inline void RoomInfo::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& RoomInfo::id() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomInfo.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomInfo::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomInfo.id)
+}
+inline std::string* RoomInfo::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomInfo.id)
+  return _s;
+}
+inline const std::string& RoomInfo::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void RoomInfo::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomInfo::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomInfo::release_id() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomInfo.id)
+  return _impl_.id_.Release();
+}
+inline void RoomInfo::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomInfo.id)
+}
+
+// string name = 2;
+inline void RoomInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RoomInfo::name() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomInfo.name)
+}
+inline std::string* RoomInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomInfo.name)
+  return _s;
+}
+inline const std::string& RoomInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RoomInfo::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomInfo::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomInfo::release_name() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomInfo.name)
+  return _impl_.name_.Release();
+}
+inline void RoomInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomInfo.name)
+}
+
+// string creatorID = 3;
+inline void RoomInfo::clear_creatorid() {
+  _impl_.creatorid_.ClearToEmpty();
+}
+inline const std::string& RoomInfo::creatorid() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomInfo.creatorID)
+  return _internal_creatorid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomInfo::set_creatorid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.creatorid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomInfo.creatorID)
+}
+inline std::string* RoomInfo::mutable_creatorid() {
+  std::string* _s = _internal_mutable_creatorid();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomInfo.creatorID)
+  return _s;
+}
+inline const std::string& RoomInfo::_internal_creatorid() const {
+  return _impl_.creatorid_.Get();
+}
+inline void RoomInfo::_internal_set_creatorid(const std::string& value) {
+  
+  _impl_.creatorid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomInfo::_internal_mutable_creatorid() {
+  
+  return _impl_.creatorid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomInfo::release_creatorid() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomInfo.creatorID)
+  return _impl_.creatorid_.Release();
+}
+inline void RoomInfo::set_allocated_creatorid(std::string* creatorid) {
+  if (creatorid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.creatorid_.SetAllocated(creatorid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.creatorid_.IsDefault()) {
+    _impl_.creatorid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomInfo.creatorID)
+}
+
+// string createTime = 4;
+inline void RoomInfo::clear_createtime() {
+  _impl_.createtime_.ClearToEmpty();
+}
+inline const std::string& RoomInfo::createtime() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomInfo.createTime)
+  return _internal_createtime();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomInfo::set_createtime(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.createtime_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomInfo.createTime)
+}
+inline std::string* RoomInfo::mutable_createtime() {
+  std::string* _s = _internal_mutable_createtime();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomInfo.createTime)
+  return _s;
+}
+inline const std::string& RoomInfo::_internal_createtime() const {
+  return _impl_.createtime_.Get();
+}
+inline void RoomInfo::_internal_set_createtime(const std::string& value) {
+  
+  _impl_.createtime_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomInfo::_internal_mutable_createtime() {
+  
+  return _impl_.createtime_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomInfo::release_createtime() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomInfo.createTime)
+  return _impl_.createtime_.Release();
+}
+inline void RoomInfo::set_allocated_createtime(std::string* createtime) {
+  if (createtime != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.createtime_.SetAllocated(createtime, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.createtime_.IsDefault()) {
+    _impl_.createtime_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomInfo.createTime)
+}
+
+// string updateTime = 5;
+inline void RoomInfo::clear_updatetime() {
+  _impl_.updatetime_.ClearToEmpty();
+}
+inline const std::string& RoomInfo::updatetime() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomInfo.updateTime)
+  return _internal_updatetime();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomInfo::set_updatetime(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.updatetime_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomInfo.updateTime)
+}
+inline std::string* RoomInfo::mutable_updatetime() {
+  std::string* _s = _internal_mutable_updatetime();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomInfo.updateTime)
+  return _s;
+}
+inline const std::string& RoomInfo::_internal_updatetime() const {
+  return _impl_.updatetime_.Get();
+}
+inline void RoomInfo::_internal_set_updatetime(const std::string& value) {
+  
+  _impl_.updatetime_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomInfo::_internal_mutable_updatetime() {
+  
+  return _impl_.updatetime_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomInfo::release_updatetime() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomInfo.updateTime)
+  return _impl_.updatetime_.Release();
+}
+inline void RoomInfo::set_allocated_updatetime(std::string* updatetime) {
+  if (updatetime != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.updatetime_.SetAllocated(updatetime, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.updatetime_.IsDefault()) {
+    _impl_.updatetime_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomInfo.updateTime)
+}
+
+// -------------------------------------------------------------------
+
+// RoomMessages
+
+// .ChatRoom.Logic.RoomInfo room = 1;
+inline bool RoomMessages::_internal_has_room() const {
+  return this != internal_default_instance() && _impl_.room_ != nullptr;
+}
+inline bool RoomMessages::has_room() const {
+  return _internal_has_room();
+}
+inline void RoomMessages::clear_room() {
+  if (GetArenaForAllocation() == nullptr && _impl_.room_ != nullptr) {
+    delete _impl_.room_;
+  }
+  _impl_.room_ = nullptr;
+}
+inline const ::ChatRoom::Logic::RoomInfo& RoomMessages::_internal_room() const {
+  const ::ChatRoom::Logic::RoomInfo* p = _impl_.room_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::RoomInfo&>(
+      ::ChatRoom::Logic::_RoomInfo_default_instance_);
+}
+inline const ::ChatRoom::Logic::RoomInfo& RoomMessages::room() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomMessages.room)
+  return _internal_room();
+}
+inline void RoomMessages::unsafe_arena_set_allocated_room(
+    ::ChatRoom::Logic::RoomInfo* room) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.room_);
+  }
+  _impl_.room_ = room;
+  if (room) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.RoomMessages.room)
+}
+inline ::ChatRoom::Logic::RoomInfo* RoomMessages::release_room() {
+  
+  ::ChatRoom::Logic::RoomInfo* temp = _impl_.room_;
+  _impl_.room_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::RoomInfo* RoomMessages::unsafe_arena_release_room() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomMessages.room)
+  
+  ::ChatRoom::Logic::RoomInfo* temp = _impl_.room_;
+  _impl_.room_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::RoomInfo* RoomMessages::_internal_mutable_room() {
+  
+  if (_impl_.room_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::RoomInfo>(GetArenaForAllocation());
+    _impl_.room_ = p;
+  }
+  return _impl_.room_;
+}
+inline ::ChatRoom::Logic::RoomInfo* RoomMessages::mutable_room() {
+  ::ChatRoom::Logic::RoomInfo* _msg = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomMessages.room)
+  return _msg;
+}
+inline void RoomMessages::set_allocated_room(::ChatRoom::Logic::RoomInfo* room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.room_;
+  }
+  if (room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room);
+    if (message_arena != submessage_arena) {
+      room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.room_ = room;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomMessages.room)
+}
+
+// bool hasMoreMessages = 2;
+inline void RoomMessages::clear_hasmoremessages() {
+  _impl_.hasmoremessages_ = false;
+}
+inline bool RoomMessages::_internal_hasmoremessages() const {
+  return _impl_.hasmoremessages_;
+}
+inline bool RoomMessages::hasmoremessages() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomMessages.hasMoreMessages)
+  return _internal_hasmoremessages();
+}
+inline void RoomMessages::_internal_set_hasmoremessages(bool value) {
+  
+  _impl_.hasmoremessages_ = value;
+}
+inline void RoomMessages::set_hasmoremessages(bool value) {
+  _internal_set_hasmoremessages(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomMessages.hasMoreMessages)
+}
+
+// repeated .ChatRoom.Logic.ChatMessage messages = 3;
+inline int RoomMessages::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int RoomMessages::messages_size() const {
+  return _internal_messages_size();
+}
+inline void RoomMessages::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::ChatRoom::Logic::ChatMessage* RoomMessages::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomMessages.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >*
+RoomMessages::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Logic.RoomMessages.messages)
+  return &_impl_.messages_;
+}
+inline const ::ChatRoom::Logic::ChatMessage& RoomMessages::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::ChatRoom::Logic::ChatMessage& RoomMessages::messages(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomMessages.messages)
+  return _internal_messages(index);
+}
+inline ::ChatRoom::Logic::ChatMessage* RoomMessages::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::ChatRoom::Logic::ChatMessage* RoomMessages::add_messages() {
+  ::ChatRoom::Logic::ChatMessage* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:ChatRoom.Logic.RoomMessages.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >&
+RoomMessages::messages() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Logic.RoomMessages.messages)
+  return _impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// VerifyReq
+
+// string cookie = 1;
+inline void VerifyReq::clear_cookie() {
+  _impl_.cookie_.ClearToEmpty();
+}
+inline const std::string& VerifyReq::cookie() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.VerifyReq.cookie)
+  return _internal_cookie();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VerifyReq::set_cookie(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cookie_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.VerifyReq.cookie)
+}
+inline std::string* VerifyReq::mutable_cookie() {
+  std::string* _s = _internal_mutable_cookie();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.VerifyReq.cookie)
+  return _s;
+}
+inline const std::string& VerifyReq::_internal_cookie() const {
+  return _impl_.cookie_.Get();
+}
+inline void VerifyReq::_internal_set_cookie(const std::string& value) {
+  
+  _impl_.cookie_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VerifyReq::_internal_mutable_cookie() {
+  
+  return _impl_.cookie_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VerifyReq::release_cookie() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.VerifyReq.cookie)
+  return _impl_.cookie_.Release();
+}
+inline void VerifyReq::set_allocated_cookie(std::string* cookie) {
+  if (cookie != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cookie_.SetAllocated(cookie, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cookie_.IsDefault()) {
+    _impl_.cookie_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.VerifyReq.cookie)
+}
+
+// -------------------------------------------------------------------
+
+// VerifyReply
+
+// bool success = 1;
+inline void VerifyReply::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool VerifyReply::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool VerifyReply::success() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.VerifyReply.success)
+  return _internal_success();
+}
+inline void VerifyReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void VerifyReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.VerifyReply.success)
+}
+
+// .ChatRoom.Logic.User user = 2;
+inline bool VerifyReply::_internal_has_user() const {
+  return this != internal_default_instance() && _impl_.user_ != nullptr;
+}
+inline bool VerifyReply::has_user() const {
+  return _internal_has_user();
+}
+inline void VerifyReply::clear_user() {
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+}
+inline const ::ChatRoom::Logic::User& VerifyReply::_internal_user() const {
+  const ::ChatRoom::Logic::User* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::User&>(
+      ::ChatRoom::Logic::_User_default_instance_);
+}
+inline const ::ChatRoom::Logic::User& VerifyReply::user() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.VerifyReply.user)
+  return _internal_user();
+}
+inline void VerifyReply::unsafe_arena_set_allocated_user(
+    ::ChatRoom::Logic::User* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.VerifyReply.user)
+}
+inline ::ChatRoom::Logic::User* VerifyReply::release_user() {
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::User* VerifyReply::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.VerifyReply.user)
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::User* VerifyReply::_internal_mutable_user() {
+  
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::User>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::ChatRoom::Logic::User* VerifyReply::mutable_user() {
+  ::ChatRoom::Logic::User* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.VerifyReply.user)
+  return _msg;
+}
+inline void VerifyReply::set_allocated_user(::ChatRoom::Logic::User* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.VerifyReply.user)
+}
+
+// string email = 3;
+inline void VerifyReply::clear_email() {
+  _impl_.email_.ClearToEmpty();
+}
+inline const std::string& VerifyReply::email() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.VerifyReply.email)
+  return _internal_email();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VerifyReply::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.VerifyReply.email)
+}
+inline std::string* VerifyReply::mutable_email() {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.VerifyReply.email)
+  return _s;
+}
+inline const std::string& VerifyReply::_internal_email() const {
+  return _impl_.email_.Get();
+}
+inline void VerifyReply::_internal_set_email(const std::string& value) {
+  
+  _impl_.email_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VerifyReply::_internal_mutable_email() {
+  
+  return _impl_.email_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VerifyReply::release_email() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.VerifyReply.email)
+  return _impl_.email_.Release();
+}
+inline void VerifyReply::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.VerifyReply.email)
+}
+
+// string error = 4;
+inline void VerifyReply::clear_error() {
+  _impl_.error_.ClearToEmpty();
+}
+inline const std::string& VerifyReply::error() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.VerifyReply.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VerifyReply::set_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.VerifyReply.error)
+}
+inline std::string* VerifyReply::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.VerifyReply.error)
+  return _s;
+}
+inline const std::string& VerifyReply::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void VerifyReply::_internal_set_error(const std::string& value) {
+  
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VerifyReply::_internal_mutable_error() {
+  
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VerifyReply::release_error() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.VerifyReply.error)
+  return _impl_.error_.Release();
+}
+inline void VerifyReply::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.VerifyReply.error)
+}
+
+// -------------------------------------------------------------------
+
+// HelloReq
+
+// .ChatRoom.Logic.User user = 1;
+inline bool HelloReq::_internal_has_user() const {
+  return this != internal_default_instance() && _impl_.user_ != nullptr;
+}
+inline bool HelloReq::has_user() const {
+  return _internal_has_user();
+}
+inline void HelloReq::clear_user() {
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+}
+inline const ::ChatRoom::Logic::User& HelloReq::_internal_user() const {
+  const ::ChatRoom::Logic::User* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::User&>(
+      ::ChatRoom::Logic::_User_default_instance_);
+}
+inline const ::ChatRoom::Logic::User& HelloReq::user() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.HelloReq.user)
+  return _internal_user();
+}
+inline void HelloReq::unsafe_arena_set_allocated_user(
+    ::ChatRoom::Logic::User* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.HelloReq.user)
+}
+inline ::ChatRoom::Logic::User* HelloReq::release_user() {
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::User* HelloReq::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.HelloReq.user)
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::User* HelloReq::_internal_mutable_user() {
+  
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::User>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::ChatRoom::Logic::User* HelloReq::mutable_user() {
+  ::ChatRoom::Logic::User* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.HelloReq.user)
+  return _msg;
+}
+inline void HelloReq::set_allocated_user(::ChatRoom::Logic::User* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.HelloReq.user)
+}
+
+// -------------------------------------------------------------------
+
+// HelloReply
+
+// repeated .ChatRoom.Logic.RoomMessages rooms = 1;
+inline int HelloReply::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
+}
+inline int HelloReply::rooms_size() const {
+  return _internal_rooms_size();
+}
+inline void HelloReply::clear_rooms() {
+  _impl_.rooms_.Clear();
+}
+inline ::ChatRoom::Logic::RoomMessages* HelloReply::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.HelloReply.rooms)
+  return _impl_.rooms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomMessages >*
+HelloReply::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Logic.HelloReply.rooms)
+  return &_impl_.rooms_;
+}
+inline const ::ChatRoom::Logic::RoomMessages& HelloReply::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
+}
+inline const ::ChatRoom::Logic::RoomMessages& HelloReply::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.HelloReply.rooms)
+  return _internal_rooms(index);
+}
+inline ::ChatRoom::Logic::RoomMessages* HelloReply::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
+}
+inline ::ChatRoom::Logic::RoomMessages* HelloReply::add_rooms() {
+  ::ChatRoom::Logic::RoomMessages* _add = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add:ChatRoom.Logic.HelloReply.rooms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomMessages >&
+HelloReply::rooms() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Logic.HelloReply.rooms)
+  return _impl_.rooms_;
+}
+
+// -------------------------------------------------------------------
+
+// SendReq
+
+// string roomID = 1;
+inline void SendReq::clear_roomid() {
+  _impl_.roomid_.ClearToEmpty();
+}
+inline const std::string& SendReq::roomid() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.SendReq.roomID)
+  return _internal_roomid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendReq::set_roomid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.roomid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.SendReq.roomID)
+}
+inline std::string* SendReq::mutable_roomid() {
+  std::string* _s = _internal_mutable_roomid();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.SendReq.roomID)
+  return _s;
+}
+inline const std::string& SendReq::_internal_roomid() const {
+  return _impl_.roomid_.Get();
+}
+inline void SendReq::_internal_set_roomid(const std::string& value) {
+  
+  _impl_.roomid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendReq::_internal_mutable_roomid() {
+  
+  return _impl_.roomid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendReq::release_roomid() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.SendReq.roomID)
+  return _impl_.roomid_.Release();
+}
+inline void SendReq::set_allocated_roomid(std::string* roomid) {
+  if (roomid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.roomid_.SetAllocated(roomid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.roomid_.IsDefault()) {
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.SendReq.roomID)
+}
+
+// .ChatRoom.Logic.User user = 2;
+inline bool SendReq::_internal_has_user() const {
+  return this != internal_default_instance() && _impl_.user_ != nullptr;
+}
+inline bool SendReq::has_user() const {
+  return _internal_has_user();
+}
+inline void SendReq::clear_user() {
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+}
+inline const ::ChatRoom::Logic::User& SendReq::_internal_user() const {
+  const ::ChatRoom::Logic::User* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::User&>(
+      ::ChatRoom::Logic::_User_default_instance_);
+}
+inline const ::ChatRoom::Logic::User& SendReq::user() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.SendReq.user)
+  return _internal_user();
+}
+inline void SendReq::unsafe_arena_set_allocated_user(
+    ::ChatRoom::Logic::User* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.SendReq.user)
+}
+inline ::ChatRoom::Logic::User* SendReq::release_user() {
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::User* SendReq::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.SendReq.user)
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::User* SendReq::_internal_mutable_user() {
+  
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::User>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::ChatRoom::Logic::User* SendReq::mutable_user() {
+  ::ChatRoom::Logic::User* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.SendReq.user)
+  return _msg;
+}
+inline void SendReq::set_allocated_user(::ChatRoom::Logic::User* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.SendReq.user)
+}
+
+// repeated string contents = 3;
+inline int SendReq::_internal_contents_size() const {
+  return _impl_.contents_.size();
+}
+inline int SendReq::contents_size() const {
+  return _internal_contents_size();
+}
+inline void SendReq::clear_contents() {
+  _impl_.contents_.Clear();
+}
+inline std::string* SendReq::add_contents() {
+  std::string* _s = _internal_add_contents();
+  // @@protoc_insertion_point(field_add_mutable:ChatRoom.Logic.SendReq.contents)
+  return _s;
+}
+inline const std::string& SendReq::_internal_contents(int index) const {
+  return _impl_.contents_.Get(index);
+}
+inline const std::string& SendReq::contents(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.SendReq.contents)
+  return _internal_contents(index);
+}
+inline std::string* SendReq::mutable_contents(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.SendReq.contents)
+  return _impl_.contents_.Mutable(index);
+}
+inline void SendReq::set_contents(int index, const std::string& value) {
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.SendReq.contents)
+}
+inline void SendReq::set_contents(int index, std::string&& value) {
+  _impl_.contents_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.SendReq.contents)
+}
+inline void SendReq::set_contents(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ChatRoom.Logic.SendReq.contents)
+}
+inline void SendReq::set_contents(int index, const char* value, size_t size) {
+  _impl_.contents_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ChatRoom.Logic.SendReq.contents)
+}
+inline std::string* SendReq::_internal_add_contents() {
+  return _impl_.contents_.Add();
+}
+inline void SendReq::add_contents(const std::string& value) {
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ChatRoom.Logic.SendReq.contents)
+}
+inline void SendReq::add_contents(std::string&& value) {
+  _impl_.contents_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ChatRoom.Logic.SendReq.contents)
+}
+inline void SendReq::add_contents(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contents_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ChatRoom.Logic.SendReq.contents)
+}
+inline void SendReq::add_contents(const char* value, size_t size) {
+  _impl_.contents_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ChatRoom.Logic.SendReq.contents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SendReq::contents() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Logic.SendReq.contents)
+  return _impl_.contents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SendReq::mutable_contents() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Logic.SendReq.contents)
+  return &_impl_.contents_;
+}
+
+// -------------------------------------------------------------------
+
+// SendReply
+
+// repeated .ChatRoom.Logic.ChatMessage messages = 1;
+inline int SendReply::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int SendReply::messages_size() const {
+  return _internal_messages_size();
+}
+inline void SendReply::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::ChatRoom::Logic::ChatMessage* SendReply::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.SendReply.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >*
+SendReply::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Logic.SendReply.messages)
+  return &_impl_.messages_;
+}
+inline const ::ChatRoom::Logic::ChatMessage& SendReply::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::ChatRoom::Logic::ChatMessage& SendReply::messages(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.SendReply.messages)
+  return _internal_messages(index);
+}
+inline ::ChatRoom::Logic::ChatMessage* SendReply::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::ChatRoom::Logic::ChatMessage* SendReply::add_messages() {
+  ::ChatRoom::Logic::ChatMessage* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:ChatRoom.Logic.SendReply.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::ChatMessage >&
+SendReply::messages() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Logic.SendReply.messages)
+  return _impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// RoomHistoryReq
+
+// string roomID = 1;
+inline void RoomHistoryReq::clear_roomid() {
+  _impl_.roomid_.ClearToEmpty();
+}
+inline const std::string& RoomHistoryReq::roomid() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomHistoryReq.roomID)
+  return _internal_roomid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomHistoryReq::set_roomid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.roomid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomHistoryReq.roomID)
+}
+inline std::string* RoomHistoryReq::mutable_roomid() {
+  std::string* _s = _internal_mutable_roomid();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomHistoryReq.roomID)
+  return _s;
+}
+inline const std::string& RoomHistoryReq::_internal_roomid() const {
+  return _impl_.roomid_.Get();
+}
+inline void RoomHistoryReq::_internal_set_roomid(const std::string& value) {
+  
+  _impl_.roomid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomHistoryReq::_internal_mutable_roomid() {
+  
+  return _impl_.roomid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomHistoryReq::release_roomid() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomHistoryReq.roomID)
+  return _impl_.roomid_.Release();
+}
+inline void RoomHistoryReq::set_allocated_roomid(std::string* roomid) {
+  if (roomid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.roomid_.SetAllocated(roomid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.roomid_.IsDefault()) {
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomHistoryReq.roomID)
+}
+
+// string firstMessageID = 2;
+inline void RoomHistoryReq::clear_firstmessageid() {
+  _impl_.firstmessageid_.ClearToEmpty();
+}
+inline const std::string& RoomHistoryReq::firstmessageid() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomHistoryReq.firstMessageID)
+  return _internal_firstmessageid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomHistoryReq::set_firstmessageid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.firstmessageid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomHistoryReq.firstMessageID)
+}
+inline std::string* RoomHistoryReq::mutable_firstmessageid() {
+  std::string* _s = _internal_mutable_firstmessageid();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomHistoryReq.firstMessageID)
+  return _s;
+}
+inline const std::string& RoomHistoryReq::_internal_firstmessageid() const {
+  return _impl_.firstmessageid_.Get();
+}
+inline void RoomHistoryReq::_internal_set_firstmessageid(const std::string& value) {
+  
+  _impl_.firstmessageid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomHistoryReq::_internal_mutable_firstmessageid() {
+  
+  return _impl_.firstmessageid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomHistoryReq::release_firstmessageid() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomHistoryReq.firstMessageID)
+  return _impl_.firstmessageid_.Release();
+}
+inline void RoomHistoryReq::set_allocated_firstmessageid(std::string* firstmessageid) {
+  if (firstmessageid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.firstmessageid_.SetAllocated(firstmessageid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.firstmessageid_.IsDefault()) {
+    _impl_.firstmessageid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomHistoryReq.firstMessageID)
+}
+
+// int32 count = 3;
+inline void RoomHistoryReq::clear_count() {
+  _impl_.count_ = 0;
+}
+inline int32_t RoomHistoryReq::_internal_count() const {
+  return _impl_.count_;
+}
+inline int32_t RoomHistoryReq::count() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomHistoryReq.count)
+  return _internal_count();
+}
+inline void RoomHistoryReq::_internal_set_count(int32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void RoomHistoryReq::set_count(int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.RoomHistoryReq.count)
+}
+
+// .ChatRoom.Logic.User user = 4;
+inline bool RoomHistoryReq::_internal_has_user() const {
+  return this != internal_default_instance() && _impl_.user_ != nullptr;
+}
+inline bool RoomHistoryReq::has_user() const {
+  return _internal_has_user();
+}
+inline void RoomHistoryReq::clear_user() {
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+}
+inline const ::ChatRoom::Logic::User& RoomHistoryReq::_internal_user() const {
+  const ::ChatRoom::Logic::User* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::User&>(
+      ::ChatRoom::Logic::_User_default_instance_);
+}
+inline const ::ChatRoom::Logic::User& RoomHistoryReq::user() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomHistoryReq.user)
+  return _internal_user();
+}
+inline void RoomHistoryReq::unsafe_arena_set_allocated_user(
+    ::ChatRoom::Logic::User* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.RoomHistoryReq.user)
+}
+inline ::ChatRoom::Logic::User* RoomHistoryReq::release_user() {
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::User* RoomHistoryReq::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomHistoryReq.user)
+  
+  ::ChatRoom::Logic::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::User* RoomHistoryReq::_internal_mutable_user() {
+  
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::User>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::ChatRoom::Logic::User* RoomHistoryReq::mutable_user() {
+  ::ChatRoom::Logic::User* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomHistoryReq.user)
+  return _msg;
+}
+inline void RoomHistoryReq::set_allocated_user(::ChatRoom::Logic::User* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomHistoryReq.user)
+}
+
+// -------------------------------------------------------------------
+
+// RoomHistoryReply
+
+// .ChatRoom.Logic.RoomMessages history = 1;
+inline bool RoomHistoryReply::_internal_has_history() const {
+  return this != internal_default_instance() && _impl_.history_ != nullptr;
+}
+inline bool RoomHistoryReply::has_history() const {
+  return _internal_has_history();
+}
+inline void RoomHistoryReply::clear_history() {
+  if (GetArenaForAllocation() == nullptr && _impl_.history_ != nullptr) {
+    delete _impl_.history_;
+  }
+  _impl_.history_ = nullptr;
+}
+inline const ::ChatRoom::Logic::RoomMessages& RoomHistoryReply::_internal_history() const {
+  const ::ChatRoom::Logic::RoomMessages* p = _impl_.history_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::RoomMessages&>(
+      ::ChatRoom::Logic::_RoomMessages_default_instance_);
+}
+inline const ::ChatRoom::Logic::RoomMessages& RoomHistoryReply::history() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomHistoryReply.history)
+  return _internal_history();
+}
+inline void RoomHistoryReply::unsafe_arena_set_allocated_history(
+    ::ChatRoom::Logic::RoomMessages* history) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.history_);
+  }
+  _impl_.history_ = history;
+  if (history) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.RoomHistoryReply.history)
+}
+inline ::ChatRoom::Logic::RoomMessages* RoomHistoryReply::release_history() {
+  
+  ::ChatRoom::Logic::RoomMessages* temp = _impl_.history_;
+  _impl_.history_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::RoomMessages* RoomHistoryReply::unsafe_arena_release_history() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.RoomHistoryReply.history)
+  
+  ::ChatRoom::Logic::RoomMessages* temp = _impl_.history_;
+  _impl_.history_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::RoomMessages* RoomHistoryReply::_internal_mutable_history() {
+  
+  if (_impl_.history_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::RoomMessages>(GetArenaForAllocation());
+    _impl_.history_ = p;
+  }
+  return _impl_.history_;
+}
+inline ::ChatRoom::Logic::RoomMessages* RoomHistoryReply::mutable_history() {
+  ::ChatRoom::Logic::RoomMessages* _msg = _internal_mutable_history();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomHistoryReply.history)
+  return _msg;
+}
+inline void RoomHistoryReply::set_allocated_history(::ChatRoom::Logic::RoomMessages* history) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.history_;
+  }
+  if (history) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(history);
+    if (message_arena != submessage_arena) {
+      history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, history, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.history_ = history;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.RoomHistoryReply.history)
+}
+
+// -------------------------------------------------------------------
+
+// CreateRoomReq
+
+// string roomName = 1;
+inline void CreateRoomReq::clear_roomname() {
+  _impl_.roomname_.ClearToEmpty();
+}
+inline const std::string& CreateRoomReq::roomname() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.CreateRoomReq.roomName)
+  return _internal_roomname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateRoomReq::set_roomname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.roomname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Logic.CreateRoomReq.roomName)
+}
+inline std::string* CreateRoomReq::mutable_roomname() {
+  std::string* _s = _internal_mutable_roomname();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.CreateRoomReq.roomName)
+  return _s;
+}
+inline const std::string& CreateRoomReq::_internal_roomname() const {
+  return _impl_.roomname_.Get();
+}
+inline void CreateRoomReq::_internal_set_roomname(const std::string& value) {
+  
+  _impl_.roomname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateRoomReq::_internal_mutable_roomname() {
+  
+  return _impl_.roomname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateRoomReq::release_roomname() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.CreateRoomReq.roomName)
+  return _impl_.roomname_.Release();
+}
+inline void CreateRoomReq::set_allocated_roomname(std::string* roomname) {
+  if (roomname != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.roomname_.SetAllocated(roomname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.roomname_.IsDefault()) {
+    _impl_.roomname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.CreateRoomReq.roomName)
+}
+
+// .ChatRoom.Logic.User creator = 2;
+inline bool CreateRoomReq::_internal_has_creator() const {
+  return this != internal_default_instance() && _impl_.creator_ != nullptr;
+}
+inline bool CreateRoomReq::has_creator() const {
+  return _internal_has_creator();
+}
+inline void CreateRoomReq::clear_creator() {
+  if (GetArenaForAllocation() == nullptr && _impl_.creator_ != nullptr) {
+    delete _impl_.creator_;
+  }
+  _impl_.creator_ = nullptr;
+}
+inline const ::ChatRoom::Logic::User& CreateRoomReq::_internal_creator() const {
+  const ::ChatRoom::Logic::User* p = _impl_.creator_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::User&>(
+      ::ChatRoom::Logic::_User_default_instance_);
+}
+inline const ::ChatRoom::Logic::User& CreateRoomReq::creator() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.CreateRoomReq.creator)
+  return _internal_creator();
+}
+inline void CreateRoomReq::unsafe_arena_set_allocated_creator(
+    ::ChatRoom::Logic::User* creator) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.creator_);
+  }
+  _impl_.creator_ = creator;
+  if (creator) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.CreateRoomReq.creator)
+}
+inline ::ChatRoom::Logic::User* CreateRoomReq::release_creator() {
+  
+  ::ChatRoom::Logic::User* temp = _impl_.creator_;
+  _impl_.creator_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::User* CreateRoomReq::unsafe_arena_release_creator() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.CreateRoomReq.creator)
+  
+  ::ChatRoom::Logic::User* temp = _impl_.creator_;
+  _impl_.creator_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::User* CreateRoomReq::_internal_mutable_creator() {
+  
+  if (_impl_.creator_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::User>(GetArenaForAllocation());
+    _impl_.creator_ = p;
+  }
+  return _impl_.creator_;
+}
+inline ::ChatRoom::Logic::User* CreateRoomReq::mutable_creator() {
+  ::ChatRoom::Logic::User* _msg = _internal_mutable_creator();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.CreateRoomReq.creator)
+  return _msg;
+}
+inline void CreateRoomReq::set_allocated_creator(::ChatRoom::Logic::User* creator) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.creator_;
+  }
+  if (creator) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(creator);
+    if (message_arena != submessage_arena) {
+      creator = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, creator, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.creator_ = creator;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.CreateRoomReq.creator)
+}
+
+// -------------------------------------------------------------------
+
+// CreateRoomReply
+
+// .ChatRoom.Logic.RoomInfo room = 1;
+inline bool CreateRoomReply::_internal_has_room() const {
+  return this != internal_default_instance() && _impl_.room_ != nullptr;
+}
+inline bool CreateRoomReply::has_room() const {
+  return _internal_has_room();
+}
+inline void CreateRoomReply::clear_room() {
+  if (GetArenaForAllocation() == nullptr && _impl_.room_ != nullptr) {
+    delete _impl_.room_;
+  }
+  _impl_.room_ = nullptr;
+}
+inline const ::ChatRoom::Logic::RoomInfo& CreateRoomReply::_internal_room() const {
+  const ::ChatRoom::Logic::RoomInfo* p = _impl_.room_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Logic::RoomInfo&>(
+      ::ChatRoom::Logic::_RoomInfo_default_instance_);
+}
+inline const ::ChatRoom::Logic::RoomInfo& CreateRoomReply::room() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.CreateRoomReply.room)
+  return _internal_room();
+}
+inline void CreateRoomReply::unsafe_arena_set_allocated_room(
+    ::ChatRoom::Logic::RoomInfo* room) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.room_);
+  }
+  _impl_.room_ = room;
+  if (room) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Logic.CreateRoomReply.room)
+}
+inline ::ChatRoom::Logic::RoomInfo* CreateRoomReply::release_room() {
+  
+  ::ChatRoom::Logic::RoomInfo* temp = _impl_.room_;
+  _impl_.room_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Logic::RoomInfo* CreateRoomReply::unsafe_arena_release_room() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Logic.CreateRoomReply.room)
+  
+  ::ChatRoom::Logic::RoomInfo* temp = _impl_.room_;
+  _impl_.room_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Logic::RoomInfo* CreateRoomReply::_internal_mutable_room() {
+  
+  if (_impl_.room_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Logic::RoomInfo>(GetArenaForAllocation());
+    _impl_.room_ = p;
+  }
+  return _impl_.room_;
+}
+inline ::ChatRoom::Logic::RoomInfo* CreateRoomReply::mutable_room() {
+  ::ChatRoom::Logic::RoomInfo* _msg = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.CreateRoomReply.room)
+  return _msg;
+}
+inline void CreateRoomReply::set_allocated_room(::ChatRoom::Logic::RoomInfo* room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.room_;
+  }
+  if (room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room);
+    if (message_arena != submessage_arena) {
+      room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.room_ = room;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Logic.CreateRoomReply.room)
+}
+
+// -------------------------------------------------------------------
+
+// RoomsReq
+
+// -------------------------------------------------------------------
+
+// RoomsReply
+
+// repeated .ChatRoom.Logic.RoomInfo rooms = 1;
+inline int RoomsReply::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
+}
+inline int RoomsReply::rooms_size() const {
+  return _internal_rooms_size();
+}
+inline void RoomsReply::clear_rooms() {
+  _impl_.rooms_.Clear();
+}
+inline ::ChatRoom::Logic::RoomInfo* RoomsReply::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Logic.RoomsReply.rooms)
+  return _impl_.rooms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomInfo >*
+RoomsReply::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Logic.RoomsReply.rooms)
+  return &_impl_.rooms_;
+}
+inline const ::ChatRoom::Logic::RoomInfo& RoomsReply::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
+}
+inline const ::ChatRoom::Logic::RoomInfo& RoomsReply::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Logic.RoomsReply.rooms)
+  return _internal_rooms(index);
+}
+inline ::ChatRoom::Logic::RoomInfo* RoomsReply::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
+}
+inline ::ChatRoom::Logic::RoomInfo* RoomsReply::add_rooms() {
+  ::ChatRoom::Logic::RoomInfo* _add = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add:ChatRoom.Logic.RoomsReply.rooms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Logic::RoomInfo >&
+RoomsReply::rooms() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Logic.RoomsReply.rooms)
+  return _impl_.rooms_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Logic
+}  // namespace ChatRoom
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ChatRoom_2eLogic_2eproto
@@ -2,26 +2,296 @@
 #include "muduo/base/Logging.h"
 #include "websocket_conn.h"
 #include "../service/pub_sub_service.h"
+#include "../service/conn_shard.h"
+#include "session_token.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <unordered_map>
 #include <json/json.h>
+#include <google/protobuf/arena.h>
+#include <grpcpp/alarm.h>
 
-extern std::unordered_map<string, CHttpConnPtr> s_user_ws_conn_map;
-extern std::mutex s_mtx_user_ws_conn_map;
+namespace ChatRoom {
+    // a tag on the cq, Proceed is called with the result of the pending operation
+    class CometCall {
+    public:
+        virtual ~CometCall() = default;
+        virtual void Proceed(bool ok) = 0;
+    };
 
+    // one unary call: requested -> handled -> finished, then deleted
+    template <class Request, class Reply>
+    class CometUnaryCall : public CometCall {
+    public:
+        typedef void (Comet::Comet::AsyncService::*RequestMethod)(grpc::ServerContext*, Request*,
+            grpc::ServerAsyncResponseWriter<Reply>*, grpc::CompletionQueue*, grpc::ServerCompletionQueue*, void*);
+        typedef grpc::Status (CometServiceImpl::*Handler)(grpc::ServerContext*, const Request*, Reply*);
 
-namespace ChatRoom {
-    grpc::Status CometServiceImpl::PushMsg(grpc::ServerContext* context,
-        const Comet::PushMsgReq* request,
-        Comet::PushMsgReply* response) {
-        LOG_INFO << "PushMsg called";
+        static void Spawn(CometServiceImpl* owner, grpc::ServerCompletionQueue* cq,
+            RequestMethod request_method, Handler handler) {
+            new CometUnaryCall(owner, cq, request_method, handler);
+        }
+
+        void Proceed(bool ok) override {
+            // !ok before handling: the cq is shutting down
+            if (finished_ || !ok) {
+                delete this;
+                return;
+            }
+            // keep one call pending for the method while this one is handled
+            Spawn(owner_, cq_, request_method_, handler_);
+
+            grpc::Status status = (owner_->*handler_)(&context_, request_, reply_);
+            finished_ = true;
+            responder_.Finish(*reply_, status, this);
+        }
+
+    private:
+        CometUnaryCall(CometServiceImpl* owner, grpc::ServerCompletionQueue* cq,
+            RequestMethod request_method, Handler handler)
+            : owner_(owner), cq_(cq), request_method_(request_method), handler_(handler),
+              arena_(arena_block_, sizeof(arena_block_)), responder_(&context_) {
+            // messages live in the call's arena, a small request never touches the heap
+            request_ = google::protobuf::Arena::CreateMessage<Request>(&arena_);
+            reply_ = google::protobuf::Arena::CreateMessage<Reply>(&arena_);
+            (owner_->service_.*request_method_)(&context_, request_, &responder_, cq_, cq_, this);
+        }
+
+        CometServiceImpl* owner_;
+        grpc::ServerCompletionQueue* cq_;
+        RequestMethod request_method_;
+        Handler handler_;
+        // the arena places its header and the messages at the start of the block
+        alignas(std::max_align_t) char arena_block_[2048];
+        google::protobuf::Arena arena_;
+        Request* request_;
+        Reply* reply_;
+        grpc::ServerContext context_;
+        grpc::ServerAsyncResponseWriter<Reply> responder_;
+        bool finished_ = false;
+    };
+
+    // one PushStream: read a batch -> dispatch -> write its ack -> read the next, until the job closes it
+    class CometPushStreamCall : public CometCall {
+    public:
+        static void Spawn(CometServiceImpl* owner, grpc::ServerCompletionQueue* cq) {
+            new CometPushStreamCall(owner, cq);
+        }
+
+        void Proceed(bool ok) override {
+            switch (state_) {
+            case kConnecting:
+                if (!ok) {
+                    delete this;
+                    return;
+                }
+                Spawn(owner_, cq_);
+                LOG_INFO << "PushStream opened by " << context_.peer();
+                state_ = kReading;
+                stream_.Read(batch_, this);
+                break;
+            case kReading:
+                if (!ok) {
+                    // the job half closed the stream, or it's broken
+                    state_ = kFinishing;
+                    stream_.Finish(grpc::Status::OK, this);
+                    break;
+                }
+                owner_->HandlePushBatch(*batch_, ack_);
+                batch_->Clear();
+                state_ = kWriting;
+                stream_.Write(*ack_, this);
+                break;
+            case kWriting:
+                if (!ok) {
+                    state_ = kFinishing;
+                    stream_.Finish(grpc::Status::CANCELLED, this);
+                    break;
+                }
+                ack_->Clear();
+                state_ = kReading;
+                stream_.Read(batch_, this);
+                break;
+            case kFinishing:
+                LOG_INFO << "PushStream closed by " << context_.peer();
+                delete this;
+                break;
+            }
+        }
+
+    private:
+        enum State { kConnecting, kReading, kWriting, kFinishing };
+
+        CometPushStreamCall(CometServiceImpl* owner, grpc::ServerCompletionQueue* cq)
+            : owner_(owner), cq_(cq), stream_(&context_) {
+            // a long lived call, batch and ack are reused for its whole life
+            batch_ = google::protobuf::Arena::CreateMessage<Comet::PushBatch>(&arena_);
+            ack_ = google::protobuf::Arena::CreateMessage<Comet::PushAck>(&arena_);
+            owner_->service_.RequestPushStream(&context_, &stream_, cq_, cq_, this);
+        }
+
+        CometServiceImpl* owner_;
+        grpc::ServerCompletionQueue* cq_;
+        State state_ = kConnecting;
+        google::protobuf::Arena arena_;
+        Comet::PushBatch* batch_;
+        Comet::PushAck* ack_;
+        grpc::ServerContext context_;
+        grpc::ServerAsyncReaderWriter<Comet::PushAck, Comet::PushBatch> stream_;
+    };
+
+    // one Rooms call: answered at once, or held on an alarm until a room gets its first member
+    // here (WakeRoomsCalls cancels the alarm) or wait_ms passes, then answered on its own cq
+    class CometRoomsCall : public CometCall {
+    public:
+        static void Spawn(CometServiceImpl* owner, grpc::ServerCompletionQueue* cq) {
+            new CometRoomsCall(owner, cq);
+        }
+
+        void Proceed(bool ok) override {
+            switch (state_) {
+            case kRequested:
+                if (!ok) {
+                    delete this;
+                    return;
+                }
+                Spawn(owner_, cq_);
+                if (!owner_->HoldRoomsCall(this, request_)) {
+                    Answer();
+                }
+                break;
+            case kHeld:
+                // expired (ok) or woken (!ok), the rooms are read now either way
+                owner_->ReleaseRoomsCall(this);
+                Answer();
+                break;
+            case kFinishing:
+                delete this;
+                break;
+            }
+        }
+
+        // called by HoldRoomsCall under its lock, so a wake never misses the alarm
+        void Hold(int wait_ms) {
+            state_ = kHeld;
+            alarm_.Set(cq_, std::chrono::system_clock::now() + std::chrono::milliseconds(wait_ms), this);
+        }
+
+        // thread safe, the alarm fires at once
+        void Wake() { alarm_.Cancel(); }
 
-        // 获取消息内容
-        const Protocol::Proto& proto = request->proto();
+    private:
+        enum State { kRequested, kHeld, kFinishing };
 
-        // 发送给指定的keys
-        for (const auto& key : request->keys()) {
-            // TODO: 实现具体的消息推送逻辑
+        CometRoomsCall(CometServiceImpl* owner, grpc::ServerCompletionQueue* cq)
+            : owner_(owner), cq_(cq), responder_(&context_) {
+            owner_->service_.RequestRooms(&context_, &request_, &responder_, cq_, cq_, this);
         }
 
+        void Answer() {
+            grpc::Status status = owner_->Rooms(&context_, &request_, &reply_);
+            state_ = kFinishing;
+            responder_.Finish(reply_, status, this);
+        }
+
+        CometServiceImpl* owner_;
+        grpc::ServerCompletionQueue* cq_;
+        State state_ = kRequested;
+        Comet::RoomsReq request_;
+        Comet::RoomsReply reply_;
+        grpc::ServerContext context_;
+        grpc::ServerAsyncResponseWriter<Comet::RoomsReply> responder_;
+        grpc::Alarm alarm_;
+    };
+
+    CometServiceImpl::~CometServiceImpl() {
+        Shutdown();
+    }
+
+    bool CometServiceImpl::Start(const std::string& address, int cq_threads) {
+        if (cq_threads <= 0) {
+            cq_threads = 1;
+        }
+
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+        builder.RegisterService(&service_);
+        for (int i = 0; i < cq_threads; i++) {
+            cqs_.push_back(builder.AddCompletionQueue());
+        }
+        server_ = builder.BuildAndStart();
+        if (!server_) {
+            LOG_ERROR << "gRPC server failed to listen on " << address;
+            cqs_.clear();
+            return false;
+        }
+
+        for (auto& cq : cqs_) {
+            grpc::ServerCompletionQueue* cq_ptr = cq.get();
+            threads_.emplace_back([this, cq_ptr]() { HandleRpcs(cq_ptr); });
+        }
+        ConnShardManager::GetInstance().SetRoomsChangedCallback([this]() { WakeRoomsCalls(false); });
+        LOG_INFO << "gRPC Server listening on " << address << ", cq threads: " << cq_threads;
+        return true;
+    }
+
+    void CometServiceImpl::Shutdown() {
+        if (!server_) {
+            return;
+        }
+        // held Rooms calls would keep the server waiting until their wait_ms
+        ConnShardManager::GetInstance().SetRoomsChangedCallback(nullptr);
+        WakeRoomsCalls(true);
+        // a PushStream stays open until the job closes it, cancel whatever is left after a grace period
+        server_->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(1));
+        // the cqs must be drained after the server is shut down
+        for (auto& cq : cqs_) {
+            cq->Shutdown();
+        }
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+        threads_.clear();
+        cqs_.clear();
+        server_.reset();
+    }
+
+    void CometServiceImpl::HandleRpcs(grpc::ServerCompletionQueue* cq) {
+        CometUnaryCall<Comet::PushMsgReq, Comet::PushMsgReply>::Spawn(this, cq,
+            &Comet::Comet::AsyncService::RequestPushMsg, &CometServiceImpl::PushMsg);
+        CometUnaryCall<Comet::BroadcastReq, Comet::BroadcastReply>::Spawn(this, cq,
+            &Comet::Comet::AsyncService::RequestBroadcast, &CometServiceImpl::Broadcast);
+        CometUnaryCall<Comet::BroadcastRoomReq, Comet::BroadcastRoomReply>::Spawn(this, cq,
+            &Comet::Comet::AsyncService::RequestBroadcastRoom, &CometServiceImpl::BroadcastRoom);
+        CometUnaryCall<Comet::BroadcastRoomBatchReq, Comet::BroadcastRoomBatchReply>::Spawn(this, cq,
+            &Comet::Comet::AsyncService::RequestBroadcastRoomBatch, &CometServiceImpl::BroadcastRoomBatch);
+        CometRoomsCall::Spawn(this, cq);
+        CometUnaryCall<Comet::UsersReq, Comet::UsersReply>::Spawn(this, cq,
+            &Comet::Comet::AsyncService::RequestUsers, &CometServiceImpl::Users);
+        CometPushStreamCall::Spawn(this, cq);
+
+        void* tag;
+        bool ok;
+        while (cq->Next(&tag, &ok)) {
+            static_cast<CometCall*>(tag)->Proceed(ok);
+        }
+    }
+
+    grpc::Status CometServiceImpl::PushMsg(grpc::ServerContext* context,
+        const Comet::PushMsgReq* request,
+        Comet::PushMsgReply* response) {
+        LOG_DEBUG << "PushMsg called, keys: " << request->keys_size();
+        return DispatchPushKeys(request->keys(), request->proto());
+    }
+
+    grpc::Status CometServiceImpl::DispatchPushKeys(const google::protobuf::RepeatedPtrField<std::string>& keys,
+        const Protocol::Proto& proto) {
+        // key 即用户id, 不在本节点的用户直接跳过
+        std::vector<std::string> user_ids(keys.begin(), keys.end());
+        WebSocketBroadcastFrame ws_frame = BuildBroadcastFrame(proto.body());
+        size_t found = ConnShardManager::GetInstance().PushToUsers(user_ids, ws_frame);
+        LOG_DEBUG << "PushMsg to " << found << "/" << user_ids.size() << " local users";
         return grpc::Status::OK;
     }
 
@@ -29,19 +299,32 @@ namespace ChatRoom {
         const Comet::BroadcastReq* request,
         Comet::BroadcastReply* response) {
         LOG_INFO << "Broadcast called";
+        return DispatchBroadcast(request->proto(), request->speed());
+    }
 
+    grpc::Status CometServiceImpl::DispatchBroadcast(const Protocol::Proto& proto, int speed) {
         // 获取广播消息
-        const Protocol::Proto& proto = request->proto();
-        int speed = request->speed();
         int operation = proto.op();  // 获取操作码
         const std::string& message_json = proto.body();
+
+        // logic 推送的会话密钥状态, comet 自己消费, 不转发给用户
+        if (operation == kOpSessionState) {
+            if (!CSessionTokenCodec::GetInstance().ApplyState(message_json)) {
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "bad session state");
+            }
+            return grpc::Status::OK;
+        }
         
         LOG_INFO << "Broadcasting message to all users:";
         LOG_INFO << "  Operation: " << operation;
         LOG_INFO << "  Message: " << message_json;
         
         // 检查是否是房间创建消息
+        bool ahead = false;
         if (operation == 5) {
+            // 在线用户立即订阅了新房间, 房间消息不等限速广播; 创建通知也不能限速或排队,
+            // 否则用户会先收到房间消息, 后收到房间
+            ahead = true;
             LOG_INFO << "Processing room creation broadcast";
             // 解析 JSON 消息获取房间信息
             Json::Value root;
@@ -64,16 +347,10 @@ namespace ChatRoom {
                     PubSubService& pubsub = PubSubService::GetInstance();
                     pubsub.AddRoomTopic(room_id, room_name, creator_id);
                     
-                    // 为所有在线用户订阅该房间
-                    {
-                        std::lock_guard<std::mutex> lock(s_mtx_user_ws_conn_map);
-                        for (const auto& user_pair : s_user_ws_conn_map) {
-                            const string& userId = user_pair.first;
-                            pubsub.AddSubscriber(room_id, userId);
-                            LOG_DEBUG << "Added user " << userId << " to room " << room_id;
-                        }
-                        LOG_INFO << "Added " << s_user_ws_conn_map.size() << " users to room " << room_id;
-                    }
+                    // 为所有在线用户订阅该房间, 由各 loop 在自己的分片内完成
+                    pubsub.AddAllSubscribers(room_id);
+                    LOG_INFO << "Added " << ConnShardManager::GetInstance().GetConnectionCount()
+                             << " users to room " << room_id;
                     
                     // 添加房间到全局房间列表
                     Room room;
@@ -93,29 +370,15 @@ namespace ChatRoom {
             }
         }
         
-        // 构造WebSocket帧
-        std::string ws_frame = BuildWebSocketFrame(message_json, 0x01);
+        // 构造WebSocket帧, 只编码(压缩)一次, 所有连接共享同一份帧
+        WebSocketBroadcastFrame ws_frame = BuildBroadcastFrame(message_json);
         
-        // 广播给所有在线用户
-        {
-            std::lock_guard<std::mutex> lock(s_mtx_user_ws_conn_map);
-            LOG_INFO << "Broadcast to " << s_user_ws_conn_map.size() << " online users";
-            
-            for (const auto& user_pair : s_user_ws_conn_map) {
-                const string& userId = user_pair.first;
-                CHttpConnPtr ws_conn_ptr = user_pair.second;
-                
-                if (ws_conn_ptr) {
-                    ws_conn_ptr->send(ws_frame);
-                    LOG_DEBUG << "Broadcast message sent to user: " << userId;
-                }
-                else {
-                    LOG_WARN << "Invalid connection for user: " << userId;
-                }
-            }
-        }
-        
-        LOG_INFO << "Broadcast completed successfully";
+        // 广播给所有在线用户, 每个 loop 投递一个批量任务; speed > 0 时按每秒写出的连接数限速
+        LOG_INFO << "Broadcast to " << ConnShardManager::GetInstance().GetConnectionCount()
+                 << " online users, speed: " << (ahead ? 0 : speed);
+        ConnShardManager::GetInstance().Broadcast(ws_frame, speed, ahead);
+
+        LOG_INFO << "Broadcast dispatched to all loops";
 
         return grpc::Status::OK;
     }
@@ -123,63 +386,235 @@ namespace ChatRoom {
     grpc::Status CometServiceImpl::BroadcastRoom(grpc::ServerContext* context, 
         const Comet::BroadcastRoomReq* request,
         Comet::BroadcastRoomReply* response) {
+        LOG_INFO << "BroadcastRoom called, roomID: " << request->roomid() << " proto: " << request->proto().body();
+        return DispatchBroadcastRoom(request->roomid(), request->proto());
+    }
 
-        // 获取房间ID和消息内容
-        const std::string& room_id = request->roomid();
-        const Protocol::Proto& proto = request->proto();
-        const std::string& message_json = proto.body();
-        
-        LOG_INFO << "BroadcastRoom called, roomID: " << request->roomid() << " proto: " << proto.body();
-        
-        // 使用PubSubService广播到指定房间
-        PubSubService& pubsub = PubSubService::GetInstance();
-
+    grpc::Status CometServiceImpl::DispatchBroadcastRoom(const std::string& room_id, const Protocol::Proto& proto) {
         // proto.body()包含完整的serverMessages格式JSON
-        std::string ws_frame = BuildWebSocketFrame(proto.body(), 0x01);
-        
-        auto callback = [ws_frame, room_id](std::unordered_set<string>& user_ids) {
-            LOG_INFO << "room_id:" << room_id << ", callback " << ", user_ids.size(): " << user_ids.size();
-            for (const string& userId : user_ids) {
-                CHttpConnPtr ws_conn_ptr = nullptr;
-
-                {
-                    std::lock_guard<std::mutex> lock(s_mtx_user_ws_conn_map);
-                    auto it = s_user_ws_conn_map.find(userId);
-                    if (it != s_user_ws_conn_map.end()) {
-                        ws_conn_ptr = it->second;
+        WebSocketBroadcastFrame ws_frame = BuildBroadcastFrame(proto.body());
+
+        // 广播给房间内所有用户, 每个 loop 在自己的分片内完成 fan-out
+        PubSubService::GetInstance().PubSubMessage(room_id, ws_frame);
+
+        return grpc::Status::OK;
+    }
+
+    grpc::Status CometServiceImpl::BroadcastRoomBatch(grpc::ServerContext* context,
+        const Comet::BroadcastRoomBatchReq* request,
+        Comet::BroadcastRoomBatchReply* response) {
+        std::vector<RoomPushRef> pushes;
+        pushes.reserve(request->rooms_size());
+        for (const auto& room : request->rooms()) {
+            pushes.emplace_back(&room.roomid(), &room.proto());
+        }
+        int failed = DispatchRoomPushes(pushes);
+        LOG_DEBUG << "BroadcastRoomBatch, pushes: " << pushes.size() << ", failed: " << failed;
+        if (failed == static_cast<int>(pushes.size()) && failed > 0) {
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "missing roomID");
+        }
+        return grpc::Status::OK;
+    }
+
+    // serverMessages of the room, its messages can be appended to another one of the same room
+    static bool IsMergeableRoomMessages(const Json::Value& root, const std::string& room_id) {
+        if (!root.isObject() || root["type"].asString() != "serverMessages") {
+            return false;
+        }
+        const Json::Value& payload = root["payload"];
+        return payload.isObject() && payload["roomId"].asString() == room_id && payload["messages"].isArray();
+    }
+
+    int CometServiceImpl::DispatchRoomPushes(const std::vector<RoomPushRef>& pushes) {
+        if (pushes.empty()) {
+            return 0;
+        }
+
+        // 只有一个批次里出现多次的房间才需要解析合并
+        std::unordered_map<std::string, int> room_counts;
+        for (const auto& push : pushes) {
+            room_counts[*push.first]++;
+        }
+
+        struct RoomBody {
+            const std::string* room_id;
+            const std::string* body;    // the original body, used as is when nothing is merged into it
+            Json::Value merged;
+            int parts;
+        };
+        std::vector<RoomBody> bodies;
+        std::unordered_map<std::string, size_t> open_bodies;   // room_id -> the body later messages are appended to
+        Json::Reader reader;
+        int failed = 0;
+        for (const auto& push : pushes) {
+            const std::string& room_id = *push.first;
+            const std::string& body = push.second->body();
+            if (room_id.empty()) {
+                failed++;
+                continue;
+            }
+
+            if (room_counts[room_id] > 1) {
+                Json::Value root;
+                if (reader.parse(body, root) && IsMergeableRoomMessages(root, room_id)) {
+                    auto it = open_bodies.find(room_id);
+                    if (it != open_bodies.end()) {
+                        RoomBody& open = bodies[it->second];
+                        Json::Value& messages = open.merged["payload"]["messages"];
+                        for (const auto& message : root["payload"]["messages"]) {
+                            messages.append(message);
+                        }
+                        open.parts++;
+                        continue;
                     }
+                    open_bodies[room_id] = bodies.size();
+                    bodies.push_back({&room_id, &body, std::move(root), 1});
+                    continue;
                 }
+                // 不能合并的消息保持原有顺序, 之后的消息不再合并到它前面
+                open_bodies.erase(room_id);
+            }
+            bodies.push_back({&room_id, &body, Json::Value(), 1});
+        }
 
-                if (ws_conn_ptr) {
-                    ws_conn_ptr->send(ws_frame);
-                    LOG_DEBUG << "Message sent to user: " << userId;
-                }
-                else {
-                    LOG_WARN << "can't find userid: " << userId;
-                }
+        // 每条消息只编码(压缩)一次, 所有房间打包成每个 loop 一个任务
+        RoomFrames frames;
+        frames.reserve(bodies.size());
+        Json::FastWriter writer;
+        writer.omitEndingLineFeed();
+        for (const auto& room_body : bodies) {
+            if (room_body.parts > 1) {
+                frames.emplace_back(*room_body.room_id, BuildBroadcastFrame(writer.write(room_body.merged)));
             }
-        };
+            else {
+                frames.emplace_back(*room_body.room_id, BuildBroadcastFrame(*room_body.body));
+            }
+        }
+        if (frames.size() < pushes.size()) {
+            LOG_DEBUG << "Merged " << pushes.size() << " room pushes into " << frames.size() << " frames";
+        }
+        PubSubService::GetInstance().PubSubMessages(std::move(frames));
+        return failed;
+    }
 
-        // 广播给房间内所有用户
-        PubSubService::GetInstance().PubSubMessage(room_id, callback);
+    bool CometServiceImpl::ClaimPushBatch(uint64_t epoch, uint64_t seq) {
+        // job 重启或下线后 epoch 不再出现, 超过上限时淘汰最久没用的
+        static const size_t kMaxPushEpochs = 256;
+        std::lock_guard<std::mutex> lock(push_epochs_mutex_);
+        auto it = push_epochs_.find(epoch);
+        if (it == push_epochs_.end()) {
+            if (push_epochs_.size() >= kMaxPushEpochs) {
+                push_epochs_.erase(std::min_element(push_epochs_.begin(), push_epochs_.end(),
+                    [](const std::pair<const uint64_t, PushEpoch>& a, const std::pair<const uint64_t, PushEpoch>& b) {
+                        return a.second.used < b.second.used;
+                    }));
+            }
+            it = push_epochs_.emplace(epoch, PushEpoch{0, 0}).first;
+        }
+        if (seq <= it->second.seq) {
+            return false;
+        }
+        // 分发前就记下, 旧流上正在处理的批次与新流上的重发不会都推送
+        it->second.seq = seq;
+        it->second.used = ++push_epoch_clock_;
+        return true;
+    }
 
-        return grpc::Status::OK;
+    void CometServiceImpl::HandlePushBatch(const Comet::PushBatch& batch, Comet::PushAck* ack) {
+        ack->set_seq(batch.seq());
+        // 断线前已处理但应答丢失的批次, 重连后会被重发, 只补应答
+        if (batch.epoch() != 0 && !ClaimPushBatch(batch.epoch(), batch.seq())) {
+            LOG_DEBUG << "PushBatch " << batch.seq() << " of epoch " << batch.epoch() << " already applied";
+            return;
+        }
+
+        int failed = 0;
+        // 全局广播是屏障: 之前的房间推送先发出, 例如房间创建之后才能推送该房间的消息
+        std::vector<RoomPushRef> room_pushes;
+        for (const auto& item : batch.items()) {
+            if (item.keys_size() == 0 && !item.roomid().empty()) {
+                room_pushes.emplace_back(&item.roomid(), &item.proto());
+                continue;
+            }
+            failed += DispatchRoomPushes(room_pushes);
+            room_pushes.clear();
+            grpc::Status status = item.keys_size() > 0 ? DispatchPushKeys(item.keys(), item.proto())
+                                                       : DispatchBroadcast(item.proto(), item.speed());
+            if (!status.ok()) {
+                failed++;
+            }
+        }
+        failed += DispatchRoomPushes(room_pushes);
+
+        ack->set_failed(failed);
+        LOG_DEBUG << "PushBatch " << batch.seq() << ", items: " << batch.items_size() << ", failed: " << failed;
     }
 
     grpc::Status CometServiceImpl::Rooms(grpc::ServerContext* context,
         const Comet::RoomsReq* request,
         Comet::RoomsReply* response) {
-        LOG_INFO << "Rooms called";
+        LOG_DEBUG << "Rooms called";
 
-        // 获取所有房间列表
-        auto& pubsub = PubSubService::GetInstance();
-        // const auto& rooms = pubsub.GetAllRooms();
+        // 本节点有订阅者的房间, job 据此只把房间消息推给有成员的 comet
+        ConnShardManager& manager = ConnShardManager::GetInstance();
+        uint64_t version = 0;
+        auto* rooms = response->mutable_rooms();
+        for (const auto& room_id : manager.GetActiveRooms(&version)) {
+            (*rooms)[room_id] = true;
+        }
+        response->set_epoch(manager.GetEpoch());
+        response->set_version(version);
 
-        // // 填充响应
-        // for (const auto& room : rooms) {
-        //     (*response->mutable_rooms())[room.first] = true;
-        // }
+        return grpc::Status::OK;
+    }
+
+    bool CometServiceImpl::HoldRoomsCall(CometRoomsCall* call, const Comet::RoomsReq& request) {
+        // below the job's deadline of the call
+        static const int kMaxRoomsWaitMs = 60000;
+        if (request.wait_ms() <= 0) {
+            return false;
+        }
+        ConnShardManager& manager = ConnShardManager::GetInstance();
+        std::lock_guard<std::mutex> lock(rooms_calls_mutex_);
+        // a version bumped after this check waits for the lock in WakeRoomsCalls
+        if (rooms_calls_closed_ || request.epoch() != manager.GetEpoch()
+            || request.version() != manager.GetRoomsVersion()) {
+            return false;
+        }
+        call->Hold(std::min(request.wait_ms(), kMaxRoomsWaitMs));
+        rooms_calls_.insert(call);
+        return true;
+    }
 
+    void CometServiceImpl::ReleaseRoomsCall(CometRoomsCall* call) {
+        std::lock_guard<std::mutex> lock(rooms_calls_mutex_);
+        rooms_calls_.erase(call);
+    }
+
+    void CometServiceImpl::WakeRoomsCalls(bool close) {
+        std::lock_guard<std::mutex> lock(rooms_calls_mutex_);
+        if (close) {
+            rooms_calls_closed_ = true;
+        }
+        for (CometRoomsCall* call : rooms_calls_) {
+            call->Wake();
+        }
+    }
+
+    grpc::Status CometServiceImpl::Users(grpc::ServerContext* context,
+        const Comet::UsersReq* request,
+        Comet::UsersReply* response) {
+        UserChanges changes;
+        ConnShardManager::GetInstance().GetUserChanges(request->epoch(), request->since(), &changes);
+        response->set_epoch(changes.epoch);
+        response->set_version(changes.version);
+        response->set_full(changes.full);
+        for (auto& user_id : changes.online) {
+            response->add_online(std::move(user_id));
+        }
+        for (auto& user_id : changes.offline) {
+            response->add_offline(std::move(user_id));
+        }
         return grpc::Status::OK;
     }
 
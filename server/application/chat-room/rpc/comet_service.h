@@ -1,27 +1,113 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include <grpcpp/grpcpp.h>
 #include "ChatRoom.Comet.grpc.pb.h"
 
 namespace ChatRoom {
 
-class CometServiceImpl final : public Comet::Comet::Service {
+class CometRoomsCall;
+
+/**
+ * ChatRoom.Comet on the async completion queue API
+ * every cq has its own polling thread, a handler only builds the frame and posts the
+ * fan-out to the io loops, the reply is sent as soon as the broadcast is enqueued
+ * the job keeps one PushStream open and sends batches of pushes on it, acked by seq,
+ * batches it resends after a reconnect are skipped by (epoch, seq),
+ * pushes of the same room in a batch (or a BroadcastRoomBatch) go out as one frame
+ */
+class CometServiceImpl {
 public:
-    grpc::Status PushMsg(grpc::ServerContext* context, 
+    CometServiceImpl() = default;
+    ~CometServiceImpl();
+
+    CometServiceImpl(const CometServiceImpl&) = delete;
+    CometServiceImpl& operator=(const CometServiceImpl&) = delete;
+
+    // cq_threads: completion queues (and threads) serving calls
+    bool Start(const std::string& address, int cq_threads);
+    void Shutdown();
+
+private:
+    template <class Request, class Reply> friend class CometUnaryCall;
+    friend class CometPushStreamCall;
+    friend class CometRoomsCall;
+
+    grpc::Status PushMsg(grpc::ServerContext* context,
                         const Comet::PushMsgReq* request,
-                        Comet::PushMsgReply* response) override;
+                        Comet::PushMsgReply* response);
 
     grpc::Status Broadcast(grpc::ServerContext* context,
-                         const Comet::BroadcastReq* request, 
-                         Comet::BroadcastReply* response) override;
+                         const Comet::BroadcastReq* request,
+                         Comet::BroadcastReply* response);
 
     grpc::Status BroadcastRoom(grpc::ServerContext* context,
                               const Comet::BroadcastRoomReq* request,
-                              Comet::BroadcastRoomReply* response) override;
+                              Comet::BroadcastRoomReply* response);
+
+    grpc::Status BroadcastRoomBatch(grpc::ServerContext* context,
+                                   const Comet::BroadcastRoomBatchReq* request,
+                                   Comet::BroadcastRoomBatchReply* response);
 
     grpc::Status Rooms(grpc::ServerContext* context,
                       const Comet::RoomsReq* request,
-                      Comet::RoomsReply* response) override;
+                      Comet::RoomsReply* response);
+
+    grpc::Status Users(grpc::ServerContext* context,
+                      const Comet::UsersReq* request,
+                      Comet::UsersReply* response);
+
+    // shared by the unary calls and PushStream, return once the fan-out is enqueued
+    // speed: conns written per second, 0 writes them at once
+    grpc::Status DispatchBroadcast(const Protocol::Proto& proto, int speed = 0);
+    grpc::Status DispatchBroadcastRoom(const std::string& room_id, const Protocol::Proto& proto);
+    grpc::Status DispatchPushKeys(const google::protobuf::RepeatedPtrField<std::string>& keys,
+                                  const Protocol::Proto& proto);
+
+    // (roomID, proto) borrowed from the request
+    typedef std::pair<const std::string*, const Protocol::Proto*> RoomPushRef;
+    // room pushes of one batch, same-room payloads are merged into one frame and every room is
+    // fanned out by one task per loop, returns the number of rejected pushes
+    int DispatchRoomPushes(const std::vector<RoomPushRef>& pushes);
+
+    // one PushStream batch, an item with keys pushes to those users, an empty roomID is a broadcast
+    void HandlePushBatch(const Comet::PushBatch& batch, Comet::PushAck* ack);
+    // false if the batch's stream already had a batch with seq at or beyond it
+    bool ClaimPushBatch(uint64_t epoch, uint64_t seq);
+
+    // a Rooms call with wait_ms is held while the rooms version is still the caller's,
+    // false if it has to be answered at once
+    bool HoldRoomsCall(CometRoomsCall* call, const Comet::RoomsReq& request);
+    void ReleaseRoomsCall(CometRoomsCall* call);
+    // a room got its first member, answer the held calls; closing also stops holding new ones
+    void WakeRoomsCalls(bool close);
+
+    // one pending call per method on each cq, then poll it until shutdown
+    void HandleRpcs(grpc::ServerCompletionQueue* cq);
+
+    Comet::Comet::AsyncService service_;
+    std::unique_ptr<grpc::Server> server_;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs_;
+    std::vector<std::thread> threads_;
+
+    std::mutex rooms_calls_mutex_;
+    std::unordered_set<CometRoomsCall*> rooms_calls_;      // held Rooms calls
+    bool rooms_calls_closed_ = false;
+
+    struct PushEpoch {
+        uint64_t seq;       // last batch claimed
+        uint64_t used;      // push_epoch_clock_ when it was claimed
+    };
+    std::mutex push_epochs_mutex_;
+    std::unordered_map<uint64_t, PushEpoch> push_epochs_;     // by PushBatch.epoch, one per job stream
+    uint64_t push_epoch_clock_ = 0;
 };
 
-} // namespace ChatRoom 
\ No newline at end of file
+} // namespace ChatRoom
@@ -0,0 +1,59 @@
+#include "backpressure.h"
+#include <sstream>
+
+bool Backpressure::ParsePolicy(const std::string& name, SlowConsumerPolicy* policy) {
+    if (name == "drop_oldest") {
+        *policy = SlowConsumerPolicy::kDropOldest;
+    }
+    else if (name == "coalesce") {
+        *policy = SlowConsumerPolicy::kCoalesce;
+    }
+    else if (name == "close") {
+        *policy = SlowConsumerPolicy::kClose;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+const char* Backpressure::PolicyName(SlowConsumerPolicy policy) {
+    switch (policy) {
+        case SlowConsumerPolicy::kDropOldest:
+            return "drop_oldest";
+        case SlowConsumerPolicy::kCoalesce:
+            return "coalesce";
+        case SlowConsumerPolicy::kClose:
+            return "close";
+        default:
+            return "unknown";
+    }
+}
+
+void Backpressure::BeforeBroadcast(const TcpConnectionPtr& conn) {
+    if (conn->pendingOutputBytes() < config_.high_water_mark) {
+        return;
+    }
+
+    if (config_.policy == SlowConsumerPolicy::kDropOldest) {
+        size_t dropped = conn->discardQueuedSharedOutput(config_.high_water_mark / 2);
+        stats_.dropped_frames.fetch_add(dropped, std::memory_order_relaxed);
+    }
+    else if (config_.policy == SlowConsumerPolicy::kCoalesce) {
+        // the new frame supersedes all queued broadcasts
+        size_t coalesced = conn->discardQueuedSharedOutput(0);
+        stats_.coalesced_frames.fetch_add(coalesced, std::memory_order_relaxed);
+    }
+    // kClose: keep queueing, the timer armed by high water mark callback closes it
+}
+
+std::string Backpressure::StatsString() {
+    std::ostringstream oss;
+    oss << "policy: " << PolicyName(config_.policy)
+        << ", high_water_mark: " << config_.high_water_mark
+        << ", high_water_events: " << stats_.high_water_events.load(std::memory_order_relaxed)
+        << ", dropped_frames: " << stats_.dropped_frames.load(std::memory_order_relaxed)
+        << ", coalesced_frames: " << stats_.coalesced_frames.load(std::memory_order_relaxed)
+        << ", closed_conns: " << stats_.closed_conns.load(std::memory_order_relaxed);
+    return oss.str();
+}
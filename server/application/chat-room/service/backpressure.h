@@ -0,0 +1,68 @@
+/**
+ * 慢消费者背压策略
+ *
+ * 连接的待发送字节超过高水位后, 按配置的策略处理后续广播:
+ *   drop_oldest: 丢弃最旧的、尚未开始发送的广播帧, 直到回落到高水位的一半
+ *   coalesce:    只保留最新的一条广播帧, 之前排队未发送的广播帧全部合并掉
+ *   close:       超过高水位持续 N 秒后以 1008 关闭连接
+ * 控制帧和单播回复不会被丢弃
+ */
+#ifndef __BACKPRESSURE_H__
+#define __BACKPRESSURE_H__
+
+#include <atomic>
+#include <string>
+#include "muduo/net/TcpConnection.h"
+
+using muduo::net::TcpConnectionPtr;
+using muduo::net::SharedBytesPtr;
+
+enum class SlowConsumerPolicy {
+    kDropOldest,
+    kCoalesce,
+    kClose,
+};
+
+struct BackpressureConfig {
+    size_t high_water_mark = 4 * 1024 * 1024;   // bytes pending per connection
+    SlowConsumerPolicy policy = SlowConsumerPolicy::kDropOldest;
+    double close_after_seconds = 10.0;          // only for kClose
+};
+
+// counters of all connections, read by any thread
+struct BackpressureStats {
+    std::atomic<uint64_t> high_water_events{0};     // connections crossed the mark
+    std::atomic<uint64_t> dropped_frames{0};        // kDropOldest
+    std::atomic<uint64_t> coalesced_frames{0};      // kCoalesce
+    std::atomic<uint64_t> closed_conns{0};          // kClose
+};
+
+class Backpressure {
+public:
+    static Backpressure& GetInstance() {
+        static Backpressure instance;
+        return instance;
+    }
+
+    void SetConfig(const BackpressureConfig& config) { config_ = config; }
+    const BackpressureConfig& GetConfig() const { return config_; }
+    BackpressureStats& GetStats() { return stats_; }
+
+    // parse "drop_oldest", "coalesce" or "close", false if unknown
+    static bool ParsePolicy(const std::string& name, SlowConsumerPolicy* policy);
+    static const char* PolicyName(SlowConsumerPolicy policy);
+
+    // make room for a broadcast frame by policy, must be called in loop thread of conn
+    void BeforeBroadcast(const TcpConnectionPtr& conn);
+
+    // one line summary of the counters
+    std::string StatsString();
+
+private:
+    Backpressure() = default;
+
+    BackpressureConfig config_;
+    BackpressureStats stats_;
+};
+
+#endif // !__BACKPRESSURE_H__
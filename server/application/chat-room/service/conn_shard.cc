@@ -0,0 +1,452 @@
+#include "conn_shard.h"
+#include "muduo/base/Logging.h"
+#include <algorithm>
+#include <chrono>
+
+// =====================ConnShard=======================
+void ConnShard::AddConnection(const string& user_id, const CHttpConnPtr& conn) {
+    loop_->assertInLoopThread();
+    // the same userid maybe exists, because websocket conn maybe don't close
+    // force insert(update), the new conn subscribes its rooms again after hello
+    CHttpConnPtr& slot = user_conns_[user_id];
+    if (slot && slot != conn) {
+        RemoveFromRooms(slot.get());
+    }
+    slot = conn;
+}
+
+void ConnShard::RemoveConnection(const string& user_id, const CHttpConn* conn) {
+    loop_->assertInLoopThread();
+    auto it = user_conns_.find(user_id);
+    if (it == user_conns_.end()) {
+        return;
+    }
+    // the user maybe reconnected on this loop, keep the newer conn
+    if (conn && it->second.get() != conn) {
+        return;
+    }
+    RemoveFromRooms(it->second.get());
+    user_conns_.erase(it);
+    LOG_DEBUG << "ConnShard remove user_id: " << user_id << ", local conns: " << user_conns_.size();
+}
+
+void ConnShard::AddSubscriber(const string& room_id, const string& user_id) {
+    loop_->assertInLoopThread();
+    auto user_it = user_conns_.find(user_id);
+    if (user_it == user_conns_.end()) {
+        return;
+    }
+
+    const CHttpConnPtr& conn = user_it->second;
+    if (!conn_rooms_[conn.get()].insert(room_id).second) {
+        return;
+    }
+    // 多个用户同时进房(例如重启后的重连)时, 每个房间每轮 loop 只复制一次订阅列表
+    pending_joins_[room_id].push_back(conn);
+    if (!flush_scheduled_) {
+        flush_scheduled_ = true;
+        loop_->queueInLoop([this]() { FlushJoins(); });
+    }
+}
+
+void ConnShard::FlushJoins() {
+    loop_->assertInLoopThread();
+    flush_scheduled_ = false;
+    for (auto& join : pending_joins_) {
+        if (join.second.empty()) {
+            continue;
+        }
+        std::vector<CHttpConnPtr> conns;
+        auto room_it = room_subscribers_.find(join.first);
+        if (room_it != room_subscribers_.end()) {
+            const std::vector<CHttpConnPtr>& old_conns = room_it->second->conns;
+            conns.reserve(old_conns.size() + join.second.size());
+            conns.assign(old_conns.begin(), old_conns.end());
+        }
+        conns.insert(conns.end(), join.second.begin(), join.second.end());
+        PublishRoom(join.first, std::move(conns));
+    }
+    pending_joins_.clear();
+}
+
+void ConnShard::AddAllSubscribers(const string& room_id) {
+    loop_->assertInLoopThread();
+    std::vector<CHttpConnPtr> conns;
+    conns.reserve(user_conns_.size());
+    for (const auto& user_pair : user_conns_) {
+        conns.push_back(user_pair.second);
+        conn_rooms_[user_pair.second.get()].insert(room_id);
+    }
+    // 尚未发布的加入都是当前连接, 已经包含在内
+    pending_joins_.erase(room_id);
+    PublishRoom(room_id, std::move(conns));
+}
+
+void ConnShard::Broadcast(const WebSocketBroadcastFrame& frame, bool ahead) {
+    loop_->assertInLoopThread();
+    // 限速广播还没写完时排在它后面, 保持广播之间的顺序
+    if (paced_.Busy() && !ahead) {
+        BroadcastPaced(frame, 0);
+        return;
+    }
+    for (const auto& user_pair : user_conns_) {
+        user_pair.second->SendBroadcast(frame.Select(user_pair.second->AcceptsDeflatedBroadcast()));
+    }
+}
+
+void ConnShard::BroadcastPaced(const WebSocketBroadcastFrame& frame, double rate) {
+    loop_->assertInLoopThread();
+    std::vector<CHttpConnPtr> conns;
+    conns.reserve(user_conns_.size());
+    for (const auto& user_pair : user_conns_) {
+        conns.push_back(user_pair.second);
+    }
+    paced_.Add(frame, std::move(conns), rate);
+}
+
+void ConnShard::BroadcastRoom(const string& room_id, const WebSocketBroadcastFrame& frame) {
+    loop_->assertInLoopThread();
+    // hold the current version, a new one published during fan-out doesn't affect it
+    RoomSubscribersPtr subscribers = GetRoomSubscribers(room_id);
+    if (!subscribers) {
+        return;
+    }
+
+    for (const CHttpConnPtr& conn : subscribers->conns) {
+        conn->SendBroadcast(frame.Select(conn->AcceptsDeflatedBroadcast()));
+    }
+}
+
+void ConnShard::BroadcastRooms(const RoomFrames& frames) {
+    for (const auto& room_frame : frames) {
+        BroadcastRoom(room_frame.first, room_frame.second);
+    }
+}
+
+void ConnShard::PushToUsers(const std::vector<string>& user_ids, const WebSocketBroadcastFrame& frame) {
+    loop_->assertInLoopThread();
+    for (const string& user_id : user_ids) {
+        auto it = user_conns_.find(user_id);
+        if (it != user_conns_.end()) {
+            it->second->SendBroadcast(frame.Select(it->second->AcceptsDeflatedBroadcast()));
+        }
+    }
+}
+
+RoomSubscribersPtr ConnShard::GetRoomSubscribers(const string& room_id) const {
+    loop_->assertInLoopThread();
+    auto it = room_subscribers_.find(room_id);
+    if (it == room_subscribers_.end()) {
+        return RoomSubscribersPtr();
+    }
+    return it->second;
+}
+
+void ConnShard::PublishRoom(const string& room_id, std::vector<CHttpConnPtr>&& conns) {
+    RoomSubscribersPtr& slot = room_subscribers_[room_id];
+    bool was_present = slot && !slot->conns.empty();
+    bool present = !conns.empty();
+    if (was_present != present) {
+        ConnShardManager::GetInstance().UpdateRoomPresence(room_id, present);
+    }
+    auto subscribers = std::make_shared<RoomSubscribers>();
+    subscribers->version = slot ? slot->version + 1 : 1;
+    subscribers->conns = std::move(conns);
+    slot = std::move(subscribers);
+}
+
+void ConnShard::RemoveFromRooms(const CHttpConn* conn) {
+    auto conn_it = conn_rooms_.find(conn);
+    if (conn_it == conn_rooms_.end()) {
+        return;
+    }
+    auto same_conn = [conn](const CHttpConnPtr& p) { return p.get() == conn; };
+    for (const string& room_id : conn_it->second) {
+        // 还没发布的加入直接撤销
+        auto pending_it = pending_joins_.find(room_id);
+        if (pending_it != pending_joins_.end()) {
+            std::vector<CHttpConnPtr>& joins = pending_it->second;
+            auto join_it = std::find_if(joins.begin(), joins.end(), same_conn);
+            if (join_it != joins.end()) {
+                joins.erase(join_it);
+                continue;
+            }
+        }
+
+        auto room_it = room_subscribers_.find(room_id);
+        if (room_it == room_subscribers_.end()) {
+            continue;
+        }
+        const std::vector<CHttpConnPtr>& old_conns = room_it->second->conns;
+        auto it = std::find_if(old_conns.begin(), old_conns.end(), same_conn);
+        if (it == old_conns.end()) {
+            continue;
+        }
+
+        std::vector<CHttpConnPtr> conns;
+        conns.reserve(old_conns.size() - 1);
+        conns.insert(conns.end(), old_conns.begin(), it);
+        conns.insert(conns.end(), it + 1, old_conns.end());
+        PublishRoom(room_id, std::move(conns));
+    }
+    conn_rooms_.erase(conn_it);
+}
+
+// =====================ConnShardManager=======================
+void ConnShardManager::Init(const std::vector<EventLoop*>& loops, int idle_seconds, int ping_seconds) {
+    shards_.clear();
+    {
+        std::lock_guard<std::mutex> lock(user_shard_mutex_);
+        user_epoch_ = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        epoch_.store(user_epoch_, std::memory_order_relaxed);
+    }
+    for (EventLoop* loop : loops) {
+        shards_.push_back(std::make_unique<ConnShard>(loop, idle_seconds, ping_seconds));
+        shards_.back()->GetIdleWheel()->Start();
+    }
+    LOG_INFO << "ConnShardManager initialized, shards: " << shards_.size()
+        << ", idle_seconds: " << idle_seconds << ", ping_seconds: " << ping_seconds;
+}
+
+size_t ConnShardManager::PushToUsers(const std::vector<string>& user_ids, const WebSocketBroadcastFrame& frame) {
+    // 按分片分组, 每个分片只投递一个任务
+    std::vector<std::pair<ConnShard*, std::vector<string>>> shard_users;
+    size_t found = 0;
+    {
+        std::lock_guard<std::mutex> lock(user_shard_mutex_);
+        for (const string& user_id : user_ids) {
+            auto it = user_shard_map_.find(user_id);
+            if (it == user_shard_map_.end()) {
+                continue;
+            }
+            ConnShard* shard = it->second.first;
+            auto group = std::find_if(shard_users.begin(), shard_users.end(),
+                [shard](const std::pair<ConnShard*, std::vector<string>>& p) { return p.first == shard; });
+            if (group == shard_users.end()) {
+                shard_users.emplace_back(shard, std::vector<string>());
+                group = shard_users.end() - 1;
+            }
+            group->second.push_back(user_id);
+            found++;
+        }
+    }
+
+    for (auto& group : shard_users) {
+        ConnShard* shard = group.first;
+        auto users = std::make_shared<std::vector<string>>(std::move(group.second));
+        shard->GetLoop()->runInLoop([shard, users, frame]() {
+            shard->PushToUsers(*users, frame);
+        });
+    }
+    return found;
+}
+
+void ConnShardManager::RecordUserChange(const string& user_id, bool online) {
+    user_changes_.emplace_back(user_id, online);
+    user_version_++;
+    if (user_changes_.size() > kMaxUserChanges) {
+        user_changes_.pop_front();
+    }
+}
+
+void ConnShardManager::GetUserChanges(uint64_t epoch, uint64_t since, UserChanges* changes) {
+    std::lock_guard<std::mutex> lock(user_shard_mutex_);
+    changes->epoch = user_epoch_;
+    changes->version = user_version_;
+    // user_changes_[i] is version oldest + i + 1
+    uint64_t oldest = user_version_ - user_changes_.size();
+    if (epoch != user_epoch_ || since < oldest || since > user_version_) {
+        changes->full = true;
+        changes->online.reserve(user_shard_map_.size());
+        for (const auto& user : user_shard_map_) {
+            changes->online.push_back(user.first);
+        }
+        return;
+    }
+
+    // 同一用户多次上下线只报告最后的状态
+    std::unordered_map<string, bool> last;
+    for (size_t i = static_cast<size_t>(since - oldest); i < user_changes_.size(); i++) {
+        last[user_changes_[i].first] = user_changes_[i].second;
+    }
+    for (const auto& user : last) {
+        (user.second ? changes->online : changes->offline).push_back(user.first);
+    }
+}
+
+std::vector<string> ConnShardManager::GetActiveRooms(uint64_t* version) const {
+    std::lock_guard<std::mutex> lock(room_presence_mutex_);
+    std::vector<string> rooms;
+    rooms.reserve(room_presence_.size());
+    for (const auto& room : room_presence_) {
+        rooms.push_back(room.first);
+    }
+    *version = rooms_version_;
+    return rooms;
+}
+
+uint64_t ConnShardManager::GetRoomsVersion() const {
+    std::lock_guard<std::mutex> lock(room_presence_mutex_);
+    return rooms_version_;
+}
+
+void ConnShardManager::SetRoomsChangedCallback(const std::function<void()>& cb) {
+    std::lock_guard<std::mutex> lock(room_presence_mutex_);
+    rooms_changed_callback_ = cb;
+}
+
+void ConnShardManager::UpdateRoomPresence(const string& room_id, bool present) {
+    std::function<void()> rooms_changed;
+    {
+        std::lock_guard<std::mutex> lock(room_presence_mutex_);
+        if (!present) {
+            auto it = room_presence_.find(room_id);
+            if (it != room_presence_.end() && --it->second <= 0) {
+                room_presence_.erase(it);
+            }
+            return;
+        }
+        if (room_presence_[room_id]++ > 0) {
+            return;
+        }
+        rooms_version_++;
+        rooms_changed = rooms_changed_callback_;
+    }
+    // the first member of the room here, the job stops skipping this comet for it; this runs
+    // before the shard publishes the subscriber, a push routed after the job heard of it
+    // reaches the new member
+    if (rooms_changed) {
+        rooms_changed();
+    }
+}
+
+CIdleWheel* ConnShardManager::GetIdleWheel(EventLoop* loop) const {
+    ConnShard* shard = GetShard(loop);
+    return shard ? shard->GetIdleWheel() : nullptr;
+}
+
+ConnShard* ConnShardManager::GetShard(EventLoop* loop) const {
+    for (const auto& shard : shards_) {
+        if (shard->GetLoop() == loop) {
+            return shard.get();
+        }
+    }
+    return nullptr;
+}
+
+void ConnShardManager::AddConnection(const string& user_id, const CHttpConnPtr& conn) {
+    ConnShard* shard = GetShard(conn->getLoop());
+    if (!shard) {
+        LOG_ERROR << "AddConnection(), no shard for user_id: " << user_id;
+        return;
+    }
+
+    ConnShard* old_shard = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(user_shard_mutex_);
+        auto it = user_shard_map_.find(user_id);
+        if (it != user_shard_map_.end()) {
+            old_shard = it->second.first;
+            LOG_DEBUG << "old websocket conn founded and will be cover, user_id: " << user_id;
+        }
+        else {
+            conn_count_.fetch_add(1, std::memory_order_relaxed);
+            RecordUserChange(user_id, true);
+        }
+        user_shard_map_[user_id] = std::make_pair(shard, conn.get());
+    }
+
+    // the old conn of the same user lives on another loop
+    if (old_shard && old_shard != shard) {
+        old_shard->GetLoop()->runInLoop([old_shard, user_id]() {
+            old_shard->RemoveConnection(user_id, nullptr);
+        });
+    }
+    shard->GetLoop()->runInLoop([shard, user_id, conn]() {
+        shard->AddConnection(user_id, conn);
+    });
+}
+
+void ConnShardManager::RemoveConnection(const string& user_id, const CHttpConnPtr& conn) {
+    ConnShard* shard = GetShard(conn->getLoop());
+    if (!shard) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(user_shard_mutex_);
+        auto it = user_shard_map_.find(user_id);
+        if (it != user_shard_map_.end() && it->second.second == conn.get()) {
+            user_shard_map_.erase(it);
+            conn_count_.fetch_sub(1, std::memory_order_relaxed);
+            RecordUserChange(user_id, false);
+        }
+    }
+
+    // hold conn until the task runs, so the address can't be reused by a newer conn
+    shard->GetLoop()->runInLoop([shard, user_id, conn]() {
+        shard->RemoveConnection(user_id, conn.get());
+    });
+}
+
+void ConnShardManager::AddSubscriber(const string& room_id, const string& user_id, const CHttpConnPtr& conn) {
+    ConnShard* shard = GetShard(conn->getLoop());
+    if (!shard) {
+        return;
+    }
+    shard->GetLoop()->runInLoop([shard, room_id, user_id]() {
+        shard->AddSubscriber(room_id, user_id);
+    });
+}
+
+void ConnShardManager::AddAllSubscribers(const string& room_id) {
+    for (const auto& shard_ptr : shards_) {
+        ConnShard* shard = shard_ptr.get();
+        shard->GetLoop()->runInLoop([shard, room_id]() {
+            shard->AddAllSubscribers(room_id);
+        });
+    }
+}
+
+void ConnShardManager::Broadcast(const WebSocketBroadcastFrame& frame, int speed, bool ahead) {
+    if (shards_.empty()) {
+        return;
+    }
+    // 连接大致均匀分布在各 loop 上, 总速度平分给每个分片
+    double rate = speed > 0 && !ahead ? static_cast<double>(speed) / shards_.size() : 0;
+    for (const auto& shard_ptr : shards_) {
+        ConnShard* shard = shard_ptr.get();
+        if (rate > 0) {
+            shard->GetLoop()->runInLoop([shard, frame, rate]() {
+                shard->BroadcastPaced(frame, rate);
+            });
+        }
+        else {
+            shard->GetLoop()->runInLoop([shard, frame, ahead]() {
+                shard->Broadcast(frame, ahead);
+            });
+        }
+    }
+}
+
+void ConnShardManager::BroadcastRoom(const string& room_id, const WebSocketBroadcastFrame& frame) {
+    for (const auto& shard_ptr : shards_) {
+        ConnShard* shard = shard_ptr.get();
+        shard->GetLoop()->runInLoop([shard, room_id, frame]() {
+            shard->BroadcastRoom(room_id, frame);
+        });
+    }
+}
+
+void ConnShardManager::BroadcastRooms(const RoomFramesPtr& frames) {
+    if (!frames || frames->empty()) {
+        return;
+    }
+    for (const auto& shard_ptr : shards_) {
+        ConnShard* shard = shard_ptr.get();
+        shard->GetLoop()->runInLoop([shard, frames]() {
+            shard->BroadcastRooms(*frames);
+        });
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * 按 EventLoop 分片的连接注册表和房间订阅索引
+ *
+ * 每个 IO EventLoop 持有一个 ConnShard, 连接只登记在其所属 loop 的分片上,
+ * 分片数据只在该 loop 线程内读写, 不需要加锁;
+ * 广播时每个 loop 投递一个批量任务, 由各 loop 线程并行完成 fan-out
+ * 房间订阅者是不可变的版本化列表, 直接保存连接句柄, 修改时整体替换(copy-on-write),
+ * 广播只持有当前版本的引用并遍历指针; 同一轮 loop 内的加入合并成一次替换,
+ * 连接订阅了哪些房间另有索引, 查重和断开时不用遍历列表
+ */
+#ifndef __CONN_SHARD_H__
+#define __CONN_SHARD_H__
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "muduo/base/noncopyable.h"
+#include "muduo/net/EventLoop.h"
+#include "http_conn.h"
+#include "websocket_deflate.h"
+#include "idle_wheel.h"
+#include "paced_broadcast.h"
+
+// immutable subscriber list of a room in one shard, a new version replaces it on every change
+struct RoomSubscribers {
+    uint64_t version = 0;
+    std::vector<CHttpConnPtr> conns;
+};
+
+using RoomSubscribersPtr = std::shared_ptr<const RoomSubscribers>;
+
+// frames of many rooms posted as one task per loop, in order
+using RoomFrames = std::vector<std::pair<string, WebSocketBroadcastFrame>>;
+using RoomFramesPtr = std::shared_ptr<const RoomFrames>;
+
+// one shard per IO EventLoop, only touched in its loop thread
+class ConnShard : muduo::noncopyable {
+public:
+    ConnShard(EventLoop* loop, int idle_seconds, int ping_seconds)
+        : loop_(loop), idle_wheel_(loop, idle_seconds, ping_seconds), paced_(loop) {}
+
+    EventLoop* GetLoop() const { return loop_; }
+    CIdleWheel* GetIdleWheel() { return &idle_wheel_; }
+
+    // the following must be called in loop_ thread
+    void AddConnection(const string& user_id, const CHttpConnPtr& conn);
+    void RemoveConnection(const string& user_id, const CHttpConn* conn);
+    // published by one task per loop iteration together with the other joins of the iteration
+    void AddSubscriber(const string& room_id, const string& user_id);
+    void AddAllSubscribers(const string& room_id);
+    // ahead: written at once even while a paced broadcast is running, for notices that later
+    // room pushes depend on
+    void Broadcast(const WebSocketBroadcastFrame& frame, bool ahead = false);
+    // writes at most rate conns per second, spread over loop ticks
+    void BroadcastPaced(const WebSocketBroadcastFrame& frame, double rate);
+    void BroadcastRoom(const string& room_id, const WebSocketBroadcastFrame& frame);
+    void BroadcastRooms(const RoomFrames& frames);
+    void PushToUsers(const std::vector<string>& user_ids, const WebSocketBroadcastFrame& frame);
+    // current version of the room, nullptr if nobody subscribed in this shard
+    RoomSubscribersPtr GetRoomSubscribers(const string& room_id) const;
+
+private:
+    void PublishRoom(const string& room_id, std::vector<CHttpConnPtr>&& conns);
+    void RemoveFromRooms(const CHttpConn* conn);
+    // publishes the pending joins, one new version per room
+    void FlushJoins();
+
+    EventLoop* loop_;
+    CIdleWheel idle_wheel_;                                                 // heartbeat and idle reaping
+    CPacedBroadcaster paced_;                                               // broadcasts with a speed
+    std::unordered_map<string, CHttpConnPtr> user_conns_;                   // user_id -> conn
+    std::unordered_map<string, RoomSubscribersPtr> room_subscribers_;       // room_id -> local subscribers
+    std::unordered_map<const CHttpConn*, std::unordered_set<string>> conn_rooms_;  // rooms joined, pending included
+    std::unordered_map<string, std::vector<CHttpConnPtr>> pending_joins_;  // room_id -> joins not published yet
+    bool flush_scheduled_ = false;
+};
+
+// connect/disconnect changes reported to the job, see ConnShardManager::GetUserChanges()
+struct UserChanges {
+    uint64_t epoch = 0;
+    uint64_t version = 0;
+    bool full = false;              // online lists every connected user
+    std::vector<string> online;
+    std::vector<string> offline;
+};
+
+// Shard manager: route every operation to the owner loop of the connection
+class ConnShardManager {
+public:
+    static ConnShardManager& GetInstance() {
+        static ConnShardManager instance;
+        return instance;
+    }
+
+    // called once in base loop thread after TcpServer::start()
+    void Init(const std::vector<EventLoop*>& loops, int idle_seconds, int ping_seconds);
+
+    // the idle wheel of the loop, use it in that loop thread only
+    CIdleWheel* GetIdleWheel(EventLoop* loop) const;
+
+    // thread safe, the work is done in the owner loop of conn
+    void AddConnection(const string& user_id, const CHttpConnPtr& conn);
+    void RemoveConnection(const string& user_id, const CHttpConnPtr& conn);
+    void AddSubscriber(const string& room_id, const string& user_id, const CHttpConnPtr& conn);
+
+    // thread safe, one batch task per loop, the frame is encoded once and shared by all conns
+    // of the same kind (plain or permessage-deflate)
+    void AddAllSubscribers(const string& room_id);
+    // speed: conns written per second over all loops, <= 0 writes them at once
+    // ahead: never paced and not queued behind paced broadcasts, see ConnShard::Broadcast
+    void Broadcast(const WebSocketBroadcastFrame& frame, int speed = 0, bool ahead = false);
+    void BroadcastRoom(const string& room_id, const WebSocketBroadcastFrame& frame);
+    void BroadcastRooms(const RoomFramesPtr& frames);
+    // thread safe, users are found in the user -> shard map, one task per shard holding any of them,
+    // returns the number of users connected here
+    size_t PushToUsers(const std::vector<string>& user_ids, const WebSocketBroadcastFrame& frame);
+
+    size_t GetConnectionCount() const { return conn_count_.load(std::memory_order_relaxed); }
+
+    // rooms with at least one local subscriber, reported to the job through the Rooms rpc,
+    // with the rooms version, bumped whenever a room gets its first local subscriber
+    std::vector<string> GetActiveRooms(uint64_t* version) const;
+    uint64_t GetRoomsVersion() const;
+    // start time of the process, the versions are only comparable within one epoch
+    uint64_t GetEpoch() const { return epoch_.load(std::memory_order_relaxed); }
+    // called by a shard when its subscriber list of the room becomes (non-)empty
+    void UpdateRoomPresence(const string& room_id, bool present);
+    // called after the rooms version is bumped, in the loop thread of that shard, thread safe
+    void SetRoomsChangedCallback(const std::function<void()>& cb);
+
+    // last state of every user changed after version `since` of `epoch`, or the full list of
+    // connected users when the epoch differs or those changes are no longer kept
+    void GetUserChanges(uint64_t epoch, uint64_t since, UserChanges* changes);
+
+private:
+    ConnShardManager() = default;
+    ConnShard* GetShard(EventLoop* loop) const;
+
+    std::vector<std::unique_ptr<ConnShard>> shards_;
+
+    // user_id -> (shard, conn), only for connect/disconnect, never on broadcast path
+    std::mutex user_shard_mutex_;
+    std::unordered_map<string, std::pair<ConnShard*, const CHttpConn*>> user_shard_map_;
+    std::atomic<size_t> conn_count_{0};
+
+    // connect/disconnect log, guarded by user_shard_mutex_, keeps the last kMaxUserChanges entries
+    static const size_t kMaxUserChanges = 65536;
+    void RecordUserChange(const string& user_id, bool online);
+    uint64_t user_epoch_ = 0;       // start time of the process, set in Init()
+    uint64_t user_version_ = 0;     // version of user_changes_.back()
+    std::deque<std::pair<string, bool>> user_changes_;
+
+    // room_id -> number of shards with subscribers, only changed on subscribe/unsubscribe
+    mutable std::mutex room_presence_mutex_;
+    std::unordered_map<string, int> room_presence_;
+    uint64_t rooms_version_ = 0;                        // guarded by room_presence_mutex_
+    std::function<void()> rooms_changed_callback_;      // guarded by room_presence_mutex_
+    std::atomic<uint64_t> epoch_{0};
+};
+
+#endif
@@ -2,10 +2,10 @@
 #include <fstream>
 #include <sstream>
 #include <string.h>
-#include <regex>
 #include "muduo/base/Logging.h" // Logger日志头文件
 #include "logic_client.h"
 #include "logic_config.h"
+#include "backpressure.h"
 
 
 
@@ -20,147 +20,172 @@ CHttpConn::~CHttpConn() {
     LOG_DEBUG << "Destructor CHttpConn uuid: " << uuid_;
 }
 
-void CHttpConn::OnRead(Buffer* buf) // CHttpConn业务层面的OnRead
+void CHttpConn::OnRequest(const CHttpRequestParser& request) // CHttpConn业务层面的请求处理
 {
-    const char* in_buf = buf->peek();
-    int32_t len = buf->readableBytes();
+    std::string_view path = request.Path();
+    string url(request.Url());
+    string content(request.Body());
+    LOG_INFO << "url: " << url << ", content: " << content;
 
-    http_parser_.ParseHttpContent(in_buf, len);
-    if (http_parser_.IsReadAll()) {
-        string url = http_parser_.GetUrlString();
-        string content = http_parser_.GetBodyContentString();
-        LOG_INFO << "url: " << url << ", content: " << content;
-
-        if (strncmp(url.c_str(), "/api/login", 10) == 0) { // 登录
-            _HandleLoginRequest(url, content);
-        }
-        else if (strncmp(url.c_str(), "/api/create-account", 18) == 0) {   //  创建账号
-            _HandleRegisterRequest(url, content);
-        }
-        else {
-            char* resp_content = new char[256];
-            string str_json = "{\"code\": 1}";
-            uint32_t len_json = str_json.size();
-            //暂时先放这里
+    if (path.substr(0, 10) == "/api/login") { // 登录
+        _HandleLoginRequest(url, content);
+    }
+    else if (path.substr(0, 19) == "/api/create-account") {   //  创建账号
+        _HandleRegisterRequest(url, content);
+    }
+    else if (path.substr(0, 11) == "/api/logout") {   // 注销
+        _HandleLogoutRequest(ExtractSid(string(request.Header(kHttpCookie))));
+    }
+    else {
+        char* resp_content = new char[256];
+        string str_json = "{\"code\": 1}";
+        uint32_t len_json = str_json.size();
+        //暂时先放这里
 #define HTTP_RESPONSE_REQ                                                     \
-                "HTTP/1.1 404 OK\r\n"                                                      \
-                "Connection:close\r\n"                                                     \
-                "Content-Length:%d\r\n"                                                    \
-                "Content-Type:application/json;charset=utf-8\r\n\r\n%s"
-            snprintf(resp_content, 256, HTTP_RESPONSE_REQ, len_json, str_json.c_str());
-            tcp_conn_->send(resp_content);
-        }
+            "HTTP/1.1 404 OK\r\n"                                                      \
+            "Connection:close\r\n"                                                     \
+            "Content-Length:%d\r\n"                                                    \
+            "Content-Type:application/json;charset=utf-8\r\n\r\n%s"
+        snprintf(resp_content, 256, HTTP_RESPONSE_REQ, len_json, str_json.c_str());
+        tcp_conn_->send(resp_content);
     }
-
 }
 
 void CHttpConn::send(const string& data) {
     LOG_DEBUG << "send:" << data;
     tcp_conn_->send(data.c_str(), data.size());
 }
-/**
-假设输入的 HTTP 请求头为：
-
-GET /chat/subdir HTTP/1.1
-Host: 127.0.0.1:8080
-Upgrade: websocket
-Connection: Upgrade
-Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==
-Sec-WebSocket-Version: 13
-
-程序运行后会输出：
-Subdirectory: /chat/subdir
- */
-std::string  CHttpConn::getSubdirectoryFromHttpRequest(const std::string& httpRequest) {
-    // 正则表达式匹配请求行中的路径部分
-    std::regex pathRegex(R"(GET\s+([^\s]+)\s+HTTP\/1\.1)");
-    std::smatch pathMatch;
-
-    // 查找路径
-    if (std::regex_search(httpRequest, pathMatch, pathRegex)) {
-        return pathMatch[1];  // 返回路径部分
-    }
 
-    return "";  // 如果没有找到路径，返回空字符串
+void CHttpConn::SendBroadcast(const SharedBytesPtr& frame) {
+    Backpressure::GetInstance().BeforeBroadcast(tcp_conn_);
+    tcp_conn_->send(frame);
 }
-
 // register 
 int CHttpConn::_HandleRegisterRequest(string& url, string& post_data) {
-    string response_json;
-    
     // 通过HTTP客户端转发到logic层
     string logic_server_addr = LogicConfig::getInstance().getLogicServerUrl();
     LogicClient logic_client(logic_server_addr);
-    int ret = logic_client.registerUser(post_data, response_json);
-    
-    char* http_response_data = new char[HTTP_RESPONSE_JSON_MAX];
-    int http_code = 200;
-    string http_code_msg;
-
-    if (ret == 0) {
-        // register success
-        LOG_INFO << "register success, cookie: " << response_json;
-        http_code = 204;
-        http_code_msg = "No content";
-
-        // encapsulate http response
-        snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_COOKIE,
-            http_code, http_code_msg.c_str(), response_json.c_str(), (size_t)0, "");
-    }
-    else {
-        // register failed
-        LOG_INFO << "register failed, response_json: " << response_json;
-        http_code = 400;
-        http_code_msg = "Bad Request";
-
-        // encapsulate http response
-        snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_CODE,
-            http_code, http_code_msg.c_str(), (size_t)response_json.length(), response_json.c_str());
-    }
+    // 应答在 logic client loop 线程里发出, 不占用工作线程
+    TcpConnectionPtr tcp_conn = tcp_conn_;
+    logic_client.registerUser(post_data, [tcp_conn](int ret, const string& response_json) {
+        char* http_response_data = new char[HTTP_RESPONSE_JSON_MAX];
+        int http_code = 200;
+        string http_code_msg;
+
+        if (ret == 0) {
+            // register success
+            LOG_INFO << "register success, cookie: " << response_json;
+            http_code = 204;
+            http_code_msg = "No content";
+
+            // encapsulate http response
+            snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_COOKIE,
+                http_code, http_code_msg.c_str(), response_json.c_str(), (size_t)0, "");
+        }
+        else {
+            // register failed
+            LOG_INFO << "register failed, response_json: " << response_json;
+            http_code = 400;
+            http_code_msg = "Bad Request";
+
+            // encapsulate http response
+            snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_CODE,
+                http_code, http_code_msg.c_str(), (size_t)response_json.length(), response_json.c_str());
+        }
 
-    tcp_conn_->send(http_response_data);
-    LOG_INFO << " http_response_data: " << http_response_data;
-    delete[] http_response_data;
+        tcp_conn->send(http_response_data);
+        LOG_INFO << " http_response_data: " << http_response_data;
+        delete[] http_response_data;
+    });
 
     return 0;
 }
 
 // login
 int CHttpConn::_HandleLoginRequest(string& url, string& post_data) {
-    string response_json;
-    
     // 通过HTTP客户端转发到logic层
     string logic_server_addr = LogicConfig::getInstance().getLogicServerUrl();
     LogicClient logic_client(logic_server_addr);
-    int ret = logic_client.loginUser(post_data, response_json);
-    
-    char* http_response_data = new char[HTTP_RESPONSE_JSON_MAX];
-    int http_code = 200;
-    string http_code_msg;
-
-    if (ret == 0) {
-        LOG_INFO << "login success, cookie: " << response_json;
-        http_code = 204;
-        http_code_msg = "No Content";
-        snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_COOKIE,
-            http_code, http_code_msg.c_str(), response_json.c_str(), (size_t)0, "");
-    }
-    else {
-        LOG_INFO << "login failed, repsonse json: " << response_json;
-        uint32_t len = response_json.length();
-        http_code = 400;
-        http_code_msg = "Bad Request";
-        snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_CODE,
-            http_code, http_code_msg.c_str(), (size_t)response_json.length(), response_json.c_str());
+    // 应答在 logic client loop 线程里发出, 不占用工作线程
+    TcpConnectionPtr tcp_conn = tcp_conn_;
+    logic_client.loginUser(post_data, [tcp_conn](int ret, const string& response_json) {
+        char* http_response_data = new char[HTTP_RESPONSE_JSON_MAX];
+        int http_code = 200;
+        string http_code_msg;
+
+        if (ret == 0) {
+            LOG_INFO << "login success, cookie: " << response_json;
+            http_code = 204;
+            http_code_msg = "No Content";
+            snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_COOKIE,
+                http_code, http_code_msg.c_str(), response_json.c_str(), (size_t)0, "");
+        }
+        else {
+            LOG_INFO << "login failed, repsonse json: " << response_json;
+            uint32_t len = response_json.length();
+            http_code = 400;
+            http_code_msg = "Bad Request";
+            snprintf(http_response_data, HTTP_RESPONSE_JSON_MAX, HTTP_RESPONSE_WITH_CODE,
+                http_code, http_code_msg.c_str(), (size_t)response_json.length(), response_json.c_str());
+        }
+
+        tcp_conn->send(http_response_data);
+        LOG_INFO << "http_response_data: " << http_response_data;
+        delete[] http_response_data;
+    });
+
+    return 0;
+}
+
+// logout
+int CHttpConn::_HandleLogoutRequest(const string& sid) {
+    TcpConnectionPtr tcp_conn = tcp_conn_;
+    auto clear_cookie = [tcp_conn]() {
+        char http_response_data[256];
+        snprintf(http_response_data, sizeof(http_response_data), HTTP_RESPONSE_CLEAR_COOKIE, 204, "No Content");
+        tcp_conn->send(http_response_data);
+    };
+    if (sid.empty()) {
+        clear_cookie();
+        return 0;
     }
 
-    tcp_conn_->send(http_response_data);
-    LOG_INFO << "http_response_data: " << http_response_data;
-    delete[] http_response_data;
+    // 浏览器的 cookie 总是清掉, logic 失败只是少了一次吊销
+    string logic_server_addr = LogicConfig::getInstance().getLogicServerUrl();
+    LogicClient logic_client(logic_server_addr);
+    logic_client.logoutUser(sid, [clear_cookie](int ret, const string& response_json) {
+        if (ret != 0) {
+            LOG_WARN << "logout failed, response_json: " << response_json;
+        }
+        clear_cookie();
+    });
 
     return 0;
 }
 
+string ExtractSid(const string& input) {
+    // get location of "sid=" 
+    size_t sid_start = input.find("sid=");
+    if (sid_start == string::npos) {
+        return "";
+    }
+
+    // the length of "sid=" is 4
+    sid_start += 4;
+
+    // get end location of sid, ' ' or '&' or ';'
+    size_t sid_end = input.find_first_of(" &;", sid_start);
+
+    if (sid_end == string::npos) {
+        sid_end = input.length();
+    }
+
+    // get sid value
+    string sid_value = input.substr(sid_start, sid_end - sid_start);
+
+    return sid_value;
+}
+
 // html data
 int CHttpConn::_HandleHtml(string& url, string& post_data) {
     std::ifstream fileStream("index.html");
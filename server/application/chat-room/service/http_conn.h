@@ -1,6 +1,9 @@
 #ifndef __HTTP_CONN_H__
 #define __HTTP_CONN_H__
-#include "http_parser_wrapper.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "http_request_parser.h"
 #include "muduo/net/TcpConnection.h"
 #include "muduo/net/Buffer.h"
 
@@ -26,6 +29,13 @@
     "Content-Length:%zu\r\n"                                                    \
     "Content-Type:application/json;charset=utf-8\r\n\r\n%s"
 
+// expire the cookie at once
+#define HTTP_RESPONSE_CLEAR_COOKIE                                             \
+    "HTTP/1.1 %d %s\r\n"                                                       \
+    "Connection:close\r\n"                                                     \
+    "set-cookie: sid=; HttpOnly; Max-Age=0; SameSite=Strict\r\n"               \
+    "Content-Length:0\r\n\r\n"
+
 #define HTTP_RESPONSE_HTML_MAX 4096
 #define HTTP_RESPONSE_HTML                                                     \
     "HTTP/1.1 200 OK\r\n"                                                      \
@@ -48,23 +58,30 @@ class CHttpConn : public std::enable_shared_from_this<CHttpConn> {
 public:
     CHttpConn(TcpConnectionPtr tcp_conn);
     virtual ~CHttpConn();
-    virtual void OnRead(Buffer* buf);
-    virtual std::string getSubdirectoryFromHttpRequest(const std::string& httpRequest);
-    virtual void setHeaders(std::unordered_map<std::string, std::string>& headers) {
-        headers_ = headers;
-    }
+    // one complete request, its views are valid during the call
+    virtual void OnRequest(const CHttpRequestParser& request);
+    // bytes after the request, e.g. websocket frames
+    virtual void OnRead(Buffer*) {}
+    virtual void OnClose() {}
+    virtual bool AcceptsDeflatedBroadcast() const { return false; }
+    // called by idle wheel in loop thread
+    virtual void OnIdlePing() {}
+    virtual void OnIdleTimeout() {}
     void send(const string& data);
+    // shared broadcast frame, encoded once and referenced by many connections,
+    // may be dropped by the slow consumer policy, must be called in loop thread
+    void SendBroadcast(const SharedBytesPtr& frame);
+    EventLoop* getLoop() const { return tcp_conn_->getLoop(); }
 protected:
     TcpConnectionPtr tcp_conn_;
     uint32_t uuid_ = 0;
-    CHttpParserWrapper http_parser_;
-    string url_;
-    std::unordered_map<std::string, std::string> headers_;
 private:
     // 账号注册处理
     int _HandleRegisterRequest(string& url, string& post_data);
     // 账号登陆处理
     int _HandleLoginRequest(string& url, string& post_data);
+    // 注销登录
+    int _HandleLogoutRequest(const string& sid);
 
     int _HandleHtml(string& url, string& post_data);
 
@@ -74,4 +91,7 @@ private:
 
 using CHttpConnPtr = std::shared_ptr<CHttpConn>;
 
+// sid value of a Cookie header, empty if none
+string ExtractSid(const string& input);
+
 #endif
\ No newline at end of file
@@ -6,9 +6,8 @@
 #include <muduo/net/TcpConnection.h>
 #include <unordered_map>
 #include <memory>
-#include <algorithm>
-#include <cctype>
-#include <sstream>
+#include <cstring>
+#include "http_request_parser.h"
 #include "websocket_conn.h"
 
 using namespace muduo;
@@ -34,77 +33,68 @@ public:
     }
 
     void OnRead(Buffer* buf) {
-        if (request_type_ == UNKNOWN) {
-            const char* in_buf = buf->peek();
-            int32_t len = buf->readableBytes();
-            std::cout << "in_buf: " << in_buf << std::endl;
-
-            auto headers = parseHttpHeaders(in_buf, len);
-            if (isWebSocketRequest(headers)) {
-                // WebSocket 请求
-                request_type_ = WEBSOCKET;
-                http_conn_ = std::make_shared<CWebSocketConn>(tcp_conn_);
-                http_conn_->setHeaders(headers);
-            }
-            else {
-                // HTTP 请求
-                request_type_ = HTTP;
-                http_conn_ = std::make_shared<CHttpConn>(tcp_conn_);
-                http_conn_->setHeaders(headers);
-            }
-        }
-        // 将数据交给具体的处理器
-        if (http_conn_) {
+        // websocket frames after handshake
+        if (request_type_ == WEBSOCKET) {
             http_conn_->OnRead(buf);
+            return;
         }
-    }
 
-private:
-    // 解析 HTTP 请求头
-    std::unordered_map<std::string, std::string> parseHttpHeaders(const char* data, int size) {
-        std::string request(data, size);
-        return parseHttpHeaders(request);
-    }
+        // requests maybe split across reads or pipelined
+        while (true) {
+            CHttpRequestParser::ParseResult result = parser_.Parse(buf);
+            if (result == CHttpRequestParser::kNeedMore) {
+                return;
+            }
+            else if (result == CHttpRequestParser::kError) {
+                LOG_WARN << "bad http request, " << tcp_conn_->peerAddress().toIpPort();
+                const char* str_json = "{\"code\": 1}";
+                char resp_content[256];
+                snprintf(resp_content, sizeof(resp_content), HTTP_RESPONSE_BAD_REQ, strlen(str_json), str_json);
+                tcp_conn_->send(resp_content);
+                tcp_conn_->shutdown();
+                buf->retrieveAll();
+                return;
+            }
 
-    // 解析 HTTP 请求头
-    std::unordered_map<std::string, std::string> parseHttpHeaders(const std::string& request) {
-        std::unordered_map<std::string, std::string> headers;
-        std::istringstream stream(request);
-        std::string line;
+            if (request_type_ == UNKNOWN) {
+                if (parser_.IsWebSocketUpgrade()) {
+                    // WebSocket 请求
+                    request_type_ = WEBSOCKET;
+                    http_conn_ = std::make_shared<CWebSocketConn>(tcp_conn_);
+                }
+                else {
+                    // HTTP 请求
+                    request_type_ = HTTP;
+                    http_conn_ = std::make_shared<CHttpConn>(tcp_conn_);
+                }
+            }
 
-        while (std::getline(stream, line) && line != "\r") {
-            size_t colon = line.find(':');
-            if (colon != std::string::npos) {
-                std::string key = line.substr(0, colon);
-                std::string value = line.substr(colon + 2, line.size() - colon - 3); // 去掉 ": " 和 "\r"
-                headers[key] = value;
+            // 将请求交给具体的处理器, the views point into buf until retrieved
+            http_conn_->OnRequest(parser_);
+            buf->retrieve(parser_.RequestLength());
+            parser_.Reset();
+
+            // the frames following the handshake
+            if (request_type_ == WEBSOCKET) {
+                if (buf->readableBytes() > 0) {
+                    http_conn_->OnRead(buf);
+                }
+                return;
             }
         }
-
-        return headers;
     }
 
-    // 判断是否是 WebSocket 请求
-    bool isWebSocketRequest(const std::unordered_map<std::string, std::string>& headers) {
-        auto upgradeIt = headers.find("Upgrade");
-        auto connectionIt = headers.find("Connection");
-
-        if (upgradeIt != headers.end() && connectionIt != headers.end()) {
-            std::string upgrade = upgradeIt->second;
-            std::string connection = connectionIt->second;
-
-            // 将字符串转换为小写
-            std::transform(upgrade.begin(), upgrade.end(), upgrade.begin(), ::tolower);
-            std::transform(connection.begin(), connection.end(), connection.begin(), ::tolower);
-
-            return upgrade == "websocket" && connection.find("upgrade") != std::string::npos;
+    // tcp conn closed
+    void OnClose() {
+        if (http_conn_) {
+            http_conn_->OnClose();
         }
-
-        return false;
     }
 
+private:
     TcpConnectionPtr tcp_conn_;
     CHttpConnPtr http_conn_; // 指向CHttpConn或CWebSocketConn的基类指针
+    CHttpRequestParser parser_;
     RequestType request_type_ = UNKNOWN;
 };
 
@@ -0,0 +1,156 @@
+#include "http_request_parser.h"
+
+namespace {
+    struct KnownHeader {
+        std::string_view name;
+        HttpHeaderId id;
+    };
+
+    const KnownHeader kKnownHeaders[] = {
+        { "Host", kHttpHost },
+        { "Connection", kHttpConnection },
+        { "Upgrade", kHttpUpgrade },
+        { "Cookie", kHttpCookie },
+        { "Content-Length", kHttpContentLength },
+        { "Content-Type", kHttpContentType },
+        { "Sec-WebSocket-Key", kHttpSecWebSocketKey },
+        { "Sec-WebSocket-Version", kHttpSecWebSocketVersion },
+        { "Sec-WebSocket-Extensions", kHttpSecWebSocketExtensions },
+    };
+
+    inline char ToLower(char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+
+    std::string_view Trim(std::string_view s) {
+        while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) {
+            s.remove_prefix(1);
+        }
+        while (!s.empty() && (s.back() == ' ' || s.back() == '\t')) {
+            s.remove_suffix(1);
+        }
+        return s;
+    }
+}
+
+bool CHttpRequestParser::EqualsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (ToLower(a[i]) != ToLower(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CHttpRequestParser::HasToken(std::string_view value, std::string_view token) {
+    while (!value.empty()) {
+        size_t comma = value.find(',');
+        if (EqualsIgnoreCase(Trim(value.substr(0, comma)), token)) {
+            return true;
+        }
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        value.remove_prefix(comma + 1);
+    }
+    return false;
+}
+
+void CHttpRequestParser::Reset() {
+    base_ = nullptr;
+    scanned_ = 0;
+    header_length_ = 0;
+    method_ = url_ = path_ = body_ = Range{ 0, 0 };
+    for (Range& r : headers_) {
+        r = Range{ 0, 0 };
+    }
+}
+
+CHttpRequestParser::ParseResult CHttpRequestParser::Parse(const Buffer* buf) {
+    base_ = buf->peek();
+    size_t readable = buf->readableBytes();
+
+    if (header_length_ == 0) {
+        // resume 3 bytes back, the "\r\n\r\n" may be split across reads
+        size_t from = scanned_ > 3 ? scanned_ - 3 : 0;
+        size_t end = std::string_view(base_, readable).find("\r\n\r\n", from);
+        if (end == std::string_view::npos) {
+            scanned_ = readable;
+            return readable > kMaxHeaderSize ? kError : kNeedMore;
+        }
+        header_length_ = end + 4;
+        if (header_length_ > kMaxHeaderSize || !ParseHead()) {
+            return kError;
+        }
+    }
+
+    // the body follows the head, only Content-Length is supported
+    if (readable < header_length_ + body_.len) {
+        return kNeedMore;
+    }
+    return kComplete;
+}
+
+bool CHttpRequestParser::ParseHead() {
+    std::string_view head(base_, header_length_ - 2);       // keep the last "\r\n" of headers
+
+    // request line: METHOD SP URL SP VERSION
+    size_t line_end = head.find("\r\n");
+    std::string_view line = head.substr(0, line_end);
+    size_t sp1 = line.find(' ');
+    size_t sp2 = line.rfind(' ');
+    if (sp1 == std::string_view::npos || sp2 == sp1 || line.substr(sp2 + 1, 5) != "HTTP/") {
+        return false;
+    }
+    method_ = Range{ 0, static_cast<uint32_t>(sp1) };
+    url_ = Range{ static_cast<uint32_t>(sp1 + 1), static_cast<uint32_t>(sp2 - sp1 - 1) };
+    size_t query = View(url_).find('?');
+    path_ = Range{ url_.off, query == std::string_view::npos ? url_.len : static_cast<uint32_t>(query) };
+
+    // header lines
+    size_t pos = line_end + 2;
+    while (pos < head.size()) {
+        size_t end = head.find("\r\n", pos);
+        if (end == std::string_view::npos) {
+            return false;
+        }
+        std::string_view field = head.substr(pos, end - pos);
+        size_t colon = field.find(':');
+        if (colon == std::string_view::npos) {
+            return false;
+        }
+
+        std::string_view name = field.substr(0, colon);
+        for (const KnownHeader& known : kKnownHeaders) {
+            if (EqualsIgnoreCase(name, known.name)) {
+                std::string_view value = Trim(field.substr(colon + 1));
+                headers_[known.id] = Range{ static_cast<uint32_t>(value.data() - base_), static_cast<uint32_t>(value.size()) };
+                break;
+            }
+        }
+        pos = end + 2;
+    }
+
+    // content length
+    std::string_view content_length = Header(kHttpContentLength);
+    size_t body_len = 0;
+    for (char c : content_length) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        body_len = body_len * 10 + (c - '0');
+        if (body_len > kMaxBodySize) {
+            return false;
+        }
+    }
+    body_ = Range{ static_cast<uint32_t>(header_length_), static_cast<uint32_t>(body_len) };
+    return true;
+}
+
+bool CHttpRequestParser::IsWebSocketUpgrade() const {
+    return EqualsIgnoreCase(Header(kHttpUpgrade), "websocket")
+        && HasToken(Header(kHttpConnection), "upgrade");
+}
@@ -0,0 +1,87 @@
+/**
+ * 增量 HTTP 请求解析器
+ *
+ * 直接在 muduo Buffer 的可读区上解析请求行、已知请求头和 Content-Length 请求体,
+ * 不分配内存, 结果以 string_view 返回;
+ * 请求被拆成多次读取时, 只扫描新到达的字节
+ */
+#ifndef __HTTP_REQUEST_PARSER_H__
+#define __HTTP_REQUEST_PARSER_H__
+
+#include <cstdint>
+#include <string_view>
+#include "muduo/net/Buffer.h"
+
+using muduo::net::Buffer;
+
+// the headers the comet cares about, others are skipped
+enum HttpHeaderId {
+    kHttpHost,
+    kHttpConnection,
+    kHttpUpgrade,
+    kHttpCookie,
+    kHttpContentLength,
+    kHttpContentType,
+    kHttpSecWebSocketKey,
+    kHttpSecWebSocketVersion,
+    kHttpSecWebSocketExtensions,
+    kHttpHeaderCount,
+};
+
+class CHttpRequestParser {
+public:
+    enum ParseResult {
+        kNeedMore,          // wait for more bytes, nothing consumed
+        kComplete,          // one request, RequestLength() bytes at buf->peek()
+        kError,             // malformed or too large, close the conn
+    };
+
+    static const size_t kMaxHeaderSize = 8 * 1024;
+    static const size_t kMaxBodySize = 64 * 1024;
+
+    CHttpRequestParser() { Reset(); }
+
+    // parse the request at buf->peek(), call again with the same buf after more bytes arrived
+    ParseResult Parse(const Buffer* buf);
+
+    // start the next request, after the current one is retrieved
+    void Reset();
+
+    // the following are valid after kComplete, until buf is modified
+    std::string_view Method() const { return View(method_); }
+    std::string_view Path() const { return View(path_); }       // without query string
+    std::string_view Url() const { return View(url_); }         // path and query string
+    std::string_view Header(HttpHeaderId id) const { return View(headers_[id]); }
+    bool HasHeader(HttpHeaderId id) const { return headers_[id].len > 0; }
+    std::string_view Body() const { return View(body_); }
+    size_t RequestLength() const { return header_length_ + body_.len; }
+
+    // Upgrade: websocket and Connection contains the upgrade token
+    bool IsWebSocketUpgrade() const;
+
+    // case-insensitive compare, e.g. header name and token
+    static bool EqualsIgnoreCase(std::string_view a, std::string_view b);
+    // comma separated header value contains the token
+    static bool HasToken(std::string_view value, std::string_view token);
+
+private:
+    // offsets from buf->peek(), the buffer may move its data between reads
+    struct Range {
+        uint32_t off;
+        uint32_t len;
+    };
+
+    bool ParseHead();
+    std::string_view View(const Range& r) const { return std::string_view(base_ + r.off, r.len); }
+
+    const char* base_;
+    size_t scanned_;            // bytes searched for the end of head
+    size_t header_length_;      // request line and headers with the empty line, 0 if not found
+    Range method_;
+    Range url_;
+    Range path_;
+    Range body_;
+    Range headers_[kHttpHeaderCount];
+};
+
+#endif // !__HTTP_REQUEST_PARSER_H__
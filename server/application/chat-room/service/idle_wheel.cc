@@ -0,0 +1,80 @@
+#include "idle_wheel.h"
+#include "muduo/base/Logging.h"
+
+// the last reference is dropped by the wheel, nothing arrived during idle_seconds
+CIdleWheel::Entry::~Entry() {
+    CHttpConnPtr conn = weak_conn.lock();
+    if (conn) {
+        conn->OnIdleTimeout();
+    }
+}
+
+CIdleWheel::CIdleWheel(EventLoop* loop, int idle_seconds, int ping_seconds)
+    : loop_(loop), idle_seconds_(idle_seconds), ping_seconds_(ping_seconds), tick_(0) {
+    // ping must come before the conn is reaped
+    if (ping_seconds_ >= idle_seconds_) {
+        ping_seconds_ = 0;
+    }
+    // one extra bucket, an entry lives at least idle_seconds ticks after its last touch
+    if (idle_seconds_ > 0) {
+        buckets_.resize(idle_seconds_ + 1);
+    }
+}
+
+void CIdleWheel::Start() {
+    if (buckets_.empty()) {
+        return;
+    }
+    loop_->runEvery(1.0, std::bind(&CIdleWheel::OnTick, this));
+}
+
+CIdleWheel::WeakEntryPtr CIdleWheel::Add(const CHttpConnPtr& conn) {
+    loop_->assertInLoopThread();
+    if (buckets_.empty()) {
+        return WeakEntryPtr();
+    }
+    EntryPtr entry = std::make_shared<Entry>(conn);
+    entry->last_active_tick = tick_;
+    BucketAt(tick_).insert(entry);
+    return entry;
+}
+
+void CIdleWheel::Touch(const WeakEntryPtr& weak_entry) {
+    loop_->assertInLoopThread();
+    EntryPtr entry = weak_entry.lock();
+    // already in the current bucket
+    if (!entry || entry->last_active_tick == tick_) {
+        return;
+    }
+    entry->last_active_tick = tick_;
+    BucketAt(tick_).insert(entry);
+}
+
+void CIdleWheel::OnTick() {
+    loop_->assertInLoopThread();
+    ++tick_;
+
+    // the oldest bucket is taken out of the wheel first, released at the end of this tick
+    Bucket expired;
+    expired.swap(BucketAt(tick_));
+
+    // ping the conns idle for a multiple of ping_seconds
+    if (ping_seconds_ > 0) {
+        for (uint64_t age = ping_seconds_; age < static_cast<uint64_t>(idle_seconds_) && age <= tick_; age += ping_seconds_) {
+            uint64_t active_tick = tick_ - age;
+            for (const EntryPtr& entry : BucketAt(active_tick)) {
+                if (entry->last_active_tick != active_tick) {
+                    continue;
+                }
+                CHttpConnPtr conn = entry->weak_conn.lock();
+                if (conn) {
+                    conn->OnIdlePing();
+                }
+            }
+        }
+    }
+
+    if (!expired.empty()) {
+        LOG_DEBUG << "CIdleWheel tick: " << tick_ << ", release entries: " << expired.size();
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * 空闲连接时间轮
+ *
+ * 每个 IO EventLoop 一个时间轮, 每秒 tick 一次, 只有一个 muduo 定时器;
+ * 连接有数据到达时把它的 Entry 放进当前格子, Entry 的最后一个引用随格子
+ * 转出时析构并关闭连接; 空闲满 ping_interval 的整数倍时由服务端发送 Ping
+ */
+#ifndef __IDLE_WHEEL_H__
+#define __IDLE_WHEEL_H__
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include "muduo/base/noncopyable.h"
+#include "muduo/net/EventLoop.h"
+#include "http_conn.h"
+
+class CIdleWheel : muduo::noncopyable {
+public:
+    struct Entry {
+        explicit Entry(const CHttpConnPtr& conn) : weak_conn(conn) {}
+        ~Entry();
+
+        std::weak_ptr<CHttpConn> weak_conn;
+        uint64_t last_active_tick = 0;
+    };
+    using EntryPtr = std::shared_ptr<Entry>;
+    using WeakEntryPtr = std::weak_ptr<Entry>;
+
+    // idle_seconds <= 0 disables the wheel, ping_seconds <= 0 or >= idle_seconds disables ping
+    CIdleWheel(EventLoop* loop, int idle_seconds, int ping_seconds);
+
+    // start ticking, thread safe
+    void Start();
+
+    // the following must be called in loop_ thread
+    WeakEntryPtr Add(const CHttpConnPtr& conn);
+    void Touch(const WeakEntryPtr& weak_entry);
+
+private:
+    using Bucket = std::unordered_set<EntryPtr>;
+
+    void OnTick();
+    Bucket& BucketAt(uint64_t tick) { return buckets_[tick % buckets_.size()]; }
+
+    EventLoop* loop_;
+    int idle_seconds_;
+    int ping_seconds_;
+    uint64_t tick_;
+    std::vector<Bucket> buckets_;
+};
+
+#endif // !__IDLE_WHEEL_H__
@@ -1,39 +1,71 @@
 #include "logic_client.h"
-#include <curl/curl.h>
-#include <sstream>
-
-/**
- * CURL callback function
- * @param contents curl缓冲区响应内容
- * @param size 数据块大小
- * @param nmemb 数据块数量
- * @param response_ptr 响应字符串指针
- * @return 返回实际写入的数据长度
- */
-static size_t WriteCallback(void* contents, size_t data_block_len, 
-    size_t data_block_n, string* response_ptr) {
-    response_ptr->append((char*)contents, data_block_len * data_block_n);
-    return data_block_len * data_block_n;
-}
+#include <chrono>
+#include "logic_config.h"
+#include "session_token.h"
+
+using namespace ChatRoom;
 
 LogicClient::LogicClient(const string& logic_server_url) 
-    : logic_server_url_(logic_server_url) {
-    // 初始化CURL
-    curl_global_init(CURL_GLOBAL_DEFAULT);
+    : logic_server_url_(logic_server_url),
+      use_grpc_(LogicConfig::getInstance().useGrpc() && CLogicRpcClient::GetInstance().IsReady()) {
 }
 
 LogicClient::~LogicClient() {
-    curl_global_cleanup();
 }
 
-LogicAuthResult LogicClient::verifyUserAuth(const string& cookie) {
+void LogicClient::verifyUserAuth(const string& cookie, LogicAuthCallback done) {
     LogicAuthResult result;
     result.success = false;
     result.user_id = "";
 
     if (cookie.empty()) {
         result.error_message = "Cookie is empty";
-        return result;
+        done(result);
+        return;
+    }
+
+    // 签名 token 在本地校验, 只有本地没有密钥的 kid 才交给 logic
+    CSessionTokenCodec& codec = CSessionTokenCodec::GetInstance();
+    if (codec.Enabled() && CSessionTokenCodec::LooksLikeToken(cookie)) {
+        SessionClaims claims;
+        SessionTokenResult ret = codec.Verify(cookie, claims);
+        if (ret == kTokenOk) {
+            result.success = true;
+            result.user_id = claims.user_id;
+            result.username = claims.username;
+            done(result);
+            return;
+        }
+        if (ret != kTokenUnknownKey) {
+            result.error_message = CSessionTokenCodec::ResultString(ret);
+            LOG_WARN << "session token rejected: " << result.error_message;
+            done(result);
+            return;
+        }
+    }
+
+    if (use_grpc_) {
+        CLogicRpcClient& rpc = CLogicRpcClient::GetInstance();
+        auto call = std::make_shared<LogicRpcCall<Logic::VerifyReq, Logic::VerifyReply>>();
+        rpc.SetDeadline(&call->context);
+        call->request.set_cookie(cookie);
+        rpc.GetStub()->async()->Verify(&call->context, &call->request, &call->reply,
+            [call, done = std::move(done)](grpc::Status status) {
+                LogicAuthResult result;
+                result.success = false;
+                if (!checkRpcStatus("Verify", status)) {
+                    result.error_message = "Failed to connect to logic server";
+                    done(result);
+                    return;
+                }
+                result.success = call->reply.success();
+                result.user_id = call->reply.user().id();
+                result.username = call->reply.user().username();
+                result.email = call->reply.email();
+                result.error_message = call->reply.error();
+                done(result);
+            });
+        return;
     }
 
     // 构造请求JSON
@@ -44,41 +76,159 @@ LogicAuthResult LogicClient::verifyUserAuth(const string& cookie) {
     string post_data = writer.write(request);
 
     // 发送HTTP请求
-    string response;
     string url = logic_server_url_ + "/logic/verify";
-    
-    if (!sendHttpRequest(url, post_data, response)) {
-        result.error_message = "Failed to connect to logic server";
-        LOG_ERROR << "Failed to send HTTP request to logic server: " << url;
-        return result;
+    sendHttpRequestAsync(url, post_data, [url, done = std::move(done)](int ret, const string& response) {
+        if (ret != 0) {
+            LogicAuthResult result;
+            result.success = false;
+            result.error_message = "Failed to connect to logic server";
+            LOG_ERROR << "Failed to send HTTP request to logic server: " << url;
+            done(result);
+            return;
+        }
+        // 解析响应
+        done(parseAuthResponse(response));
+    });
+}
+
+void LogicClient::hello(const string& user_id, const string& username, LogicHelloCallback done) {
+    if (use_grpc_) {
+        CLogicRpcClient& rpc = CLogicRpcClient::GetInstance();
+        auto call = std::make_shared<LogicRpcCall<Logic::HelloReq, Logic::HelloReply>>();
+        rpc.SetDeadline(&call->context);
+        call->request.mutable_user()->set_id(user_id);
+        call->request.mutable_user()->set_username(username);
+        rpc.GetStub()->async()->Hello(&call->context, &call->request, &call->reply,
+            [call, user_id, username, done = std::move(done)](grpc::Status status) {
+                std::vector<LogicRoom> rooms;
+                if (!checkRpcStatus("Hello", status)) {
+                    done(-1, "", rooms);
+                    return;
+                }
+
+                // 与 logic 的 /logic/hello 相同的格式
+                Json::Value root;
+                root["type"] = "hello";
+                Json::Value me;
+                me["id"] = user_id;
+                me["username"] = username;
+                Json::Value payload;
+                payload["me"] = me;
+                Json::Value rooms_json(Json::arrayValue);
+                for (const auto& item : call->reply.rooms()) {
+                    Json::Value room;
+                    room["id"] = item.room().id();
+                    room["name"] = item.room().name();
+                    room["creator_id"] = item.room().creatorid();
+                    room["hasMoreMessages"] = item.hasmoremessages();
+                    room["messages"] = encodeChatMessages(item.messages());
+                    rooms_json.append(room);
+                    rooms.push_back({item.room().id(), item.room().name()});
+                }
+                payload["rooms"] = rooms_json;
+                root["payload"] = payload;
+                Json::FastWriter writer;
+                done(0, writer.write(root), rooms);
+            });
+        return;
     }
 
-    // 解析响应
-    result = parseAuthResponse(response);
-    return result;
+    Json::Value hello_request;
+    hello_request["userId"] = user_id;
+    hello_request["username"] = username;
+    Json::FastWriter writer;
+    string post_data = writer.write(hello_request);
+
+    string url = logic_server_url_ + "/logic/hello";
+    sendHttpRequestAsync(url, post_data, [done = std::move(done)](int ret, const string& response_json) {
+        std::vector<LogicRoom> rooms;
+        if (ret != 0) {
+            done(-1, response_json, rooms);
+            return;
+        }
+
+        Json::Reader reader;
+        Json::Value logic_response;
+        if (!reader.parse(response_json, logic_response)) {
+            LOG_ERROR << "Failed to parse logic hello response JSON";
+            done(-1, response_json, rooms);
+            return;
+        }
+        if (logic_response.isMember("payload") && logic_response["payload"].isMember("rooms")) {
+            for (const auto& room : logic_response["payload"]["rooms"]) {
+                if (room.isMember("id")) {
+                    rooms.push_back({room["id"].asString(), room.get("name", "").asString()});
+                }
+            }
+        }
+        done(0, response_json, rooms);
+    });
 }
 
-int LogicClient::loginUser(const string& post_data, string& response) {
-    string url = logic_server_url_ + "/logic/login";
-    
-    if (sendHttpRequest(url, post_data, response)) {
-        return 0; // 成功
-    } else {
-        return -1; // 失败
+int LogicClient::getAllRooms(std::vector<LogicRoom>& rooms) {
+    if (use_grpc_) {
+        CLogicRpcClient& rpc = CLogicRpcClient::GetInstance();
+        grpc::ClientContext context;
+        rpc.SetDeadline(&context);
+        Logic::RoomsReq request;
+        Logic::RoomsReply reply;
+        if (!checkRpcStatus("Rooms", rpc.GetStub()->Rooms(&context, request, &reply))) {
+            return -1;
+        }
+        for (const auto& room : reply.rooms()) {
+            rooms.push_back({room.id(), room.name()});
+        }
+        return 0;
+    }
+
+    Json::Value request_json;
+    request_json["type"] = "getAllRooms";
+    Json::FastWriter writer;
+    string post_data = writer.write(request_json);
+
+    string response_json;
+    string url = logic_server_url_ + "/logic/rooms";
+    if (!sendHttpRequest(url, post_data, response_json)) {
+        return -1;
+    }
+
+    Json::Reader reader;
+    Json::Value logic_response;
+    if (!reader.parse(response_json, logic_response)) {
+        LOG_ERROR << "Failed to parse room list response from Logic layer";
+        return -1;
+    }
+    if (!logic_response.isMember("rooms") || logic_response["status"].asString() != "success") {
+        LOG_WARN << "No rooms found in Logic layer response";
+        return -1;
+    }
+    for (const auto& room : logic_response["rooms"]) {
+        if (room.isMember("id") && room.isMember("name")) {
+            rooms.push_back({room["id"].asString(), room["name"].asString()});
+        }
     }
+    return 0;
+}
+
+void LogicClient::loginUser(const string& post_data, LogicDoneCallback done) {
+    string url = logic_server_url_ + "/logic/login";
+    sendHttpRequestAsync(url, post_data, std::move(done));
 }
 
-int LogicClient::registerUser(const string& post_data, string& response) {
+void LogicClient::registerUser(const string& post_data, LogicDoneCallback done) {
     string url = logic_server_url_ + "/logic/register";
-    
-    if (sendHttpRequest(url, post_data, response)) {
-        return 0; // 成功
-    } else {
-        return -1; // 失败
-    }
+    sendHttpRequestAsync(url, post_data, std::move(done));
 }
 
-int LogicClient::handleSend(Json::Value& root, const string& user_id, const string& username, string& response) {
+void LogicClient::logoutUser(const string& cookie, LogicDoneCallback done) {
+    Json::Value request;
+    request["cookie"] = cookie;
+    Json::FastWriter writer;
+    string url = logic_server_url_ + "/logic/logout";
+    sendHttpRequestAsync(url, writer.write(request), std::move(done));
+}
+
+int LogicClient::handleSend(Json::Value& root, const string& user_id, const string& username, LogicDoneCallback done) {
     // 验证payload字段
     if (!root.isMember("payload") || root["payload"].isNull()) {
         LOG_ERROR << "Missing payload in clientMessages";
@@ -95,6 +245,29 @@ int LogicClient::handleSend(Json::Value& root, const string& user_id, const stri
     
     string room_id = payload["roomId"].asString();
     Json::Value messages = payload["messages"];
+
+    if (use_grpc_) {
+        CLogicRpcClient& rpc = CLogicRpcClient::GetInstance();
+        auto call = std::make_shared<LogicRpcCall<Logic::SendReq, Logic::SendReply>>();
+        rpc.SetDeadline(&call->context);
+        call->request.set_roomid(room_id);
+        call->request.mutable_user()->set_id(user_id);
+        call->request.mutable_user()->set_username(username);
+        for (const auto& message : messages) {
+            if (message.isMember("content")) {
+                call->request.add_contents(message["content"].asString());
+            }
+        }
+        rpc.GetStub()->async()->Send(&call->context, &call->request, &call->reply,
+            [call, done = std::move(done)](grpc::Status status) {
+                if (!checkRpcStatus("Send", status)) {
+                    done(-1, status.error_message());
+                    return;
+                }
+                done(0, "");
+            });
+        return 0;
+    }
     
     Json::Value request_data;
     request_data["roomId"] = room_id;
@@ -109,33 +282,39 @@ int LogicClient::handleSend(Json::Value& root, const string& user_id, const stri
     
     // 调用logic层的send接口
     string url = logic_server_url_ + "/logic/send";
-    if (!sendHttpRequest(url, post_data, response)) {
-        LOG_ERROR << "Failed to send message to logic layer";
-        return -1;
-    }
-    
-    // 解析logic层返回的响应
-    Json::Value response_root;
-    Json::Reader reader;
-    if (!reader.parse(response, response_root)) {
-        LOG_ERROR << "Failed to parse logic response: " << response;
-        return -1;
-    }
-    
-    // 检查logic层是否成功处理
-    if (!response_root.isMember("status") || response_root["status"].asString() != "success") {
-        LOG_ERROR << "Logic layer failed to process message: " << response;
-        return -1;
-    }
-    
-    // logic-> Kafka -> Job -> gRPC -> comet_service.cc -> broadcastRoom
-    LOG_INFO << "Message sent to logic layer successfully, will be broadcasted via Kafka->Job->gRPC";
+    sendHttpRequestAsync(url, post_data, [done = std::move(done)](int ret, const string& response) {
+        if (ret != 0) {
+            LOG_ERROR << "Failed to send message to logic layer";
+            done(-1, response);
+            return;
+        }
+
+        // 解析logic层返回的响应
+        Json::Value response_root;
+        Json::Reader reader;
+        if (!reader.parse(response, response_root)) {
+            LOG_ERROR << "Failed to parse logic response: " << response;
+            done(-1, response);
+            return;
+        }
+
+        // 检查logic层是否成功处理
+        if (!response_root.isMember("status") || response_root["status"].asString() != "success") {
+            LOG_ERROR << "Logic layer failed to process message: " << response;
+            done(-1, response);
+            return;
+        }
+
+        // logic-> Kafka -> Job -> gRPC -> comet_service.cc -> broadcastRoom
+        LOG_INFO << "Message sent to logic layer successfully, will be broadcasted via Kafka->Job->gRPC";
+        done(0, response);
+    });
 
     return 0;
 }
 
 
-int LogicClient::handleRoomHistory(Json::Value& root, const string& user_id, const string& username, string& response) {
+int LogicClient::handleRoomHistory(Json::Value& root, const string& user_id, const string& username, LogicDoneCallback done) {
     // 验证payload字段
     if (!root.isMember("payload") || root["payload"].isNull()) {
         LOG_ERROR << "Missing payload in requestRoomHistory";
@@ -154,6 +333,36 @@ int LogicClient::handleRoomHistory(Json::Value& root, const string& user_id, con
     string first_message_id = payload.get("firstMessageId", "").asString();
     int count = payload.get("count", 10).asInt();
     if (count <= 0) count = 10; // 默认值
+
+    if (use_grpc_) {
+        CLogicRpcClient& rpc = CLogicRpcClient::GetInstance();
+        auto call = std::make_shared<LogicRpcCall<Logic::RoomHistoryReq, Logic::RoomHistoryReply>>();
+        rpc.SetDeadline(&call->context);
+        call->request.set_roomid(room_id);
+        call->request.set_firstmessageid(first_message_id);
+        call->request.set_count(count);
+        call->request.mutable_user()->set_id(user_id);
+        call->request.mutable_user()->set_username(username);
+        rpc.GetStub()->async()->RoomHistory(&call->context, &call->request, &call->reply,
+            [call, room_id, done = std::move(done)](grpc::Status status) {
+                if (!checkRpcStatus("RoomHistory", status)) {
+                    done(-1, status.error_message());
+                    return;
+                }
+                const Logic::RoomMessages& history = call->reply.history();
+                Json::Value response_root;
+                response_root["type"] = "serverRoomHistory";
+                Json::Value response_payload;
+                response_payload["roomId"] = room_id;
+                response_payload["name"] = history.room().name();
+                response_payload["hasMoreMessages"] = history.hasmoremessages();
+                response_payload["messages"] = encodeChatMessages(history.messages());
+                response_root["payload"] = response_payload;
+                Json::FastWriter writer;
+                done(0, writer.write(response_root));
+            });
+        return 0;
+    }
     
     // 构造请求数据，添加用户信息用于权限验证
     Json::Value request_data;
@@ -175,30 +384,36 @@ int LogicClient::handleRoomHistory(Json::Value& root, const string& user_id, con
     
     // 调用logic层的room_history接口
     string url = logic_server_url_ + "/logic/room_history";
-    if (!sendHttpRequest(url, post_data, response)) {
-        LOG_ERROR << "Failed to send room history request to logic layer";
-        return -1;
-    }
-    
-    Json::Value response_root;
-    Json::Reader reader;
-    if (!reader.parse(response, response_root)) {
-        LOG_ERROR << "Failed to parse logic response: " << response;
-        return -1;
-    }
-    
-    // 检查WebSocket格式响应
-    if (response_root.isMember("type") && response_root["type"].asString() == "serverRoomHistory") {
-        // 直接返回WebSocket格式的响应给调用方
-        LOG_INFO << "Room history request processed successfully by logic layer";
-        return 0;
-    } else {
-        LOG_ERROR << "Logic layer returned unexpected response format: " << response;
-        return -1;
-    }
+    sendHttpRequestAsync(url, post_data, [done = std::move(done)](int ret, const string& response) {
+        if (ret != 0) {
+            LOG_ERROR << "Failed to send room history request to logic layer";
+            done(-1, response);
+            return;
+        }
+
+        Json::Value response_root;
+        Json::Reader reader;
+        if (!reader.parse(response, response_root)) {
+            LOG_ERROR << "Failed to parse logic response: " << response;
+            done(-1, response);
+            return;
+        }
+
+        // 检查WebSocket格式响应
+        if (response_root.isMember("type") && response_root["type"].asString() == "serverRoomHistory") {
+            // 直接返回WebSocket格式的响应给调用方
+            LOG_INFO << "Room history request processed successfully by logic layer";
+            done(0, response);
+        } else {
+            LOG_ERROR << "Logic layer returned unexpected response format: " << response;
+            done(-1, response);
+        }
+    });
+
+    return 0;
 }
 
-int LogicClient::handleCreateRoom(Json::Value& root, const string& user_id, const string& username, string& response) {
+int LogicClient::handleCreateRoom(Json::Value& root, const string& user_id, const string& username, LogicDoneCallback done) {
     // 验证payload字段
     if (!root.isMember("payload") || root["payload"].isNull()) {
         LOG_ERROR << "Missing payload in clientCreateRoom";
@@ -214,6 +429,37 @@ int LogicClient::handleCreateRoom(Json::Value& root, const string& user_id, cons
     }
     
     string room_name = payload["roomName"].asString();
+
+    if (use_grpc_) {
+        CLogicRpcClient& rpc = CLogicRpcClient::GetInstance();
+        auto call = std::make_shared<LogicRpcCall<Logic::CreateRoomReq, Logic::CreateRoomReply>>();
+        rpc.SetDeadline(&call->context);
+        call->request.set_roomname(room_name);
+        call->request.mutable_creator()->set_id(user_id);
+        call->request.mutable_creator()->set_username(username);
+        rpc.GetStub()->async()->CreateRoom(&call->context, &call->request, &call->reply,
+            [call, username, done = std::move(done)](grpc::Status status) {
+                bool created = status.ok();
+                if (!created && status.error_code() != grpc::StatusCode::ALREADY_EXISTS) {
+                    checkRpcStatus("CreateRoom", status);
+                    done(-1, status.error_message());
+                    return;
+                }
+                // 与 /logic/room/create 相同的格式, roomId 为空表示房间名已存在
+                const Logic::RoomInfo& room = call->reply.room();
+                Json::Value response_root;
+                response_root["type"] = "serverCreateRoom";
+                Json::Value response_payload;
+                response_payload["roomId"] = room.id();
+                response_payload["roomName"] = created ? room.name() : call->request.roomname();
+                response_payload["creatorId"] = room.creatorid();
+                response_payload["creatorUsername"] = created ? username : string();
+                response_root["payload"] = response_payload;
+                Json::FastWriter writer;
+                done(0, writer.write(response_root));
+            });
+        return 0;
+    }
     
     // 构造请求数据，添加用户信息
     Json::Value request_data;
@@ -233,76 +479,97 @@ int LogicClient::handleCreateRoom(Json::Value& root, const string& user_id, cons
     
     // 调用logic层的room/create接口
     string url = logic_server_url_ + "/logic/room/create";
-    if (!sendHttpRequest(url, post_data, response)) {
-        LOG_ERROR << "Failed to send create room request to logic layer";
-        return -1;
+    sendHttpRequestAsync(url, post_data, [done = std::move(done)](int ret, const string& response) {
+        if (ret != 0) {
+            LOG_ERROR << "Failed to send create room request to logic layer";
+            done(-1, response);
+            return;
+        }
+
+        // 验证响应格式
+        Json::Value response_root;
+        Json::Reader reader;
+        if (!reader.parse(response, response_root)) {
+            LOG_ERROR << "Failed to parse logic response: " << response;
+            done(-1, response);
+            return;
+        }
+
+        if (response_root.isMember("type") && response_root["type"].asString() == "serverCreateRoom") {
+            LOG_INFO << "Create room request processed successfully by logic layer";
+            done(0, response);
+        } else {
+            LOG_ERROR << "Logic layer returned unexpected response format: " << response;
+            done(-1, response);
+        }
+    });
+
+    return 0;
+}
+
+bool LogicClient::sendHttpRequest(const string& url, const string& post_data, string& response) {
+    CLogicHttpPool& pool = CLogicHttpPool::GetInstance();
+    if (pool.IsInLoopThread()) {
+        // the answer is delivered by this thread, waiting here never ends
+        LOG_ERROR << "blocking logic request in logic client loop, url: " << url;
+        return false;
     }
-    
-    // 验证响应格式
-    Json::Value response_root;
-    Json::Reader reader;
-    if (!reader.parse(response, response_root)) {
-        LOG_ERROR << "Failed to parse logic response: " << response;
-        return -1;
+
+    std::future<LogicHttpResponse> future = pool.Post(url, post_data);
+    // the pool fails the request after request_timeout, wait a little longer
+    std::chrono::seconds timeout(pool.GetConfig().request_timeout + 1);
+    if (future.wait_for(timeout) != std::future_status::ready) {
+        LOG_ERROR << "logic request not answered in time, url: " << url;
+        return false;
     }
-    
-    if (response_root.isMember("type") && response_root["type"].asString() == "serverCreateRoom") {
-        LOG_INFO << "Create room request processed successfully by logic layer";
-        return 0;
-    } else {
-        LOG_ERROR << "Logic layer returned unexpected response format: " << response;
-        return -1;
+    return takeResponse(url, future.get(), response);
+}
+
+void LogicClient::sendHttpRequestAsync(const string& url, const string& post_data, LogicDoneCallback done) {
+    CLogicHttpPool::GetInstance().Post(url, post_data, [url, done = std::move(done)](const LogicHttpResponse& result) {
+        string response;
+        bool success = takeResponse(url, result, response);
+        done(success ? 0 : -1, response);
+    });
+}
+
+Json::Value LogicClient::encodeChatMessages(
+    const google::protobuf::RepeatedPtrField<ChatRoom::Logic::ChatMessage>& messages) {
+    Json::Value messages_array(Json::arrayValue);
+    for (const auto& msg : messages) {
+        Json::Value message_obj;
+        message_obj["id"] = msg.id();
+        message_obj["content"] = msg.content();
+        message_obj["timestamp"] = (Json::UInt64)msg.timestamp();
+        Json::Value user_obj;
+        user_obj["id"] = msg.user().id();
+        user_obj["username"] = msg.user().username();
+        message_obj["user"] = user_obj;
+        messages_array.append(message_obj);
     }
+    return messages_array;
 }
 
-bool LogicClient::sendHttpRequest(const string& url, const string& post_data, string& response) {
-    CURL* curl;
-    CURLcode res;
-    bool success = false;
-
-    curl = curl_easy_init();
-    if (curl) {
-        // 设置URL
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-        
-        // 设置POST数据
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, post_data.c_str());
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, post_data.length());
-        
-        // 设置HTTP头
-        struct curl_slist* headers = NULL;
-        headers = curl_slist_append(headers, "Content-Type: application/json");
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-        
-        // 设置写回调
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-        
-        // 设置超时
-        curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
-        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 3L);
-        
-        // 执行请求
-        res = curl_easy_perform(curl);
-        
-        if (res == CURLE_OK) {
-            long response_code;
-            curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
-            if (response_code == 200 || response_code == 401) {
-                success = true;
-            } else {
-                LOG_ERROR << "HTTP request failed with response code: " << response_code;
-            }
-        } else {
-            LOG_ERROR << "CURL request failed: " << curl_easy_strerror(res);
-        }
-        
-        // 清理
-        curl_slist_free_all(headers);
-        curl_easy_cleanup(curl);
+bool LogicClient::checkRpcStatus(const char* method, const grpc::Status& status) {
+    if (status.ok()) {
+        return true;
     }
+    LOG_ERROR << "logic rpc " << method << " failed, code: " << status.error_code()
+              << ", message: " << status.error_message();
+    return false;
+}
 
-    return success;
+bool LogicClient::takeResponse(const string& url, const LogicHttpResponse& result, string& response) {
+    if (!result.ok) {
+        LOG_ERROR << "logic request failed: " << result.error << ", url: " << url;
+        return false;
+    }
+    response = result.body;
+    if (result.status_code == 200 || result.status_code == 401) {
+        return true;
+    }
+    LOG_ERROR << "HTTP request failed with response code: " << result.status_code;
+    return false;
 }
 
 LogicAuthResult LogicClient::parseAuthResponse(const string& response_json) {
@@ -1,12 +1,19 @@
 #ifndef __LOGIC_CLIENT_H__
 #define __LOGIC_CLIENT_H__
 
+#include <functional>
 #include <string>
+#include <vector>
 #include <json/json.h>
 #include "muduo/base/Logging.h"
+#include "logic_http_pool.h"
+#include "logic_rpc_client.h"
 
 using std::string;
 
+// async completion, runs in the logic client loop thread (http) or a gRPC thread, ret 0 success
+typedef std::function<void(int ret, const string& response)> LogicDoneCallback;
+
 struct LogicAuthResult {
     bool success;               // 认证是否成功
     string user_id;             // 用户ID (UUID)
@@ -15,8 +22,23 @@ struct LogicAuthResult {
     string error_message;       // 错误信息
 };
 
+struct LogicRoom {
+    string room_id;
+    string room_name;
+};
+
+// same threads as LogicDoneCallback, or the calling thread when answered locally
+typedef std::function<void(const LogicAuthResult& result)> LogicAuthCallback;
+// ret 0 success, response_json is the hello message for the client
+typedef std::function<void(int ret, const string& response_json, const std::vector<LogicRoom>& rooms)>
+    LogicHelloCallback;
+
 /**
  * Logic client, interaction with logic server
+ * by default requests are typed ChatRoom.Logic gRPC calls (CLogicRpcClient), with logic_rpc_mode=http
+ * they go through the pooled keep-alive conns of CLogicHttpPool; login/register/logout are always http
+ * signed session tokens are verified locally, see CSessionTokenCodec
+ * the object itself is cheap, the callbacks don't use it, it may be gone before they run
  */
 class LogicClient {
 public:
@@ -24,60 +46,80 @@ public:
     ~LogicClient();
 
     /**
-     * 通过cookie验证用户身份
+     * 通过cookie验证用户身份, 签名 token 在调用线程里直接回调, 其余异步问 logic
      * @param cookie user login cookie
-     * @return LogicAuthResult 
+     * @param done 完成回调, 认证结果
+     */
+    void verifyUserAuth(const string& cookie, LogicAuthCallback done);
+
+    /**
+     * 新连接的 hello, 不等待应答
+     * @param user_id 用户ID
+     * @param username 用户名
+     * @param done 完成回调, 发给客户端的 hello 消息和用户要订阅的房间
      */
-    LogicAuthResult verifyUserAuth(const string& cookie);
+    void hello(const string& user_id, const string& username, LogicHelloCallback done);
+
+    /**
+     * 获取所有房间, 阻塞等待应答
+     * @param rooms 房间列表
+     * @return 0成功，-1失败
+     */
+    int getAllRooms(std::vector<LogicRoom>& rooms);
 
     /**
      * 用户登录
      * @param post_data 登录请求数据
-     * @param response 响应数据
-     * @return 0成功，非0失败
+     * @param done 完成回调, 响应数据
      */
-    int loginUser(const string& post_data, string& response);
+    void loginUser(const string& post_data, LogicDoneCallback done);
 
     /**
      * 用户注册
      * @param post_data 注册请求数据
-     * @param response 响应数据
-     * @return 0成功，非0失败
+     * @param done 完成回调, 响应数据
      */
-    int registerUser(const string& post_data, string& response);
+    void registerUser(const string& post_data, LogicDoneCallback done);
+
+    /**
+     * 用户注销, logic 吊销会话并推送给所有 comet
+     * @param cookie 用户cookie
+     * @param done 完成回调, 响应数据
+     */
+    void logoutUser(const string& cookie, LogicDoneCallback done);
 
     /**
      * 处理客户端消息
      * @param root WebSocket消息的JSON根对象
      * @param user_id 用户ID
      * @param username 用户名
-     * @param response 响应数据
-     * @return 0成功，非0失败
+     * @param done 完成回调, 响应数据
+     * @return 0已发出，非0请求无效(不会回调)
      */
-    int handleSend(Json::Value& root, const string& user_id, const string& username, string& response);
+    int handleSend(Json::Value& root, const string& user_id, const string& username, LogicDoneCallback done);
 
     /**
      * 处理房间历史消息请求（分布式模式）
      * @param root WebSocket消息的JSON根对象
      * @param user_id 用户ID
      * @param username 用户名
-     * @param response 响应数据
-     * @return 0成功，非0失败
+     * @param done 完成回调, 响应数据
+     * @return 0已发出，非0请求无效(不会回调)
      */
-    int handleRoomHistory(Json::Value& root, const string& user_id, const string& username, string& response);
+    int handleRoomHistory(Json::Value& root, const string& user_id, const string& username, LogicDoneCallback done);
     
     /**
      * 处理创建房间请求（分布式模式）
      * @param root WebSocket消息的JSON根对象
      * @param user_id 用户ID
      * @param username 用户名
-     * @param response 响应数据
-     * @return 0成功，非0失败
+     * @param done 完成回调, 响应数据
+     * @return 0已发出，非0请求无效(不会回调)
      */
-    int handleCreateRoom(Json::Value& root, const string& user_id, const string& username, string& response);
+    int handleCreateRoom(Json::Value& root, const string& user_id, const string& username, LogicDoneCallback done);
 
     /**
-     * 发送HTTP POST请求
+     * 发送HTTP POST请求, 阻塞等待应答(最多 request_timeout), 不能在 logic client loop 线程调用
      * @param url 请求URL
      * @param post_data POST数据
      * @param response 响应数据
@@ -85,15 +127,31 @@ public:
      */
     bool sendHttpRequest(const string& url, const string& post_data, string& response);
 
+    /**
+     * 异步发送HTTP POST请求
+     * @param url 请求URL
+     * @param post_data POST数据
+     * @param done 完成回调, 0成功
+     */
+    void sendHttpRequestAsync(const string& url, const string& post_data, LogicDoneCallback done);
+
 private:
     string logic_server_url_;
+    bool use_grpc_;
 
     /**
      * 解析认证响应
      * @param response_json 响应JSON
      * @return LogicAuthResult 认证结果
      */
-    LogicAuthResult parseAuthResponse(const string& response_json);
+    static LogicAuthResult parseAuthResponse(const string& response_json);
+
+    // ChatRoom.Logic replies to the json the browser expects
+    static Json::Value encodeChatMessages(const google::protobuf::RepeatedPtrField<ChatRoom::Logic::ChatMessage>& messages);
+    static bool checkRpcStatus(const char* method, const grpc::Status& status);
+
+    // 200 and 401 carry a logic answer, others are failures
+    static bool takeResponse(const string& url, const LogicHttpResponse& result, string& response);
 };
 
 #endif // __LOGIC_CLIENT_H__
\ No newline at end of file
@@ -21,6 +21,17 @@ bool LogicConfig::init(const string& config_file) {
     } else {
         LOG_WARN << "Logic server config not found, using default: " << logic_server_url_;
     }
+
+    // logic gRPC port, same host as the http api
+    char* logic_grpc_port = config_reader.GetConfigName("logic_grpc_port");
+    string host = logic_server_host ? string(logic_server_host) : string("localhost");
+    logic_rpc_target_ = host + ":" + string(logic_grpc_port ? logic_grpc_port : "50052");
+
+    char* logic_rpc_mode = config_reader.GetConfigName("logic_rpc_mode");
+    if (logic_rpc_mode) {
+        use_grpc_ = string(logic_rpc_mode) != "http";
+    }
+    LOG_INFO << "Logic rpc mode: " << (use_grpc_ ? "grpc " + logic_rpc_target_ : string("http"));
     
     // 读取超时配置
     char* connect_timeout_str = config_reader.GetConfigName("logic_connect_timeout");
@@ -34,6 +45,28 @@ bool LogicConfig::init(const string& config_file) {
         request_timeout_ = atoi(request_timeout_str);
         LOG_INFO << "Logic request timeout configured: " << request_timeout_ << "s";
     }
+
+    // 连接池配置
+    char* pool_connections_str = config_reader.GetConfigName("logic_pool_connections");
+    if (pool_connections_str) {
+        pool_connections_ = atoi(pool_connections_str);
+        LOG_INFO << "Logic pool connections configured: " << pool_connections_;
+    }
+
+    char* pipeline_depth_str = config_reader.GetConfigName("logic_pipeline_depth");
+    if (pipeline_depth_str) {
+        pipeline_depth_ = atoi(pipeline_depth_str);
+        LOG_INFO << "Logic pipeline depth configured: " << pipeline_depth_;
+    }
+
+    char* session_token_enable = config_reader.GetConfigName("session_token_enable");
+    if (session_token_enable) {
+        session_token_enable_ = atoi(session_token_enable) != 0;
+    }
+    char* session_token_keys = config_reader.GetConfigName("session_token_keys");
+    if (session_token_keys) {
+        session_token_keys_ = session_token_keys;
+    }
     
     return true;
 }
\ No newline at end of file
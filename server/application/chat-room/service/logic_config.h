@@ -21,6 +21,12 @@ public:
     bool init(const string& config_file);
     
     const string& getLogicServerUrl() const { return logic_server_url_; }
+
+    // host:port of the ChatRoom.Logic gRPC service
+    const string& getLogicRpcTarget() const { return logic_rpc_target_; }
+
+    // grpc(默认) 走 ChatRoom.Logic, http 走兼容的 /logic/* 接口
+    bool useGrpc() const { return use_grpc_; }
     
     // 获取连接超时时间（秒）
     int getConnectTimeout() const { return connect_timeout_; }
@@ -28,6 +34,18 @@ public:
     // 获取请求超时时间（秒）
     int getRequestTimeout() const { return request_timeout_; }
 
+    // 每个logic地址的keep-alive连接数
+    int getPoolConnections() const { return pool_connections_; }
+
+    // 单条连接上流水线发送的最大请求数
+    int getPipelineDepth() const { return pipeline_depth_; }
+
+    // 本地校验 logic 签发的会话 token
+    bool sessionTokenEnabled() const { return session_token_enable_; }
+
+    // kid:secret,kid:secret, 与 logic 相同
+    const string& getSessionTokenKeys() const { return session_token_keys_; }
+
 private:
     LogicConfig() = default;
     ~LogicConfig() = default;
@@ -35,8 +53,14 @@ private:
     LogicConfig& operator=(const LogicConfig&) = delete;
     
     string logic_server_url_ = "http://localhost:8090";  // 默认logic服务器地址
+    string logic_rpc_target_ = "localhost:50052";        // 默认logic gRPC地址
+    bool use_grpc_ = true;                               // comet->logic 调用方式
     int connect_timeout_ = 3;                            // 连接超时时间（秒）
     int request_timeout_ = 5;                            // 请求超时时间（秒）
+    int pool_connections_ = 4;                           // 每个logic地址的长连接数
+    int pipeline_depth_ = 32;                            // 单连接流水线深度
+    bool session_token_enable_ = false;                  // 会话 token 本地校验
+    string session_token_keys_;                          // 会话 token 密钥
 };
 
 #endif // __LOGIC_CONFIG_H__
\ No newline at end of file
@@ -0,0 +1,320 @@
+#include "logic_http_pool.h"
+#include <stdlib.h>
+#include <string.h>
+#include "muduo/base/Logging.h"
+#include "http_request_parser.h"
+
+static const size_t kMaxResponseHeaderSize = 8 * 1024;
+static const size_t kMaxResponseBodySize = 16 * 1024 * 1024;
+
+CLogicHttpChannel::CLogicHttpChannel(EventLoop* loop, const InetAddress& addr, const string& host,
+    const string& name, const LogicHttpPoolConfig& config)
+    : loop_(loop),
+      host_(host),
+      config_(config),
+      client_(loop, addr, name)
+{
+    client_.setConnectionCallback(
+        std::bind(&CLogicHttpChannel::OnConnection, this, std::placeholders::_1));
+    client_.setMessageCallback(
+        std::bind(&CLogicHttpChannel::OnMessage, this, std::placeholders::_1,
+            std::placeholders::_2, std::placeholders::_3));
+    // reconnect with backoff after logic restarts or the conn is dropped
+    client_.enableRetry();
+    client_.connect();
+}
+
+CLogicHttpChannel::~CLogicHttpChannel() {
+    client_.stop();
+}
+
+void CLogicHttpChannel::Post(const string& path, const string& body, LogicResponseCallback cb) {
+    loop_->assertInLoopThread();
+    PendingRequest request;
+    request.data.reserve(128 + path.size() + body.size());
+    request.data.append("POST ").append(path).append(" HTTP/1.1\r\n");
+    request.data.append("Host: ").append(host_).append("\r\n");
+    request.data.append("Connection: keep-alive\r\n");
+    request.data.append("Content-Type: application/json\r\n");
+    request.data.append("Content-Length: ").append(std::to_string(body.size())).append("\r\n\r\n");
+    request.data.append(body);
+    request.cb = std::move(cb);
+    request.post_time = Timestamp::now();
+    waiting_.push_back(std::move(request));
+    Flush();
+}
+
+// write waiting requests while the pipeline has room
+void CLogicHttpChannel::Flush() {
+    if (!conn_ || !conn_->connected()) {
+        return;
+    }
+    while (!waiting_.empty() && in_flight_.size() < static_cast<size_t>(config_.max_pipeline_depth)) {
+        PendingRequest& request = waiting_.front();
+        conn_->send(request.data.data(), static_cast<int>(request.data.size()));
+        request.data.clear();
+        request.data.shrink_to_fit();
+        in_flight_.push_back(std::move(request));
+        waiting_.pop_front();
+    }
+}
+
+void CLogicHttpChannel::OnConnection(const TcpConnectionPtr& conn) {
+    if (conn->connected()) {
+        LOG_INFO << "logic conn up: " << conn->name();
+        conn->setTcpNoDelay(true);
+        conn_ = conn;
+        Flush();
+    }
+    else {
+        LOG_WARN << "logic conn down: " << conn->name() << ", in flight: " << in_flight_.size();
+        conn_.reset();
+        // the requests may or may not be handled by logic, never resend them
+        FailInFlight("logic connection closed");
+    }
+}
+
+void CLogicHttpChannel::OnMessage(const TcpConnectionPtr& conn, Buffer* buf, Timestamp) {
+    while (buf->readableBytes() > 0) {
+        LogicHttpResponse response;
+        bool close = false;
+        ParseResult result = ParseResponse(buf, &response, &close);
+        if (result == kNeedMore) {
+            break;
+        }
+        if (result == kError || in_flight_.empty()) {
+            LOG_ERROR << "bad or unexpected response from logic, conn: " << conn->name();
+            buf->retrieveAll();
+            FailInFlight("bad response from logic");
+            conn->forceClose();
+            return;
+        }
+        PendingRequest request = std::move(in_flight_.front());
+        in_flight_.pop_front();
+        Complete(request, response);
+        if (close) {
+            // later responses on this conn never come, TcpClient reconnects
+            FailInFlight("logic closed the connection");
+            conn->shutdown();
+            return;
+        }
+    }
+    Flush();
+}
+
+// one response at buf->peek(), retrieved only when complete
+CLogicHttpChannel::ParseResult CLogicHttpChannel::ParseResponse(Buffer* buf,
+    LogicHttpResponse* response, bool* close) {
+    const char* begin = buf->peek();
+    size_t readable = buf->readableBytes();
+    const char* head_end = static_cast<const char*>(memmem(begin, readable, "\r\n\r\n", 4));
+    if (!head_end) {
+        return readable > kMaxResponseHeaderSize ? kError : kNeedMore;
+    }
+
+    // HTTP/1.1 200 OK
+    const char* line_end = buf->findCRLF();
+    if (line_end - begin < 12 || memcmp(begin, "HTTP/1.", 7) != 0) {
+        return kError;
+    }
+    int status_code = atoi(begin + 9);
+
+    size_t content_length = 0;
+    bool has_length = false;
+    const char* line = line_end + 2;
+    while (line < head_end) {
+        const char* eol = static_cast<const char*>(memmem(line, head_end + 2 - line, "\r\n", 2));
+        std::string_view field(line, eol - line);
+        size_t colon = field.find(':');
+        if (colon != std::string_view::npos) {
+            std::string_view name = field.substr(0, colon);
+            std::string_view value = field.substr(colon + 1);
+            while (!value.empty() && value.front() == ' ') {
+                value.remove_prefix(1);
+            }
+            if (CHttpRequestParser::EqualsIgnoreCase(name, "Content-Length")) {
+                content_length = strtoul(string(value).c_str(), nullptr, 10);
+                has_length = true;
+            }
+            else if (CHttpRequestParser::EqualsIgnoreCase(name, "Connection")) {
+                *close = CHttpRequestParser::HasToken(value, "close");
+            }
+        }
+        line = eol + 2;
+    }
+
+    // logic always answers with Content-Length, read-until-close is not supported
+    if (!has_length || content_length > kMaxResponseBodySize) {
+        return kError;
+    }
+    size_t header_length = head_end + 4 - begin;
+    if (readable < header_length + content_length) {
+        return kNeedMore;
+    }
+    response->ok = true;
+    response->status_code = status_code;
+    response->body.assign(begin + header_length, content_length);
+    buf->retrieve(header_length + content_length);
+    return kComplete;
+}
+
+void CLogicHttpChannel::FailInFlight(const string& error) {
+    LogicHttpResponse response;
+    response.error = error;
+    std::deque<PendingRequest> failed;
+    failed.swap(in_flight_);
+    for (auto& request : failed) {
+        Complete(request, response);
+    }
+}
+
+void CLogicHttpChannel::Complete(PendingRequest& request, const LogicHttpResponse& response) {
+    if (request.cb) {
+        request.cb(response);
+    }
+}
+
+void CLogicHttpChannel::CheckTimeout(Timestamp now) {
+    // waiting requests are not on the wire, fail them one by one
+    while (!waiting_.empty()) {
+        double timeout = conn_ ? config_.request_timeout : config_.connect_timeout;
+        if (timeDifference(now, waiting_.front().post_time) < timeout) {
+            break;
+        }
+        PendingRequest request = std::move(waiting_.front());
+        waiting_.pop_front();
+        LogicHttpResponse response;
+        response.error = conn_ ? "logic request timeout" : "logic connect timeout";
+        Complete(request, response);
+    }
+
+    // responses are in order, a late head blocks the whole pipeline
+    if (!in_flight_.empty() && timeDifference(now, in_flight_.front().post_time) >= config_.request_timeout) {
+        LOG_WARN << "logic request timeout, drop conn with " << in_flight_.size() << " requests in flight";
+        FailInFlight("logic request timeout");
+        if (conn_) {
+            conn_->forceClose();
+        }
+    }
+}
+
+CLogicHttpPool& CLogicHttpPool::GetInstance() {
+    static CLogicHttpPool instance;
+    return instance;
+}
+
+void CLogicHttpPool::Init(const LogicHttpPoolConfig& config) {
+    if (loop_) {
+        return;
+    }
+    config_ = config;
+    if (config_.conns_per_endpoint <= 0) {
+        config_.conns_per_endpoint = 1;
+    }
+    if (config_.max_pipeline_depth <= 0) {
+        config_.max_pipeline_depth = 1;
+    }
+    loop_ = loop_thread_.startLoop();
+    loop_->runEvery(1.0, std::bind(&CLogicHttpPool::CheckTimeout, this));
+    LOG_INFO << "logic http pool started, conns_per_endpoint: " << config_.conns_per_endpoint
+        << ", max_pipeline_depth: " << config_.max_pipeline_depth;
+}
+
+void CLogicHttpPool::Post(const string& url, const string& body, LogicResponseCallback cb) {
+    string host;
+    uint16_t port = 0;
+    string path;
+    if (!loop_ || !SplitUrl(url, &host, &port, &path)) {
+        LOG_ERROR << "logic http pool not ready or bad url: " << url;
+        LogicHttpResponse response;
+        response.error = "bad logic url";
+        cb(response);
+        return;
+    }
+
+    loop_->runInLoop([this, host = std::move(host), port, path = std::move(path), body,
+        cb = std::move(cb)]() mutable {
+        Endpoint* endpoint = this->GetEndpoint(host, port);
+        if (!endpoint) {
+            LogicHttpResponse response;
+            response.error = "can't resolve logic host " + host;
+            cb(response);
+            return;
+        }
+        // least loaded conn, round robin on ties
+        size_t n = endpoint->channels.size();
+        size_t best = endpoint->next++ % n;
+        for (size_t i = 1; i < n; i++) {
+            size_t index = (best + i) % n;
+            if (endpoint->channels[index]->Pending() < endpoint->channels[best]->Pending()) {
+                best = index;
+            }
+        }
+        endpoint->channels[best]->Post(path, body, std::move(cb));
+    });
+}
+
+std::future<LogicHttpResponse> CLogicHttpPool::Post(const string& url, const string& body) {
+    auto promise = std::make_shared<std::promise<LogicHttpResponse>>();
+    std::future<LogicHttpResponse> future = promise->get_future();
+    this->Post(url, body, [promise](const LogicHttpResponse& response) {
+        promise->set_value(response);
+    });
+    return future;
+}
+
+// http://host:port/path
+bool CLogicHttpPool::SplitUrl(const string& url, string* host, uint16_t* port, string* path) {
+    size_t pos = 0;
+    if (url.compare(0, 7, "http://") == 0) {
+        pos = 7;
+    }
+    size_t slash = url.find('/', pos);
+    string host_port = url.substr(pos, slash == string::npos ? string::npos : slash - pos);
+    *path = slash == string::npos ? "/" : url.substr(slash);
+
+    size_t colon = host_port.rfind(':');
+    if (colon == string::npos) {
+        *host = host_port;
+        *port = 80;
+    }
+    else {
+        *host = host_port.substr(0, colon);
+        *port = static_cast<uint16_t>(atoi(host_port.c_str() + colon + 1));
+    }
+    return !host->empty() && *port != 0;
+}
+
+CLogicHttpPool::Endpoint* CLogicHttpPool::GetEndpoint(const string& host, uint16_t port) {
+    string key = host + ":" + std::to_string(port);
+    auto it = endpoints_.find(key);
+    if (it != endpoints_.end()) {
+        return it->second.get();
+    }
+
+    // resolved once per endpoint, the conns reconnect to the same address
+    InetAddress addr(port);
+    if (!InetAddress::resolve(host, &addr)) {
+        LOG_ERROR << "resolve logic host failed: " << host;
+        return nullptr;
+    }
+    std::unique_ptr<Endpoint> endpoint(new Endpoint);
+    for (int i = 0; i < config_.conns_per_endpoint; i++) {
+        endpoint->channels.emplace_back(new CLogicHttpChannel(loop_, addr, key,
+            "logic-" + key + "#" + std::to_string(i), config_));
+    }
+    LOG_INFO << "logic endpoint " << key << " -> " << addr.toIpPort()
+        << ", conns: " << config_.conns_per_endpoint;
+    Endpoint* result = endpoint.get();
+    endpoints_[key] = std::move(endpoint);
+    return result;
+}
+
+void CLogicHttpPool::CheckTimeout() {
+    Timestamp now = Timestamp::now();
+    for (auto& kv : endpoints_) {
+        for (auto& channel : kv.second->channels) {
+            channel->CheckTimeout(now);
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * comet -> logic 的非阻塞 HTTP 连接池
+ *
+ * 独立的客户端 EventLoop 线程上, 每个 logic 地址(host:port)维护若干条 keep-alive 长连接,
+ * 请求在连接上流水线(pipelining)发送, logic 按顺序应答, 应答按 FIFO 匹配到请求;
+ * 完成时在客户端 loop 线程里执行回调, 也可以通过 future 等待结果
+ * 一个慢的 logic 实例只会让对应请求超时, 不会占住 comet 的工作线程
+ */
+#ifndef __LOGIC_HTTP_POOL_H__
+#define __LOGIC_HTTP_POOL_H__
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
+#include "muduo/net/InetAddress.h"
+#include "muduo/net/TcpClient.h"
+
+using std::string;
+using namespace muduo;
+using namespace muduo::net;
+
+struct LogicHttpResponse {
+    bool ok = false;            // a whole response was received
+    int status_code = 0;
+    string body;
+    string error;               // why it failed when !ok
+};
+
+// runs in the client loop thread, must not block
+typedef std::function<void(const LogicHttpResponse&)> LogicResponseCallback;
+
+struct LogicHttpPoolConfig {
+    int conns_per_endpoint = 4;         // keep-alive conns to one logic
+    int max_pipeline_depth = 32;        // requests on the wire of one conn
+    int connect_timeout = 3;            // seconds a request waits for a conn
+    int request_timeout = 5;            // seconds from post to response
+};
+
+// one keep-alive conn, responses come back in request order
+class CLogicHttpChannel : muduo::noncopyable {
+public:
+    CLogicHttpChannel(EventLoop* loop, const InetAddress& addr, const string& host,
+        const string& name, const LogicHttpPoolConfig& config);
+    ~CLogicHttpChannel();
+
+    // the following must be called in loop thread
+    void Post(const string& path, const string& body, LogicResponseCallback cb);
+    size_t Pending() const { return in_flight_.size() + waiting_.size(); }
+    void CheckTimeout(Timestamp now);
+
+private:
+    struct PendingRequest {
+        string data;                // whole http request
+        LogicResponseCallback cb;
+        Timestamp post_time;
+    };
+
+    enum ParseResult {
+        kNeedMore,
+        kComplete,
+        kError,
+    };
+
+    void OnConnection(const TcpConnectionPtr& conn);
+    void OnMessage(const TcpConnectionPtr& conn, Buffer* buf, Timestamp time);
+    ParseResult ParseResponse(Buffer* buf, LogicHttpResponse* response, bool* close);
+    void Flush();
+    void FailInFlight(const string& error);
+    void Complete(PendingRequest& request, const LogicHttpResponse& response);
+
+    EventLoop* loop_;
+    string host_;
+    const LogicHttpPoolConfig& config_;
+    TcpClient client_;
+    TcpConnectionPtr conn_;
+    std::deque<PendingRequest> in_flight_;      // written, waiting for the response
+    std::deque<PendingRequest> waiting_;        // no conn or pipeline is full
+};
+
+class CLogicHttpPool : muduo::noncopyable {
+public:
+    static CLogicHttpPool& GetInstance();
+
+    // start the client loop, must be called before any Post
+    void Init(const LogicHttpPoolConfig& config);
+
+    // url: http://host:port/path, thread safe
+    void Post(const string& url, const string& body, LogicResponseCallback cb);
+    std::future<LogicHttpResponse> Post(const string& url, const string& body);
+
+    bool IsInLoopThread() const { return loop_ && loop_->isInLoopThread(); }
+    const LogicHttpPoolConfig& GetConfig() const { return config_; }
+
+private:
+    struct Endpoint {
+        std::vector<std::unique_ptr<CLogicHttpChannel>> channels;
+        size_t next = 0;
+    };
+
+    CLogicHttpPool() = default;
+    ~CLogicHttpPool() = default;
+
+    static bool SplitUrl(const string& url, string* host, uint16_t* port, string* path);
+    Endpoint* GetEndpoint(const string& host, uint16_t port);      // loop thread
+    void CheckTimeout();
+
+    LogicHttpPoolConfig config_;
+    EventLoopThread loop_thread_;
+    EventLoop* loop_ = nullptr;
+    std::map<string, std::unique_ptr<Endpoint>> endpoints_;        // host:port -> conns, loop thread
+};
+
+#endif // __LOGIC_HTTP_POOL_H__
@@ -0,0 +1,37 @@
+#include "logic_rpc_client.h"
+#include <chrono>
+#include "muduo/base/Logging.h"
+
+CLogicRpcClient& CLogicRpcClient::GetInstance() {
+    static CLogicRpcClient instance;
+    return instance;
+}
+
+void CLogicRpcClient::Init(const string& target, int channels, int request_timeout) {
+    if (!stubs_.empty()) {
+        return;
+    }
+    request_timeout_ = request_timeout > 0 ? request_timeout : 5;
+    if (channels <= 0) {
+        channels = 1;
+    }
+
+    for (int i = 0; i < channels; i++) {
+        grpc::ChannelArguments args;
+        // channels with the same args share one subchannel (one tcp conn) unless the pool is local
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, 30 * 1000);
+        std::shared_ptr<grpc::Channel> channel =
+            grpc::CreateCustomChannel(target, grpc::InsecureChannelCredentials(), args);
+        stubs_.push_back(ChatRoom::Logic::Logic::NewStub(channel));
+    }
+    LOG_INFO << "logic rpc client started, target: " << target << ", channels: " << channels;
+}
+
+ChatRoom::Logic::Logic::Stub* CLogicRpcClient::GetStub() {
+    return stubs_[next_.fetch_add(1, std::memory_order_relaxed) % stubs_.size()].get();
+}
+
+void CLogicRpcClient::SetDeadline(grpc::ClientContext* context) const {
+    context->set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(request_timeout_));
+}
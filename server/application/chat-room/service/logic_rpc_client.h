@@ -0,0 +1,53 @@
+/**
+ * comet -> logic 的 gRPC 客户端
+ *
+ * ChatRoom.Logic 服务的 typed 调用, 替代 /logic/xxx 的 HTTP + JSON
+ * 每个 channel 一条独立的 HTTP/2 连接, 调用按轮询分到各 channel 上;
+ * stub 线程安全, 异步调用的回调在 gRPC 内部线程执行
+ */
+#ifndef __LOGIC_RPC_CLIENT_H__
+#define __LOGIC_RPC_CLIENT_H__
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "muduo/base/noncopyable.h"
+#include "ChatRoom.Logic.grpc.pb.h"
+
+using std::string;
+
+// one async unary call, alive until its callback returns
+template <class Request, class Reply>
+struct LogicRpcCall {
+    grpc::ClientContext context;
+    Request request;
+    Reply reply;
+};
+
+class CLogicRpcClient : muduo::noncopyable {
+public:
+    static CLogicRpcClient& GetInstance();
+
+    // target: host:port of the logic gRPC server, must be called before any call
+    void Init(const string& target, int channels, int request_timeout);
+
+    bool IsReady() const { return !stubs_.empty(); }
+
+    // round robin over the channels, thread safe
+    ChatRoom::Logic::Logic::Stub* GetStub();
+
+    // every call carries a deadline, a slow logic only fails its own calls
+    void SetDeadline(grpc::ClientContext* context) const;
+
+private:
+    CLogicRpcClient() = default;
+    ~CLogicRpcClient() = default;
+
+    int request_timeout_ = 5;
+    std::vector<std::unique_ptr<ChatRoom::Logic::Logic::Stub>> stubs_;
+    std::atomic<size_t> next_{0};
+};
+
+#endif // __LOGIC_RPC_CLIENT_H__
@@ -0,0 +1,63 @@
+#include "paced_broadcast.h"
+#include <algorithm>
+
+void CPacedBroadcaster::Add(const WebSocketBroadcastFrame& frame, std::vector<CHttpConnPtr>&& conns, double rate) {
+    loop_->assertInLoopThread();
+    Job job;
+    job.frame = frame;
+    job.conns = std::move(conns);
+    job.rate = rate;
+    jobs_.push_back(std::move(job));
+    if (scheduled_) {
+        return;
+    }
+
+    // 空闲时第一个 tick 立即执行, 先写一个 tick 的额度
+    tokens_ = 0;
+    last_tick_ = muduo::addTime(muduo::Timestamp::now(), -kTickSeconds);
+    OnTick();
+}
+
+void CPacedBroadcaster::Send(Job& job, size_t count) {
+    size_t end = std::min(job.conns.size(), job.next + count);
+    for (; job.next < end; job.next++) {
+        const CHttpConnPtr& conn = job.conns[job.next];
+        conn->SendBroadcast(job.frame.Select(conn->AcceptsDeflatedBroadcast()));
+    }
+}
+
+void CPacedBroadcaster::OnTick() {
+    scheduled_ = false;
+    muduo::Timestamp now = muduo::Timestamp::now();
+    double elapsed = muduo::timeDifference(now, last_tick_);
+    last_tick_ = now;
+
+    while (!jobs_.empty()) {
+        Job& job = jobs_.front();
+        if (job.rate > 0) {
+            // 桶容量两个 tick, loop 繁忙推迟了 tick 也不会突发写出大量连接
+            double burst = std::max(job.rate * kTickSeconds * 2, 1.0);
+            tokens_ = std::min(tokens_ + elapsed * job.rate, burst);
+            elapsed = 0;
+            size_t count = static_cast<size_t>(tokens_);
+            size_t before = job.next;
+            Send(job, count);
+            tokens_ -= static_cast<double>(job.next - before);
+        }
+        else {
+            Send(job, job.conns.size());
+        }
+        if (job.next < job.conns.size()) {
+            break;
+        }
+        // 剩余的额度留给下一个广播
+        jobs_.pop_front();
+    }
+
+    if (jobs_.empty()) {
+        tokens_ = 0;
+        return;
+    }
+    scheduled_ = true;
+    loop_->runAfter(kTickSeconds, [this]() { OnTick(); });
+}
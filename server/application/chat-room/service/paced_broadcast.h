@@ -0,0 +1,50 @@
+/**
+ * 限速的全局广播
+ *
+ * 每个 IO EventLoop 一个, 只在该 loop 线程内使用; 按令牌桶限速, 每个 tick 最多写
+ * rate * 经过时间 个连接, 写不完的留到下一个 tick, 一次广播不会长时间占住 loop,
+ * 房间消息和其他连接的读写可以穿插进行
+ * 多个广播按到达顺序依次进行, 限速广播进行期间到达的立即广播也排在它后面;
+ * 房间创建通知 (op 5) 例外, 不限速也不排队, 见 ConnShard::Broadcast 的 ahead
+ */
+#ifndef __PACED_BROADCAST_H__
+#define __PACED_BROADCAST_H__
+
+#include <deque>
+#include <vector>
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/EventLoop.h"
+#include "http_conn.h"
+#include "websocket_deflate.h"
+
+class CPacedBroadcaster : muduo::noncopyable {
+public:
+    explicit CPacedBroadcaster(EventLoop* loop) : loop_(loop) {}
+
+    // the following must be called in loop_ thread
+    // rate: conns written per second, <= 0 writes all of them once it's the first in line
+    void Add(const WebSocketBroadcastFrame& frame, std::vector<CHttpConnPtr>&& conns, double rate);
+    bool Busy() const { return !jobs_.empty(); }
+
+private:
+    struct Job {
+        WebSocketBroadcastFrame frame;
+        std::vector<CHttpConnPtr> conns;    // snapshot when the broadcast arrived
+        size_t next = 0;
+        double rate = 0;
+    };
+
+    static constexpr double kTickSeconds = 0.01;
+
+    void OnTick();
+    void Send(Job& job, size_t count);
+
+    EventLoop* loop_;
+    std::deque<Job> jobs_;
+    double tokens_ = 0;
+    muduo::Timestamp last_tick_;
+    bool scheduled_ = false;
+};
+
+#endif // !__PACED_BROADCAST_H__
@@ -13,22 +13,6 @@ RoomTopic::RoomTopic(string room_id, string room_topic, const string& creator_id
 }
 
 RoomTopic::~RoomTopic() {
-    this->user_ids.clear();
-}
-
-// add user to room topic
-void RoomTopic::AddSubscriber(const string& user_id) {
-    this->user_ids.insert(user_id);
-}
-
-// delete user to room topic 
-void RoomTopic::DeleteSubscriber(const string& user_id) {
-    this->user_ids.erase(user_id);
-}
-
-// get all users in room topic
-std::unordered_set<string>& RoomTopic::GetSubscribers() {
-    return this->user_ids;
 }
 
 // =============================PubSubService===========================
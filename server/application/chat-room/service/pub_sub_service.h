@@ -1,5 +1,6 @@
 #ifndef __PUB_SUB_SERVICE_H__
 #define __PUB_SUB_SERVICE_H__
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 #include <mutex>
@@ -7,29 +8,23 @@
 #include <functional>
 #include <memory>
 #include "api_types.h"
+#include "conn_shard.h"
 #include "muduo/base/Logging.h"
 #include <json/json.h>
 
-// Room manager
+// Room manager, the subscribers of room live in ConnShard of each loop
 class RoomTopic {
 private:
     string room_id;
     string room_topic;
     string creator_id;          // UUID string
-    std::unordered_set<string> user_ids;    // all users subscribe this room
 public:
     RoomTopic(string room_id, string room_topic, const string& creator_id);
     ~RoomTopic();
-    void AddSubscriber(const string& user_id);
-    void DeleteSubscriber(const string& user_id);
-    std::unordered_set<string>& GetSubscribers();
 };
 
 using RoomTopicPtr = std::shared_ptr<RoomTopic>;
 
-// callback: based on function
-using PubSubCallback = std::function<void(std::unordered_set<string>& user_ids)>;
-
 // Subscribe Manager
 class PubSubService {
 private:
@@ -74,40 +69,53 @@ public:
         this->room_topic_map.erase(room_id);
     }
 
-    // add user to room topic
-    bool AddSubscriber(const string& room_id, const string& user_id) {
+    // add user to room topic, recorded in the shard of conn's loop
+    bool AddSubscriber(const string& room_id, const string& user_id, const CHttpConnPtr& conn) {
         LOG_DEBUG << "AddSubscriber(), room_id: " << room_id << ", user_id: " << user_id;
-        std::lock_guard<std::mutex> lock(this->room_topic_map_mutex);
-        if (this->room_topic_map.find(room_id) == this->room_topic_map.end()) {
+        if (!this->HasRoomTopic(room_id)) {
             LOG_WARN << "AddSubscriber(), can't find room_id: " << room_id;
             return false;
         }
 
-        this->room_topic_map[room_id]->AddSubscriber(user_id);
+        ConnShardManager::GetInstance().AddSubscriber(room_id, user_id, conn);
         return true;
     }
 
-    // delete user from room topic 
-    void DeleteSubscriber(const string& room_id, const string& user_id) {
-        std::lock_guard<std::mutex> lock(this->room_topic_map_mutex);
-        if (this->room_topic_map.find(room_id) == this->room_topic_map.end()) {
+    // add all online users to room topic
+    bool AddAllSubscribers(const string& room_id) {
+        if (!this->HasRoomTopic(room_id)) {
+            LOG_WARN << "AddAllSubscribers(), can't find room_id: " << room_id;
+            return false;
+        }
+
+        ConnShardManager::GetInstance().AddAllSubscribers(room_id);
+        return true;
+    }
+
+    // send websocket frame to all user in room topic, one batch task per loop
+    void PubSubMessage(const string& room_id, const WebSocketBroadcastFrame& frame) {
+        if (!this->HasRoomTopic(room_id)) {
             return;
         }
-        this->room_topic_map[room_id]->DeleteSubscriber(user_id);
+
+        ConnShardManager::GetInstance().BroadcastRoom(room_id, frame);
     }
 
-    // send message to all user in room topic
-    void PubSubMessage(const string& room_id, PubSubCallback callback) {
-        std::unordered_set<string> user_ids;
+    // frames of many rooms, unknown rooms are skipped, still one batch task per loop
+    void PubSubMessages(RoomFrames&& frames) {
         {
             std::lock_guard<std::mutex> lock(this->room_topic_map_mutex);
-            if (this->room_topic_map.find(room_id) == this->room_topic_map.end()) {
-                return;
-            }
-            user_ids = this->room_topic_map[room_id]->GetSubscribers();
+            frames.erase(std::remove_if(frames.begin(), frames.end(), [this](const RoomFrames::value_type& room_frame) {
+                return this->room_topic_map.find(room_frame.first) == this->room_topic_map.end();
+            }), frames.end());
         }
 
-        callback(user_ids);
+        ConnShardManager::GetInstance().BroadcastRooms(std::make_shared<const RoomFrames>(std::move(frames)));
+    }
+
+    bool HasRoomTopic(const string& room_id) {
+        std::lock_guard<std::mutex> lock(this->room_topic_map_mutex);
+        return this->room_topic_map.find(room_id) != this->room_topic_map.end();
     }
     // 房间列表管理: comet 层用于订阅管理
     static std::vector<Room>& GetRoomList();
@@ -0,0 +1,56 @@
+#include "strand.h"
+#include "muduo/base/Logging.h"
+
+void CStrand::Post(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+        if (scheduled_) {
+            // the running Drain picks it up
+            return;
+        }
+        scheduled_ = true;
+    }
+    Schedule();
+}
+
+void CStrand::Schedule() {
+    if (pool_) {
+        auto self = shared_from_this();
+        pool_->run([self]() { self->Drain(); });
+    }
+    else {
+        Drain();
+    }
+}
+
+void CStrand::Drain() {
+    for (int i = 0; i < kMaxBatch; i++) {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (tasks_.empty()) {
+                scheduled_ = false;
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        try {
+            task();
+        } catch (const std::exception& e) {
+            // one bad message must not stall the tasks behind it
+            LOG_ERROR << "strand task failed: " << e.what();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            scheduled_ = false;
+            return;
+        }
+    }
+    // scheduled_ stays true, nobody else can start a Drain in between
+    Schedule();
+}
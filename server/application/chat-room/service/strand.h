@@ -0,0 +1,44 @@
+/**
+ * 串行执行器 (strand)
+ *
+ * 每个连接一个, 投递到它的任务按投递顺序逐个执行, 同一时刻最多一个在跑,
+ * 可以落在业务线程池的任意线程上; 不同连接的任务仍然并行, 调大 num_threads
+ * 不会让同一连接的消息乱序或并发访问连接状态
+ * 一次最多连续执行 kMaxBatch 个任务, 剩下的重新排到线程池队尾, 一个连接发得
+ * 再快也不会长时间占住一个业务线程
+ */
+#ifndef __STRAND_H__
+#define __STRAND_H__
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/ThreadPool.h"
+
+class CStrand : public std::enable_shared_from_this<CStrand>, muduo::noncopyable {
+public:
+    using Task = std::function<void()>;
+
+    // pool == nullptr runs the tasks in the posting thread, still one by one
+    explicit CStrand(muduo::ThreadPool* pool) : pool_(pool) {}
+
+    // thread safe, the task owns its input, e.g. a moved payload
+    void Post(Task task);
+
+private:
+    static const int kMaxBatch = 64;
+
+    void Schedule();
+    void Drain();
+
+    muduo::ThreadPool* pool_;
+    std::mutex mutex_;
+    std::deque<Task> tasks_;
+    bool scheduled_ = false;    // a Drain is queued or running
+};
+
+using CStrandPtr = std::shared_ptr<CStrand>;
+
+#endif // !__STRAND_H__
@@ -0,0 +1,98 @@
+// websocket_simd 的基准: 选中的内核对比标量实现
+// cmake -DCHATROOM_BUILD_BENCHMARKS=ON, 然后运行 build/bin/websocket_simd_bench [MiB]
+#include "websocket_simd.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+// repeats pieces up to size bytes, never splitting a code point
+std::string MakePayload(const std::vector<std::string>& pieces, size_t size) {
+    std::string payload;
+    payload.reserve(size + 8);
+    for (size_t i = 0; payload.size() < size; i++) {
+        const std::string& piece = pieces[(i * 7 + i / 3) % pieces.size()];
+        if (payload.size() + piece.size() > size) {
+            break;
+        }
+        payload += piece;
+    }
+    payload.resize(size, 'x');
+    return payload;
+}
+
+template <class Func>
+double BenchGBps(size_t bytes_per_run, int runs, Func func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++) {
+        func();
+    }
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(bytes_per_run) * runs / seconds.count() / 1e9;
+}
+
+void BenchValidate(const char* name, const std::string& payload, int runs) {
+    bool expect = WsValidateUtf8Scalar(payload.data(), payload.size());
+    if (WsValidateUtf8(payload.data(), payload.size()) != expect) {
+        printf("%-22s MISMATCH\n", name);
+        exit(1);
+    }
+    volatile bool sink = false;
+    double scalar = BenchGBps(payload.size(), runs, [&]() {
+        sink = WsValidateUtf8Scalar(payload.data(), payload.size());
+    });
+    double simd = BenchGBps(payload.size(), runs, [&]() {
+        sink = WsValidateUtf8(payload.data(), payload.size());
+    });
+    (void)sink;
+    printf("utf8 %-17s scalar %7.2f GB/s  %-6s %7.2f GB/s\n", name, scalar, WsSimdKernelName(), simd);
+}
+
+void BenchUnmask(size_t size, int runs) {
+    const uint8_t key[4] = { 0x37, 0xfa, 0x21, 0x3d };
+    std::string payload(size, 'a');
+    std::string expect = payload;
+    WsUnmaskScalar(&expect[0], expect.size(), key);
+    std::string check = payload;
+    WsUnmask(&check[0], check.size(), key);
+    if (check != expect) {
+        printf("unmask MISMATCH\n");
+        exit(1);
+    }
+    double scalar = BenchGBps(size, runs, [&]() { WsUnmaskScalar(&payload[0], payload.size(), key); });
+    double simd = BenchGBps(size, runs, [&]() { WsUnmask(&payload[0], payload.size(), key); });
+    printf("unmask %-15zu scalar %7.2f GB/s  %-6s %7.2f GB/s\n", size, scalar, WsSimdKernelName(), simd);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t mib = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 1;
+    size_t size = (mib > 0 ? mib : 1) << 20;
+    int runs = static_cast<int>(200 / (mib > 0 ? mib : 1)) + 1;
+    printf("kernel: %s, payload: %zu MiB, runs: %d\n", WsSimdKernelName(), size >> 20, runs);
+
+    std::string ascii = MakePayload({ "hello ", "world, ", "chat room message ", "1234567890 " }, size);
+    std::string chinese = MakePayload({ "\xE4\xBD\xA0\xE5\xA5\xBD", "\xE8\x81\x8A\xE5\xA4\xA9\xE5\xAE\xA4",
+                                        "\xEF\xBC\x8C", "\xE6\xB6\x88\xE6\x81\xAF" }, size);
+    std::string mixed = MakePayload({ "hi ", "\xE4\xBD\xA0\xE5\xA5\xBD ", "caf\xC3\xA9 ", "\xF0\x9F\x98\x80",
+                                      "ok, ", "\xE8\x81\x8A\xE5\xA4\xA9" }, size);
+    std::string invalid = chinese;
+    invalid[invalid.size() - 2] = '\xFF';
+
+    BenchValidate("ascii", ascii, runs);
+    BenchValidate("chinese", chinese, runs);
+    BenchValidate("mixed", mixed, runs);
+    BenchValidate("invalid at end", invalid, runs);
+    // typical chat frame
+    std::string small = mixed.substr(0, 256);
+    while (static_cast<unsigned char>(small.back()) >= 0x80) {
+        small.pop_back();
+    }
+    BenchValidate("mixed 256B", small, runs * static_cast<int>(size / 256));
+    BenchUnmask(size, runs);
+    return 0;
+}
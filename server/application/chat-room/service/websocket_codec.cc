@@ -0,0 +1,67 @@
+#include "websocket_codec.h"
+#include "websocket_simd.h"
+
+CWebSocketDecoder::DecodeResult CWebSocketDecoder::Decode(Buffer* buf, WebSocketFrameView* frame) {
+    size_t readable = buf->readableBytes();
+    if (readable < 2) {
+        return kNeedMore;
+    }
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(buf->peek());
+    bool fin = (bytes[0] & 0x80) != 0;
+    uint8_t rsv = (bytes[0] >> 4) & 0x07;
+    uint8_t opcode = bytes[0] & 0x0F;
+    bool has_mask = (bytes[1] & 0x80) != 0;
+    uint64_t payload_len = bytes[1] & 0x7F;
+    size_t header_length = 2;
+
+    // calculate payload length
+    if (payload_len == 126) {
+        if (readable < 4) {
+            return kNeedMore;
+        }
+        header_length += 2;
+        payload_len = (static_cast<uint64_t>(bytes[2]) << 8) | bytes[3];
+    }
+    else if (payload_len == 127) {
+        if (readable < 10) {
+            return kNeedMore;
+        }
+        header_length += 8;
+        payload_len = 0;
+        for (int i = 2; i < 10; i++) {
+            payload_len = (payload_len << 8) | bytes[i];
+        }
+    }
+
+    // control frame must not be fragmented and carries at most 125 bytes
+    if ((opcode & 0x08) && (!fin || payload_len > 125)) {
+        return kProtocolError;
+    }
+    // client to server frame must be masked
+    if (!has_mask) {
+        return kProtocolError;
+    }
+    // reject before waiting for the payload, a huge length never completes
+    if (payload_len > max_frame_size_) {
+        return kTooLarge;
+    }
+
+    header_length += 4;
+    size_t total_frame_length = header_length + static_cast<size_t>(payload_len);
+    if (readable < total_frame_length) {
+        return kNeedMore;
+    }
+
+    // the readable bytes are owned by buf and not retrieved yet, unmask in place
+    char* payload = const_cast<char*>(buf->peek()) + header_length;
+    WsUnmask(payload, static_cast<size_t>(payload_len), bytes + header_length - 4);
+
+    frame->fin = fin;
+    frame->rsv = rsv;
+    frame->opcode = opcode;
+    frame->payload = payload;
+    frame->payload_length = static_cast<size_t>(payload_len);
+    frame->frame_length = total_frame_length;
+    return kFrame;
+}
@@ -0,0 +1,66 @@
+/**
+ * 增量 WebSocket 帧解码器
+ *
+ * 直接在 muduo Buffer 的可读区解析帧头, 数据不完整时不消费任何字节,
+ * 完整帧的 payload 在 Buffer 内原地去掩码, 以 (指针, 长度) 的形式交给调用方,
+ * 调用方处理完后再 retrieve, 中间不产生任何 string 拷贝
+ */
+#ifndef __WEBSOCKET_CODEC_H__
+#define __WEBSOCKET_CODEC_H__
+
+#include <cstdint>
+#include <cstddef>
+#include "muduo/net/Buffer.h"
+
+using muduo::net::Buffer;
+
+// RFC 6455 opcode
+enum WebSocketOpcode : uint8_t {
+    kWsOpContinuation = 0x0,
+    kWsOpText = 0x1,
+    kWsOpBinary = 0x2,
+    kWsOpClose = 0x8,
+    kWsOpPing = 0x9,
+    kWsOpPong = 0xA,
+};
+
+// one decoded frame, payload points into the Buffer and is valid until the frame is retrieved
+struct WebSocketFrameView {
+    bool fin = false;
+    uint8_t rsv = 0;                // RSV1..RSV3 bits, 0x4 is RSV1
+    uint8_t opcode = 0;
+    const char* payload = nullptr;
+    size_t payload_length = 0;
+    size_t frame_length = 0;        // header + payload, the bytes to retrieve
+};
+
+class CWebSocketDecoder {
+public:
+    enum DecodeResult {
+        kNeedMore,          // the frame is not complete, nothing consumed
+        kFrame,             // one complete frame, call Retrieve() after handling it
+        kTooLarge,          // payload_length exceeds max_frame_size
+        kProtocolError,     // unmasked client frame or bad control frame
+    };
+
+    static const size_t kDefaultMaxFrameSize = 1024 * 1024;
+
+    explicit CWebSocketDecoder(size_t max_frame_size = kDefaultMaxFrameSize)
+        : max_frame_size_(max_frame_size) {}
+
+    void SetMaxFrameSize(size_t max_frame_size) { max_frame_size_ = max_frame_size; }
+    size_t GetMaxFrameSize() const { return max_frame_size_; }
+
+    // parse the frame at buf->peek(), the payload is unmasked in place
+    DecodeResult Decode(Buffer* buf, WebSocketFrameView* frame);
+
+    // consume the handled frame
+    static void Retrieve(Buffer* buf, const WebSocketFrameView& frame) {
+        buf->retrieve(frame.frame_length);
+    }
+
+private:
+    size_t max_frame_size_;
+};
+
+#endif // !__WEBSOCKET_CODEC_H__
@@ -4,27 +4,21 @@
 
 #include "api_types.h"
 #include "pub_sub_service.h"
+#include "conn_shard.h"
 #include "websocket_conn.h"
+#include "websocket_simd.h"
+#include "websocket_deflate.h"
+#include "backpressure.h"
 #include "base64.h"
 #include "logic_client.h"
 #include "logic_config.h"
 
-typedef struct WebSocketFrame {
-    bool fin;
-    uint8_t opcode;
-    bool mask;
-    uint64_t payload_length;
-    uint8_t masking_key[4];
-    std::string payload_data;
-}WebSocketFrame;
-
 // 全局变量定义
-std::unordered_map<string, CHttpConnPtr> s_user_ws_conn_map;       // store user id and websocket conn
-std::mutex s_mtx_user_ws_conn_map;
 ThreadPool* CWebSocketConn::s_thread_pool = nullptr;                // thread pool handles for websocket conn
+size_t CWebSocketConn::s_max_frame_size = CWebSocketDecoder::kDefaultMaxFrameSize;
 
 // handshake
-string GenerateWebSocketHandshakeResponse(const string& key) {
+string GenerateWebSocketHandshakeResponse(const string& key, const string& extensions) {
     string magic = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
     string accept_key = key + magic;
 
@@ -37,15 +31,20 @@ string GenerateWebSocketHandshakeResponse(const string& key) {
         "HTTP/1.1 101 Switching Protocols\r\n"
         "Upgrade: websocket\r\n"
         "Connection: Upgrade\r\n"
-        "Sec-WebSocket-Accept: " + accept + "\r\n\r\n";
+        "Sec-WebSocket-Accept: " + accept + "\r\n";
+    if (!extensions.empty()) {
+        response += "Sec-WebSocket-Extensions: " + extensions + "\r\n";
+    }
+    response += "\r\n";
     return response;
 }
 
 // create websocket frame
-string BuildWebSocketFrame(const string& payload, const uint8_t opcode) {
+string BuildWebSocketFrame(const string& payload, const uint8_t opcode, bool compressed) {
     string frame;
 
-    frame.push_back(0x80 | (opcode & 0x0F));
+    // RSV1 marks a permessage-deflate compressed message
+    frame.push_back(0x80 | (compressed ? 0x40 : 0x00) | (opcode & 0x0F));
 
     size_t payload_length = payload.size();
     if (payload_length <= 125) {
@@ -68,302 +67,339 @@ string BuildWebSocketFrame(const string& payload, const uint8_t opcode) {
     return frame;
 }
 
-// parse http data and get websocket frame
-WebSocketFrame ParseWebSocketFrame(const std::string& data) {
-    WebSocketFrame frame;
-    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data.data());
+// get current timestamp
+uint64_t getCurrentTimestamp() {
+    auto now = std::chrono::system_clock::time_point::clock::now();
+    auto duration = now.time_since_epoch();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+    return milliseconds.count(); // ms
+}
 
-    // parse first byte
-    frame.fin = (bytes[0] & 0x80) != 0;
-    frame.opcode = bytes[0] & 0x0F;
+// =========================CWebSocketConn======================
+CWebSocketConn::CWebSocketConn(const TcpConnectionPtr& conn)
+    :CHttpConn(conn), handshake_completed(false), decoder_(s_max_frame_size),
+    strand_(std::make_shared<CStrand>(s_thread_pool)) {
+    LOG_INFO << "Constructor CWebSocketConn";
+}
 
-    // parse second byte
-    frame.mask = (bytes[1] & 0x80) != 0;
-    frame.payload_length = bytes[1] & 0x7F;
+CWebSocketConn::~CWebSocketConn() {
+    LOG_INFO << "Destructor CWebSocketConn" << this->user_id << ", stats_total_messages: " << this->stats_total_messages
+        << ", stats_total_bytes: " << this->stats_total_bytes;
+}
 
-    size_t offset = 2;
 
-    // parse 
-    if (frame.payload_length == 126) {
-        frame.payload_length = (bytes[2] << 8) | bytes[3];
-        offset += 2;
-    }
-    else if (frame.payload_length == 127) {
-        frame.payload_length =
-            (static_cast<uint64_t>(bytes[2]) << 56) |
-            (static_cast<uint64_t>(bytes[3]) << 48) |
-            (static_cast<uint64_t>(bytes[4]) << 40) |
-            (static_cast<uint64_t>(bytes[5]) << 32) |
-            (static_cast<uint64_t>(bytes[6]) << 24) |
-            (static_cast<uint64_t>(bytes[7]) << 16) |
-            (static_cast<uint64_t>(bytes[8]) << 8) |
-            static_cast<uint64_t>(bytes[9]);
-        offset += 8;
+void CWebSocketConn::OnRequest(const CHttpRequestParser& request) {
+    if (this->handshake_completed) {
+        return;
     }
 
-    // parse mask
-    if (frame.mask) {
-        std::memcpy(frame.masking_key, bytes + offset, 4);
-        offset += 4;
-    }
+    // WebSocket handshake
+    LOG_DEBUG << "request: " << string(request.Method()) << " " << string(request.Url());
+
+    if (request.HasHeader(kHttpSecWebSocketKey)) {
+        string key(request.Header(kHttpSecWebSocketKey));
 
-    // parse payload_data
-    frame.payload_data.assign(data.begin() + offset, data.end());
+        LOG_DEBUG << "key: " << key;
 
-    // parse masking-key
-    if (frame.mask) {
-        for (size_t i = 0; i < frame.payload_data.size(); i++) {
-            frame.payload_data[i] ^= frame.masking_key[i % 4];
+        // negotiate permessage-deflate
+        string extensions;
+        if (NegotiatePerMessageDeflate(string(request.Header(kHttpSecWebSocketExtensions)), &this->deflate_params_, &extensions)) {
+            this->inflater_.reset(new CWebSocketInflater(this->deflate_params_.client_no_context_takeover));
+            LOG_DEBUG << "permessage-deflate enabled: " << extensions;
         }
-    }
 
-    return frame;
-}
+        // generate handshake response
+        std::string response = GenerateWebSocketHandshakeResponse(key, extensions);
 
-string ExtractSid(const string& input) {
-    // get location of "sid=" 
-    size_t sid_start = input.find("sid=");
-    if (sid_start == string::npos) {
-        return "";
-    }
+        // send http response
+        this->send(response);
+        this->handshake_completed = true;
+
+        // heartbeat and idle reaping on the timing wheel of this loop
+        this->idle_wheel_ = ConnShardManager::GetInstance().GetIdleWheel(this->getLoop());
+        if (this->idle_wheel_) {
+            this->idle_entry_ = this->idle_wheel_->Add(this->shared_from_this());
+        }
+        LOG_DEBUG << "WebSocket handshake completed";
 
-    // the length of "sid=" is 4
-    sid_start += 4;
+        // verify cookie
+        string Cookie(request.Header(kHttpCookie));
+        LOG_DEBUG << "Cookie: " << Cookie;
 
-    // get end location of sid, ' ' or '&' or ';'
-    size_t sid_end = input.find_first_of(" &;", sid_start);
+        string sid;
+        string email;
 
-    if (sid_end == string::npos) {
-        sid_end = input.length();
+        if (!Cookie.empty()) {
+            sid = ExtractSid(Cookie);      // get cookie data
+        }
+        LOG_DEBUG << "sid: " << sid;
+        
+        // logic层进行用户认证, 不阻塞 IO 线程, 应答回到本连接的 loop 继续握手
+        LogicConfig& config = LogicConfig::getInstance();
+        LogicClient logic_client(config.getLogicServerUrl());
+        std::weak_ptr<CHttpConn> weak_self = this->shared_from_this();
+        EventLoop* loop = this->getLoop();
+        logic_client.verifyUserAuth(sid, [weak_self, loop](const LogicAuthResult& auth_result) {
+            loop->runInLoop([weak_self, auth_result]() {
+                CHttpConnPtr self = weak_self.lock();
+                if (self) {
+                    static_cast<CWebSocketConn*>(self.get())->OnAuthDone(auth_result);
+                }
+            });
+        });
+    }
+    else {
+        LOG_ERROR << "no Sec-Websocket-Key";
     }
+}
 
-    // get sid value
-    string sid_value = input.substr(sid_start, sid_end - sid_start);
+void CWebSocketConn::OnAuthDone(const LogicAuthResult& auth_result) {
+    // closed while logic was answering, OnClose has run already
+    if (!this->tcp_conn_->connected()) {
+        return;
+    }
 
-    return sid_value;
-}
+    if (!auth_result.success) {
+        string reason = auth_result.error_message.empty() ? 
+            "Cookie validation failed" : auth_result.error_message;
 
-// get current timestamp
-uint64_t getCurrentTimestamp() {
-    auto now = std::chrono::system_clock::time_point::clock::now();
-    auto duration = now.time_since_epoch();
-    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
-    return milliseconds.count(); // ms
-}
+        // validation failed, send close websocket frame
+        LOG_WARN << "cookie validation failed via logic server, reason: " << reason;
+        this->SendCloseFrame(1008, reason);
+        return;
+    }
 
-// =========================CWebSocketConn======================
-CWebSocketConn::CWebSocketConn(const TcpConnectionPtr& conn)
-    :CHttpConn(conn), handshake_completed(false) {
-    LOG_INFO << "Constructor CWebSocketConn";
-}
+    // 认证成功，设置用户信息
+    this->user_id = auth_result.user_id;
+    this->username = auth_result.username;
+    
+    // get chatrooms that current user join
+    LOG_DEBUG << "cookie validation ok via logic server, user_id: " << this->user_id 
+             << ", username: " << this->username;
+
+    // insert current userid and websocket into the shard of its loop
+    // shared_from_this() ==> ensure one ControlBlock, one WebSocketConn
+    ConnShardManager::GetInstance().AddConnection(this->user_id, this->shared_from_this());
+
+    // slow consumer backpressure
+    std::weak_ptr<CHttpConn> weak_self = this->shared_from_this();
+    this->tcp_conn_->setHighWaterMarkCallback(
+        [weak_self](const TcpConnectionPtr&, size_t pending) {
+            CHttpConnPtr self = weak_self.lock();
+            if (self) {
+                static_cast<CWebSocketConn*>(self.get())->OnHighWaterMark(pending);
+            }
+        },
+        Backpressure::GetInstance().GetConfig().high_water_mark);
 
-CWebSocketConn::~CWebSocketConn() {
-    LOG_INFO << "Destructor CWebSocketConn" << this->user_id << ", stats_total_messages: " << this->stats_total_messages
-        << ", stats_total_bytes: " << this->stats_total_bytes;
-}
+    // join the rooms
+    std::vector<Room>& room_list = PubSubService::GetRoomList();    // get all the default chatroom
+    for (const auto& room : room_list) {
+        this->rooms_map.insert({ room.room_id, room });
+    }
 
+    // send message to client, get history message and add subscribe to all chatrooms(join)
+    this->SendHelloMessage();
+}
 
 void CWebSocketConn::OnRead(Buffer* buf) {
     if (!this->handshake_completed) {
-        // WebSocket handshake
-        string request = buf->retrieveAllAsString();
-        LOG_DEBUG << "request: " << request;
+        buf->retrieveAll();
+        return;
+    }
 
-        // if don't judge Websocket frame, please judgement first
-        size_t key_start = request.find("Sec-WebSocket-Key: ");
-        if (key_start != std::string::npos) {
-            key_start += 19;
-            size_t key_end = request.find("\r\n", key_start);
-            std::string key = request.substr(key_start, key_end - key_start);
+    // any bytes from peer means alive
+    if (this->idle_wheel_) {
+        this->idle_wheel_->Touch(this->idle_entry_);
+    }
 
-            LOG_DEBUG << "key: " << key;
+    // loop handle WebSocket frame, parse in place and only retrieve the consumed bytes
+    LOG_DEBUG << "current buffer length: " << buf->readableBytes();
+    WebSocketFrameView frame;
+    while (true) {
+        CWebSocketDecoder::DecodeResult result = this->decoder_.Decode(buf, &frame);
+        if (result == CWebSocketDecoder::kNeedMore) {
+            LOG_DEBUG << "not enough data for complete frame, waiting for more...";
+            return;
+        }
+        else if (result == CWebSocketDecoder::kTooLarge) {
+            LOG_WARN << "frame exceeds max_frame_size: " << this->decoder_.GetMaxFrameSize() << ", user_id: " << this->user_id;
+            buf->retrieveAll();
+            this->Disconnect(1009, "Message too big");
+            return;
+        }
+        else if (result == CWebSocketDecoder::kProtocolError) {
+            LOG_WARN << "websocket protocol error, user_id: " << this->user_id;
+            buf->retrieveAll();
+            this->Disconnect(1002, "Protocol error");
+            return;
+        }
 
-            // generate handshake response
-            std::string response = GenerateWebSocketHandshakeResponse(key);
+        ++this->stats_total_messages;
+        this->stats_total_bytes += frame.payload_length;
 
-            // send http response
-            this->send(response);
-            this->handshake_completed = true;
-            LOG_DEBUG << "WebSocket handshake completed";
+        // RSV1 is only allowed on the first frame of a data message after negotiation
+        bool compressed = (frame.rsv & 0x4) != 0;
+        if ((frame.rsv & 0x3) || (compressed && (!this->inflater_ || (frame.opcode & 0x08)))) {
+            LOG_WARN << "unexpected rsv bits: " << static_cast<int>(frame.rsv) << ", user_id: " << this->user_id;
+            buf->retrieveAll();
+            this->Disconnect(1002, "Protocol error");
+            return;
+        }
+        if (compressed && !frame.fin) {
+            LOG_WARN << "fragmented compressed message is not supported, user_id: " << this->user_id;
+            buf->retrieveAll();
+            this->Disconnect(1003, "Fragmented compressed message");
+            return;
+        }
 
-            // verify cookie
-            string Cookie = this->headers_["Cookie"];
-            LOG_DEBUG << "Cookie: " << Cookie;
+        if (frame.opcode == kWsOpText) {
+            // the only copy, the payload is moved into the strand task
+            string payload;
+            if (compressed) {
+                if (!this->inflater_->Inflate(frame.payload, frame.payload_length, this->decoder_.GetMaxFrameSize(), &payload)) {
+                    buf->retrieveAll();
+                    this->Disconnect(1007, "Invalid compressed data");
+                    return;
+                }
+            }
+            else {
+                payload.assign(frame.payload, frame.payload_length);
+            }
+            CWebSocketDecoder::Retrieve(buf, frame);
 
-            string sid;
-            string email;
+            // fragmented message is not reassembled, only a whole text frame can be validated
+            if (frame.fin && !WsValidateUtf8(payload.data(), payload.size())) {
+                LOG_WARN << "invalid utf-8 text frame, user_id: " << this->user_id;
+                buf->retrieveAll();
+                this->Disconnect(1007, "Invalid UTF-8");
+                return;
+            }
 
-            if (!Cookie.empty()) {
-                sid = ExtractSid(Cookie);      // get cookie data
+            // frames before the hello wait for it, the strand then sees them in order
+            if (this->hello_done_) {
+                this->PostTextFrame(std::move(payload));
             }
-            LOG_DEBUG << "sid: " << sid;
-            
-            // logic层进行用户认证
-            LogicConfig& config = LogicConfig::getInstance();
-            LogicClient logic_client(config.getLogicServerUrl());
-            LogicAuthResult auth_result = logic_client.verifyUserAuth(sid);
-            
-            if (Cookie.empty() || !auth_result.success) {
-                string reason = auth_result.error_message.empty() ? 
-                    "Cookie validation failed" : auth_result.error_message;
-
-                // validation failed, send close websocket frame
-                LOG_WARN << "cookie validation failed via logic server, reason: " << reason;
-                this->SendCloseFrame(1008, reason);
+            else if (this->pending_frames_.size() < kMaxPendingFrames) {
+                this->pending_frames_.push_back(std::move(payload));
             }
             else {
-                // 认证成功，设置用户信息
-                this->user_id = auth_result.user_id;
-                this->username = auth_result.username;
-                
-                // get chatrooms that current user join
-                LOG_DEBUG << "cookie validation ok via logic server, user_id: " << this->user_id 
-                         << ", username: " << this->username;
-
-                s_mtx_user_ws_conn_map.lock();
-                // insert current userid and websocket
-                // shared_from_this() ==> ensure one ControlBlock, one WebSocketConn
-                auto existing_conn = s_user_ws_conn_map.find(this->user_id);
-                if (existing_conn != s_user_ws_conn_map.end()) {
-                    s_user_ws_conn_map.erase(existing_conn);
-                    LOG_DEBUG << "old websocket conn founded and will be cover, user_id: " << this->user_id;
-                }
-                // the same userid maybe exists, because websocket conn maybe don't close
-                // force insert(update)
-                s_user_ws_conn_map[this->user_id] = this->shared_from_this();
-                s_mtx_user_ws_conn_map.unlock();
-
-                // join the rooms
-                std::vector<Room>& room_list = PubSubService::GetRoomList();    // get all the default chatroom
-                for (const auto& room : room_list) {
-                    this->rooms_map.insert({ room.room_id, room });
-                }
-
-                // send message to client, get history message and add subscribe to all chatrooms(join)
-                this->SendHelloMessage();
+                LOG_WARN << "too many frames before hello, user_id: " << this->user_id;
+                buf->retrieveAll();
+                this->Disconnect(1008, "Not ready");
+                return;
             }
         }
+        else if (frame.opcode == kWsOpPing) {
+            // reply the same application data
+            this->SendPongFrame(frame.payload, frame.payload_length);
+            CWebSocketDecoder::Retrieve(buf, frame);
+        }
+        else if (frame.opcode == kWsOpClose) {
+            // close frame
+            CWebSocketDecoder::Retrieve(buf, frame);
+            LOG_DEBUG << "received close frame, closing connection...";
+            this->Disconnect();
+            return;
+        }
         else {
-            LOG_ERROR << "no Sec-Websocket-Key";
+            CWebSocketDecoder::Retrieve(buf, frame);
         }
     }
-    else {
-        // loop handle WebSocket frame
-        this->incomplete_frame_buffer += buf->retrieveAllAsString();
-        LOG_DEBUG << "current buffer length: " << this->incomplete_frame_buffer.length();
-        while (!this->incomplete_frame_buffer.empty()) {
-            // 
-            if (this->incomplete_frame_buffer.length() < 2) {
-                LOG_DEBUG << "Not enough data for frame header, waiting for more...";
-                return;
-            }
-
-            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(this->incomplete_frame_buffer.data());
-            uint64_t payload_len = bytes[1] & 0x7F;
-            size_t header_length = 2;
+}
 
-            // calculate payload length
-            if (payload_len == 126) {
-                if (this->incomplete_frame_buffer.length() < 4) {
-                    LOG_DEBUG << "not enough data for extended length(2 bytes), waiting for more...";
-                    return;
+// frames of one conn are handled in arrival order, one at a time, on any pool thread
+void CWebSocketConn::PostTextFrame(string payload) {
+    // shared_from_this() ==> copy constructor of shared_ptr
+    auto self = shared_from_this();
+    this->strand_->Post([this, self, payload = std::move(payload)]()
+    {
+        // get thread id
+        std::ostringstream oss;
+        oss << std::this_thread::get_id();
+        LOG_DEBUG << "pool thread id: " << oss.str() << ", stats_total_messages: "
+            << this->stats_total_messages << ", stats_total_bytes: " << this->stats_total_bytes;
+
+        // text frame
+        LOG_DEBUG << "process text frame, payload: " << payload;
+        bool res;
+        Json::Value root;
+        Json::Reader jsonReader;
+        res = jsonReader.parse(payload, root);
+        if (!res) {
+            LOG_WARN << "parse json failed ";
+            return;
+        }
+        else {
+            string type;
+            if (root.isObject() && !root["type"].isNull()) {
+                type = root["type"].asString();
+                if (type == "clientMessages") {
+                    HandleClientMessages(root);
                 }
-                header_length += 2;
-                payload_len = (bytes[2] << 8) | bytes[3];
-            }
-            else if (payload_len == 127) {
-                if (this->incomplete_frame_buffer.length() < 10) {
-                    LOG_DEBUG << "not enough data for extended length(8 bytes), waiting for more...";
-                    return;
+                else if (type == "requestRoomHistory") {
+                    HandleRequestRoomHistory(root);
+                }
+                else if (type == "clientCreateRoom") {
+                    HandleClientCreateRoom(root);
                 }
-                header_length += 8;
-                payload_len = ((uint64_t)bytes[2] << 56) | ((uint64_t)bytes[3] << 48) |
-                    ((uint64_t)bytes[4] << 40) | ((uint64_t)bytes[5] << 32) |
-                    ((uint64_t)bytes[6] << 24) | ((uint64_t)bytes[7] << 16) |
-                    ((uint64_t)bytes[8] << 8) | bytes[9];
             }
-
-            // is there mask 
-            bool has_mask = (bytes[1] & 0x80) != 0;
-            if (has_mask) {
-                header_length += 4;
+            else {
+                LOG_ERROR << "data no a json object";
             }
+        }
+    });
+}
 
-            // the length of one websocket frame
-            size_t total_frame_length = header_length + payload_len;
-
-            // check is enough data for one websocket frame
-            if (this->incomplete_frame_buffer.length() < total_frame_length) {
-                LOG_DEBUG << "not enough data for complete frame, waiting for more... "
-                    << "need: " << total_frame_length
-                    << ", have: " << this->incomplete_frame_buffer.length();
-                return;
-            }
+// in loop thread, the output crossed the high water mark
+void CWebSocketConn::OnHighWaterMark(size_t pending) {
+    Backpressure& backpressure = Backpressure::GetInstance();
+    const BackpressureConfig& config = backpressure.GetConfig();
+    backpressure.GetStats().high_water_events.fetch_add(1, std::memory_order_relaxed);
+    LOG_WARN << "slow consumer, user_id: " << this->user_id << ", pending bytes: " << pending
+        << ", policy: " << Backpressure::PolicyName(config.policy);
 
-            // complete websocket frame ==> buffer maybe have more than one websocket frame
-            if (this->incomplete_frame_buffer.length() >= total_frame_length) {
-                // copy one complete websocket frame and delete handled complete websocket frame
-                string frame_data = this->incomplete_frame_buffer.substr(0, total_frame_length);
-                this->incomplete_frame_buffer = this->incomplete_frame_buffer.substr(total_frame_length);
-
-                // shared_from_this() ==> copy constructor of shared_ptr
-                auto self = shared_from_this();
-
-                // push websocket handle task to thread pool
-                this->s_thread_pool->run([this, self, frame_data]()
-                    {
-                        // parse websocket frame
-                        WebSocketFrame frame = ParseWebSocketFrame(frame_data);
-                        ++this->stats_total_messages;
-                        this->stats_total_bytes += frame.payload_data.size();
-
-                        // get thread id
-                        std::ostringstream oss;
-                        oss << std::this_thread::get_id();
-                        LOG_DEBUG << "pool thread id: " << oss.str() << ", stats_total_messages: "
-                            << this->stats_total_messages << ", stats_total_bytes: " << this->stats_total_bytes;
-
-                        // handle frame
-                        if (frame.opcode == 0x01) {
-                            // text frame
-                            LOG_DEBUG << "process text frame, payload: " << frame.payload_data;
-                            bool res;
-                            Json::Value root;
-                            Json::Reader jsonReader;
-                            res = jsonReader.parse(frame.payload_data, root);
-                            if (!res) {
-                                LOG_WARN << "parse json failed ";
-                                return;
-                            }
-                            else {
-                                string type;
-                                if (root.isObject() && !root["type"].isNull()) {
-                                    type = root["type"].asString();
-                                    if (type == "clientMessages") {
-                                        HandleClientMessages(root);
-                                    }
-                                    else if (type == "requestRoomHistory") {
-                                        HandleRequestRoomHistory(root);
-                                    }
-                                    else if (type == "clientCreateRoom") {
-                                        HandleClientCreateRoom(root);
-                                    }
-                                }
-                                else {
-                                    LOG_ERROR << "data no a json object";
-                                }
-                            }
-                        }
-                        else if (frame.opcode == 0x08) {
-                            // close frame
-                            LOG_DEBUG << "received close frame, closing connection...";
-                            this->Disconnect();
-                        }
-                    }
-                );
-            }
+    if (config.policy != SlowConsumerPolicy::kClose || this->slow_consumer_timer_armed) {
+        return;
+    }
+    this->slow_consumer_timer_armed = true;
+    std::weak_ptr<CHttpConn> weak_self = this->shared_from_this();
+    this->getLoop()->runAfter(config.close_after_seconds, [weak_self]() {
+        CHttpConnPtr self = weak_self.lock();
+        if (self) {
+            static_cast<CWebSocketConn*>(self.get())->CheckSlowConsumer();
         }
+    });
+}
+
+// close the conn if it still stays over the high water mark
+void CWebSocketConn::CheckSlowConsumer() {
+    this->slow_consumer_timer_armed = false;
+    Backpressure& backpressure = Backpressure::GetInstance();
+    if (!this->tcp_conn_->connected()
+        || this->tcp_conn_->pendingOutputBytes() < backpressure.GetConfig().high_water_mark) {
+        return;
     }
+
+    backpressure.GetStats().closed_conns.fetch_add(1, std::memory_order_relaxed);
+    LOG_WARN << "close slow consumer, user_id: " << this->user_id
+        << ", pending bytes: " << this->tcp_conn_->pendingOutputBytes();
+    // drop the queued broadcasts so the close frame is not stuck behind them,
+    // give the client a moment to read it, then close anyway
+    this->tcp_conn_->discardQueuedSharedOutput(0);
+    this->Disconnect(1008, "Slow consumer");
+    this->tcp_conn_->forceCloseWithDelay(kSlowConsumerCloseGraceSeconds);
+}
+
+// compress the message if negotiated, every message is compressed without context takeover
+void CWebSocketConn::SendTextMessage(const string& payload) {
+    string compressed;
+    if (this->deflate_params_.enabled && payload.size() >= GetPerMessageDeflateConfig().min_size
+        && DeflateMessage(payload, this->deflate_params_.server_max_window_bits, &compressed)) {
+        this->send(BuildWebSocketFrame(compressed, kWsOpText, true));
+        return;
+    }
+    this->send(BuildWebSocketFrame(payload, kWsOpText));
 }
 
 void CWebSocketConn::SendCloseFrame(uint16_t code, const string& reason) {
@@ -371,92 +407,114 @@ void CWebSocketConn::SendCloseFrame(uint16_t code, const string& reason) {
         return;
     }
 
-    // create websocket close frame
-    char frame[2 + reason.size()];
-    frame[0] = (code >> 8) & 0xFF;  // higt position of status code
-    frame[1] = code & 0xFF;         // low position of status code
-    std::memcpy(frame + 2, reason.data(), reason.size());
+    // create websocket close frame, control frame payload is at most 125 bytes
+    string payload;
+    payload.push_back(static_cast<char>((code >> 8) & 0xFF));   // higt position of status code
+    payload.push_back(static_cast<char>(code & 0xFF));          // low position of status code
+    payload.append(reason, 0, 123);
 
     // send websocket close frame
-    tcp_conn_->send(frame, sizeof(frame));
+    this->send(BuildWebSocketFrame(payload, kWsOpClose));
+}
+
+void CWebSocketConn::SendPingFrame() {
+    this->send(BuildWebSocketFrame("", kWsOpPing));
+}
+
+void CWebSocketConn::SendPongFrame(const char* data, size_t len) {
+    this->send(BuildWebSocketFrame(string(data, len), kWsOpPong));
+}
+
+// in loop thread, nothing arrived for ping_seconds
+void CWebSocketConn::OnIdlePing() {
+    if (this->tcp_conn_->connected()) {
+        this->SendPingFrame();
+    }
+}
+
+// in loop thread, nothing arrived for idle_seconds, maybe a dead half-open conn
+void CWebSocketConn::OnIdleTimeout() {
+    if (!this->tcp_conn_->connected()) {
+        return;
+    }
+    LOG_INFO << "reap idle websocket conn, user_id: " << this->user_id;
+    this->SendCloseFrame(1001, "Idle timeout");
+    this->OnClose();
+    // a dead peer never drains the output, don't wait for it
+    this->tcp_conn_->forceClose();
 }
 
-int CWebSocketConn::SendHelloMessage() {
+void CWebSocketConn::SendHelloMessage() {
 
-    // 调用 logic 层 hello 接口
+    // 调用 logic 层 hello 接口, 应答回到本连接的 loop
     string logic_server_addr = LogicConfig::getInstance().getLogicServerUrl();
     LogicClient logic_client(logic_server_addr);
-    
-    // 构造hello请求数据
-    Json::Value hello_request;
-    hello_request["userId"] = this->user_id;
-    hello_request["username"] = this->username;
-    
-    Json::FastWriter writer;
-    string post_data = writer.write(hello_request);
-    
-    string response_json;
-    string url = logic_server_addr + "/logic/hello";
-    if (!logic_client.sendHttpRequest(url, post_data, response_json)) {
-        LOG_ERROR << "Failed to call logic hello API";
-        return -1;
+
+    std::weak_ptr<CHttpConn> weak_self = this->shared_from_this();
+    EventLoop* loop = this->getLoop();
+    logic_client.hello(this->user_id, this->username,
+        [weak_self, loop](int ret, const string& response_json, const std::vector<LogicRoom>& rooms) {
+            loop->runInLoop([weak_self, ret, response_json, rooms]() {
+                CHttpConnPtr self = weak_self.lock();
+                if (self) {
+                    static_cast<CWebSocketConn*>(self.get())->OnHelloDone(ret, response_json, rooms);
+                }
+            });
+        });
+}
+
+void CWebSocketConn::OnHelloDone(int ret, const string& response_json, const std::vector<LogicRoom>& rooms) {
+    if (!this->tcp_conn_->connected()) {
+        return;
     }
-    
-    // 解析 logic 层返回的 JSON
-    Json::Reader reader;
-    Json::Value logic_response;
-    if (!reader.parse(response_json, logic_response)) {
-        LOG_ERROR << "Failed to parse logic hello response JSON";
-        return -1;
+
+    if (ret < 0) {
+        LOG_ERROR << "Failed to call logic hello API";
     }
-    
-    LOG_INFO << "Logic hello response: " << response_json;
-    
-    // 为用户订阅所有房间
-    if (logic_response.isMember("payload") && logic_response["payload"].isMember("rooms")) {
-        Json::Value rooms = logic_response["payload"]["rooms"];
-        for (int i = 0; i < rooms.size(); ++i) {
-            Json::Value room = rooms[i];
-            if (room.isMember("id")) {
-                string room_id = room["id"].asString();
-                string room_name = room.get("name", "").asString();
-                
-                // 添加到本地房间映射
-                Room local_room;
-                local_room.room_id = room_id;
-                local_room.room_name = room_name;
-                this->rooms_map[room_id] = local_room;
-                
-                // 订阅房间
-                PubSubService::GetInstance().AddSubscriber(room_id, this->user_id);
-                LOG_DEBUG << "User " << this->user_id << " subscribed to room: " << room_id;
-            }
+    else {
+        LOG_INFO << "Logic hello response: " << response_json;
+
+        // 为用户订阅所有房间
+        for (const auto& room : rooms) {
+            // 添加到本地房间映射
+            Room local_room;
+            local_room.room_id = room.room_id;
+            local_room.room_name = room.room_name;
+            this->rooms_map[room.room_id] = local_room;
+
+            // 订阅房间
+            PubSubService::GetInstance().AddSubscriber(room.room_id, this->user_id, this->shared_from_this());
+            LOG_DEBUG << "User " << this->user_id << " subscribed to room: " << room.room_id;
         }
-    }
-    
 
-    std::string hello_frame = BuildWebSocketFrame(response_json);
-    this->send(hello_frame);
-    
-    LOG_INFO << "Hello message sent successfully for user: " << this->user_id;
+        this->SendTextMessage(response_json);
 
-    return 0;
+        LOG_INFO << "Hello message sent successfully for user: " << this->user_id;
+    }
+
+    // the frames that came early go first
+    this->hello_done_ = true;
+    std::vector<string> pending;
+    pending.swap(this->pending_frames_);
+    for (auto& payload : pending) {
+        this->PostTextFrame(std::move(payload));
+    }
 }
 
 int CWebSocketConn::HandleClientMessages(Json::Value& root) {
     // 转发给logic层处理
     string logic_server_addr = LogicConfig::getInstance().getLogicServerUrl();
     LogicClient logic_client(logic_server_addr);
-    string response_json;
     
-    // 调用logic层的handleSend
-    int ret = logic_client.handleSend(root, this->user_id, this->username, response_json);
-    
-    if (ret == 0) {
-        LOG_INFO << "Message sent to logic layer successfully, will be broadcasted via Kafka->Job->gRPC";
-    } else {
-        LOG_ERROR << "Failed to send message to logic layer";
-    }
+    // 调用logic层的handleSend, 不等待应答, 广播走 Kafka->Job->gRPC
+    int ret = logic_client.handleSend(root, this->user_id, this->username,
+        [user_id = this->user_id](int ret, const string&) {
+            if (ret == 0) {
+                LOG_INFO << "Message sent to logic layer successfully, will be broadcasted via Kafka->Job->gRPC";
+            } else {
+                LOG_ERROR << "Failed to send message to logic layer, user_id: " << user_id;
+            }
+        });
     
     return ret;
 }
@@ -464,23 +522,20 @@ int CWebSocketConn::HandleClientMessages(Json::Value& root) {
 int CWebSocketConn::HandleRequestRoomHistory(Json::Value& root) {
     string logic_server_addr = LogicConfig::getInstance().getLogicServerUrl();
     LogicClient logic_client(logic_server_addr);
-    string response_json;
     
-    // 调用logic层的handleRoomHistory方法
+    // 调用logic层的handleRoomHistory方法, 应答到达后直接发给客户端
+    auto self = shared_from_this();
     int ret = logic_client.handleRoomHistory(root, this->user_id,
-        this->username, response_json);
-    
-    if (ret == 0) {
-        LOG_INFO << "Room history request sent to logic layer successfully, response will be sent directly";
-        
-        // 构造WebSocket帧
-        string websocket_frame = BuildWebSocketFrame(response_json);
-        this->send(websocket_frame);
-        
-        LOG_INFO << "Room history WebSocket message sent to client: " << response_json;
-    } else {
-        LOG_ERROR << "Failed to send room history request to logic layer";
-    }
+        this->username, [this, self](int ret, const string& response_json) {
+            if (ret == 0) {
+                // 构造WebSocket帧
+                this->SendTextMessage(response_json);
+                
+                LOG_INFO << "Room history WebSocket message sent to client: " << response_json;
+            } else {
+                LOG_ERROR << "Failed to send room history request to logic layer";
+            }
+        });
     
     return ret;
 }
@@ -490,84 +545,85 @@ int CWebSocketConn::HandleRequestRoomHistory(Json::Value& root) {
 int CWebSocketConn::HandleClientCreateRoom(Json::Value& root) {
     string logic_server_addr = LogicConfig::getInstance().getLogicServerUrl();
     LogicClient logic_client(logic_server_addr);
-    string response_json;
     
-    // 调用logic层handleCreateRoom
+    // 调用logic层handleCreateRoom, 创建成功的广播走 Kafka->Job->gRPC, 这里只回复重名失败
+    auto self = shared_from_this();
     int ret = logic_client.handleCreateRoom(root, this->user_id,
-        this->username, response_json);
-    
-    if (ret != 0) {
-        LOG_ERROR << "Failed to send create room request to logic layer";
-        return -1;
-    }
-    
-    LOG_INFO << "Create room request sent to logic layer successfully";
-    
-    // 解析logic层返回的响应以获取房间信息
-    Json::Value response_root;
-    Json::Reader reader;
-    if (!reader.parse(response_json, response_root)) {
-        LOG_ERROR << "Failed to parse logic response: " << response_json;
-        return -1;
-    }
-    
-    // 验证响应格式并获取房间信息
-    if (!response_root.isMember("type") || response_root["type"].asString() != "serverCreateRoom" ||
-        !response_root.isMember("payload") || response_root["payload"].isNull()) {
-        LOG_ERROR << "Logic layer returned unexpected response format: " << response_json;
-        return -1;
-    }
-    
-    Json::Value payload = response_root["payload"];
-    if (!payload.isMember("roomId") || !payload.isMember("roomName")) {
-        LOG_ERROR << "Missing roomId or roomName in logic response: " << response_json;
-        return -1;
-    }
-    
-    // 获取新创建的房间信息
-    string room_id = payload["roomId"].asString();
-    string room_name = payload["roomName"].asString();
-    
-    if (room_id.empty()) {
-        LOG_INFO << "Room name duplicated, sending failure response to client for room: (" << room_name << ")";
-        Json::Value resp;
-        resp["type"] = "serverCreateRoom";
-        Json::Value respPayload;
-        respPayload["roomId"] = "";
-        respPayload["roomName"] = room_name;
-        respPayload["creatorId"] = this->user_id;
-        resp["payload"] = respPayload;
-        Json::FastWriter writer;
-        std::string resp_json = writer.write(resp);
-        std::string websocket_frame = BuildWebSocketFrame(resp_json, 0x01);
-        this->send(websocket_frame);
-        return 0;
-    }
+        this->username, [this, self](int ret, const string& response_json) {
+        if (ret != 0) {
+            LOG_ERROR << "Failed to send create room request to logic layer";
+            return;
+        }
+        
+        // 解析logic层返回的响应以获取房间信息
+        Json::Value response_root;
+        Json::Reader reader;
+        if (!reader.parse(response_json, response_root)) {
+            LOG_ERROR << "Failed to parse logic response: " << response_json;
+            return;
+        }
+        
+        // 验证响应格式并获取房间信息
+        if (!response_root.isMember("type") || response_root["type"].asString() != "serverCreateRoom" ||
+            !response_root.isMember("payload") || response_root["payload"].isNull()) {
+            LOG_ERROR << "Logic layer returned unexpected response format: " << response_json;
+            return;
+        }
+        
+        Json::Value payload = response_root["payload"];
+        if (!payload.isMember("roomId") || !payload.isMember("roomName")) {
+            LOG_ERROR << "Missing roomId or roomName in logic response: " << response_json;
+            return;
+        }
+        
+        // 获取新创建的房间信息
+        string room_id = payload["roomId"].asString();
+        string room_name = payload["roomName"].asString();
+        
+        if (room_id.empty()) {
+            LOG_INFO << "Room name duplicated, sending failure response to client for room: (" << room_name << ")";
+            Json::Value resp;
+            resp["type"] = "serverCreateRoom";
+            Json::Value respPayload;
+            respPayload["roomId"] = "";
+            respPayload["roomName"] = room_name;
+            respPayload["creatorId"] = this->user_id;
+            resp["payload"] = respPayload;
+            Json::FastWriter writer;
+            std::string resp_json = writer.write(resp);
+            this->SendTextMessage(resp_json);
+            return;
+        }
+        
+        LOG_INFO << "Room created successfully: " << room_id << " (" << room_name << ")";
+    });
     
-    LOG_INFO << "Room created successfully: " << room_id << " (" << room_name << ")";
-    return 0;
+    return ret;
 }
 
-void CWebSocketConn::Disconnect() {
+void CWebSocketConn::Disconnect(uint16_t code, const string& reason) {
     if (tcp_conn_) {
-        LOG_INFO << "tcp_conn_ sendCloseFrame";
+        LOG_INFO << "tcp_conn_ sendCloseFrame, code: " << code;
         // send webSocket close frame
-        this->SendCloseFrame(1000, "Normal closure");
+        this->SendCloseFrame(code, reason);
         tcp_conn_->shutdown();
     }
 
-    {
-        std::lock_guard<std::mutex> lock(s_mtx_user_ws_conn_map);
-        auto existing_conn = s_user_ws_conn_map.find(this->user_id);
-        if (existing_conn != s_user_ws_conn_map.end()) {
-            LOG_DEBUG << "disconnect, userid: " << this->user_id << " from s_user_ws_conn_map erase";
-            LOG_DEBUG << "1 s_user_ws_conn_map.size(): " << s_user_ws_conn_map.size();
-
-            s_user_ws_conn_map.erase(existing_conn);
+    this->OnClose();
+}
 
-            LOG_DEBUG << "2 s_user_ws_conn_map.size(): " << s_user_ws_conn_map.size();
-        }
+// tcp conn closed, remove from the shard of its loop
+void CWebSocketConn::OnClose() {
+    if (this->user_id.empty()) {
+        return;
     }
+    LOG_DEBUG << "disconnect, userid: " << this->user_id << " remove from conn shard";
+    ConnShardManager::GetInstance().RemoveConnection(this->user_id, this->shared_from_this());
+}
+
+void CWebSocketConn::SetMaxFrameSize(size_t max_frame_size) {
+    LOG_INFO << "SetMaxFrameSize, max_frame_size:" << max_frame_size;
+    s_max_frame_size = max_frame_size;
 }
 
 void CWebSocketConn::InitThreadPool(int thread_num) {
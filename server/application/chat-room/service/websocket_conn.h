@@ -6,29 +6,63 @@
 #include "muduo/base/Logging.h" 
 #include "muduo/base/ThreadPool.h"
 #include "api_types.h"
+#include "websocket_codec.h"
+#include "websocket_deflate.h"
+#include "idle_wheel.h"
+#include "strand.h"
+#include "logic_client.h"
 #include <json/json.h>
 
 class CWebSocketConn : public CHttpConn {
 public:
     static void InitThreadPool(int thread_num);
+    // limit of one frame payload, bigger frame is closed with 1009
+    static void SetMaxFrameSize(size_t max_frame_size);
 
     CWebSocketConn(const TcpConnectionPtr& conn);
     virtual ~CWebSocketConn();
+    virtual void OnRequest(const CHttpRequestParser& request);
     virtual void OnRead(Buffer* buf);
-    void Disconnect();
+    virtual void OnClose();
+    // the shared broadcast frame is compressed with 15 bits window
+    virtual bool AcceptsDeflatedBroadcast() const {
+        return deflate_params_.enabled && deflate_params_.server_max_window_bits == 15;
+    }
+    void Disconnect(uint16_t code = 1000, const string& reason = "Normal closure");
+    void OnHighWaterMark(size_t pending);
+    virtual void OnIdlePing();
+    virtual void OnIdleTimeout();
 private:
     string user_id;             // userid (UUID)
     string username;            // username
     bool handshake_completed = false;               // websocket conn has completed
-    std::unordered_map<string, Room> rooms_map;     // has joined the chatrooms
-    string incomplete_frame_buffer;                 // store incomplete websocket frame
+    bool hello_done_ = false;                       // auth and hello answered, only touched in loop thread
+    std::vector<string> pending_frames_;            // text frames before the hello, only touched in loop thread
+    std::unordered_map<string, Room> rooms_map;     // has joined the chatrooms, only touched in strand_ after handshake
+    CWebSocketDecoder decoder_;                     // parse websocket frame in tcp input buffer
+    PerMessageDeflateParams deflate_params_;        // negotiated in handshake
+    std::unique_ptr<CWebSocketInflater> inflater_;  // only when permessage-deflate enabled
+    bool slow_consumer_timer_armed = false;         // only touched in loop thread
+    CIdleWheel* idle_wheel_ = nullptr;              // the wheel of conn's loop
+    CIdleWheel::WeakEntryPtr idle_entry_;
     uint64_t stats_total_messages = 0;
     uint64_t stats_total_bytes = 0;
+    CStrandPtr strand_;                             // text frames of this conn run in order on s_thread_pool
     static ThreadPool* s_thread_pool;
+    static size_t s_max_frame_size;
+    static constexpr double kSlowConsumerCloseGraceSeconds = 1.0;   // wait for the 1008 close frame to drain
+    static const size_t kMaxPendingFrames = 16;
 
     void SendCloseFrame(uint16_t code, const string& reason);
-    void SendPongFrame();       // Pong frame
-    int SendHelloMessage();
+    void SendPingFrame();
+    void SendPongFrame(const char* data, size_t len);   // Pong frame, echo the ping payload
+    void SendTextMessage(const string& payload);    // text frame, compressed if negotiated
+    void CheckSlowConsumer();
+    // auth and hello answers come back to the loop thread
+    void OnAuthDone(const LogicAuthResult& auth_result);
+    void SendHelloMessage();
+    void OnHelloDone(int ret, const string& response_json, const std::vector<LogicRoom>& rooms);
+    void PostTextFrame(string payload);
 
     int HandleClientMessages(Json::Value& root);
     int HandleRequestRoomHistory(Json::Value& root);
@@ -37,9 +71,6 @@ private:
 
 using CWebSocketConnPtr = std::shared_ptr<CWebSocketConn>;
 
-extern std::unordered_map<string, CHttpConnPtr> s_user_ws_conn_map;       // store user id and websocket conn
-extern std::mutex s_mtx_user_ws_conn_map;
-
-string BuildWebSocketFrame(const string& payload, const uint8_t opcode = 0x01);
+string BuildWebSocketFrame(const string& payload, const uint8_t opcode = 0x01, bool compressed = false);
 
 #endif // !__WEBSOCKET_CONN_H__
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "websocket_deflate.h"
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include "websocket_conn.h"
+#include "muduo/base/Logging.h"
+
+static PerMessageDeflateConfig s_deflate_config;
+
+// the tail of a sync flush, removed by sender and appended by receiver
+static const char kDeflateTail[4] = { 0x00, 0x00, static_cast<char>(0xff), static_cast<char>(0xff) };
+
+void SetPerMessageDeflateConfig(const PerMessageDeflateConfig& config) {
+    s_deflate_config = config;
+}
+
+const PerMessageDeflateConfig& GetPerMessageDeflateConfig() {
+    return s_deflate_config;
+}
+
+static string Trim(const string& s) {
+    size_t begin = s.find_first_not_of(" \t");
+    if (begin == string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t");
+    return s.substr(begin, end - begin + 1);
+}
+
+// try one offer, e.g. "permessage-deflate; client_max_window_bits; server_no_context_takeover"
+static bool AcceptOffer(const string& offer, PerMessageDeflateParams* params, string* response) {
+    std::istringstream stream(offer);
+    string token;
+    if (!std::getline(stream, token, ';') || Trim(token) != "permessage-deflate") {
+        return false;
+    }
+
+    PerMessageDeflateParams result;
+    result.enabled = true;
+    // the frame is shared by all receivers, never take over server context
+    string accepted = "permessage-deflate; server_no_context_takeover";
+    while (std::getline(stream, token, ';')) {
+        string param = Trim(token);
+        string name = param;
+        string value;
+        size_t eq = param.find('=');
+        if (eq != string::npos) {
+            name = Trim(param.substr(0, eq));
+            value = Trim(param.substr(eq + 1));
+            if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+                value = value.substr(1, value.size() - 2);
+            }
+        }
+
+        if (name == "server_no_context_takeover") {
+            // always declared
+        }
+        else if (name == "client_no_context_takeover") {
+            result.client_no_context_takeover = true;
+            accepted += "; client_no_context_takeover";
+        }
+        else if (name == "server_max_window_bits") {
+            int bits = atoi(value.c_str());
+            // zlib doesn't support raw deflate with 8 bits window
+            if (bits < 9 || bits > 15) {
+                return false;
+            }
+            result.server_max_window_bits = bits;
+            accepted += "; server_max_window_bits=" + std::to_string(bits);
+        }
+        else if (name == "client_max_window_bits") {
+            // inflate always uses 15 bits window, which accepts any smaller window
+        }
+        else {
+            return false;
+        }
+    }
+
+    *params = result;
+    *response = accepted;
+    return true;
+}
+
+bool NegotiatePerMessageDeflate(const string& extensions, PerMessageDeflateParams* params, string* response) {
+    if (!s_deflate_config.enabled || extensions.empty()) {
+        return false;
+    }
+
+    // offers are separated by ',', take the first acceptable one
+    std::istringstream stream(extensions);
+    string offer;
+    while (std::getline(stream, offer, ',')) {
+        if (AcceptOffer(offer, params, response)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DeflateMessage(const string& payload, int window_bits, string* output) {
+    Buffer buf;
+    muduo::net::ZlibOutputStream stream(&buf, s_deflate_config.level, -window_bits);
+    if (!stream.write(muduo::StringPiece(payload.data(), static_cast<int>(payload.size()))) || !stream.flush()) {
+        LOG_WARN << "DeflateMessage failed, " << stream.zlibErrorCode();
+        return false;
+    }
+
+    // sync flush output ends with the tail, which is not sent
+    size_t len = buf.readableBytes();
+    if (len < 4 || memcmp(buf.peek() + len - 4, kDeflateTail, 4) != 0) {
+        return false;
+    }
+    len -= 4;
+    if (len >= payload.size()) {
+        return false;
+    }
+    output->assign(buf.peek(), len);
+    return true;
+}
+
+WebSocketBroadcastFrame BuildBroadcastFrame(const string& payload) {
+    WebSocketBroadcastFrame frame;
+    frame.plain = std::make_shared<const string>(BuildWebSocketFrame(payload, kWsOpText));
+
+    if (s_deflate_config.enabled && payload.size() >= s_deflate_config.min_size) {
+        string compressed;
+        // 15 bits window, receivers who asked a smaller one get the plain frame
+        if (DeflateMessage(payload, 15, &compressed)) {
+            frame.deflated = std::make_shared<const string>(BuildWebSocketFrame(compressed, kWsOpText, true));
+        }
+    }
+    return frame;
+}
+
+// =========================CWebSocketInflater======================
+CWebSocketInflater::CWebSocketInflater(bool no_context_takeover)
+    : stream_(&output_, -15), no_context_takeover_(no_context_takeover) {
+}
+
+bool CWebSocketInflater::Inflate(const char* data, size_t len, size_t max_size, string* output) {
+    output_.retrieveAll();
+    bool ok = stream_.write(muduo::StringPiece(data, static_cast<int>(len)), max_size);
+    // the tail is only needed while the stream isn't ended by a final block
+    if (ok && stream_.zlibErrorCode() == Z_OK) {
+        ok = stream_.write(muduo::StringPiece(kDeflateTail, 4), max_size - output_.readableBytes());
+    }
+    if (!ok) {
+        LOG_WARN << "Inflate failed, " << stream_.zlibErrorCode();
+        return false;
+    }
+
+    if (no_context_takeover_ || stream_.zlibErrorCode() == Z_STREAM_END) {
+        stream_.reset();
+    }
+    *output = output_.retrieveAllAsString();
+    return true;
+}
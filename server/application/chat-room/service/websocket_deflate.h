@@ -0,0 +1,71 @@
+/**
+ * permessage-deflate (RFC 7692)
+ *
+ * 服务端总是声明 server_no_context_takeover, 每条下行消息都独立压缩,
+ * 所以一条广播只需压缩一次, 压缩后的帧被所有协商了扩展的连接共享;
+ * 上行消息按协商结果保留或丢弃客户端的压缩上下文
+ */
+#ifndef __WEBSOCKET_DEFLATE_H__
+#define __WEBSOCKET_DEFLATE_H__
+
+#include <memory>
+#include <string>
+#include "muduo/net/Buffer.h"
+#include "muduo/net/Callbacks.h"
+#include "muduo/net/ZlibStream.h"
+
+using std::string;
+using muduo::net::Buffer;
+using muduo::net::SharedBytesPtr;
+
+// the negotiated parameters of one connection
+struct PerMessageDeflateParams {
+    bool enabled = false;
+    bool client_no_context_takeover = false;
+    int server_max_window_bits = 15;
+};
+
+// process wide settings, loaded from chat-room.conf
+struct PerMessageDeflateConfig {
+    bool enabled = true;
+    int level = 6;                  // zlib compression level
+    size_t min_size = 256;          // smaller payloads are sent uncompressed
+};
+
+// one broadcast message, encoded once for each kind of receiver
+struct WebSocketBroadcastFrame {
+    SharedBytesPtr plain;
+    SharedBytesPtr deflated;        // nullptr if not worth compressing
+
+    const SharedBytesPtr& Select(bool accepts_deflated) const {
+        return (accepts_deflated && deflated) ? deflated : plain;
+    }
+};
+
+void SetPerMessageDeflateConfig(const PerMessageDeflateConfig& config);
+const PerMessageDeflateConfig& GetPerMessageDeflateConfig();
+
+// parse Sec-WebSocket-Extensions of the request, fill the response header value if accepted
+bool NegotiatePerMessageDeflate(const string& extensions, PerMessageDeflateParams* params, string* response);
+
+// compress one message without context takeover, false if the result isn't smaller
+bool DeflateMessage(const string& payload, int window_bits, string* output);
+
+// build both frames of a text broadcast
+WebSocketBroadcastFrame BuildBroadcastFrame(const string& payload);
+
+// decompress client messages of one connection
+class CWebSocketInflater {
+public:
+    explicit CWebSocketInflater(bool no_context_takeover);
+
+    // inflate one message, fails on corrupt data or output larger than max_size
+    bool Inflate(const char* data, size_t len, size_t max_size, string* output);
+
+private:
+    Buffer output_;
+    muduo::net::ZlibInputStream stream_;
+    bool no_context_takeover_;
+};
+
+#endif // !__WEBSOCKET_DEFLATE_H__
@@ -0,0 +1,358 @@
+#include "websocket_simd.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define WS_SIMD_X86 1
+#endif
+
+// =========================scalar=======================
+void WsUnmaskScalar(char* data, size_t len, const uint8_t* masking_key) {
+    for (size_t i = 0; i < len; i++) {
+        data[i] ^= masking_key[i & 3];
+    }
+}
+
+// length of the valid code point at p, 0 if invalid
+static size_t Utf8CodePointLength(const uint8_t* p, const uint8_t* end) {
+    uint8_t c = p[0];
+    if (c < 0x80) {
+        return 1;
+    }
+    size_t avail = end - p;
+    if (c >= 0xC2 && c <= 0xDF) {
+        return (avail >= 2 && (p[1] & 0xC0) == 0x80) ? 2 : 0;
+    }
+    if (c >= 0xE0 && c <= 0xEF) {
+        if (avail < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80) {
+            return 0;
+        }
+        // overlong and surrogates
+        if ((c == 0xE0 && p[1] < 0xA0) || (c == 0xED && p[1] > 0x9F)) {
+            return 0;
+        }
+        return 3;
+    }
+    if (c >= 0xF0 && c <= 0xF4) {
+        if (avail < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80) {
+            return 0;
+        }
+        // overlong and > U+10FFFF
+        if ((c == 0xF0 && p[1] < 0x90) || (c == 0xF4 && p[1] > 0x8F)) {
+            return 0;
+        }
+        return 4;
+    }
+    return 0;
+}
+
+bool WsValidateUtf8Scalar(const char* data, size_t len) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+    const uint8_t* end = p + len;
+    while (p < end) {
+        size_t n = Utf8CodePointLength(p, end);
+        if (n == 0) {
+            return false;
+        }
+        p += n;
+    }
+    return true;
+}
+
+#ifdef WS_SIMD_X86
+// =========================sse2=======================
+// the key repeated to the vector width, rotated so lane 0 matches data[0]
+static void FillMaskPattern(uint8_t* pattern, size_t width, const uint8_t* masking_key) {
+    for (size_t i = 0; i < width; i++) {
+        pattern[i] = masking_key[i & 3];
+    }
+}
+
+__attribute__((target("sse2")))
+static void WsUnmaskSse2(char* data, size_t len, const uint8_t* masking_key) {
+    alignas(16) uint8_t pattern[16];
+    FillMaskPattern(pattern, sizeof(pattern), masking_key);
+    __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_xor_si128(v, mask));
+    }
+    // i is a multiple of 4, the key phase is unchanged
+    WsUnmaskScalar(data + i, len - i, masking_key);
+}
+
+// without pshufb: skip ascii 16 bytes at a time, multi-byte sequences go through the scalar path
+__attribute__((target("sse2")))
+static bool WsValidateUtf8Sse2(const char* data, size_t len) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+    const uint8_t* end = p + len;
+    while (p < end) {
+        if (end - p >= 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            if (_mm_movemask_epi8(v) == 0) {
+                p += 16;
+                continue;
+            }
+        }
+        size_t n = Utf8CodePointLength(p, end);
+        if (n == 0) {
+            return false;
+        }
+        p += n;
+    }
+    return true;
+}
+
+// =========================ssse3=======================
+// Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte": every invalid
+// two byte pattern is told apart by the high and low nibble of the first byte and the high
+// nibble of the second, each nibble looks up a 16 entry table of error bits and a pattern is
+// invalid if the three results share a bit; the 3rd/4th bytes of longer sequences are checked
+// by comparing "must be a continuation" with the TWO_CONTS bit
+static const uint8_t kTooShort = 1 << 0;        // 11______ 0_______, 11______ 11______
+static const uint8_t kTooLong = 1 << 1;         // 0_______ 10______
+static const uint8_t kOverlong3 = 1 << 2;       // 11100000 100_____
+static const uint8_t kTooLarge = 1 << 3;        // 11110100 1001____, 11110101-11111111 1001____/101_____
+static const uint8_t kSurrogate = 1 << 4;       // 11101101 101_____
+static const uint8_t kOverlong2 = 1 << 5;       // 1100000_ 10______
+static const uint8_t kTooLarge1000 = 1 << 6;    // 11110101-11111111 1000____
+static const uint8_t kOverlong4 = 1 << 6;       // 11110000 1000____
+static const uint8_t kTwoConts = 1 << 7;        // 10______ 10______
+static const uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+alignas(16) static const uint8_t kUtf8Byte1High[16] = {
+    // 0_______ ascii
+    kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+    // 10______ continuation
+    kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+    // 1100____, 1101____ two byte lead
+    kTooShort | kOverlong2, kTooShort,
+    // 1110____ three byte lead
+    kTooShort | kOverlong3 | kSurrogate,
+    // 1111____ four byte lead
+    kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+};
+
+alignas(16) static const uint8_t kUtf8Byte1Low[16] = {
+    kCarry | kOverlong3 | kOverlong2 | kOverlong4,          // ____0000
+    kCarry | kOverlong2,                                    // ____0001
+    kCarry, kCarry,                                         // ____001_
+    kCarry | kTooLarge,                                     // ____0100
+    kCarry | kTooLarge | kTooLarge1000,                     // ____0101
+    kCarry | kTooLarge | kTooLarge1000,                     // ____011_
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,                     // ____1___
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000 | kSurrogate,        // ____1101
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+};
+
+alignas(16) static const uint8_t kUtf8Byte2High[16] = {
+    // ________ 0_______ ascii
+    kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+    // ________ 1000____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+    // ________ 1001____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+    // ________ 101_____
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    // ________ 11______ lead
+    kTooShort, kTooShort, kTooShort, kTooShort,
+};
+
+// a block ending in the first byte of a 2 byte, the first 2 of a 3 byte or the first 3 of a
+// 4 byte sequence is incomplete, the last 16/32 bytes are the limits for the vector width
+alignas(32) static const uint8_t kUtf8IncompleteMax[32] = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+
+// error bits of a 16 byte block, prev_input is the block before it (zero at the start)
+__attribute__((target("ssse3")))
+static inline __m128i Utf8BlockErrorsSsse3(__m128i input, __m128i prev_input) {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i byte_1_high_table = _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1High));
+    const __m128i byte_1_low_table = _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1Low));
+    const __m128i byte_2_high_table = _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte2High));
+
+    __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+    __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble));
+    __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+    __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    // only 111_____ two bytes back and 1111____ three bytes back reach 0x80
+    __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+    __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte),
+                                                 _mm_set1_epi8(static_cast<char>(0x80)));
+    return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+__attribute__((target("ssse3")))
+static bool WsValidateUtf8Ssse3(const char* data, size_t len) {
+    const __m128i incomplete_max = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kUtf8IncompleteMax + 16));
+    __m128i error = _mm_setzero_si128();
+    __m128i prev_input = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(input) == 0) {
+            // ascii block, only a sequence cut at the end of the last one is an error
+            error = _mm_or_si128(error, prev_incomplete);
+            prev_incomplete = _mm_setzero_si128();
+        }
+        else {
+            error = _mm_or_si128(error, Utf8BlockErrorsSsse3(input, prev_input));
+            prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+        }
+        prev_input = input;
+    }
+    if (i < len) {
+        // zero padding is ascii, a sequence cut by the end of data shows up as TOO_SHORT
+        alignas(16) uint8_t tail[16] = {0};
+        memcpy(tail, data + i, len - i);
+        __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(tail));
+        error = _mm_or_si128(error, Utf8BlockErrorsSsse3(input, prev_input));
+    }
+    else {
+        error = _mm_or_si128(error, prev_incomplete);
+    }
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+// =========================avx2=======================
+__attribute__((target("avx2")))
+static void WsUnmaskAvx2(char* data, size_t len, const uint8_t* masking_key) {
+    alignas(32) uint8_t pattern[32];
+    FillMaskPattern(pattern, sizeof(pattern), masking_key);
+    __m256i mask = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern));
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_xor_si256(v0, mask));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i + 32), _mm256_xor_si256(v1, mask));
+    }
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_xor_si256(v, mask));
+    }
+    WsUnmaskScalar(data + i, len - i, masking_key);
+}
+
+// Utf8BlockErrorsSsse3 on 32 bytes, the tables are repeated in both 128 bit lanes
+__attribute__((target("avx2")))
+static inline __m256i Utf8BlockErrorsAvx2(__m256i input, __m256i prev_input) {
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i byte_1_high_table = _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1High)));
+    const __m256i byte_1_low_table = _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte1Low)));
+    const __m256i byte_2_high_table = _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(kUtf8Byte2High)));
+
+    // alignr works per lane, shift in the high lane of prev_input for the low lane
+    __m256i prev_shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, prev_shifted, 15);
+    __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table,
+                                              _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+    __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, nibble));
+    __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table,
+                                              _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+    __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    __m256i prev2 = _mm256_alignr_epi8(input, prev_shifted, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, prev_shifted, 13);
+    __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                                                    _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+__attribute__((target("avx2")))
+static bool WsValidateUtf8Avx2(const char* data, size_t len) {
+    const __m256i incomplete_max = _mm256_load_si256(reinterpret_cast<const __m256i*>(kUtf8IncompleteMax));
+    __m256i error = _mm256_setzero_si256();
+    __m256i prev_input = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = _mm256_or_si256(error, prev_incomplete);
+            prev_incomplete = _mm256_setzero_si256();
+        }
+        else {
+            error = _mm256_or_si256(error, Utf8BlockErrorsAvx2(input, prev_input));
+            prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+        }
+        prev_input = input;
+    }
+    if (i < len) {
+        alignas(32) uint8_t tail[32] = {0};
+        memcpy(tail, data + i, len - i);
+        __m256i input = _mm256_load_si256(reinterpret_cast<const __m256i*>(tail));
+        error = _mm256_or_si256(error, Utf8BlockErrorsAvx2(input, prev_input));
+    }
+    else {
+        error = _mm256_or_si256(error, prev_incomplete);
+    }
+    return _mm256_testz_si256(error, error) != 0;
+}
+#endif // WS_SIMD_X86
+
+// =========================runtime dispatch=======================
+typedef void (*UnmaskFunc)(char*, size_t, const uint8_t*);
+typedef bool (*ValidateUtf8Func)(const char*, size_t);
+
+struct WsSimdKernels {
+    UnmaskFunc unmask;
+    ValidateUtf8Func validate_utf8;
+    const char* name;
+};
+
+static WsSimdKernels SelectKernels() {
+#ifdef WS_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return { WsUnmaskAvx2, WsValidateUtf8Avx2, "avx2" };
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return { WsUnmaskSse2, WsValidateUtf8Ssse3, "ssse3" };
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return { WsUnmaskSse2, WsValidateUtf8Sse2, "sse2" };
+    }
+#endif
+    return { WsUnmaskScalar, WsValidateUtf8Scalar, "scalar" };
+}
+
+// function local static, selected once and thread safe for cpp11
+static const WsSimdKernels& GetKernels() {
+    static const WsSimdKernels kernels = SelectKernels();
+    return kernels;
+}
+
+void WsUnmask(char* data, size_t len, const uint8_t* masking_key) {
+    GetKernels().unmask(data, len, masking_key);
+}
+
+bool WsValidateUtf8(const char* data, size_t len) {
+    return GetKernels().validate_utf8(data, len);
+}
+
+const char* WsSimdKernelName() {
+    return GetKernels().name;
+}
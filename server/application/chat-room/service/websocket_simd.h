@@ -0,0 +1,27 @@
+/**
+ * WebSocket 入站路径的向量化内核: payload 去掩码和 UTF-8 校验
+ *
+ * x86 上启动时通过 CPUID 选择 AVX2 / SSSE3 / SSE2 实现, 其他平台使用标量实现,
+ * 各实现结果完全一致; AVX2 和 SSSE3 的 UTF-8 校验用查表法整块校验多字节字符,
+ * SSE2 没有字节查表指令, 只跳过 ASCII
+ */
+#ifndef __WEBSOCKET_SIMD_H__
+#define __WEBSOCKET_SIMD_H__
+
+#include <cstddef>
+#include <cstdint>
+
+// xor data with the 4 bytes masking key in place, data[0] uses masking_key[0]
+void WsUnmask(char* data, size_t len, const uint8_t* masking_key);
+
+// RFC 6455 8.1, text frame payload must be valid UTF-8
+bool WsValidateUtf8(const char* data, size_t len);
+
+// scalar reference implementations, also the fallback
+void WsUnmaskScalar(char* data, size_t len, const uint8_t* masking_key);
+bool WsValidateUtf8Scalar(const char* data, size_t len);
+
+// name of the selected kernels, "avx2", "ssse3", "sse2" or "scalar"
+const char* WsSimdKernelName();
+
+#endif // !__WEBSOCKET_SIMD_H__
@@ -0,0 +1,488 @@
+#include "session_token.h"
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <random>
+#include <json/json.h>
+#include "muduo/base/Logging.h"
+
+namespace {
+
+// v1 joined the claims with '\n' and a user name could forge the expire, never accepted again
+const char kTokenVersion[] = "v2";
+
+// FIPS 180-4 SHA-256
+class Sha256 {
+public:
+    Sha256() {
+        static const uint32_t init[8] = {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+        };
+        memcpy(h_, init, sizeof(h_));
+    }
+
+    void Update(const void* data, size_t len) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        total_ += len;
+        while (len > 0) {
+            size_t n = std::min(len, sizeof(block_) - used_);
+            memcpy(block_ + used_, p, n);
+            used_ += n;
+            p += n;
+            len -= n;
+            if (used_ == sizeof(block_)) {
+                Compress(block_);
+                used_ = 0;
+            }
+        }
+    }
+
+    void Final(uint8_t digest[32]) {
+        uint64_t bits = total_ * 8;
+        uint8_t pad = 0x80;
+        Update(&pad, 1);
+        pad = 0;
+        while (used_ != 56) {
+            Update(&pad, 1);
+        }
+        uint8_t length[8];
+        for (int i = 0; i < 8; i++) {
+            length[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+        }
+        Update(length, 8);
+        for (int i = 0; i < 8; i++) {
+            digest[4 * i] = static_cast<uint8_t>(h_[i] >> 24);
+            digest[4 * i + 1] = static_cast<uint8_t>(h_[i] >> 16);
+            digest[4 * i + 2] = static_cast<uint8_t>(h_[i] >> 8);
+            digest[4 * i + 3] = static_cast<uint8_t>(h_[i]);
+        }
+    }
+
+private:
+    static uint32_t Rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    void Compress(const uint8_t* block) {
+        static const uint32_t k[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+        };
+        uint32_t w[64];
+        for (int i = 0; i < 16; i++) {
+            w[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) |
+                   (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+        }
+        for (int i = 16; i < 64; i++) {
+            uint32_t s0 = Rotr(w[i - 15], 7) ^ Rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = Rotr(w[i - 2], 17) ^ Rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = h_[0], b = h_[1], c = h_[2], d = h_[3];
+        uint32_t e = h_[4], f = h_[5], g = h_[6], h = h_[7];
+        for (int i = 0; i < 64; i++) {
+            uint32_t t1 = h + (Rotr(e, 6) ^ Rotr(e, 11) ^ Rotr(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+            uint32_t t2 = (Rotr(a, 2) ^ Rotr(a, 13) ^ Rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        h_[0] += a; h_[1] += b; h_[2] += c; h_[3] += d;
+        h_[4] += e; h_[5] += f; h_[6] += g; h_[7] += h;
+    }
+
+    uint32_t h_[8];
+    uint8_t block_[64];
+    size_t used_ = 0;
+    uint64_t total_ = 0;
+};
+
+// RFC 2104
+void HmacSha256(const string& key, const string& message, uint8_t mac[32]) {
+    uint8_t key_block[64] = { 0 };
+    if (key.size() > sizeof(key_block)) {
+        Sha256 hash;
+        hash.Update(key.data(), key.size());
+        hash.Final(key_block);
+    }
+    else {
+        memcpy(key_block, key.data(), key.size());
+    }
+
+    uint8_t pad[64];
+    for (int i = 0; i < 64; i++) {
+        pad[i] = key_block[i] ^ 0x36;
+    }
+    uint8_t inner_digest[32];
+    Sha256 inner;
+    inner.Update(pad, sizeof(pad));
+    inner.Update(message.data(), message.size());
+    inner.Final(inner_digest);
+
+    for (int i = 0; i < 64; i++) {
+        pad[i] = key_block[i] ^ 0x5c;
+    }
+    Sha256 outer;
+    outer.Update(pad, sizeof(pad));
+    outer.Update(inner_digest, sizeof(inner_digest));
+    outer.Final(mac);
+}
+
+const char kBase64Url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// unpadded, safe in a cookie value
+string Base64UrlEncode(const uint8_t* data, size_t len) {
+    string out;
+    out.reserve((len + 2) / 3 * 4);
+    size_t i = 0;
+    for (; i + 3 <= len; i += 3) {
+        uint32_t v = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+        out.push_back(kBase64Url[(v >> 18) & 63]);
+        out.push_back(kBase64Url[(v >> 12) & 63]);
+        out.push_back(kBase64Url[(v >> 6) & 63]);
+        out.push_back(kBase64Url[v & 63]);
+    }
+    if (len - i == 1) {
+        uint32_t v = uint32_t(data[i]) << 16;
+        out.push_back(kBase64Url[(v >> 18) & 63]);
+        out.push_back(kBase64Url[(v >> 12) & 63]);
+    }
+    else if (len - i == 2) {
+        uint32_t v = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8);
+        out.push_back(kBase64Url[(v >> 18) & 63]);
+        out.push_back(kBase64Url[(v >> 12) & 63]);
+        out.push_back(kBase64Url[(v >> 6) & 63]);
+    }
+    return out;
+}
+
+bool Base64UrlDecode(const string& in, string& out) {
+    if (in.size() % 4 == 1) {
+        return false;
+    }
+    out.clear();
+    out.reserve(in.size() * 3 / 4);
+    uint32_t v = 0;
+    int bits = 0;
+    for (char c : in) {
+        const char* pos = static_cast<const char*>(memchr(kBase64Url, c, 64));
+        if (!pos || c == '\0') {
+            return false;
+        }
+        v = (v << 6) | static_cast<uint32_t>(pos - kBase64Url);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out.push_back(static_cast<char>((v >> bits) & 0xff));
+        }
+    }
+    return true;
+}
+
+void AppendClaim(string& payload, const string& claim) {
+    payload.append(std::to_string(claim.size())).append(":").append(claim);
+}
+
+// <len>:<bytes> at pos, pos moves past it
+bool ReadClaim(const string& payload, size_t& pos, string& claim) {
+    size_t colon = payload.find(':', pos);
+    // at most 9 digits, a token is never that long
+    if (colon == string::npos || colon == pos || colon - pos > 9) {
+        return false;
+    }
+    size_t len = 0;
+    for (size_t i = pos; i < colon; i++) {
+        if (payload[i] < '0' || payload[i] > '9') {
+            return false;
+        }
+        len = len * 10 + static_cast<size_t>(payload[i] - '0');
+    }
+    if (len > payload.size() - colon - 1) {
+        return false;
+    }
+    claim = payload.substr(colon + 1, len);
+    pos = colon + 1 + len;
+    return true;
+}
+
+bool ConstantTimeEquals(const string& a, const string& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    unsigned char diff = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        diff |= static_cast<unsigned char>(a[i] ^ b[i]);
+    }
+    return diff == 0;
+}
+
+string RandomTokenId() {
+    thread_local std::mt19937_64 engine(std::random_device{}());
+    uint8_t bytes[12];
+    for (size_t i = 0; i < sizeof(bytes); i += 4) {
+        uint32_t v = static_cast<uint32_t>(engine());
+        memcpy(bytes + i, &v, 4);
+    }
+    return Base64UrlEncode(bytes, sizeof(bytes));
+}
+
+} // namespace
+
+CSessionTokenCodec& CSessionTokenCodec::GetInstance() {
+    static CSessionTokenCodec instance;
+    return instance;
+}
+
+bool CSessionTokenCodec::Init(const string& keys, const string& active_key_id, int ttl) {
+    secrets_.clear();
+    auto state = std::make_shared<KeyState>();
+    size_t pos = 0;
+    while (pos < keys.size()) {
+        size_t comma = keys.find(',', pos);
+        string item = keys.substr(pos, comma == string::npos ? string::npos : comma - pos);
+        pos = comma == string::npos ? keys.size() : comma + 1;
+
+        size_t colon = item.find(':');
+        if (colon == string::npos || colon == 0 || colon + 1 == item.size()) {
+            LOG_ERROR << "bad session token key, expect kid:secret";
+            return false;
+        }
+        string kid = item.substr(0, colon);
+        if (kid.find('.') != string::npos) {
+            LOG_ERROR << "session token kid can't contain '.': " << kid;
+            return false;
+        }
+        secrets_[kid] = item.substr(colon + 1);
+        state->accepted.insert(kid);
+    }
+    if (secrets_.empty()) {
+        LOG_ERROR << "session token mode needs at least one key";
+        return false;
+    }
+    if (!active_key_id.empty() && secrets_.count(active_key_id) == 0) {
+        LOG_ERROR << "no secret for the active session key: " << active_key_id;
+        return false;
+    }
+
+    active_key_id_ = active_key_id;
+    ttl_ = ttl > 0 ? ttl : 86400;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        state_ = state;
+    }
+    enabled_ = true;
+    LOG_INFO << "session token enabled, keys: " << secrets_.size()
+             << ", active key: " << (active_key_id_.empty() ? "-" : active_key_id_) << ", ttl: " << ttl_;
+    return true;
+}
+
+bool ContainsControlChars(const string& str) {
+    for (char c : str) {
+        unsigned char uc = static_cast<unsigned char>(c);
+        if (uc < 0x20 || uc == 0x7f) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CSessionTokenCodec::LooksLikeToken(const string& cookie) {
+    return cookie.compare(0, sizeof(kTokenVersion), string(kTokenVersion) + ".") == 0;
+}
+
+bool CSessionTokenCodec::Issue(const string& user_id, const string& username, string& token) const {
+    if (!enabled_ || active_key_id_.empty()) {
+        return false;
+    }
+    if (ContainsControlChars(user_id) || ContainsControlChars(username)) {
+        LOG_WARN << "refuse to issue a session token, control characters in user_id or username";
+        return false;
+    }
+    int64_t expire = static_cast<int64_t>(::time(nullptr)) + ttl_;
+    string payload;
+    AppendClaim(payload, user_id);
+    AppendClaim(payload, username);
+    AppendClaim(payload, std::to_string(expire));
+    AppendClaim(payload, RandomTokenId());
+
+    token.assign(kTokenVersion).append(".").append(active_key_id_).append(".");
+    token.append(Base64UrlEncode(reinterpret_cast<const uint8_t*>(payload.data()), payload.size()));
+    string signature = Sign(secrets_.at(active_key_id_), token);
+    token.append(".").append(signature);
+    return true;
+}
+
+SessionTokenResult CSessionTokenCodec::Verify(const string& token, SessionClaims& claims) const {
+    if (!enabled_ || !LooksLikeToken(token)) {
+        return kTokenMalformed;
+    }
+    // v2.<kid>.<payload>.<sig>
+    size_t kid_begin = sizeof(kTokenVersion);
+    size_t kid_end = token.find('.', kid_begin);
+    if (kid_end == string::npos) {
+        return kTokenMalformed;
+    }
+    size_t sig_dot = token.rfind('.');
+    if (sig_dot <= kid_end) {
+        return kTokenMalformed;
+    }
+    claims.key_id = token.substr(kid_begin, kid_end - kid_begin);
+
+    auto secret = secrets_.find(claims.key_id);
+    if (secret == secrets_.end()) {
+        return kTokenUnknownKey;
+    }
+    std::shared_ptr<const KeyState> state = GetState();
+    if (state->accepted.count(claims.key_id) == 0) {
+        return kTokenRetiredKey;
+    }
+    if (!ConstantTimeEquals(Sign(secret->second, token.substr(0, sig_dot)), token.substr(sig_dot + 1))) {
+        return kTokenBadSignature;
+    }
+
+    // signed by us, the payload is well formed unless the key leaked
+    string payload;
+    if (!Base64UrlDecode(token.substr(kid_end + 1, sig_dot - kid_end - 1), payload)) {
+        return kTokenMalformed;
+    }
+    size_t pos = 0;
+    string expire;
+    if (!ReadClaim(payload, pos, claims.user_id) || !ReadClaim(payload, pos, claims.username) ||
+        !ReadClaim(payload, pos, expire) || !ReadClaim(payload, pos, claims.token_id) || pos != payload.size()) {
+        return kTokenMalformed;
+    }
+    if (expire.empty() || expire.size() > 18 || expire.find_first_not_of("0123456789") != string::npos) {
+        return kTokenMalformed;
+    }
+    claims.expire = strtoll(expire.c_str(), nullptr, 10);
+
+    if (claims.expire <= static_cast<int64_t>(::time(nullptr))) {
+        return kTokenExpired;
+    }
+    if (state->revoked.count(claims.token_id) > 0) {
+        return kTokenRevoked;
+    }
+    return kTokenOk;
+}
+
+void CSessionTokenCodec::Revoke(const string& token_id, int64_t expire) {
+    int64_t now = static_cast<int64_t>(::time(nullptr));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto state = std::make_shared<KeyState>(*state_);
+    // drop entries whose tokens are dead anyway
+    for (auto it = state->revoked.begin(); it != state->revoked.end();) {
+        if (it->second <= now) {
+            it = state->revoked.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    if (expire > now) {
+        state->revoked[token_id] = expire;
+    }
+    state_ = state;
+}
+
+string CSessionTokenCodec::EncodeState() const {
+    std::shared_ptr<const KeyState> state = GetState();
+    int64_t now = static_cast<int64_t>(::time(nullptr));
+
+    Json::Value root;
+    Json::Value keys(Json::arrayValue);
+    for (const auto& kid : state->accepted) {
+        keys.append(kid);
+    }
+    root["keys"] = keys;
+    Json::Value revoked(Json::objectValue);
+    for (const auto& kv : state->revoked) {
+        if (kv.second > now) {
+            revoked[kv.first] = (Json::Int64)kv.second;
+        }
+    }
+    root["revoked"] = revoked;
+
+    Json::FastWriter writer;
+    return writer.write(root);
+}
+
+bool CSessionTokenCodec::ApplyState(const string& state_json) {
+    Json::Value root;
+    Json::Reader reader;
+    if (!reader.parse(state_json, root) || !root["keys"].isArray() || !root["revoked"].isObject()) {
+        LOG_ERROR << "bad session key state";
+        return false;
+    }
+
+    // every logic instance pushes its own view, the accepted kids are replaced but
+    // the revocations are merged, one instance's push never undoes another's revoke
+    auto state = std::make_shared<KeyState>();
+    for (const auto& kid : root["keys"]) {
+        state->accepted.insert(kid.asString());
+    }
+    int64_t now = static_cast<int64_t>(::time(nullptr));
+    for (const auto& token_id : root["revoked"].getMemberNames()) {
+        int64_t expire = root["revoked"][token_id].asInt64();
+        if (expire > now) {
+            state->revoked[token_id] = expire;
+        }
+    }
+
+    size_t accepted = state->accepted.size();
+    size_t revoked = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (state_) {
+            for (const auto& kv : state_->revoked) {
+                if (kv.second > now) {
+                    state->revoked.insert(kv);
+                }
+            }
+        }
+        revoked = state->revoked.size();
+        state_ = state;
+    }
+    LOG_INFO << "session key state applied, accepted keys: " << accepted << ", revoked tokens: " << revoked;
+    return true;
+}
+
+const char* CSessionTokenCodec::ResultString(SessionTokenResult result) {
+    switch (result) {
+    case kTokenOk:
+        return "ok";
+    case kTokenMalformed:
+        return "malformed session token";
+    case kTokenUnknownKey:
+        return "unknown session key";
+    case kTokenRetiredKey:
+        return "retired session key";
+    case kTokenBadSignature:
+        return "bad session token signature";
+    case kTokenExpired:
+        return "session expired";
+    case kTokenRevoked:
+        return "session revoked";
+    }
+    return "unknown";
+}
+
+std::shared_ptr<const CSessionTokenCodec::KeyState> CSessionTokenCodec::GetState() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return state_;
+}
+
+string CSessionTokenCodec::Sign(const string& secret, const string& signing_input) const {
+    uint8_t mac[32];
+    HmacSha256(secret, signing_input, mac);
+    return Base64UrlEncode(mac, sizeof(mac));
+}
@@ -0,0 +1,106 @@
+/**
+ * 无状态的签名会话 token, logic 与 comet 共用同一份实现
+ *
+ * v2.<kid>.<payload>.<sig>
+ *   payload = base64url(<len>:user_id <len>:username <len>:expire <len>:token_id), 字段间无分隔符,
+ *             每个字段带十进制长度前缀, 字段内容不会被当成下一个字段
+ *   sig     = base64url(HMAC-SHA256(secret[kid], "v2.<kid>.<payload>"))
+ * logic 登录时签发, comet 握手时用共享密钥本地校验, 不再经过 logic/redis/mysql
+ *
+ * 密钥(kid:secret)在配置里预先分发, 不经过网络; logic 周期性地把当前接受的 kid
+ * 和吊销列表推送给 comet (kafka -> job -> comet Broadcast, op = kOpSessionState),
+ * 推送前先从 redis 重新加载吊销列表; comet 合并各实例推送的吊销, 不会互相覆盖
+ * 轮换: 先给 comet 加新密钥, 再切换 logic 的 active key; 下线: 从 logic 配置删掉 kid
+ */
+#ifndef __SESSION_TOKEN_H__
+#define __SESSION_TOKEN_H__
+
+#include <stdint.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+using std::string;
+
+// Broadcast op of the pushed key state, never forwarded to users
+const int kOpSessionState = 6;
+
+// ascii control characters (< 0x20 and 0x7f), refused in user names and token claims
+bool ContainsControlChars(const string& str);
+
+struct SessionClaims {
+    string key_id;
+    string user_id;
+    string username;
+    int64_t expire = 0;         // unix seconds
+    string token_id;
+};
+
+enum SessionTokenResult {
+    kTokenOk = 0,
+    kTokenMalformed,
+    kTokenUnknownKey,           // no secret for the kid here, the caller may ask logic
+    kTokenRetiredKey,
+    kTokenBadSignature,
+    kTokenExpired,
+    kTokenRevoked,
+};
+
+class CSessionTokenCodec {
+public:
+    static CSessionTokenCodec& GetInstance();
+
+    /**
+     * @param keys kid:secret,kid:secret
+     * @param active_key_id kid that signs new tokens, empty on comet
+     * @param ttl token lifetime in seconds
+     */
+    bool Init(const string& keys, const string& active_key_id, int ttl);
+
+    bool Enabled() const { return enabled_; }
+    int GetTtl() const { return ttl_; }
+
+    // legacy sessions are uuids kept in redis
+    static bool LooksLikeToken(const string& cookie);
+
+    // false if disabled or a claim contains control characters
+    bool Issue(const string& user_id, const string& username, string& token) const;
+    SessionTokenResult Verify(const string& token, SessionClaims& claims) const;
+
+    // kept until the token would expire anyway
+    void Revoke(const string& token_id, int64_t expire);
+
+    // {"keys":["k1","k2"],"revoked":{"<token_id>":<expire>}}
+    string EncodeState() const;
+    // replaces the accepted kids, adds the revocations to the ones already known
+    bool ApplyState(const string& state_json);
+
+    static const char* ResultString(SessionTokenResult result);
+
+private:
+    // copy on write, Verify takes a snapshot and never blocks a writer for long
+    struct KeyState {
+        std::unordered_set<string> accepted;            // kids accepted for verification
+        std::unordered_map<string, int64_t> revoked;    // token_id -> expire
+    };
+
+    CSessionTokenCodec() = default;
+    ~CSessionTokenCodec() = default;
+    CSessionTokenCodec(const CSessionTokenCodec&) = delete;
+    CSessionTokenCodec& operator=(const CSessionTokenCodec&) = delete;
+
+    std::shared_ptr<const KeyState> GetState() const;
+    string Sign(const string& secret, const string& signing_input) const;
+
+    bool enabled_ = false;
+    int ttl_ = 86400;
+    string active_key_id_;
+    std::map<string, string> secrets_;                  // kid -> secret, read only after Init
+    mutable std::mutex mutex_;
+    std::shared_ptr<const KeyState> state_;
+};
+
+#endif // __SESSION_TOKEN_H__
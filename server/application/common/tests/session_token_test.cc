@@ -0,0 +1,110 @@
+// CSessionTokenCodec 单元测试
+// cmake -DLOGIC_BUILD_TESTS=ON, 然后在 logic 的构建目录运行 ctest
+#include "session_token.h"
+#include <time.h>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);  \
+            g_failures++;                                                   \
+        }                                                                   \
+    } while (0)
+
+// the payload segment of v2.<kid>.<payload>.<sig>
+string PayloadOf(const string& token) {
+    size_t kid_end = token.find('.', 3);
+    size_t sig_dot = token.rfind('.');
+    return token.substr(kid_end + 1, sig_dot - kid_end - 1);
+}
+
+void TestRoundTrip(CSessionTokenCodec& codec) {
+    string token;
+    CHECK(codec.Issue("u-1", "alice", token));
+    CHECK(CSessionTokenCodec::LooksLikeToken(token));
+
+    SessionClaims claims;
+    CHECK(codec.Verify(token, claims) == kTokenOk);
+    CHECK(claims.key_id == "k1");
+    CHECK(claims.user_id == "u-1");
+    CHECK(claims.username == "alice");
+    int64_t now = static_cast<int64_t>(::time(nullptr));
+    CHECK(claims.expire > now && claims.expire <= now + 60);
+    CHECK(!claims.token_id.empty());
+}
+
+// a user name must not be able to move the expire, however it looks like the encoding
+void TestUsernameCantForgeExpire(CSessionTokenCodec& codec) {
+    string token;
+    // v1 joined the claims with '\n', this user got a token that never expired
+    CHECK(!codec.Issue("u-2", "eve\n9999999999", token));
+    CHECK(!codec.Issue("u-2\n", "eve", token));
+    CHECK(!codec.Issue("u-2", string("eve\0", 4), token));
+    CHECK(!codec.Issue("u-2", "eve\x7f", token));
+
+    // printable names that mimic the length prefixes stay one claim
+    const char* names[] = { "eve 10:9999999999", "3:eve", ":", "0:", "eve:", "9999999999" };
+    for (const char* name : names) {
+        CHECK(codec.Issue("u-2", name, token));
+        SessionClaims claims;
+        CHECK(codec.Verify(token, claims) == kTokenOk);
+        CHECK(claims.username == name);
+        CHECK(claims.expire <= static_cast<int64_t>(::time(nullptr)) + 60);
+    }
+}
+
+void TestTampered(CSessionTokenCodec& codec) {
+    string token;
+    CHECK(codec.Issue("u-3", "bob", token));
+    SessionClaims claims;
+
+    string payload = PayloadOf(token);
+    string other;
+    CHECK(codec.Issue("u-3", "bobby", other));
+    string swapped = token;
+    swapped.replace(swapped.find(payload), payload.size(), PayloadOf(other));
+    CHECK(codec.Verify(swapped, claims) == kTokenBadSignature);
+
+    CHECK(codec.Verify(token.substr(0, token.size() - 1), claims) == kTokenBadSignature);
+    CHECK(codec.Verify("v2.k1.", claims) == kTokenMalformed);
+    CHECK(codec.Verify("v2.k9.abc.def", claims) == kTokenUnknownKey);
+    // the old format is not a token any more
+    CHECK(codec.Verify("v1.k1.abc.def", claims) == kTokenMalformed);
+}
+
+void TestRevoked(CSessionTokenCodec& codec) {
+    string token;
+    CHECK(codec.Issue("u-4", "carol", token));
+    SessionClaims claims;
+    CHECK(codec.Verify(token, claims) == kTokenOk);
+    codec.Revoke(claims.token_id, claims.expire);
+    CHECK(codec.Verify(token, claims) == kTokenRevoked);
+}
+
+}  // namespace
+
+int main() {
+    CHECK(!ContainsControlChars("alice bob 3:x"));
+    CHECK(ContainsControlChars("a\tb"));
+
+    CSessionTokenCodec& codec = CSessionTokenCodec::GetInstance();
+    CHECK(codec.Init("k1:secret-one,k2:secret-two", "k1", 60));
+
+    TestRoundTrip(codec);
+    TestUsernameCantForgeExpire(codec);
+    TestTampered(codec);
+    TestRevoked(codec);
+
+    if (g_failures > 0) {
+        printf("session_token_test: %d failures\n", g_failures);
+        return 1;
+    }
+    printf("session_token_test: ok\n");
+    return 0;
+}
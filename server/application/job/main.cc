@@ -1,13 +1,23 @@
+#include <algorithm>
 #include <memory>
 #include <muduo/net/EventLoop.h>
 #include <muduo/base/ThreadPool.h>
 #include <muduo/base/Logging.h>
 #include <thread>
 #include <chrono>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <vector>
 #include <librdkafka/rdkafkacpp.h>
 #include <grpcpp/grpcpp.h>
 #include <json/json.h>
 #include "service/kafka_consumer.h"
+#include "service/comet_push_stream.h"
+#include "service/push_pipeline.h"
+#include "service/comet_router.h"
+#include "service/offset_tracker.h"
+#include "service/retry_worker.h"
 #include "base/config_file_reader.h"
 #include "proto/ChatRoom.Job.pb.h"
 #include "proto/ChatRoom.Comet.pb.h"  
@@ -74,8 +84,10 @@ public:
         return false;
     }
 
-    bool broadcast(const std::string& msgContent) {
-        const int MAX_RETRIES = 3;
+    // op: 5 创建房间, 6 会话密钥状态(comet 自己消费)
+    // speed: 每秒写出的连接数, 0 立即发送
+    bool broadcast(int op, const std::string& msgContent, int max_retries = 3, int speed = 0) {
+        const int MAX_RETRIES = max_retries;
         
         for (int retry = 0; retry < MAX_RETRIES; ++retry) {
             // 创建全局广播请求
@@ -84,11 +96,11 @@ public:
             // 创建并设置Proto消息
             ChatRoom::Protocol::Proto *proto = request.mutable_proto();
             proto->set_ver(1);        // 设置版本号
-            proto->set_op(5);         // 房间创建
+            proto->set_op(op);
             proto->set_seq(0);        // 序列号
             proto->set_body(msgContent);  // 设置消息内容
 
-            request.set_speed(0);     // 0: 立即发送
+            request.set_speed(speed);
 
             // 发送gRPC请求
             ChatRoom::Comet::BroadcastReply response;
@@ -124,6 +136,44 @@ public:
         return false;
     }
     
+    // 推送给指定用户(key 即用户id), comet 跳过不在本节点的用户
+    bool pushKeys(const std::vector<std::string>& keys, int op, const std::string& msgContent, int max_retries = 3) {
+        for (int retry = 0; retry < max_retries; ++retry) {
+            ChatRoom::Comet::PushMsgReq request;
+            for (const std::string& key : keys) {
+                request.add_keys(key);
+            }
+            request.set_protoop(op);
+            ChatRoom::Protocol::Proto *proto = request.mutable_proto();
+            proto->set_ver(1);
+            proto->set_op(op);
+            proto->set_seq(0);
+            proto->set_body(msgContent);
+
+            ChatRoom::Comet::PushMsgReply response;
+            grpc::ClientContext context;
+            context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(5));
+
+            grpc::Status status = stub_->PushMsg(&context, request, &response);
+            if (status.ok()) {
+                return true;
+            }
+
+            LOG_WARN << "PushMsg RPC failed (attempt " << (retry + 1) << "/" << max_retries
+                     << "): " << status.error_message();
+            if (status.error_code() == grpc::StatusCode::UNAVAILABLE ||
+                status.error_code() == grpc::StatusCode::CANCELLED) {
+                recreateConnection();
+            }
+            if (retry < max_retries - 1) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100 * (retry + 1)));
+            }
+        }
+
+        LOG_ERROR << "PushMsg RPC failed after " << max_retries << " retries";
+        return false;
+    }
+
     void recreateConnection() {
         auto channel = grpc::CreateChannel(
             server_address_, grpc::InsecureChannelCredentials());
@@ -135,7 +185,13 @@ private:
     std::unique_ptr<ChatRoom::Comet::Comet::Stub> stub_;
 };
 
-// 管理与chatroom的连接
+// 推送失败时写入重试 topic, 未配置重试 topic 时为 nullptr
+static RetryWorker* g_retry_worker = nullptr;
+
+static void onPushDone(const PushTag& tag, bool delivered);
+
+// 管理与所有 comet 的连接: comet_servers 为逗号分隔的地址列表, 未配置时使用 comet_server
+// 每个 comet 一个 PushStream (或一条推送流水线), 房间分布由 CometRouter 定期向各 comet 查询
 class CometManager {
 public:
     static CometManager& getInstance() {
@@ -143,34 +199,323 @@ public:
         return instance;
     }
 
-    CometClient* getClient() {
-        if (!m_client) {
-            // 从配置文件读取chatroom地址
-            CConfigFileReader config_reader("job.conf");
+    CometRouter& router() {
+        init();
+        return *m_router;
+    }
+
+    size_t size() {
+        init();
+        return m_comets.size();
+    }
+
+    const std::string& server(size_t index) {
+        init();
+        return m_router->servers()[index];
+    }
+
+    CometClient* getClient(size_t index) {
+        init();
+        return m_comets[index].client.get();
+    }
+
+    // 长连接批量推送通道, comet_push_stream=0 时返回 nullptr, 走单次 RPC
+    CometPushStream* getPushStream(size_t index) {
+        init();
+        return m_comets[index].stream.get();
+    }
+
+    // 单次 RPC 模式的房间推送流水线, 只在 comet_push_stream=0 时存在
+    PushPipeline* getPipeline(size_t index) {
+        init();
+        return m_comets[index].pipeline.get();
+    }
+
+private:
+    struct Comet {
+        std::unique_ptr<CometClient> client;
+        std::unique_ptr<CometPushStream> stream;
+        std::unique_ptr<PushPipeline> pipeline;
+    };
+
+    static std::vector<std::string> parseServers(CConfigFileReader& config_reader) {
+        std::vector<std::string> servers;
+        const char* servers_c = config_reader.GetConfigName("comet_servers");
+        if (servers_c) {
+            std::stringstream ss(servers_c);
+            std::string server;
+            while (std::getline(ss, server, ',')) {
+                server.erase(0, server.find_first_not_of(" \t"));
+                server.erase(server.find_last_not_of(" \t") + 1);
+                if (!server.empty() && std::find(servers.begin(), servers.end(), server) == servers.end()) {
+                    servers.push_back(server);
+                }
+            }
+        }
+        if (servers.empty()) {
             const char* comet_server_c = config_reader.GetConfigName("comet_server");
-            std::string comet_server = comet_server_c ? comet_server_c : "chatroom-app:50051";
-            LOG_INFO << "Connecting to comet server: " << comet_server;
-            m_client = std::make_unique<CometClient>(comet_server);  
+            servers.push_back(comet_server_c ? comet_server_c : "chatroom-app:50051");
         }
-        
-        return m_client.get();
+        return servers;
     }
 
-private:
-    std::unique_ptr<CometClient> m_client;
+    void init() {
+        std::call_once(m_init_once, [this]() {
+            CConfigFileReader config_reader("job.conf");
+            std::vector<std::string> servers = parseServers(config_reader);
+
+            bool use_stream = true;
+            if (const char* v = config_reader.GetConfigName("comet_push_stream")) {
+                use_stream = atoi(v) != 0;
+            }
+
+            PushStreamOptions stream_options;
+            if (const char* v = config_reader.GetConfigName("comet_push_batch_items")) {
+                stream_options.max_batch_items = atoi(v);
+            }
+            if (const char* v = config_reader.GetConfigName("comet_push_linger_ms")) {
+                stream_options.linger_ms = atoi(v);
+            }
+            if (const char* v = config_reader.GetConfigName("comet_push_inflight_batches")) {
+                stream_options.max_inflight_batches = atoi(v);
+            }
+
+            PushPipelineOptions pipeline_options;
+            if (const char* v = config_reader.GetConfigName("job_push_lanes")) {
+                pipeline_options.lanes = atoi(v);
+            }
+            if (const char* v = config_reader.GetConfigName("job_lane_queue_size")) {
+                pipeline_options.lane_queue_size = atoi(v);
+            }
+            if (const char* v = config_reader.GetConfigName("comet_room_batch_items")) {
+                pipeline_options.batch_items = atoi(v);
+            }
+            if (const char* v = config_reader.GetConfigName("comet_room_batch_window_ms")) {
+                pipeline_options.window_ms = atoi(v);
+            }
+            if (const char* v = config_reader.GetConfigName("comet_inflight_per_lane")) {
+                pipeline_options.max_inflight = atoi(v);
+            }
+
+            int refresh_ms = 1000;
+            if (const char* v = config_reader.GetConfigName("comet_rooms_refresh_ms")) {
+                refresh_ms = atoi(v);
+            }
+
+            for (const std::string& comet_server : servers) {
+                Comet comet;
+                LOG_INFO << "Connecting to comet server: " << comet_server;
+                comet.client = std::make_unique<CometClient>(comet_server);
+                if (use_stream) {
+                    LOG_INFO << "Opening push stream to comet server: " << comet_server
+                             << ", batch items: " << stream_options.max_batch_items
+                             << ", linger ms: " << stream_options.linger_ms;
+                    comet.stream = std::make_unique<CometPushStream>(comet_server, stream_options);
+                    // 流上的推送断线后会重发直到确认, 只有确认一种结果
+                    comet.stream->setAckCallback([](const std::vector<PushTag>& tags) {
+                        for (const PushTag& tag : tags) {
+                            onPushDone(tag, true);
+                        }
+                    });
+                }
+                else {
+                    LOG_INFO << "Starting push pipeline to comet server: " << comet_server
+                             << ", lanes: " << pipeline_options.lanes
+                             << ", batch items: " << pipeline_options.batch_items
+                             << ", inflight per lane: " << pipeline_options.max_inflight;
+                    comet.pipeline = std::make_unique<PushPipeline>(comet_server, pipeline_options);
+                    comet.pipeline->setDoneCallback(onPushDone);
+                }
+                m_comets.push_back(std::move(comet));
+            }
+
+            m_router = std::make_unique<CometRouter>(servers, refresh_ms);
+            m_router->start();
+            LOG_INFO << "Comet servers: " << servers.size() << ", rooms refresh ms: " << refresh_ms;
+        });
+    }
+
+    std::once_flag m_init_once;
+    std::vector<Comet> m_comets;
+    std::unique_ptr<CometRouter> m_router;
 };
 
+// 推送完成: comet 确认的推送交回 tracker 等待提交 offset, 放弃的推送写入重试 topic 后再交回
+// 一条消息推给多个 comet 时, 只有失败的 comet 会收到重试
+static void onPushDone(const PushTag& tag, bool delivered) {
+    if (!tag.tracker) {
+        return;
+    }
+    if (delivered) {
+        tag.tracker->done(tag.partition, tag.offset);
+        return;
+    }
+    if (!g_retry_worker) {
+        LOG_ERROR << "Push of partition " << tag.partition << " offset " << tag.offset << " dropped";
+        tag.tracker->done(tag.partition, tag.offset);
+        return;
+    }
+    CometManager& manager = CometManager::getInstance();
+    std::string server;
+    if (tag.comet >= 0 && manager.size() > 1) {
+        server = manager.server(static_cast<size_t>(tag.comet));
+    }
+    PushTag parked = tag;
+    g_retry_worker->schedule(tag.tracker->payload(tag.partition, tag.offset), server, [parked]() {
+        parked.tracker->done(parked.partition, parked.offset);
+    });
+}
+
+// 按消息类型分发: 房间推送只发给有成员的 comet, 指定用户的推送只发给用户所在的 comet,
+// 全局广播发给所有 comet, 重试只发给失败的 comet
+// 每个 comet 上房间推送进入有序 lane (或 PushStream), 全局广播作为屏障
+// 推送结果通过 tag 交回, 所有目标 comet 都完成后才能提交 offset
+static void dispatchPushMsg(const std::string& message, const PushTag& tag) {
+    ChatRoom::Job::PushMsg pushMsg;
+    if (!pushMsg.ParseFromString(message)) {
+        LOG_ERROR << "Failed to parse message as PushMsg";
+        onPushDone(tag, true);      // 无法解析的消息重试也没有用
+        return;
+    }
+    LOG_DEBUG << "Received PushMsg, type: " << ChatRoom::Job::PushMsg_Type_Name(pushMsg.type())
+              << ", operation: " << pushMsg.operation() << ", roomId: " << pushMsg.room()
+              << ", keys: " << pushMsg.keys_size() << ", attempts: " << pushMsg.attempts()
+              << ", server: " << pushMsg.server();
+
+    // 旧版本 logic 把房间消息标记为 PUSH 且不带 keys, 仍按房间推送
+    bool to_keys = pushMsg.type() == ChatRoom::Job::PushMsg_Type_PUSH && pushMsg.keys_size() > 0;
+    bool to_room = !to_keys && (pushMsg.type() == ChatRoom::Job::PushMsg_Type_PUSH ||
+                                pushMsg.type() == ChatRoom::Job::PushMsg_Type_ROOM);
+    if (!to_keys && !to_room && pushMsg.type() != ChatRoom::Job::PushMsg_Type_BROADCAST) {
+        LOG_ERROR << "Unknown message type: " << pushMsg.type();
+        onPushDone(tag, true);
+        return;
+    }
+
+    CometManager& manager = CometManager::getInstance();
+    std::vector<size_t> comets;
+    std::vector<std::vector<std::string>> comet_keys;   // to_keys: users of every target comet
+    int target = pushMsg.server().empty() ? -1 : manager.router().indexOf(pushMsg.server());
+    if (target >= 0) {
+        comets.push_back(static_cast<size_t>(target));
+        if (to_keys) {
+            comet_keys.emplace_back(pushMsg.keys().begin(), pushMsg.keys().end());
+        }
+    }
+    else if (to_keys) {
+        std::vector<std::pair<size_t, std::vector<std::string>>> users;
+        manager.router().routeUsers(std::vector<std::string>(pushMsg.keys().begin(), pushMsg.keys().end()), users);
+        for (auto& comet_users : users) {
+            comets.push_back(comet_users.first);
+            comet_keys.push_back(std::move(comet_users.second));
+        }
+    }
+    else if (to_room) {
+        manager.router().route(pushMsg.room(), comets);
+    }
+    else {
+        for (size_t i = 0; i < manager.size(); i++) {
+            comets.push_back(i);
+        }
+    }
+    // 用户都不在线
+    if (comets.empty()) {
+        onPushDone(tag, true);
+        return;
+    }
+    if (tag.tracker) {
+        tag.tracker->expect(tag.partition, tag.offset, static_cast<int>(comets.size()));
+    }
+
+    std::vector<PushTag> tags;
+    for (size_t i : comets) {
+        tags.push_back(tag);
+        tags.back().comet = static_cast<int32_t>(i);
+    }
+
+    // 长连接通道: 只入队, 由各 comet 的发送线程攒批推送, 流内有序
+    if (manager.getPushStream(0)) {
+        for (size_t k = 0; k < comets.size(); k++) {
+            CometPushStream* stream = manager.getPushStream(comets[k]);
+            if (to_keys) {
+                stream->pushKeys(comet_keys[k], pushMsg.operation(), pushMsg.msg(), tags[k]);
+            } else if (to_room) {
+                stream->push(pushMsg.room(), 4, pushMsg.msg(), tags[k]);
+            } else {
+                stream->push("", pushMsg.operation(), pushMsg.msg(), tags[k], pushMsg.speed());
+            }
+        }
+        return;
+    }
+
+    if (to_room) {
+        for (size_t k = 0; k < comets.size(); k++) {
+            manager.getPipeline(comets[k])->pushRoom(pushMsg.room(), pushMsg.msg(), tags[k]);
+        }
+        return;
+    }
+
+    // 全局广播(例如房间创建)之前的房间消息先发完, 之后的房间消息再进入 lane
+    // 指定用户的推送只有几个用户, 不和房间消息排序
+    // 各 comet 并行只发一次, 失败的 comet 转入重试 topic, 不在消费线程里等待重试
+    if (!to_keys) {
+        for (size_t i : comets) {
+            manager.getPipeline(i)->drain();
+        }
+    }
+    std::vector<std::future<bool>> results;
+    for (size_t k = 0; k < comets.size(); k++) {
+        CometClient* client = manager.getClient(comets[k]);
+        const std::vector<std::string>* keys = to_keys ? &comet_keys[k] : nullptr;
+        results.push_back(std::async(std::launch::async, [client, keys, &pushMsg]() {
+            if (keys) {
+                return client->pushKeys(*keys, pushMsg.operation(), pushMsg.msg(), 1);
+            }
+            return client->broadcast(pushMsg.operation(), pushMsg.msg(), 1, pushMsg.speed());
+        }));
+    }
+    for (size_t k = 0; k < comets.size(); k++) {
+        bool success = results[k].get();
+        if (!success) {
+            LOG_ERROR << "Failed to push message to comet " << manager.server(comets[k]);
+        }
+        onPushDone(tags[k], success);
+    }
+}
+
 int main() {
     EventLoop loop;
+    // 消费线程只做批量拉取和分发, 推送由 PushStream 或流水线的 lane 线程完成
     ThreadPool threadPool("KafkaThreadPool");
-    threadPool.start(4);
+    threadPool.start(1);
 
     // 从配置文件读取Kafka配置
     CConfigFileReader config_reader("job.conf");
     const char* brokers_c = config_reader.GetConfigName("kafka_brokers");
     const char* topic_c = config_reader.GetConfigName("kafka_topic");
+    const char* consume_batch_c = config_reader.GetConfigName("kafka_consume_batch");
+    const char* commit_interval_c = config_reader.GetConfigName("kafka_commit_interval_ms");
+    const char* commit_every_c = config_reader.GetConfigName("kafka_commit_every");
     std::string kafka_brokers = brokers_c ? brokers_c : "localhost:9092";
     std::string kafka_topic = topic_c ? topic_c : "my-topic";
+    size_t consume_batch = consume_batch_c ? static_cast<size_t>(std::max(atoi(consume_batch_c), 1)) : 256;
+    int commit_interval_ms = commit_interval_c ? std::max(atoi(commit_interval_c), 1) : 1000;
+    size_t commit_every = commit_every_c ? static_cast<size_t>(std::max(atoi(commit_every_c), 1)) : 1000;
+
+    // 重试 topic 为空时不重试, 失败的推送记录日志后放弃
+    RetryOptions retry_options;
+    const char* retry_topic_c = config_reader.GetConfigName("kafka_retry_topic");
+    retry_options.topic = retry_topic_c ? retry_topic_c : kafka_topic + "-retry";
+    if (const char* v = config_reader.GetConfigName("kafka_retry_max_attempts")) {
+        retry_options.max_attempts = atoi(v);
+    }
+    if (const char* v = config_reader.GetConfigName("kafka_retry_backoff_ms")) {
+        retry_options.backoff_ms = atoi(v);
+    }
+    if (const char* v = config_reader.GetConfigName("kafka_retry_max_backoff_ms")) {
+        retry_options.max_backoff_ms = atoi(v);
+    }
+    retry_options.commit_interval_ms = commit_interval_ms;
 
     LOG_INFO << "Initializing Kafka consumer with brokers: " << kafka_brokers << ", topic: " << kafka_topic;
 
@@ -180,48 +525,37 @@ int main() {
         return -1;
     }
 
-    // 处理消息
+    std::unique_ptr<RetryWorker> retry_worker;
+    if (!retry_options.topic.empty()) {
+        retry_worker = std::make_unique<RetryWorker>(kafka_brokers, "my_consumer_group-retry", retry_options);
+        if (retry_worker->start(dispatchPushMsg)) {
+            g_retry_worker = retry_worker.get();
+        }
+    }
+
+    // 先连上所有 comet 并取得一次房间分布
+    CometManager::getInstance().size();
+
+    // 处理消息: offset 在推送完成后才可提交, 每 commit_every 条或 commit_interval_ms 异步提交一次
+    OffsetTracker tracker;
     threadPool.run([&]() {
+        std::vector<KafkaMessage> messages;
+        size_t since_commit = 0;
+        auto last_commit = std::chrono::steady_clock::now();
         while (true) {
-            std::string message = consumer.consume();
-            if (!message.empty()) {
-                ChatRoom::Job::PushMsg pushMsg;
-                if (pushMsg.ParseFromString(message)) {
-                    LOG_INFO << "Received PushMsg:";
-                    LOG_INFO << "  Type: " << ChatRoom::Job::PushMsg_Type_Name(pushMsg.type());
-                    LOG_INFO << "  Operation: " << pushMsg.operation();
-                    LOG_INFO << "  roomId: " << pushMsg.room();
-                    LOG_INFO << "  msg: " << pushMsg.msg();
-                    // 获取chatroom的客户端并根据消息类型发送消息
-                    auto client = CometManager::getInstance().getClient();
-                    if (client) {
-                        bool success = false;
-                        
-                        // 根据消息类型选择不同的广播方式
-                        if (pushMsg.type() == ChatRoom::Job::PushMsg_Type_BROADCAST) {
-                            // 全局广播
-                            LOG_INFO << "Processing BROADCAST message";
-                            success = client->broadcast(pushMsg.msg());
-                            if (!success) {
-                                LOG_ERROR << "Failed to broadcast message globally";
-                            }
-                        } else if (pushMsg.type() == ChatRoom::Job::PushMsg_Type_PUSH || 
-                                   pushMsg.type() == ChatRoom::Job::PushMsg_Type_ROOM) {
-                            // 房间内广播
-                            LOG_INFO << "Processing ROOM/PUSH message to room: " << pushMsg.room();
-                            success = client->broadcastRoom(pushMsg.room(), pushMsg.msg());
-                            if (!success) {
-                                LOG_ERROR << "Failed to broadcast message to room: " << pushMsg.room();
-                            }
-                        } else {
-                            LOG_ERROR << "Unknown message type: " << pushMsg.type();
-                        }
-                    } else {
-                        LOG_ERROR << "Failed to get comet client";
-                    }
-                } else {
-                    LOG_ERROR << "Failed to parse message as PushMsg";
-                }
+            messages.clear();
+            consumer.consumeBatch(messages, consume_batch, commit_interval_ms);
+            for (const auto& message : messages) {
+                PushTag tag = tracker.track(message.partition, message.offset, message.payload);
+                dispatchPushMsg(message.payload, tag);
+            }
+
+            since_commit += messages.size();
+            auto now = std::chrono::steady_clock::now();
+            if (since_commit >= commit_every || now - last_commit >= std::chrono::milliseconds(commit_interval_ms)) {
+                consumer.commitAsync(tracker.takeCommits());
+                since_commit = 0;
+                last_commit = now;
             }
         }
     });
@@ -44,6 +44,7 @@ class Buffer : public muduo::copyable
  public:
   static const size_t kCheapPrepend = 8;
   static const size_t kInitialSize = 1024;
+  static const size_t kExtraBufSize = 65536;
 
   explicit Buffer(size_t initialSize = kInitialSize)
     : buffer_(kCheapPrepend + initialSize),
@@ -379,6 +380,13 @@ class Buffer : public muduo::copyable
   /// @return result of read(2), @c errno is saved
   ssize_t readFd(int fd, int* savedErrno);
 
+  /// Bytes one readFd() takes at most, a shorter read emptied the socket.
+  size_t readFdCapacity() const
+  {
+    const size_t writable = writableBytes();
+    return writable < kExtraBufSize ? writable + kExtraBufSize : writable;
+  }
+
  private:
 
   char* begin()
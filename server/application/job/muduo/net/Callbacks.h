@@ -60,6 +60,8 @@ namespace net
 class Buffer;
 class TcpConnection;
 typedef std::shared_ptr<TcpConnection> TcpConnectionPtr;
+// immutable bytes shared by many connections, e.g. one encoded broadcast frame
+typedef std::shared_ptr<const string> SharedBytesPtr;
 typedef std::function<void()> TimerCallback;
 typedef std::function<void (const TcpConnectionPtr&)> ConnectionCallback;
 typedef std::function<void (const TcpConnectionPtr&)> CloseCallback;
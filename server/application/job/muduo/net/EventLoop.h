@@ -104,6 +104,10 @@ class EventLoop : noncopyable
   void updateChannel(Channel* channel);
   void removeChannel(Channel* channel);
   bool hasChannel(Channel* channel);
+  // see Poller::supportsEdgeTriggered()
+  bool supportsEdgeTriggered() const;
+  // see Poller::submitSend()
+  bool submitSend(int fd, const void* data, size_t len, const TcpConnectionPtr& conn);
 
   // pid_t threadId() const { return threadId_; }
   void assertInLoopThread()
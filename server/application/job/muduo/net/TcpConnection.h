@@ -18,6 +18,7 @@
 #include "muduo/net/Buffer.h"
 #include "muduo/net/InetAddress.h"
 
+#include <deque>
 #include <memory>
 
 #include <any>
@@ -42,6 +43,8 @@ class TcpConnection : noncopyable,
                       public std::enable_shared_from_this<TcpConnection>
 {
  public:
+  static const size_t kDefaultEdgeBudget = 256 * 1024;
+
   /// Constructs a TcpConnection with a connected sockfd
   ///
   /// User should not create this object.
@@ -67,6 +70,8 @@ class TcpConnection : noncopyable,
   void send(const StringPiece& message);
   // void send(Buffer&& message); // C++11
   void send(Buffer* message);  // this one will swap data
+  // zero copy, the connection holds a reference of message until it is written
+  void send(const SharedBytesPtr& message);
   void shutdown(); // NOT thread safe, no simultaneous calling
   // void shutdownAndForceCloseAfter(double seconds); // NOT thread safe, no simultaneous calling
   void forceClose();
@@ -98,6 +103,14 @@ class TcpConnection : noncopyable,
   void setHighWaterMarkCallback(const HighWaterMarkCallback& cb, size_t highWaterMark)
   { highWaterMarkCallback_ = cb; highWaterMark_ = highWaterMark; }
 
+  /// Edge-triggered, if the loop's poller supports it: read and write interest
+  /// are registered once, every event drains the socket until EAGAIN.
+  /// At most budgetBytes are read or written per event, the rest continues
+  /// after the other ready connections of the round.
+  /// Must be called before connectEstablished().
+  void setEdgeTriggered(size_t budgetBytes = kDefaultEdgeBudget)
+  { edgeTriggered_ = true; edgeBudget_ = budgetBytes > 0 ? budgetBytes : 1; }
+
   /// Advanced interface
   Buffer* inputBuffer()
   { return &inputBuffer_; }
@@ -105,10 +118,22 @@ class TcpConnection : noncopyable,
   Buffer* outputBuffer()
   { return &outputBuffer_; }
 
+  /// bytes waiting in outputBuffer_ and the shared output queue
+  size_t pendingOutputBytes() const
+  { return outputBuffer_.readableBytes() + sharedOutputBytes_; }
+
+  /// drop queued shared messages from the oldest, which are not started to write,
+  /// until pendingOutputBytes() <= maxPendingBytes. Must be called in loop thread.
+  /// return the number of dropped messages.
+  size_t discardQueuedSharedOutput(size_t maxPendingBytes);
+
   /// Internal use only.
   void setCloseCallback(const CloseCallback& cb)
   { closeCallback_ = cb; }
 
+  /// Internal use only, result of EventLoop::submitSend(), bytes or -errno.
+  void handleSendComplete(ssize_t n);
+
   // called when TcpServer accepts a new connection
   void connectEstablished();   // should be called only once
   // called when TcpServer has removed me from its map
@@ -118,11 +143,25 @@ class TcpConnection : noncopyable,
   enum StateE { kDisconnected, kConnecting, kConnected, kDisconnecting };
   void handleRead(Timestamp receiveTime);
   void handleWrite();
+  void handleReadEdge(Timestamp receiveTime);
+  void handleWriteEdge();
+  // continue an edge-triggered read or write cut by the budget
+  void resumeRead();
+  void resumeWrite();
+  // output is queued and waits for the socket to be writable,
+  // edge-triggered connections don't toggle the write interest
+  bool isWritingOutput() const;
+  void startWritingOutput();
+  void stopWritingOutput();
   void handleClose();
   void handleError();
   // void sendInLoop(string&& message);
   void sendInLoop(const StringPiece& message);
   void sendInLoop(const void* message, size_t len);
+  void sendSharedInLoop(const SharedBytesPtr& message);
+  ssize_t writeOutput();
+  // drops n written bytes from the front of outputBuffer_ and the shared output queue
+  void retrieveOutput(size_t n);
   void shutdownInLoop();
   // void shutdownAndForceCloseInLoop(double seconds);
   void forceCloseInLoop();
@@ -148,6 +187,20 @@ class TcpConnection : noncopyable,
   size_t highWaterMark_;
   Buffer inputBuffer_;
   Buffer outputBuffer_; // FIXME: use list<Buffer> as output buffer.
+  // written after outputBuffer_, nothing is appended to outputBuffer_ while not empty
+  struct SharedOutput
+  {
+    SharedBytesPtr data;
+    bool discardable;  // sent by send(SharedBytesPtr), may be dropped before written
+  };
+  std::deque<SharedOutput> sharedOutput_;
+  size_t sharedOutputOffset_;  // written bytes of sharedOutput_.front()
+  size_t sharedOutputBytes_;
+  // sharedOutput_.front() is being sent by the poller, nothing else writes meanwhile
+  bool sendSubmitted_;
+  bool edgeTriggered_;
+  size_t edgeBudget_;
+  bool awaitingWrite_;  // edge-triggered isWritingOutput()
   std::any context_;
   // FIXME: creationTime_, lastReceiveTime_
   //        bytesReceived_, bytesSent_
@@ -8,6 +8,7 @@
 
 #include "muduo/net/TcpServer.h"
 
+#include "muduo/base/CountDownLatch.h"
 #include "muduo/base/Logging.h"
 #include "muduo/net/Acceptor.h"
 #include "muduo/net/EventLoop.h"
@@ -26,14 +27,21 @@ TcpServer::TcpServer(EventLoop* loop,
   : loop_(CHECK_NOTNULL(loop)),
     ipPort_(listenAddr.toIpPort()),
     name_(nameArg),
-    acceptor_(new Acceptor(loop, listenAddr, option == kReusePort)),
+    listenAddr_(listenAddr),
+    option_(option),
     threadPool_(new EventLoopThreadPool(loop, name_)),
     connectionCallback_(defaultConnectionCallback),
     messageCallback_(defaultMessageCallback),
-    nextConnId_(1)
+    edgeTriggered_(false),
+    edgeBudget_(TcpConnection::kDefaultEdgeBudget)
 {
-  acceptor_->setNewConnectionCallback(
-      std::bind(&TcpServer::newConnection, this, _1, _2));
+  nextConnId_.getAndSet(1);
+  if (option_ != kReusePortPerLoop)
+  {
+    acceptor_.reset(new Acceptor(loop, listenAddr, option == kReusePort));
+    acceptor_->setNewConnectionCallback(
+        std::bind(&TcpServer::newConnection, this, _1, _2));
+  }
 }
 
 TcpServer::~TcpServer()
@@ -41,6 +49,18 @@ TcpServer::~TcpServer()
   loop_->assertInLoopThread();
   LOG_TRACE << "TcpServer::~TcpServer [" << name_ << "] destructing";
 
+  // an Acceptor unregisters its channel, so it's destroyed in its own loop
+  for (auto& item : loopAcceptors_)
+  {
+    Acceptor* acceptor = item.second.release();
+    CountDownLatch latch(1);
+    item.first->runInLoop([acceptor, &latch]() {
+      delete acceptor;
+      latch.countDown();
+    });
+    latch.wait();
+  }
+
   for (auto& item : connections_)
   {
     TcpConnectionPtr conn(item.second);
@@ -62,6 +82,22 @@ void TcpServer::start()
   {
     threadPool_->start(threadInitCallback_);
 
+    if (option_ == kReusePortPerLoop)
+    {
+      // the base loop when there is no io thread
+      for (EventLoop* ioLoop : threadPool_->getAllLoops())
+      {
+        Acceptor* acceptor = new Acceptor(ioLoop, listenAddr_, true);
+        acceptor->setNewConnectionCallback(
+            std::bind(&TcpServer::newConnectionInLoop, this, ioLoop, _1, _2));
+        loopAcceptors_.emplace_back(ioLoop, std::unique_ptr<Acceptor>(acceptor));
+        ioLoop->runInLoop(std::bind(&Acceptor::listen, acceptor));
+      }
+      LOG_INFO << "TcpServer::start [" << name_ << "] - " << loopAcceptors_.size()
+               << " SO_REUSEPORT acceptors on " << ipPort_;
+      return;
+    }
+
     assert(!acceptor_->listening());
     loop_->runInLoop(
         std::bind(&Acceptor::listen, get_pointer(acceptor_)));
@@ -72,9 +108,26 @@ void TcpServer::newConnection(int sockfd, const InetAddress& peerAddr)
 {
   loop_->assertInLoopThread();
   EventLoop* ioLoop = threadPool_->getNextLoop();
+  TcpConnectionPtr conn = createConnection(ioLoop, sockfd, peerAddr);
+  connections_[conn->name()] = conn;
+  ioLoop->runInLoop(std::bind(&TcpConnection::connectEstablished, conn));
+}
+
+void TcpServer::newConnectionInLoop(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr)
+{
+  ioLoop->assertInLoopThread();
+  TcpConnectionPtr conn = createConnection(ioLoop, sockfd, peerAddr);
+  // registered before the removal this loop may post later, both go through loop_ in order
+  loop_->runInLoop([this, conn]() {
+    connections_[conn->name()] = conn;
+  });
+  conn->connectEstablished();
+}
+
+TcpConnectionPtr TcpServer::createConnection(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr)
+{
   char buf[64];
-  snprintf(buf, sizeof buf, "-%s#%d", ipPort_.c_str(), nextConnId_);
-  ++nextConnId_;
+  snprintf(buf, sizeof buf, "-%s#%d", ipPort_.c_str(), nextConnId_.getAndAdd(1));
   string connName = name_ + buf;
 
   LOG_INFO << "TcpServer::newConnection [" << name_
@@ -88,13 +141,16 @@ void TcpServer::newConnection(int sockfd, const InetAddress& peerAddr)
                                           sockfd,
                                           localAddr,
                                           peerAddr));
-  connections_[connName] = conn;
   conn->setConnectionCallback(connectionCallback_);
   conn->setMessageCallback(messageCallback_);
   conn->setWriteCompleteCallback(writeCompleteCallback_);
+  if (edgeTriggered_)
+  {
+    conn->setEdgeTriggered(edgeBudget_);
+  }
   conn->setCloseCallback(
       std::bind(&TcpServer::removeConnection, this, _1)); // FIXME: unsafe
-  ioLoop->runInLoop(std::bind(&TcpConnection::connectEstablished, conn));
+  return conn;
 }
 
 void TcpServer::removeConnection(const TcpConnectionPtr& conn)
@@ -13,9 +13,12 @@
 
 #include "muduo/base/Atomic.h"
 #include "muduo/base/Types.h"
+#include "muduo/net/InetAddress.h"
 #include "muduo/net/TcpConnection.h"
 
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace muduo
 {
@@ -38,6 +41,9 @@ class TcpServer : noncopyable
   {
     kNoReusePort,
     kReusePort,
+    /// one SO_REUSEPORT listening socket per io loop, each with its own Acceptor,
+    /// the kernel balances accepts and a connection stays on the loop that accepted it
+    kReusePortPerLoop,
   };
 
   //TcpServer(EventLoop* loop, const InetAddress& listenAddr);
@@ -89,9 +95,18 @@ class TcpServer : noncopyable
   void setWriteCompleteCallback(const WriteCompleteCallback& cb)
   { writeCompleteCallback_ = cb; }
 
+  /// Edge-triggered connections, see TcpConnection::setEdgeTriggered().
+  /// Only takes effect with EPollPoller.
+  /// Must be called before @c start
+  void setEdgeTriggered(bool on, size_t budgetBytes = TcpConnection::kDefaultEdgeBudget)
+  { edgeTriggered_ = on; edgeBudget_ = budgetBytes; }
+
  private:
   /// Not thread safe, but in loop
   void newConnection(int sockfd, const InetAddress& peerAddr);
+  /// kReusePortPerLoop, in ioLoop
+  void newConnectionInLoop(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr);
+  TcpConnectionPtr createConnection(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr);
   /// Thread safe.
   void removeConnection(const TcpConnectionPtr& conn);
   /// Not thread safe, but in loop
@@ -102,15 +117,22 @@ class TcpServer : noncopyable
   EventLoop* loop_;  // the acceptor loop
   const string ipPort_;
   const string name_;
-  std::unique_ptr<Acceptor> acceptor_; // avoid revealing Acceptor
+  const InetAddress listenAddr_;
+  const Option option_;
+  std::unique_ptr<Acceptor> acceptor_; // avoid revealing Acceptor, nullptr with kReusePortPerLoop
+  // kReusePortPerLoop, created in start(), every one lives in its io loop
+  std::vector<std::pair<EventLoop*, std::unique_ptr<Acceptor>>> loopAcceptors_;
   std::shared_ptr<EventLoopThreadPool> threadPool_;
   ConnectionCallback connectionCallback_;
   MessageCallback messageCallback_;
   WriteCompleteCallback writeCompleteCallback_;
   ThreadInitCallback threadInitCallback_;
+  bool edgeTriggered_;
+  size_t edgeBudget_;
   AtomicInt32 started_;
+  // io loops take ids concurrently with kReusePortPerLoop
+  AtomicInt32 nextConnId_;
   // always in loop thread
-  int nextConnId_;
   ConnectionMap connections_;
 };
 
@@ -11,34 +11,116 @@ namespace net
 {
 
 // input is zlib compressed data, output uncompressed data
-// FIXME: finish this
 class ZlibInputStream : noncopyable
 {
  public:
   explicit ZlibInputStream(Buffer* output)
     : output_(output),
-      zerror_(Z_OK)
+      zerror_(Z_OK),
+      bufferSize_(1024),
+      finished_(false)
   {
     memZero(&zstream_, sizeof zstream_);
     zerror_ = inflateInit(&zstream_);
   }
 
+  // windowBits < 0 for raw deflate data without zlib header, e.g. -15
+  ZlibInputStream(Buffer* output, int windowBits)
+    : output_(output),
+      zerror_(Z_OK),
+      bufferSize_(1024),
+      finished_(false)
+  {
+    memZero(&zstream_, sizeof zstream_);
+    zerror_ = inflateInit2(&zstream_, windowBits);
+  }
+
   ~ZlibInputStream()
   {
     finish();
   }
 
-  bool write(StringPiece buf);
-  bool write(Buffer* input);
-  bool finish();
-    // inflateEnd(&zstream_);
+  const char* zlibErrorMessage() const { return zstream_.msg; }
+  int zlibErrorCode() const { return zerror_; }
+  int64_t inputBytes() const { return zstream_.total_in; }
+  int64_t outputBytes() const { return zstream_.total_out; }
+
+  // decompress all of buf, fails if the output of this call exceeds maxOutput
+  bool write(StringPiece buf, size_t maxOutput = SIZE_MAX)
+  {
+    if (zerror_ != Z_OK)
+      return false;
+
+    void* in = const_cast<char*>(buf.data());
+    zstream_.next_in = static_cast<Bytef*>(in);
+    zstream_.avail_in = buf.size();
+    size_t oldLen = output_->readableBytes();
+    while (zerror_ == Z_OK)
+    {
+      zerror_ = decompress(Z_SYNC_FLUSH);
+      if (output_->readableBytes() - oldLen > maxOutput)
+      {
+        zerror_ = Z_DATA_ERROR;
+        break;
+      }
+      // all input consumed and all output flushed
+      if (zstream_.avail_in == 0 && zstream_.avail_out != 0)
+        break;
+    }
+    // no more progress after all input consumed is not an error
+    if (zerror_ == Z_BUF_ERROR && zstream_.avail_in == 0)
+      zerror_ = Z_OK;
+    zstream_.next_in = NULL;
+    zstream_.avail_in = 0;
+    // Z_STREAM_END: the stream is complete, reset() before next write()
+    return zerror_ == Z_OK || zerror_ == Z_STREAM_END;
+  }
+
+  bool write(Buffer* input)
+  {
+    bool ok = write(StringPiece(input->peek(), static_cast<int>(input->readableBytes())));
+    input->retrieveAll();
+    return ok;
+  }
+
+  // drop the sliding window, next write() starts a new stream
+  bool reset()
+  {
+    if (finished_)
+      return false;
+    zerror_ = inflateReset(&zstream_);
+    return zerror_ == Z_OK;
+  }
+
+  bool finish()
+  {
+    if (finished_)
+      return zerror_ == Z_OK;
+    finished_ = true;
+    zerror_ = inflateEnd(&zstream_);
+    return zerror_ == Z_OK;
+  }
 
  private:
-  int decompress(int flush);
+  int decompress(int flush)
+  {
+    output_->ensureWritableBytes(bufferSize_);
+    zstream_.next_out = reinterpret_cast<Bytef*>(output_->beginWrite());
+    zstream_.avail_out = static_cast<int>(output_->writableBytes());
+    int error = ::inflate(&zstream_, flush);
+    output_->hasWritten(output_->writableBytes() - zstream_.avail_out);
+    if (output_->writableBytes() == 0 && bufferSize_ < 65536)
+    {
+      bufferSize_ *= 2;
+    }
+    return error;
+  }
 
   Buffer* output_;
   z_stream zstream_;
   int zerror_;
+  int bufferSize_;
+  bool finished_;
 };
 
 // input is uncompressed data, output zlib compressed data
@@ -54,6 +136,16 @@ class ZlibOutputStream : noncopyable
     zerror_ = deflateInit(&zstream_, Z_DEFAULT_COMPRESSION);
   }
 
+  // windowBits < 0 for raw deflate data without zlib header, e.g. -15
+  ZlibOutputStream(Buffer* output, int level, int windowBits)
+    : output_(output),
+      zerror_(Z_OK),
+      bufferSize_(1024)
+  {
+    memZero(&zstream_, sizeof zstream_);
+    zerror_ = deflateInit2(&zstream_, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY);
+  }
+
   ~ZlibOutputStream()
   {
     finish();
@@ -105,6 +197,31 @@ class ZlibOutputStream : noncopyable
     return zerror_ == Z_OK;
   }
 
+  // flush all pending output on a byte boundary, ends with 00 00 ff ff
+  bool flush()
+  {
+    if (zerror_ != Z_OK)
+      return false;
+
+    do
+    {
+      zerror_ = compress(Z_SYNC_FLUSH);
+    } while (zerror_ == Z_OK && zstream_.avail_out == 0);
+    // no more progress is not an error
+    if (zerror_ == Z_BUF_ERROR)
+      zerror_ = Z_OK;
+    return zerror_ == Z_OK;
+  }
+
+  // drop the sliding window, the stream can be used for a new message
+  bool reset()
+  {
+    if (zerror_ != Z_OK)
+      return false;
+    zerror_ = deflateReset(&zstream_);
+    return zerror_ == Z_OK;
+  }
+
   bool finish()
   {
     if (zerror_ != Z_OK)
@@ -26,7 +26,10 @@ static const char* Comet_method_names[] = {
   "/ChatRoom.Comet.Comet/PushMsg",
   "/ChatRoom.Comet.Comet/Broadcast",
   "/ChatRoom.Comet.Comet/BroadcastRoom",
+  "/ChatRoom.Comet.Comet/BroadcastRoomBatch",
   "/ChatRoom.Comet.Comet/Rooms",
+  "/ChatRoom.Comet.Comet/Users",
+  "/ChatRoom.Comet.Comet/PushStream",
 };
 
 std::unique_ptr< Comet::Stub> Comet::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -39,7 +42,10 @@ Comet::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, con
   : channel_(channel), rpcmethod_PushMsg_(Comet_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Broadcast_(Comet_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_BroadcastRoom_(Comet_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Rooms_(Comet_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_BroadcastRoomBatch_(Comet_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Rooms_(Comet_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Users_(Comet_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_PushStream_(Comet_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   {}
 
 ::grpc::Status Comet::Stub::PushMsg(::grpc::ClientContext* context, const ::ChatRoom::Comet::PushMsgReq& request, ::ChatRoom::Comet::PushMsgReply* response) {
@@ -111,6 +117,29 @@ void Comet::Stub::async::BroadcastRoom(::grpc::ClientContext* context, const ::C
   return result;
 }
 
+::grpc::Status Comet::Stub::BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_BroadcastRoomBatch_, context, request, response);
+}
+
+void Comet::Stub::async::BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_BroadcastRoomBatch_, context, request, response, std::move(f));
+}
+
+void Comet::Stub::async::BroadcastRoomBatch(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_BroadcastRoomBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>* Comet::Stub::PrepareAsyncBroadcastRoomBatchRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Comet::BroadcastRoomBatchReply, ::ChatRoom::Comet::BroadcastRoomBatchReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_BroadcastRoomBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::BroadcastRoomBatchReply>* Comet::Stub::AsyncBroadcastRoomBatchRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncBroadcastRoomBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status Comet::Stub::Rooms(::grpc::ClientContext* context, const ::ChatRoom::Comet::RoomsReq& request, ::ChatRoom::Comet::RoomsReply* response) {
   return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Comet::RoomsReq, ::ChatRoom::Comet::RoomsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Rooms_, context, request, response);
 }
@@ -134,6 +163,45 @@ void Comet::Stub::async::Rooms(::grpc::ClientContext* context, const ::ChatRoom:
   return result;
 }
 
+::grpc::Status Comet::Stub::Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::ChatRoom::Comet::UsersReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Users_, context, request, response);
+}
+
+void Comet::Stub::async::Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Users_, context, request, response, std::move(f));
+}
+
+void Comet::Stub::async::Users(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Users_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>* Comet::Stub::PrepareAsyncUsersRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ChatRoom::Comet::UsersReply, ::ChatRoom::Comet::UsersReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Users_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ChatRoom::Comet::UsersReply>* Comet::Stub::AsyncUsersRaw(::grpc::ClientContext* context, const ::ChatRoom::Comet::UsersReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncUsersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* Comet::Stub::PushStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>::Create(channel_.get(), rpcmethod_PushStream_, context);
+}
+
+void Comet::Stub::async::PushStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::ChatRoom::Comet::PushBatch,::ChatRoom::Comet::PushAck>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::ChatRoom::Comet::PushBatch,::ChatRoom::Comet::PushAck>::Create(stub_->channel_.get(), stub_->rpcmethod_PushStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* Comet::Stub::AsyncPushStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>::Create(channel_.get(), cq, rpcmethod_PushStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>* Comet::Stub::PrepareAsyncPushStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>::Create(channel_.get(), cq, rpcmethod_PushStream_, context, false, nullptr);
+}
+
 Comet::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       Comet_method_names[0],
@@ -168,6 +236,16 @@ Comet::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       Comet_method_names[3],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Comet::Service, ::ChatRoom::Comet::BroadcastRoomBatchReq, ::ChatRoom::Comet::BroadcastRoomBatchReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Comet::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Comet::BroadcastRoomBatchReq* req,
+             ::ChatRoom::Comet::BroadcastRoomBatchReply* resp) {
+               return service->BroadcastRoomBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Comet_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< Comet::Service, ::ChatRoom::Comet::RoomsReq, ::ChatRoom::Comet::RoomsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](Comet::Service* service,
              ::grpc::ServerContext* ctx,
@@ -175,6 +253,26 @@ Comet::Service::Service() {
              ::ChatRoom::Comet::RoomsReply* resp) {
                return service->Rooms(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Comet_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Comet::Service, ::ChatRoom::Comet::UsersReq, ::ChatRoom::Comet::UsersReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Comet::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ChatRoom::Comet::UsersReq* req,
+             ::ChatRoom::Comet::UsersReply* resp) {
+               return service->Users(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Comet_method_names[6],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< Comet::Service, ::ChatRoom::Comet::PushBatch, ::ChatRoom::Comet::PushAck>(
+          [](Comet::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::ChatRoom::Comet::PushAck,
+             ::ChatRoom::Comet::PushBatch>* stream) {
+               return service->PushStream(ctx, stream);
+             }, this)));
 }
 
 Comet::Service::~Service() {
@@ -201,6 +299,13 @@ Comet::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status Comet::Service::BroadcastRoomBatch(::grpc::ServerContext* context, const ::ChatRoom::Comet::BroadcastRoomBatchReq* request, ::ChatRoom::Comet::BroadcastRoomBatchReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status Comet::Service::Rooms(::grpc::ServerContext* context, const ::ChatRoom::Comet::RoomsReq* request, ::ChatRoom::Comet::RoomsReply* response) {
   (void) context;
   (void) request;
@@ -208,6 +313,19 @@ Comet::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status Comet::Service::Users(::grpc::ServerContext* context, const ::ChatRoom::Comet::UsersReq* request, ::ChatRoom::Comet::UsersReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Comet::Service::PushStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::ChatRoom::Comet::PushAck, ::ChatRoom::Comet::PushBatch>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace ChatRoom
 }  // namespace Comet
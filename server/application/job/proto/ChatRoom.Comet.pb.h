@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -24,7 +24,6 @@
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_bases.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -47,14 +46,6 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_ChatRoom_2eComet_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[9]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ChatRoom_2eComet_2eproto;
@@ -66,12 +57,27 @@ extern BroadcastReplyDefaultTypeInternal _BroadcastReply_default_instance_;
 class BroadcastReq;
 struct BroadcastReqDefaultTypeInternal;
 extern BroadcastReqDefaultTypeInternal _BroadcastReq_default_instance_;
+class BroadcastRoomBatchReply;
+struct BroadcastRoomBatchReplyDefaultTypeInternal;
+extern BroadcastRoomBatchReplyDefaultTypeInternal _BroadcastRoomBatchReply_default_instance_;
+class BroadcastRoomBatchReq;
+struct BroadcastRoomBatchReqDefaultTypeInternal;
+extern BroadcastRoomBatchReqDefaultTypeInternal _BroadcastRoomBatchReq_default_instance_;
 class BroadcastRoomReply;
 struct BroadcastRoomReplyDefaultTypeInternal;
 extern BroadcastRoomReplyDefaultTypeInternal _BroadcastRoomReply_default_instance_;
 class BroadcastRoomReq;
 struct BroadcastRoomReqDefaultTypeInternal;
 extern BroadcastRoomReqDefaultTypeInternal _BroadcastRoomReq_default_instance_;
+class PushAck;
+struct PushAckDefaultTypeInternal;
+extern PushAckDefaultTypeInternal _PushAck_default_instance_;
+class PushBatch;
+struct PushBatchDefaultTypeInternal;
+extern PushBatchDefaultTypeInternal _PushBatch_default_instance_;
+class PushItem;
+struct PushItemDefaultTypeInternal;
+extern PushItemDefaultTypeInternal _PushItem_default_instance_;
 class PushMsgReply;
 struct PushMsgReplyDefaultTypeInternal;
 extern PushMsgReplyDefaultTypeInternal _PushMsgReply_default_instance_;
@@ -87,18 +93,31 @@ extern RoomsReply_RoomsEntry_DoNotUseDefaultTypeInternal _RoomsReply_RoomsEntry_
 class RoomsReq;
 struct RoomsReqDefaultTypeInternal;
 extern RoomsReqDefaultTypeInternal _RoomsReq_default_instance_;
+class UsersReply;
+struct UsersReplyDefaultTypeInternal;
+extern UsersReplyDefaultTypeInternal _UsersReply_default_instance_;
+class UsersReq;
+struct UsersReqDefaultTypeInternal;
+extern UsersReqDefaultTypeInternal _UsersReq_default_instance_;
 }  // namespace Comet
 }  // namespace ChatRoom
 PROTOBUF_NAMESPACE_OPEN
 template<> ::ChatRoom::Comet::BroadcastReply* Arena::CreateMaybeMessage<::ChatRoom::Comet::BroadcastReply>(Arena*);
 template<> ::ChatRoom::Comet::BroadcastReq* Arena::CreateMaybeMessage<::ChatRoom::Comet::BroadcastReq>(Arena*);
+template<> ::ChatRoom::Comet::BroadcastRoomBatchReply* Arena::CreateMaybeMessage<::ChatRoom::Comet::BroadcastRoomBatchReply>(Arena*);
+template<> ::ChatRoom::Comet::BroadcastRoomBatchReq* Arena::CreateMaybeMessage<::ChatRoom::Comet::BroadcastRoomBatchReq>(Arena*);
 template<> ::ChatRoom::Comet::BroadcastRoomReply* Arena::CreateMaybeMessage<::ChatRoom::Comet::BroadcastRoomReply>(Arena*);
 template<> ::ChatRoom::Comet::BroadcastRoomReq* Arena::CreateMaybeMessage<::ChatRoom::Comet::BroadcastRoomReq>(Arena*);
+template<> ::ChatRoom::Comet::PushAck* Arena::CreateMaybeMessage<::ChatRoom::Comet::PushAck>(Arena*);
+template<> ::ChatRoom::Comet::PushBatch* Arena::CreateMaybeMessage<::ChatRoom::Comet::PushBatch>(Arena*);
+template<> ::ChatRoom::Comet::PushItem* Arena::CreateMaybeMessage<::ChatRoom::Comet::PushItem>(Arena*);
 template<> ::ChatRoom::Comet::PushMsgReply* Arena::CreateMaybeMessage<::ChatRoom::Comet::PushMsgReply>(Arena*);
 template<> ::ChatRoom::Comet::PushMsgReq* Arena::CreateMaybeMessage<::ChatRoom::Comet::PushMsgReq>(Arena*);
 template<> ::ChatRoom::Comet::RoomsReply* Arena::CreateMaybeMessage<::ChatRoom::Comet::RoomsReply>(Arena*);
 template<> ::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse* Arena::CreateMaybeMessage<::ChatRoom::Comet::RoomsReply_RoomsEntry_DoNotUse>(Arena*);
 template<> ::ChatRoom::Comet::RoomsReq* Arena::CreateMaybeMessage<::ChatRoom::Comet::RoomsReq>(Arena*);
+template<> ::ChatRoom::Comet::UsersReply* Arena::CreateMaybeMessage<::ChatRoom::Comet::UsersReply>(Arena*);
+template<> ::ChatRoom::Comet::UsersReq* Arena::CreateMaybeMessage<::ChatRoom::Comet::UsersReq>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace ChatRoom {
 namespace Comet {
@@ -110,7 +129,7 @@ class PushMsgReq final :
  public:
   inline PushMsgReq() : PushMsgReq(nullptr) {}
   ~PushMsgReq() override;
-  explicit constexpr PushMsgReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR PushMsgReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PushMsgReq(const PushMsgReq& from);
   PushMsgReq(PushMsgReq&& from) noexcept
@@ -185,9 +204,11 @@ class PushMsgReq final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PushMsgReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const PushMsgReq& from);
+  void MergeFrom( const PushMsgReq& from) {
+    PushMsgReq::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -196,10 +217,10 @@ class PushMsgReq final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PushMsgReq* other);
@@ -212,9 +233,6 @@ class PushMsgReq final :
   protected:
   explicit PushMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -289,10 +307,13 @@ class PushMsgReq final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
-  ::ChatRoom::Protocol::Proto* proto_;
-  int32_t protoop_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::ChatRoom::Protocol::Proto* proto_;
+    int32_t protoop_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
 };
 // -------------------------------------------------------------------
@@ -301,7 +322,7 @@ class PushMsgReply final :
     public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.PushMsgReply) */ {
  public:
   inline PushMsgReply() : PushMsgReply(nullptr) {}
-  explicit constexpr PushMsgReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR PushMsgReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PushMsgReply(const PushMsgReply& from);
   PushMsgReply(PushMsgReply&& from) noexcept
@@ -375,11 +396,11 @@ class PushMsgReply final :
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
   inline void CopyFrom(const PushMsgReply& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(this, from);
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
   void MergeFrom(const PushMsgReply& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(this, from);
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
   public:
 
@@ -391,7 +412,6 @@ class PushMsgReply final :
   protected:
   explicit PushMsgReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
   public:
 
   static const ClassData _class_data_;
@@ -410,7 +430,8 @@ class PushMsgReply final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+  };
   friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
 };
 // -------------------------------------------------------------------
@@ -420,7 +441,7 @@ class BroadcastReq final :
  public:
   inline BroadcastReq() : BroadcastReq(nullptr) {}
   ~BroadcastReq() override;
-  explicit constexpr BroadcastReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR BroadcastReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BroadcastReq(const BroadcastReq& from);
   BroadcastReq(BroadcastReq&& from) noexcept
@@ -495,9 +516,11 @@ class BroadcastReq final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BroadcastReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const BroadcastReq& from);
+  void MergeFrom( const BroadcastReq& from) {
+    BroadcastReq::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -506,10 +529,10 @@ class BroadcastReq final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BroadcastReq* other);
@@ -522,9 +545,6 @@ class BroadcastReq final :
   protected:
   explicit BroadcastReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -584,10 +604,13 @@ class BroadcastReq final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::ChatRoom::Protocol::Proto* proto_;
-  int32_t protoop_;
-  int32_t speed_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::ChatRoom::Protocol::Proto* proto_;
+    int32_t protoop_;
+    int32_t speed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
 };
 // -------------------------------------------------------------------
@@ -596,7 +619,7 @@ class BroadcastReply final :
     public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.BroadcastReply) */ {
  public:
   inline BroadcastReply() : BroadcastReply(nullptr) {}
-  explicit constexpr BroadcastReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR BroadcastReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BroadcastReply(const BroadcastReply& from);
   BroadcastReply(BroadcastReply&& from) noexcept
@@ -670,11 +693,11 @@ class BroadcastReply final :
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
   inline void CopyFrom(const BroadcastReply& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(this, from);
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
   void MergeFrom(const BroadcastReply& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(this, from);
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
   public:
 
@@ -686,7 +709,6 @@ class BroadcastReply final :
   protected:
   explicit BroadcastReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
   public:
 
   static const ClassData _class_data_;
@@ -705,7 +727,8 @@ class BroadcastReply final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+  };
   friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
 };
 // -------------------------------------------------------------------
@@ -715,7 +738,7 @@ class BroadcastRoomReq final :
  public:
   inline BroadcastRoomReq() : BroadcastRoomReq(nullptr) {}
   ~BroadcastRoomReq() override;
-  explicit constexpr BroadcastRoomReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR BroadcastRoomReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BroadcastRoomReq(const BroadcastRoomReq& from);
   BroadcastRoomReq(BroadcastRoomReq&& from) noexcept
@@ -790,9 +813,11 @@ class BroadcastRoomReq final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BroadcastRoomReq& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const BroadcastRoomReq& from);
+  void MergeFrom( const BroadcastRoomReq& from) {
+    BroadcastRoomReq::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -801,10 +826,10 @@ class BroadcastRoomReq final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BroadcastRoomReq* other);
@@ -817,9 +842,6 @@ class BroadcastRoomReq final :
   protected:
   explicit BroadcastRoomReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -874,9 +896,12 @@ class BroadcastRoomReq final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr roomid_;
-  ::ChatRoom::Protocol::Proto* proto_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr roomid_;
+    ::ChatRoom::Protocol::Proto* proto_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
 };
 // -------------------------------------------------------------------
@@ -885,7 +910,7 @@ class BroadcastRoomReply final :
     public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.BroadcastRoomReply) */ {
  public:
   inline BroadcastRoomReply() : BroadcastRoomReply(nullptr) {}
-  explicit constexpr BroadcastRoomReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR BroadcastRoomReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BroadcastRoomReply(const BroadcastRoomReply& from);
   BroadcastRoomReply(BroadcastRoomReply&& from) noexcept
@@ -959,11 +984,11 @@ class BroadcastRoomReply final :
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
   inline void CopyFrom(const BroadcastRoomReply& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(this, from);
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
   void MergeFrom(const BroadcastRoomReply& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(this, from);
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
   public:
 
@@ -975,7 +1000,6 @@ class BroadcastRoomReply final :
   protected:
   explicit BroadcastRoomReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
   public:
 
   static const ClassData _class_data_;
@@ -994,28 +1018,30 @@ class BroadcastRoomReply final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+  };
   friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomsReq final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.RoomsReq) */ {
+class BroadcastRoomBatchReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.BroadcastRoomBatchReq) */ {
  public:
-  inline RoomsReq() : RoomsReq(nullptr) {}
-  explicit constexpr RoomsReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BroadcastRoomBatchReq() : BroadcastRoomBatchReq(nullptr) {}
+  ~BroadcastRoomBatchReq() override;
+  explicit PROTOBUF_CONSTEXPR BroadcastRoomBatchReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RoomsReq(const RoomsReq& from);
-  RoomsReq(RoomsReq&& from) noexcept
-    : RoomsReq() {
+  BroadcastRoomBatchReq(const BroadcastRoomBatchReq& from);
+  BroadcastRoomBatchReq(BroadcastRoomBatchReq&& from) noexcept
+    : BroadcastRoomBatchReq() {
     *this = ::std::move(from);
   }
 
-  inline RoomsReq& operator=(const RoomsReq& from) {
+  inline BroadcastRoomBatchReq& operator=(const BroadcastRoomBatchReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RoomsReq& operator=(RoomsReq&& from) noexcept {
+  inline BroadcastRoomBatchReq& operator=(BroadcastRoomBatchReq&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1038,20 +1064,20 @@ class RoomsReq final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const RoomsReq& default_instance() {
+  static const BroadcastRoomBatchReq& default_instance() {
     return *internal_default_instance();
   }
-  static inline const RoomsReq* internal_default_instance() {
-    return reinterpret_cast<const RoomsReq*>(
-               &_RoomsReq_default_instance_);
+  static inline const BroadcastRoomBatchReq* internal_default_instance() {
+    return reinterpret_cast<const BroadcastRoomBatchReq*>(
+               &_BroadcastRoomBatchReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(RoomsReq& a, RoomsReq& b) {
+  friend void swap(BroadcastRoomBatchReq& a, BroadcastRoomBatchReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(RoomsReq* other) {
+  inline void Swap(BroadcastRoomBatchReq* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1064,7 +1090,7 @@ class RoomsReq final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RoomsReq* other) {
+  void UnsafeArenaSwap(BroadcastRoomBatchReq* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1072,28 +1098,41 @@ class RoomsReq final :
 
   // implements Message ----------------------------------------------
 
-  RoomsReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<RoomsReq>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const RoomsReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(this, from);
+  BroadcastRoomBatchReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BroadcastRoomBatchReq>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const RoomsReq& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BroadcastRoomBatchReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BroadcastRoomBatchReq& from) {
+    BroadcastRoomBatchReq::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BroadcastRoomBatchReq* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ChatRoom.Comet.RoomsReq";
+    return "ChatRoom.Comet.BroadcastRoomBatchReq";
   }
   protected:
-  explicit RoomsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BroadcastRoomBatchReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
   public:
 
   static const ClassData _class_data_;
@@ -1105,61 +1144,179 @@ class RoomsReq final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.RoomsReq)
+  enum : int {
+    kRoomsFieldNumber = 1,
+  };
+  // repeated .ChatRoom.Comet.BroadcastRoomReq rooms = 1;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  ::ChatRoom::Comet::BroadcastRoomReq* mutable_rooms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::BroadcastRoomReq >*
+      mutable_rooms();
+  private:
+  const ::ChatRoom::Comet::BroadcastRoomReq& _internal_rooms(int index) const;
+  ::ChatRoom::Comet::BroadcastRoomReq* _internal_add_rooms();
+  public:
+  const ::ChatRoom::Comet::BroadcastRoomReq& rooms(int index) const;
+  ::ChatRoom::Comet::BroadcastRoomReq* add_rooms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::BroadcastRoomReq >&
+      rooms() const;
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.BroadcastRoomBatchReq)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::BroadcastRoomReq > rooms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomsReply_RoomsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RoomsReply_RoomsEntry_DoNotUse, 
-    std::string, bool,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL> {
-public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RoomsReply_RoomsEntry_DoNotUse, 
-    std::string, bool,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL> SuperType;
-  RoomsReply_RoomsEntry_DoNotUse();
-  explicit constexpr RoomsReply_RoomsEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit RoomsReply_RoomsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const RoomsReply_RoomsEntry_DoNotUse& other);
-  static const RoomsReply_RoomsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const RoomsReply_RoomsEntry_DoNotUse*>(&_RoomsReply_RoomsEntry_DoNotUse_default_instance_); }
-  static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "ChatRoom.Comet.RoomsReply.RoomsEntry.key");
- }
-  static bool ValidateValue(void*) { return true; }
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+class BroadcastRoomBatchReply final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.BroadcastRoomBatchReply) */ {
+ public:
+  inline BroadcastRoomBatchReply() : BroadcastRoomBatchReply(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR BroadcastRoomBatchReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BroadcastRoomBatchReply(const BroadcastRoomBatchReply& from);
+  BroadcastRoomBatchReply(BroadcastRoomBatchReply&& from) noexcept
+    : BroadcastRoomBatchReply() {
+    *this = ::std::move(from);
+  }
+
+  inline BroadcastRoomBatchReply& operator=(const BroadcastRoomBatchReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BroadcastRoomBatchReply& operator=(BroadcastRoomBatchReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BroadcastRoomBatchReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BroadcastRoomBatchReply* internal_default_instance() {
+    return reinterpret_cast<const BroadcastRoomBatchReply*>(
+               &_BroadcastRoomBatchReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(BroadcastRoomBatchReply& a, BroadcastRoomBatchReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BroadcastRoomBatchReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BroadcastRoomBatchReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BroadcastRoomBatchReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BroadcastRoomBatchReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const BroadcastRoomBatchReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const BroadcastRoomBatchReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Comet.BroadcastRoomBatchReply";
+  }
+  protected:
+  explicit BroadcastRoomBatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-};
 
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.BroadcastRoomBatchReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
 // -------------------------------------------------------------------
 
-class RoomsReply final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.RoomsReply) */ {
+class PushItem final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.PushItem) */ {
  public:
-  inline RoomsReply() : RoomsReply(nullptr) {}
-  ~RoomsReply() override;
-  explicit constexpr RoomsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline PushItem() : PushItem(nullptr) {}
+  ~PushItem() override;
+  explicit PROTOBUF_CONSTEXPR PushItem(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RoomsReply(const RoomsReply& from);
-  RoomsReply(RoomsReply&& from) noexcept
-    : RoomsReply() {
+  PushItem(const PushItem& from);
+  PushItem(PushItem&& from) noexcept
+    : PushItem() {
     *this = ::std::move(from);
   }
 
-  inline RoomsReply& operator=(const RoomsReply& from) {
+  inline PushItem& operator=(const PushItem& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RoomsReply& operator=(RoomsReply&& from) noexcept {
+  inline PushItem& operator=(PushItem&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1182,20 +1339,20 @@ class RoomsReply final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const RoomsReply& default_instance() {
+  static const PushItem& default_instance() {
     return *internal_default_instance();
   }
-  static inline const RoomsReply* internal_default_instance() {
-    return reinterpret_cast<const RoomsReply*>(
-               &_RoomsReply_default_instance_);
+  static inline const PushItem* internal_default_instance() {
+    return reinterpret_cast<const PushItem*>(
+               &_PushItem_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(RoomsReply& a, RoomsReply& b) {
+  friend void swap(PushItem& a, PushItem& b) {
     a.Swap(&b);
   }
-  inline void Swap(RoomsReply* other) {
+  inline void Swap(PushItem* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1208,7 +1365,7 @@ class RoomsReply final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RoomsReply* other) {
+  void UnsafeArenaSwap(PushItem* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1216,15 +1373,17 @@ class RoomsReply final :
 
   // implements Message ----------------------------------------------
 
-  RoomsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<RoomsReply>(arena);
+  PushItem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PushItem>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const RoomsReply& from);
+  void CopyFrom(const PushItem& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RoomsReply& from);
+  void MergeFrom( const PushItem& from) {
+    PushItem::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1233,25 +1392,22 @@ class RoomsReply final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RoomsReply* other);
+  void InternalSwap(PushItem* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ChatRoom.Comet.RoomsReply";
+    return "ChatRoom.Comet.PushItem";
   }
   protected:
-  explicit RoomsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit PushItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1261,44 +1417,1196 @@ class RoomsReply final :
 
   // nested types ----------------------------------------------------
 
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kRoomsFieldNumber = 1,
+    kKeysFieldNumber = 3,
+    kRoomIDFieldNumber = 1,
+    kProtoFieldNumber = 2,
+    kSpeedFieldNumber = 4,
   };
-  // map<string, bool> rooms = 1;
-  int rooms_size() const;
+  // repeated string keys = 3;
+  int keys_size() const;
   private:
-  int _internal_rooms_size() const;
+  int _internal_keys_size() const;
   public:
-  void clear_rooms();
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >&
-      _internal_rooms() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >*
-      _internal_mutable_rooms();
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >&
-      rooms() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >*
-      mutable_rooms();
 
-  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.RoomsReply)
- private:
-  class _Internal;
+  // string roomID = 1;
+  void clear_roomid();
+  const std::string& roomid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_roomid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_roomid();
+  PROTOBUF_NODISCARD std::string* release_roomid();
+  void set_allocated_roomid(std::string* roomid);
+  private:
+  const std::string& _internal_roomid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_roomid(const std::string& value);
+  std::string* _internal_mutable_roomid();
+  public:
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      RoomsReply_RoomsEntry_DoNotUse,
-      std::string, bool,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL> rooms_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
-};
+  // .ChatRoom.Protocol.Proto proto = 2;
+  bool has_proto() const;
+  private:
+  bool _internal_has_proto() const;
+  public:
+  void clear_proto();
+  const ::ChatRoom::Protocol::Proto& proto() const;
+  PROTOBUF_NODISCARD ::ChatRoom::Protocol::Proto* release_proto();
+  ::ChatRoom::Protocol::Proto* mutable_proto();
+  void set_allocated_proto(::ChatRoom::Protocol::Proto* proto);
+  private:
+  const ::ChatRoom::Protocol::Proto& _internal_proto() const;
+  ::ChatRoom::Protocol::Proto* _internal_mutable_proto();
+  public:
+  void unsafe_arena_set_allocated_proto(
+      ::ChatRoom::Protocol::Proto* proto);
+  ::ChatRoom::Protocol::Proto* unsafe_arena_release_proto();
+
+  // int32 speed = 4;
+  void clear_speed();
+  int32_t speed() const;
+  void set_speed(int32_t value);
+  private:
+  int32_t _internal_speed() const;
+  void _internal_set_speed(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.PushItem)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr roomid_;
+    ::ChatRoom::Protocol::Proto* proto_;
+    int32_t speed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PushBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.PushBatch) */ {
+ public:
+  inline PushBatch() : PushBatch(nullptr) {}
+  ~PushBatch() override;
+  explicit PROTOBUF_CONSTEXPR PushBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PushBatch(const PushBatch& from);
+  PushBatch(PushBatch&& from) noexcept
+    : PushBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline PushBatch& operator=(const PushBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PushBatch& operator=(PushBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PushBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PushBatch* internal_default_instance() {
+    return reinterpret_cast<const PushBatch*>(
+               &_PushBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PushBatch& a, PushBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PushBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PushBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PushBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PushBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PushBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PushBatch& from) {
+    PushBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PushBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Comet.PushBatch";
+  }
+  protected:
+  explicit PushBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kItemsFieldNumber = 2,
+    kSeqFieldNumber = 1,
+    kEpochFieldNumber = 3,
+  };
+  // repeated .ChatRoom.Comet.PushItem items = 2;
+  int items_size() const;
+  private:
+  int _internal_items_size() const;
+  public:
+  void clear_items();
+  ::ChatRoom::Comet::PushItem* mutable_items(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::PushItem >*
+      mutable_items();
+  private:
+  const ::ChatRoom::Comet::PushItem& _internal_items(int index) const;
+  ::ChatRoom::Comet::PushItem* _internal_add_items();
+  public:
+  const ::ChatRoom::Comet::PushItem& items(int index) const;
+  ::ChatRoom::Comet::PushItem* add_items();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::PushItem >&
+      items() const;
+
+  // uint64 seq = 1;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // uint64 epoch = 3;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.PushBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::PushItem > items_;
+    uint64_t seq_;
+    uint64_t epoch_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PushAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.PushAck) */ {
+ public:
+  inline PushAck() : PushAck(nullptr) {}
+  ~PushAck() override;
+  explicit PROTOBUF_CONSTEXPR PushAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PushAck(const PushAck& from);
+  PushAck(PushAck&& from) noexcept
+    : PushAck() {
+    *this = ::std::move(from);
+  }
+
+  inline PushAck& operator=(const PushAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PushAck& operator=(PushAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PushAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PushAck* internal_default_instance() {
+    return reinterpret_cast<const PushAck*>(
+               &_PushAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PushAck& a, PushAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PushAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PushAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PushAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PushAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PushAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PushAck& from) {
+    PushAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PushAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Comet.PushAck";
+  }
+  protected:
+  explicit PushAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSeqFieldNumber = 1,
+    kFailedFieldNumber = 2,
+  };
+  // uint64 seq = 1;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // int32 failed = 2;
+  void clear_failed();
+  int32_t failed() const;
+  void set_failed(int32_t value);
+  private:
+  int32_t _internal_failed() const;
+  void _internal_set_failed(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.PushAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t seq_;
+    int32_t failed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomsReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.RoomsReq) */ {
+ public:
+  inline RoomsReq() : RoomsReq(nullptr) {}
+  ~RoomsReq() override;
+  explicit PROTOBUF_CONSTEXPR RoomsReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomsReq(const RoomsReq& from);
+  RoomsReq(RoomsReq&& from) noexcept
+    : RoomsReq() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomsReq& operator=(const RoomsReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomsReq& operator=(RoomsReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomsReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomsReq* internal_default_instance() {
+    return reinterpret_cast<const RoomsReq*>(
+               &_RoomsReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(RoomsReq& a, RoomsReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomsReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomsReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomsReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomsReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomsReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomsReq& from) {
+    RoomsReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomsReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Comet.RoomsReq";
+  }
+  protected:
+  explicit RoomsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEpochFieldNumber = 1,
+    kVersionFieldNumber = 2,
+    kWaitMsFieldNumber = 3,
+  };
+  // uint64 epoch = 1;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // int32 wait_ms = 3;
+  void clear_wait_ms();
+  int32_t wait_ms() const;
+  void set_wait_ms(int32_t value);
+  private:
+  int32_t _internal_wait_ms() const;
+  void _internal_set_wait_ms(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.RoomsReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t epoch_;
+    uint64_t version_;
+    int32_t wait_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomsReply_RoomsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RoomsReply_RoomsEntry_DoNotUse, 
+    std::string, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RoomsReply_RoomsEntry_DoNotUse, 
+    std::string, bool,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL> SuperType;
+  RoomsReply_RoomsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR RoomsReply_RoomsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit RoomsReply_RoomsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const RoomsReply_RoomsEntry_DoNotUse& other);
+  static const RoomsReply_RoomsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const RoomsReply_RoomsEntry_DoNotUse*>(&_RoomsReply_RoomsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "ChatRoom.Comet.RoomsReply.RoomsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class RoomsReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.RoomsReply) */ {
+ public:
+  inline RoomsReply() : RoomsReply(nullptr) {}
+  ~RoomsReply() override;
+  explicit PROTOBUF_CONSTEXPR RoomsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomsReply(const RoomsReply& from);
+  RoomsReply(RoomsReply&& from) noexcept
+    : RoomsReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomsReply& operator=(const RoomsReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomsReply& operator=(RoomsReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomsReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomsReply* internal_default_instance() {
+    return reinterpret_cast<const RoomsReply*>(
+               &_RoomsReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(RoomsReply& a, RoomsReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomsReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomsReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomsReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomsReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomsReply& from) {
+    RoomsReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomsReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Comet.RoomsReply";
+  }
+  protected:
+  explicit RoomsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomsFieldNumber = 1,
+    kEpochFieldNumber = 2,
+    kVersionFieldNumber = 3,
+  };
+  // map<string, bool> rooms = 1;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >&
+      _internal_rooms() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >*
+      _internal_mutable_rooms();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >&
+      rooms() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >*
+      mutable_rooms();
+
+  // uint64 epoch = 2;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // uint64 version = 3;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.RoomsReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        RoomsReply_RoomsEntry_DoNotUse,
+        std::string, bool,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL> rooms_;
+    uint64_t epoch_;
+    uint64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UsersReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.UsersReq) */ {
+ public:
+  inline UsersReq() : UsersReq(nullptr) {}
+  ~UsersReq() override;
+  explicit PROTOBUF_CONSTEXPR UsersReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UsersReq(const UsersReq& from);
+  UsersReq(UsersReq&& from) noexcept
+    : UsersReq() {
+    *this = ::std::move(from);
+  }
+
+  inline UsersReq& operator=(const UsersReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UsersReq& operator=(UsersReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UsersReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UsersReq* internal_default_instance() {
+    return reinterpret_cast<const UsersReq*>(
+               &_UsersReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(UsersReq& a, UsersReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UsersReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UsersReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UsersReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UsersReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UsersReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UsersReq& from) {
+    UsersReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UsersReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Comet.UsersReq";
+  }
+  protected:
+  explicit UsersReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEpochFieldNumber = 1,
+    kSinceFieldNumber = 2,
+  };
+  // uint64 epoch = 1;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // uint64 since = 2;
+  void clear_since();
+  uint64_t since() const;
+  void set_since(uint64_t value);
+  private:
+  uint64_t _internal_since() const;
+  void _internal_set_since(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.UsersReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t epoch_;
+    uint64_t since_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UsersReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ChatRoom.Comet.UsersReply) */ {
+ public:
+  inline UsersReply() : UsersReply(nullptr) {}
+  ~UsersReply() override;
+  explicit PROTOBUF_CONSTEXPR UsersReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UsersReply(const UsersReply& from);
+  UsersReply(UsersReply&& from) noexcept
+    : UsersReply() {
+    *this = ::std::move(from);
+  }
+
+  inline UsersReply& operator=(const UsersReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UsersReply& operator=(UsersReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UsersReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UsersReply* internal_default_instance() {
+    return reinterpret_cast<const UsersReply*>(
+               &_UsersReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(UsersReply& a, UsersReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UsersReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UsersReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UsersReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UsersReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UsersReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UsersReply& from) {
+    UsersReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UsersReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ChatRoom.Comet.UsersReply";
+  }
+  protected:
+  explicit UsersReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOnlineFieldNumber = 4,
+    kOfflineFieldNumber = 5,
+    kEpochFieldNumber = 1,
+    kVersionFieldNumber = 2,
+    kFullFieldNumber = 3,
+  };
+  // repeated string online = 4;
+  int online_size() const;
+  private:
+  int _internal_online_size() const;
+  public:
+  void clear_online();
+  const std::string& online(int index) const;
+  std::string* mutable_online(int index);
+  void set_online(int index, const std::string& value);
+  void set_online(int index, std::string&& value);
+  void set_online(int index, const char* value);
+  void set_online(int index, const char* value, size_t size);
+  std::string* add_online();
+  void add_online(const std::string& value);
+  void add_online(std::string&& value);
+  void add_online(const char* value);
+  void add_online(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& online() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_online();
+  private:
+  const std::string& _internal_online(int index) const;
+  std::string* _internal_add_online();
+  public:
+
+  // repeated string offline = 5;
+  int offline_size() const;
+  private:
+  int _internal_offline_size() const;
+  public:
+  void clear_offline();
+  const std::string& offline(int index) const;
+  std::string* mutable_offline(int index);
+  void set_offline(int index, const std::string& value);
+  void set_offline(int index, std::string&& value);
+  void set_offline(int index, const char* value);
+  void set_offline(int index, const char* value, size_t size);
+  std::string* add_offline();
+  void add_offline(const std::string& value);
+  void add_offline(std::string&& value);
+  void add_offline(const char* value);
+  void add_offline(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& offline() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_offline();
+  private:
+  const std::string& _internal_offline(int index) const;
+  std::string* _internal_add_offline();
+  public:
+
+  // uint64 epoch = 1;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // bool full = 3;
+  void clear_full();
+  bool full() const;
+  void set_full(bool value);
+  private:
+  bool _internal_full() const;
+  void _internal_set_full(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ChatRoom.Comet.UsersReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> online_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> offline_;
+    uint64_t epoch_;
+    uint64_t version_;
+    bool full_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChatRoom_2eComet_2eproto;
+};
 // ===================================================================
 
 
@@ -1312,13 +2620,13 @@ class RoomsReply final :
 
 // repeated string keys = 1;
 inline int PushMsgReq::_internal_keys_size() const {
-  return keys_.size();
+  return _impl_.keys_.size();
 }
 inline int PushMsgReq::keys_size() const {
   return _internal_keys_size();
 }
 inline void PushMsgReq::clear_keys() {
-  keys_.Clear();
+  _impl_.keys_.Clear();
 }
 inline std::string* PushMsgReq::add_keys() {
   std::string* _s = _internal_add_keys();
@@ -1326,7 +2634,7 @@ inline std::string* PushMsgReq::add_keys() {
   return _s;
 }
 inline const std::string& PushMsgReq::_internal_keys(int index) const {
-  return keys_.Get(index);
+  return _impl_.keys_.Get(index);
 }
 inline const std::string& PushMsgReq::keys(int index) const {
   // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushMsgReq.keys)
@@ -1334,63 +2642,63 @@ inline const std::string& PushMsgReq::keys(int index) const {
 }
 inline std::string* PushMsgReq::mutable_keys(int index) {
   // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.PushMsgReq.keys)
-  return keys_.Mutable(index);
+  return _impl_.keys_.Mutable(index);
 }
 inline void PushMsgReq::set_keys(int index, const std::string& value) {
-  keys_.Mutable(index)->assign(value);
+  _impl_.keys_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline void PushMsgReq::set_keys(int index, std::string&& value) {
-  keys_.Mutable(index)->assign(std::move(value));
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline void PushMsgReq::set_keys(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keys_.Mutable(index)->assign(value);
+  _impl_.keys_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline void PushMsgReq::set_keys(int index, const char* value, size_t size) {
-  keys_.Mutable(index)->assign(
+  _impl_.keys_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline std::string* PushMsgReq::_internal_add_keys() {
-  return keys_.Add();
+  return _impl_.keys_.Add();
 }
 inline void PushMsgReq::add_keys(const std::string& value) {
-  keys_.Add()->assign(value);
+  _impl_.keys_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline void PushMsgReq::add_keys(std::string&& value) {
-  keys_.Add(std::move(value));
+  _impl_.keys_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline void PushMsgReq::add_keys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keys_.Add()->assign(value);
+  _impl_.keys_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline void PushMsgReq::add_keys(const char* value, size_t size) {
-  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:ChatRoom.Comet.PushMsgReq.keys)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 PushMsgReq::keys() const {
   // @@protoc_insertion_point(field_list:ChatRoom.Comet.PushMsgReq.keys)
-  return keys_;
+  return _impl_.keys_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 PushMsgReq::mutable_keys() {
   // @@protoc_insertion_point(field_mutable_list:ChatRoom.Comet.PushMsgReq.keys)
-  return &keys_;
+  return &_impl_.keys_;
 }
 
 // int32 protoOp = 3;
 inline void PushMsgReq::clear_protoop() {
-  protoop_ = 0;
+  _impl_.protoop_ = 0;
 }
 inline int32_t PushMsgReq::_internal_protoop() const {
-  return protoop_;
+  return _impl_.protoop_;
 }
 inline int32_t PushMsgReq::protoop() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushMsgReq.protoOp)
@@ -1398,7 +2706,7 @@ inline int32_t PushMsgReq::protoop() const {
 }
 inline void PushMsgReq::_internal_set_protoop(int32_t value) {
   
-  protoop_ = value;
+  _impl_.protoop_ = value;
 }
 inline void PushMsgReq::set_protoop(int32_t value) {
   _internal_set_protoop(value);
@@ -1407,13 +2715,13 @@ inline void PushMsgReq::set_protoop(int32_t value) {
 
 // .ChatRoom.Protocol.Proto proto = 2;
 inline bool PushMsgReq::_internal_has_proto() const {
-  return this != internal_default_instance() && proto_ != nullptr;
+  return this != internal_default_instance() && _impl_.proto_ != nullptr;
 }
 inline bool PushMsgReq::has_proto() const {
   return _internal_has_proto();
 }
 inline const ::ChatRoom::Protocol::Proto& PushMsgReq::_internal_proto() const {
-  const ::ChatRoom::Protocol::Proto* p = proto_;
+  const ::ChatRoom::Protocol::Proto* p = _impl_.proto_;
   return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Protocol::Proto&>(
       ::ChatRoom::Protocol::_Proto_default_instance_);
 }
@@ -1424,9 +2732,9 @@ inline const ::ChatRoom::Protocol::Proto& PushMsgReq::proto() const {
 inline void PushMsgReq::unsafe_arena_set_allocated_proto(
     ::ChatRoom::Protocol::Proto* proto) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
   }
-  proto_ = proto;
+  _impl_.proto_ = proto;
   if (proto) {
     
   } else {
@@ -1436,8 +2744,8 @@ inline void PushMsgReq::unsafe_arena_set_allocated_proto(
 }
 inline ::ChatRoom::Protocol::Proto* PushMsgReq::release_proto() {
   
-  ::ChatRoom::Protocol::Proto* temp = proto_;
-  proto_ = nullptr;
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1452,17 +2760,17 @@ inline ::ChatRoom::Protocol::Proto* PushMsgReq::release_proto() {
 inline ::ChatRoom::Protocol::Proto* PushMsgReq::unsafe_arena_release_proto() {
   // @@protoc_insertion_point(field_release:ChatRoom.Comet.PushMsgReq.proto)
   
-  ::ChatRoom::Protocol::Proto* temp = proto_;
-  proto_ = nullptr;
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
   return temp;
 }
 inline ::ChatRoom::Protocol::Proto* PushMsgReq::_internal_mutable_proto() {
   
-  if (proto_ == nullptr) {
+  if (_impl_.proto_ == nullptr) {
     auto* p = CreateMaybeMessage<::ChatRoom::Protocol::Proto>(GetArenaForAllocation());
-    proto_ = p;
+    _impl_.proto_ = p;
   }
-  return proto_;
+  return _impl_.proto_;
 }
 inline ::ChatRoom::Protocol::Proto* PushMsgReq::mutable_proto() {
   ::ChatRoom::Protocol::Proto* _msg = _internal_mutable_proto();
@@ -1472,12 +2780,11 @@ inline ::ChatRoom::Protocol::Proto* PushMsgReq::mutable_proto() {
 inline void PushMsgReq::set_allocated_proto(::ChatRoom::Protocol::Proto* proto) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
   }
   if (proto) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto));
     if (message_arena != submessage_arena) {
       proto = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -1487,7 +2794,7 @@ inline void PushMsgReq::set_allocated_proto(::ChatRoom::Protocol::Proto* proto)
   } else {
     
   }
-  proto_ = proto;
+  _impl_.proto_ = proto;
   // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.PushMsgReq.proto)
 }
 
@@ -1501,10 +2808,10 @@ inline void PushMsgReq::set_allocated_proto(::ChatRoom::Protocol::Proto* proto)
 
 // int32 protoOp = 1;
 inline void BroadcastReq::clear_protoop() {
-  protoop_ = 0;
+  _impl_.protoop_ = 0;
 }
 inline int32_t BroadcastReq::_internal_protoop() const {
-  return protoop_;
+  return _impl_.protoop_;
 }
 inline int32_t BroadcastReq::protoop() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Comet.BroadcastReq.protoOp)
@@ -1512,7 +2819,7 @@ inline int32_t BroadcastReq::protoop() const {
 }
 inline void BroadcastReq::_internal_set_protoop(int32_t value) {
   
-  protoop_ = value;
+  _impl_.protoop_ = value;
 }
 inline void BroadcastReq::set_protoop(int32_t value) {
   _internal_set_protoop(value);
@@ -1521,13 +2828,13 @@ inline void BroadcastReq::set_protoop(int32_t value) {
 
 // .ChatRoom.Protocol.Proto proto = 2;
 inline bool BroadcastReq::_internal_has_proto() const {
-  return this != internal_default_instance() && proto_ != nullptr;
+  return this != internal_default_instance() && _impl_.proto_ != nullptr;
 }
 inline bool BroadcastReq::has_proto() const {
   return _internal_has_proto();
 }
 inline const ::ChatRoom::Protocol::Proto& BroadcastReq::_internal_proto() const {
-  const ::ChatRoom::Protocol::Proto* p = proto_;
+  const ::ChatRoom::Protocol::Proto* p = _impl_.proto_;
   return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Protocol::Proto&>(
       ::ChatRoom::Protocol::_Proto_default_instance_);
 }
@@ -1538,9 +2845,9 @@ inline const ::ChatRoom::Protocol::Proto& BroadcastReq::proto() const {
 inline void BroadcastReq::unsafe_arena_set_allocated_proto(
     ::ChatRoom::Protocol::Proto* proto) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
   }
-  proto_ = proto;
+  _impl_.proto_ = proto;
   if (proto) {
     
   } else {
@@ -1550,8 +2857,8 @@ inline void BroadcastReq::unsafe_arena_set_allocated_proto(
 }
 inline ::ChatRoom::Protocol::Proto* BroadcastReq::release_proto() {
   
-  ::ChatRoom::Protocol::Proto* temp = proto_;
-  proto_ = nullptr;
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1566,17 +2873,17 @@ inline ::ChatRoom::Protocol::Proto* BroadcastReq::release_proto() {
 inline ::ChatRoom::Protocol::Proto* BroadcastReq::unsafe_arena_release_proto() {
   // @@protoc_insertion_point(field_release:ChatRoom.Comet.BroadcastReq.proto)
   
-  ::ChatRoom::Protocol::Proto* temp = proto_;
-  proto_ = nullptr;
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
   return temp;
 }
 inline ::ChatRoom::Protocol::Proto* BroadcastReq::_internal_mutable_proto() {
   
-  if (proto_ == nullptr) {
+  if (_impl_.proto_ == nullptr) {
     auto* p = CreateMaybeMessage<::ChatRoom::Protocol::Proto>(GetArenaForAllocation());
-    proto_ = p;
+    _impl_.proto_ = p;
   }
-  return proto_;
+  return _impl_.proto_;
 }
 inline ::ChatRoom::Protocol::Proto* BroadcastReq::mutable_proto() {
   ::ChatRoom::Protocol::Proto* _msg = _internal_mutable_proto();
@@ -1586,12 +2893,11 @@ inline ::ChatRoom::Protocol::Proto* BroadcastReq::mutable_proto() {
 inline void BroadcastReq::set_allocated_proto(::ChatRoom::Protocol::Proto* proto) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
   }
   if (proto) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto));
     if (message_arena != submessage_arena) {
       proto = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -1601,122 +2907,312 @@ inline void BroadcastReq::set_allocated_proto(::ChatRoom::Protocol::Proto* proto
   } else {
     
   }
-  proto_ = proto;
+  _impl_.proto_ = proto;
   // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.BroadcastReq.proto)
 }
 
 // int32 speed = 3;
 inline void BroadcastReq::clear_speed() {
-  speed_ = 0;
+  _impl_.speed_ = 0;
 }
 inline int32_t BroadcastReq::_internal_speed() const {
-  return speed_;
+  return _impl_.speed_;
 }
 inline int32_t BroadcastReq::speed() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Comet.BroadcastReq.speed)
   return _internal_speed();
 }
-inline void BroadcastReq::_internal_set_speed(int32_t value) {
-  
-  speed_ = value;
+inline void BroadcastReq::_internal_set_speed(int32_t value) {
+  
+  _impl_.speed_ = value;
+}
+inline void BroadcastReq::set_speed(int32_t value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.BroadcastReq.speed)
+}
+
+// -------------------------------------------------------------------
+
+// BroadcastReply
+
+// -------------------------------------------------------------------
+
+// BroadcastRoomReq
+
+// string roomID = 1;
+inline void BroadcastRoomReq::clear_roomid() {
+  _impl_.roomid_.ClearToEmpty();
+}
+inline const std::string& BroadcastRoomReq::roomid() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.BroadcastRoomReq.roomID)
+  return _internal_roomid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BroadcastRoomReq::set_roomid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.roomid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.BroadcastRoomReq.roomID)
+}
+inline std::string* BroadcastRoomReq::mutable_roomid() {
+  std::string* _s = _internal_mutable_roomid();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.BroadcastRoomReq.roomID)
+  return _s;
+}
+inline const std::string& BroadcastRoomReq::_internal_roomid() const {
+  return _impl_.roomid_.Get();
+}
+inline void BroadcastRoomReq::_internal_set_roomid(const std::string& value) {
+  
+  _impl_.roomid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BroadcastRoomReq::_internal_mutable_roomid() {
+  
+  return _impl_.roomid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BroadcastRoomReq::release_roomid() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Comet.BroadcastRoomReq.roomID)
+  return _impl_.roomid_.Release();
+}
+inline void BroadcastRoomReq::set_allocated_roomid(std::string* roomid) {
+  if (roomid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.roomid_.SetAllocated(roomid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.roomid_.IsDefault()) {
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.BroadcastRoomReq.roomID)
+}
+
+// .ChatRoom.Protocol.Proto proto = 2;
+inline bool BroadcastRoomReq::_internal_has_proto() const {
+  return this != internal_default_instance() && _impl_.proto_ != nullptr;
+}
+inline bool BroadcastRoomReq::has_proto() const {
+  return _internal_has_proto();
+}
+inline const ::ChatRoom::Protocol::Proto& BroadcastRoomReq::_internal_proto() const {
+  const ::ChatRoom::Protocol::Proto* p = _impl_.proto_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Protocol::Proto&>(
+      ::ChatRoom::Protocol::_Proto_default_instance_);
+}
+inline const ::ChatRoom::Protocol::Proto& BroadcastRoomReq::proto() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.BroadcastRoomReq.proto)
+  return _internal_proto();
+}
+inline void BroadcastRoomReq::unsafe_arena_set_allocated_proto(
+    ::ChatRoom::Protocol::Proto* proto) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
+  }
+  _impl_.proto_ = proto;
+  if (proto) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Comet.BroadcastRoomReq.proto)
+}
+inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::release_proto() {
+  
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::unsafe_arena_release_proto() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Comet.BroadcastRoomReq.proto)
+  
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
+  return temp;
+}
+inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::_internal_mutable_proto() {
+  
+  if (_impl_.proto_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ChatRoom::Protocol::Proto>(GetArenaForAllocation());
+    _impl_.proto_ = p;
+  }
+  return _impl_.proto_;
+}
+inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::mutable_proto() {
+  ::ChatRoom::Protocol::Proto* _msg = _internal_mutable_proto();
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.BroadcastRoomReq.proto)
+  return _msg;
+}
+inline void BroadcastRoomReq::set_allocated_proto(::ChatRoom::Protocol::Proto* proto) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
+  }
+  if (proto) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto));
+    if (message_arena != submessage_arena) {
+      proto = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, proto, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.proto_ = proto;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.BroadcastRoomReq.proto)
+}
+
+// -------------------------------------------------------------------
+
+// BroadcastRoomReply
+
+// -------------------------------------------------------------------
+
+// BroadcastRoomBatchReq
+
+// repeated .ChatRoom.Comet.BroadcastRoomReq rooms = 1;
+inline int BroadcastRoomBatchReq::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
+}
+inline int BroadcastRoomBatchReq::rooms_size() const {
+  return _internal_rooms_size();
+}
+inline void BroadcastRoomBatchReq::clear_rooms() {
+  _impl_.rooms_.Clear();
+}
+inline ::ChatRoom::Comet::BroadcastRoomReq* BroadcastRoomBatchReq::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.BroadcastRoomBatchReq.rooms)
+  return _impl_.rooms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::BroadcastRoomReq >*
+BroadcastRoomBatchReq::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Comet.BroadcastRoomBatchReq.rooms)
+  return &_impl_.rooms_;
+}
+inline const ::ChatRoom::Comet::BroadcastRoomReq& BroadcastRoomBatchReq::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
+}
+inline const ::ChatRoom::Comet::BroadcastRoomReq& BroadcastRoomBatchReq::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.BroadcastRoomBatchReq.rooms)
+  return _internal_rooms(index);
+}
+inline ::ChatRoom::Comet::BroadcastRoomReq* BroadcastRoomBatchReq::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
+}
+inline ::ChatRoom::Comet::BroadcastRoomReq* BroadcastRoomBatchReq::add_rooms() {
+  ::ChatRoom::Comet::BroadcastRoomReq* _add = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.BroadcastRoomBatchReq.rooms)
+  return _add;
 }
-inline void BroadcastReq::set_speed(int32_t value) {
-  _internal_set_speed(value);
-  // @@protoc_insertion_point(field_set:ChatRoom.Comet.BroadcastReq.speed)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::BroadcastRoomReq >&
+BroadcastRoomBatchReq::rooms() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Comet.BroadcastRoomBatchReq.rooms)
+  return _impl_.rooms_;
 }
 
 // -------------------------------------------------------------------
 
-// BroadcastReply
+// BroadcastRoomBatchReply
 
 // -------------------------------------------------------------------
 
-// BroadcastRoomReq
+// PushItem
 
 // string roomID = 1;
-inline void BroadcastRoomReq::clear_roomid() {
-  roomid_.ClearToEmpty();
+inline void PushItem::clear_roomid() {
+  _impl_.roomid_.ClearToEmpty();
 }
-inline const std::string& BroadcastRoomReq::roomid() const {
-  // @@protoc_insertion_point(field_get:ChatRoom.Comet.BroadcastRoomReq.roomID)
+inline const std::string& PushItem::roomid() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushItem.roomID)
   return _internal_roomid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void BroadcastRoomReq::set_roomid(ArgT0&& arg0, ArgT... args) {
+void PushItem::set_roomid(ArgT0&& arg0, ArgT... args) {
  
- roomid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:ChatRoom.Comet.BroadcastRoomReq.roomID)
+ _impl_.roomid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushItem.roomID)
 }
-inline std::string* BroadcastRoomReq::mutable_roomid() {
+inline std::string* PushItem::mutable_roomid() {
   std::string* _s = _internal_mutable_roomid();
-  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.BroadcastRoomReq.roomID)
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.PushItem.roomID)
   return _s;
 }
-inline const std::string& BroadcastRoomReq::_internal_roomid() const {
-  return roomid_.Get();
+inline const std::string& PushItem::_internal_roomid() const {
+  return _impl_.roomid_.Get();
 }
-inline void BroadcastRoomReq::_internal_set_roomid(const std::string& value) {
+inline void PushItem::_internal_set_roomid(const std::string& value) {
   
-  roomid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.roomid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* BroadcastRoomReq::_internal_mutable_roomid() {
+inline std::string* PushItem::_internal_mutable_roomid() {
   
-  return roomid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.roomid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* BroadcastRoomReq::release_roomid() {
-  // @@protoc_insertion_point(field_release:ChatRoom.Comet.BroadcastRoomReq.roomID)
-  return roomid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+inline std::string* PushItem::release_roomid() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Comet.PushItem.roomID)
+  return _impl_.roomid_.Release();
 }
-inline void BroadcastRoomReq::set_allocated_roomid(std::string* roomid) {
+inline void PushItem::set_allocated_roomid(std::string* roomid) {
   if (roomid != nullptr) {
     
   } else {
     
   }
-  roomid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), roomid,
-      GetArenaForAllocation());
+  _impl_.roomid_.SetAllocated(roomid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (roomid_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    roomid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.roomid_.IsDefault()) {
+    _impl_.roomid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.BroadcastRoomReq.roomID)
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.PushItem.roomID)
 }
 
 // .ChatRoom.Protocol.Proto proto = 2;
-inline bool BroadcastRoomReq::_internal_has_proto() const {
-  return this != internal_default_instance() && proto_ != nullptr;
+inline bool PushItem::_internal_has_proto() const {
+  return this != internal_default_instance() && _impl_.proto_ != nullptr;
 }
-inline bool BroadcastRoomReq::has_proto() const {
+inline bool PushItem::has_proto() const {
   return _internal_has_proto();
 }
-inline const ::ChatRoom::Protocol::Proto& BroadcastRoomReq::_internal_proto() const {
-  const ::ChatRoom::Protocol::Proto* p = proto_;
+inline const ::ChatRoom::Protocol::Proto& PushItem::_internal_proto() const {
+  const ::ChatRoom::Protocol::Proto* p = _impl_.proto_;
   return p != nullptr ? *p : reinterpret_cast<const ::ChatRoom::Protocol::Proto&>(
       ::ChatRoom::Protocol::_Proto_default_instance_);
 }
-inline const ::ChatRoom::Protocol::Proto& BroadcastRoomReq::proto() const {
-  // @@protoc_insertion_point(field_get:ChatRoom.Comet.BroadcastRoomReq.proto)
+inline const ::ChatRoom::Protocol::Proto& PushItem::proto() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushItem.proto)
   return _internal_proto();
 }
-inline void BroadcastRoomReq::unsafe_arena_set_allocated_proto(
+inline void PushItem::unsafe_arena_set_allocated_proto(
     ::ChatRoom::Protocol::Proto* proto) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
   }
-  proto_ = proto;
+  _impl_.proto_ = proto;
   if (proto) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Comet.BroadcastRoomReq.proto)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ChatRoom.Comet.PushItem.proto)
 }
-inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::release_proto() {
+inline ::ChatRoom::Protocol::Proto* PushItem::release_proto() {
   
-  ::ChatRoom::Protocol::Proto* temp = proto_;
-  proto_ = nullptr;
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1728,35 +3224,34 @@ inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::release_proto() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::unsafe_arena_release_proto() {
-  // @@protoc_insertion_point(field_release:ChatRoom.Comet.BroadcastRoomReq.proto)
+inline ::ChatRoom::Protocol::Proto* PushItem::unsafe_arena_release_proto() {
+  // @@protoc_insertion_point(field_release:ChatRoom.Comet.PushItem.proto)
   
-  ::ChatRoom::Protocol::Proto* temp = proto_;
-  proto_ = nullptr;
+  ::ChatRoom::Protocol::Proto* temp = _impl_.proto_;
+  _impl_.proto_ = nullptr;
   return temp;
 }
-inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::_internal_mutable_proto() {
+inline ::ChatRoom::Protocol::Proto* PushItem::_internal_mutable_proto() {
   
-  if (proto_ == nullptr) {
+  if (_impl_.proto_ == nullptr) {
     auto* p = CreateMaybeMessage<::ChatRoom::Protocol::Proto>(GetArenaForAllocation());
-    proto_ = p;
+    _impl_.proto_ = p;
   }
-  return proto_;
+  return _impl_.proto_;
 }
-inline ::ChatRoom::Protocol::Proto* BroadcastRoomReq::mutable_proto() {
+inline ::ChatRoom::Protocol::Proto* PushItem::mutable_proto() {
   ::ChatRoom::Protocol::Proto* _msg = _internal_mutable_proto();
-  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.BroadcastRoomReq.proto)
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.PushItem.proto)
   return _msg;
 }
-inline void BroadcastRoomReq::set_allocated_proto(::ChatRoom::Protocol::Proto* proto) {
+inline void PushItem::set_allocated_proto(::ChatRoom::Protocol::Proto* proto) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.proto_);
   }
   if (proto) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proto));
     if (message_arena != submessage_arena) {
       proto = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -1766,18 +3261,297 @@ inline void BroadcastRoomReq::set_allocated_proto(::ChatRoom::Protocol::Proto* p
   } else {
     
   }
-  proto_ = proto;
-  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.BroadcastRoomReq.proto)
+  _impl_.proto_ = proto;
+  // @@protoc_insertion_point(field_set_allocated:ChatRoom.Comet.PushItem.proto)
+}
+
+// repeated string keys = 3;
+inline int PushItem::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int PushItem::keys_size() const {
+  return _internal_keys_size();
+}
+inline void PushItem::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* PushItem::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:ChatRoom.Comet.PushItem.keys)
+  return _s;
+}
+inline const std::string& PushItem::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& PushItem::keys(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushItem.keys)
+  return _internal_keys(index);
+}
+inline std::string* PushItem::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.PushItem.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void PushItem::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushItem.keys)
+}
+inline void PushItem::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushItem.keys)
+}
+inline void PushItem::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ChatRoom.Comet.PushItem.keys)
+}
+inline void PushItem::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ChatRoom.Comet.PushItem.keys)
+}
+inline std::string* PushItem::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void PushItem::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.PushItem.keys)
+}
+inline void PushItem::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.PushItem.keys)
+}
+inline void PushItem::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ChatRoom.Comet.PushItem.keys)
+}
+inline void PushItem::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ChatRoom.Comet.PushItem.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PushItem::keys() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Comet.PushItem.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PushItem::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Comet.PushItem.keys)
+  return &_impl_.keys_;
+}
+
+// int32 speed = 4;
+inline void PushItem::clear_speed() {
+  _impl_.speed_ = 0;
+}
+inline int32_t PushItem::_internal_speed() const {
+  return _impl_.speed_;
+}
+inline int32_t PushItem::speed() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushItem.speed)
+  return _internal_speed();
+}
+inline void PushItem::_internal_set_speed(int32_t value) {
+  
+  _impl_.speed_ = value;
+}
+inline void PushItem::set_speed(int32_t value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushItem.speed)
 }
 
 // -------------------------------------------------------------------
 
-// BroadcastRoomReply
+// PushBatch
+
+// uint64 seq = 1;
+inline void PushBatch::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t PushBatch::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t PushBatch::seq() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushBatch.seq)
+  return _internal_seq();
+}
+inline void PushBatch::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void PushBatch::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushBatch.seq)
+}
+
+// repeated .ChatRoom.Comet.PushItem items = 2;
+inline int PushBatch::_internal_items_size() const {
+  return _impl_.items_.size();
+}
+inline int PushBatch::items_size() const {
+  return _internal_items_size();
+}
+inline void PushBatch::clear_items() {
+  _impl_.items_.Clear();
+}
+inline ::ChatRoom::Comet::PushItem* PushBatch::mutable_items(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.PushBatch.items)
+  return _impl_.items_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::PushItem >*
+PushBatch::mutable_items() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Comet.PushBatch.items)
+  return &_impl_.items_;
+}
+inline const ::ChatRoom::Comet::PushItem& PushBatch::_internal_items(int index) const {
+  return _impl_.items_.Get(index);
+}
+inline const ::ChatRoom::Comet::PushItem& PushBatch::items(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushBatch.items)
+  return _internal_items(index);
+}
+inline ::ChatRoom::Comet::PushItem* PushBatch::_internal_add_items() {
+  return _impl_.items_.Add();
+}
+inline ::ChatRoom::Comet::PushItem* PushBatch::add_items() {
+  ::ChatRoom::Comet::PushItem* _add = _internal_add_items();
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.PushBatch.items)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ChatRoom::Comet::PushItem >&
+PushBatch::items() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Comet.PushBatch.items)
+  return _impl_.items_;
+}
+
+// uint64 epoch = 3;
+inline void PushBatch::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+}
+inline uint64_t PushBatch::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t PushBatch::epoch() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushBatch.epoch)
+  return _internal_epoch();
+}
+inline void PushBatch::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void PushBatch::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushBatch.epoch)
+}
+
+// -------------------------------------------------------------------
+
+// PushAck
+
+// uint64 seq = 1;
+inline void PushAck::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t PushAck::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t PushAck::seq() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushAck.seq)
+  return _internal_seq();
+}
+inline void PushAck::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void PushAck::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushAck.seq)
+}
+
+// int32 failed = 2;
+inline void PushAck::clear_failed() {
+  _impl_.failed_ = 0;
+}
+inline int32_t PushAck::_internal_failed() const {
+  return _impl_.failed_;
+}
+inline int32_t PushAck::failed() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.PushAck.failed)
+  return _internal_failed();
+}
+inline void PushAck::_internal_set_failed(int32_t value) {
+  
+  _impl_.failed_ = value;
+}
+inline void PushAck::set_failed(int32_t value) {
+  _internal_set_failed(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.PushAck.failed)
+}
 
 // -------------------------------------------------------------------
 
 // RoomsReq
 
+// uint64 epoch = 1;
+inline void RoomsReq::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+}
+inline uint64_t RoomsReq::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t RoomsReq::epoch() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.RoomsReq.epoch)
+  return _internal_epoch();
+}
+inline void RoomsReq::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void RoomsReq::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.RoomsReq.epoch)
+}
+
+// uint64 version = 2;
+inline void RoomsReq::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t RoomsReq::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t RoomsReq::version() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.RoomsReq.version)
+  return _internal_version();
+}
+inline void RoomsReq::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void RoomsReq::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.RoomsReq.version)
+}
+
+// int32 wait_ms = 3;
+inline void RoomsReq::clear_wait_ms() {
+  _impl_.wait_ms_ = 0;
+}
+inline int32_t RoomsReq::_internal_wait_ms() const {
+  return _impl_.wait_ms_;
+}
+inline int32_t RoomsReq::wait_ms() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.RoomsReq.wait_ms)
+  return _internal_wait_ms();
+}
+inline void RoomsReq::_internal_set_wait_ms(int32_t value) {
+  
+  _impl_.wait_ms_ = value;
+}
+inline void RoomsReq::set_wait_ms(int32_t value) {
+  _internal_set_wait_ms(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.RoomsReq.wait_ms)
+}
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -1786,17 +3560,17 @@ inline void BroadcastRoomReq::set_allocated_proto(::ChatRoom::Protocol::Proto* p
 
 // map<string, bool> rooms = 1;
 inline int RoomsReply::_internal_rooms_size() const {
-  return rooms_.size();
+  return _impl_.rooms_.size();
 }
 inline int RoomsReply::rooms_size() const {
   return _internal_rooms_size();
 }
 inline void RoomsReply::clear_rooms() {
-  rooms_.Clear();
+  _impl_.rooms_.Clear();
 }
 inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >&
 RoomsReply::_internal_rooms() const {
-  return rooms_.GetMap();
+  return _impl_.rooms_.GetMap();
 }
 inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >&
 RoomsReply::rooms() const {
@@ -1805,7 +3579,7 @@ RoomsReply::rooms() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >*
 RoomsReply::_internal_mutable_rooms() {
-  return rooms_.MutableMap();
+  return _impl_.rooms_.MutableMap();
 }
 inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, bool >*
 RoomsReply::mutable_rooms() {
@@ -1813,6 +3587,304 @@ RoomsReply::mutable_rooms() {
   return _internal_mutable_rooms();
 }
 
+// uint64 epoch = 2;
+inline void RoomsReply::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+}
+inline uint64_t RoomsReply::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t RoomsReply::epoch() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.RoomsReply.epoch)
+  return _internal_epoch();
+}
+inline void RoomsReply::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void RoomsReply::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.RoomsReply.epoch)
+}
+
+// uint64 version = 3;
+inline void RoomsReply::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t RoomsReply::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t RoomsReply::version() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.RoomsReply.version)
+  return _internal_version();
+}
+inline void RoomsReply::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void RoomsReply::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.RoomsReply.version)
+}
+
+// -------------------------------------------------------------------
+
+// UsersReq
+
+// uint64 epoch = 1;
+inline void UsersReq::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+}
+inline uint64_t UsersReq::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t UsersReq::epoch() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.UsersReq.epoch)
+  return _internal_epoch();
+}
+inline void UsersReq::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void UsersReq::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReq.epoch)
+}
+
+// uint64 since = 2;
+inline void UsersReq::clear_since() {
+  _impl_.since_ = uint64_t{0u};
+}
+inline uint64_t UsersReq::_internal_since() const {
+  return _impl_.since_;
+}
+inline uint64_t UsersReq::since() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.UsersReq.since)
+  return _internal_since();
+}
+inline void UsersReq::_internal_set_since(uint64_t value) {
+  
+  _impl_.since_ = value;
+}
+inline void UsersReq::set_since(uint64_t value) {
+  _internal_set_since(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReq.since)
+}
+
+// -------------------------------------------------------------------
+
+// UsersReply
+
+// uint64 epoch = 1;
+inline void UsersReply::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+}
+inline uint64_t UsersReply::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t UsersReply::epoch() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.UsersReply.epoch)
+  return _internal_epoch();
+}
+inline void UsersReply::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void UsersReply::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReply.epoch)
+}
+
+// uint64 version = 2;
+inline void UsersReply::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t UsersReply::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t UsersReply::version() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.UsersReply.version)
+  return _internal_version();
+}
+inline void UsersReply::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void UsersReply::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReply.version)
+}
+
+// bool full = 3;
+inline void UsersReply::clear_full() {
+  _impl_.full_ = false;
+}
+inline bool UsersReply::_internal_full() const {
+  return _impl_.full_;
+}
+inline bool UsersReply::full() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.UsersReply.full)
+  return _internal_full();
+}
+inline void UsersReply::_internal_set_full(bool value) {
+  
+  _impl_.full_ = value;
+}
+inline void UsersReply::set_full(bool value) {
+  _internal_set_full(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReply.full)
+}
+
+// repeated string online = 4;
+inline int UsersReply::_internal_online_size() const {
+  return _impl_.online_.size();
+}
+inline int UsersReply::online_size() const {
+  return _internal_online_size();
+}
+inline void UsersReply::clear_online() {
+  _impl_.online_.Clear();
+}
+inline std::string* UsersReply::add_online() {
+  std::string* _s = _internal_add_online();
+  // @@protoc_insertion_point(field_add_mutable:ChatRoom.Comet.UsersReply.online)
+  return _s;
+}
+inline const std::string& UsersReply::_internal_online(int index) const {
+  return _impl_.online_.Get(index);
+}
+inline const std::string& UsersReply::online(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.UsersReply.online)
+  return _internal_online(index);
+}
+inline std::string* UsersReply::mutable_online(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.UsersReply.online)
+  return _impl_.online_.Mutable(index);
+}
+inline void UsersReply::set_online(int index, const std::string& value) {
+  _impl_.online_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReply.online)
+}
+inline void UsersReply::set_online(int index, std::string&& value) {
+  _impl_.online_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReply.online)
+}
+inline void UsersReply::set_online(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.online_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ChatRoom.Comet.UsersReply.online)
+}
+inline void UsersReply::set_online(int index, const char* value, size_t size) {
+  _impl_.online_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ChatRoom.Comet.UsersReply.online)
+}
+inline std::string* UsersReply::_internal_add_online() {
+  return _impl_.online_.Add();
+}
+inline void UsersReply::add_online(const std::string& value) {
+  _impl_.online_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.UsersReply.online)
+}
+inline void UsersReply::add_online(std::string&& value) {
+  _impl_.online_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.UsersReply.online)
+}
+inline void UsersReply::add_online(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.online_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ChatRoom.Comet.UsersReply.online)
+}
+inline void UsersReply::add_online(const char* value, size_t size) {
+  _impl_.online_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ChatRoom.Comet.UsersReply.online)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+UsersReply::online() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Comet.UsersReply.online)
+  return _impl_.online_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+UsersReply::mutable_online() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Comet.UsersReply.online)
+  return &_impl_.online_;
+}
+
+// repeated string offline = 5;
+inline int UsersReply::_internal_offline_size() const {
+  return _impl_.offline_.size();
+}
+inline int UsersReply::offline_size() const {
+  return _internal_offline_size();
+}
+inline void UsersReply::clear_offline() {
+  _impl_.offline_.Clear();
+}
+inline std::string* UsersReply::add_offline() {
+  std::string* _s = _internal_add_offline();
+  // @@protoc_insertion_point(field_add_mutable:ChatRoom.Comet.UsersReply.offline)
+  return _s;
+}
+inline const std::string& UsersReply::_internal_offline(int index) const {
+  return _impl_.offline_.Get(index);
+}
+inline const std::string& UsersReply::offline(int index) const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Comet.UsersReply.offline)
+  return _internal_offline(index);
+}
+inline std::string* UsersReply::mutable_offline(int index) {
+  // @@protoc_insertion_point(field_mutable:ChatRoom.Comet.UsersReply.offline)
+  return _impl_.offline_.Mutable(index);
+}
+inline void UsersReply::set_offline(int index, const std::string& value) {
+  _impl_.offline_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReply.offline)
+}
+inline void UsersReply::set_offline(int index, std::string&& value) {
+  _impl_.offline_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ChatRoom.Comet.UsersReply.offline)
+}
+inline void UsersReply::set_offline(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.offline_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ChatRoom.Comet.UsersReply.offline)
+}
+inline void UsersReply::set_offline(int index, const char* value, size_t size) {
+  _impl_.offline_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ChatRoom.Comet.UsersReply.offline)
+}
+inline std::string* UsersReply::_internal_add_offline() {
+  return _impl_.offline_.Add();
+}
+inline void UsersReply::add_offline(const std::string& value) {
+  _impl_.offline_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.UsersReply.offline)
+}
+inline void UsersReply::add_offline(std::string&& value) {
+  _impl_.offline_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ChatRoom.Comet.UsersReply.offline)
+}
+inline void UsersReply::add_offline(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.offline_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ChatRoom.Comet.UsersReply.offline)
+}
+inline void UsersReply::add_offline(const char* value, size_t size) {
+  _impl_.offline_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ChatRoom.Comet.UsersReply.offline)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+UsersReply::offline() const {
+  // @@protoc_insertion_point(field_list:ChatRoom.Comet.UsersReply.offline)
+  return _impl_.offline_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+UsersReply::mutable_offline() {
+  // @@protoc_insertion_point(field_mutable_list:ChatRoom.Comet.UsersReply.offline)
+  return &_impl_.offline_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1832,6 +3904,20 @@ RoomsReply::mutable_rooms() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
@@ -41,14 +40,6 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_ChatRoom_2eJob_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 namespace ChatRoom {
@@ -97,7 +88,7 @@ class PushMsg final :
  public:
   inline PushMsg() : PushMsg(nullptr) {}
   ~PushMsg() override;
-  explicit constexpr PushMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR PushMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PushMsg(const PushMsg& from);
   PushMsg(PushMsg&& from) noexcept
@@ -170,10 +161,10 @@ class PushMsg final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(PushMsg* other);
@@ -186,9 +177,6 @@ class PushMsg final :
   protected:
   explicit PushMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   std::string GetTypeName() const final;
@@ -233,6 +221,7 @@ class PushMsg final :
     kTypeFieldNumber = 1,
     kOperationFieldNumber = 2,
     kSpeedFieldNumber = 3,
+    kAttemptsFieldNumber = 8,
   };
   // repeated string keys = 6;
   int keys_size() const;
@@ -327,6 +316,15 @@ class PushMsg final :
   void _internal_set_speed(int32_t value);
   public:
 
+  // int32 attempts = 8;
+  void clear_attempts();
+  int32_t attempts() const;
+  void set_attempts(int32_t value);
+  private:
+  int32_t _internal_attempts() const;
+  void _internal_set_attempts(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:ChatRoom.Job.PushMsg)
  private:
   class _Internal;
@@ -334,14 +332,18 @@ class PushMsg final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
-  int type_;
-  int32_t operation_;
-  int32_t speed_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    int type_;
+    int32_t operation_;
+    int32_t speed_;
+    int32_t attempts_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_ChatRoom_2eJob_2eproto;
 };
 // -------------------------------------------------------------------
@@ -351,7 +353,7 @@ class Proto final :
  public:
   inline Proto() : Proto(nullptr) {}
   ~Proto() override;
-  explicit constexpr Proto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Proto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Proto(const Proto& from);
   Proto(Proto&& from) noexcept
@@ -424,10 +426,10 @@ class Proto final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(Proto* other);
@@ -440,9 +442,6 @@ class Proto final :
   protected:
   explicit Proto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   std::string GetTypeName() const final;
@@ -505,11 +504,14 @@ class Proto final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  int32_t ver_;
-  int32_t op_;
-  int32_t seq_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    int32_t ver_;
+    int32_t op_;
+    int32_t seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_ChatRoom_2eJob_2eproto;
 };
 // ===================================================================
@@ -525,10 +527,10 @@ class Proto final :
 
 // .ChatRoom.Job.PushMsg.Type type = 1;
 inline void PushMsg::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
 }
 inline ::ChatRoom::Job::PushMsg_Type PushMsg::_internal_type() const {
-  return static_cast< ::ChatRoom::Job::PushMsg_Type >(type_);
+  return static_cast< ::ChatRoom::Job::PushMsg_Type >(_impl_.type_);
 }
 inline ::ChatRoom::Job::PushMsg_Type PushMsg::type() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.type)
@@ -536,7 +538,7 @@ inline ::ChatRoom::Job::PushMsg_Type PushMsg::type() const {
 }
 inline void PushMsg::_internal_set_type(::ChatRoom::Job::PushMsg_Type value) {
   
-  type_ = value;
+  _impl_.type_ = value;
 }
 inline void PushMsg::set_type(::ChatRoom::Job::PushMsg_Type value) {
   _internal_set_type(value);
@@ -545,10 +547,10 @@ inline void PushMsg::set_type(::ChatRoom::Job::PushMsg_Type value) {
 
 // int32 operation = 2;
 inline void PushMsg::clear_operation() {
-  operation_ = 0;
+  _impl_.operation_ = 0;
 }
 inline int32_t PushMsg::_internal_operation() const {
-  return operation_;
+  return _impl_.operation_;
 }
 inline int32_t PushMsg::operation() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.operation)
@@ -556,7 +558,7 @@ inline int32_t PushMsg::operation() const {
 }
 inline void PushMsg::_internal_set_operation(int32_t value) {
   
-  operation_ = value;
+  _impl_.operation_ = value;
 }
 inline void PushMsg::set_operation(int32_t value) {
   _internal_set_operation(value);
@@ -565,10 +567,10 @@ inline void PushMsg::set_operation(int32_t value) {
 
 // int32 speed = 3;
 inline void PushMsg::clear_speed() {
-  speed_ = 0;
+  _impl_.speed_ = 0;
 }
 inline int32_t PushMsg::_internal_speed() const {
-  return speed_;
+  return _impl_.speed_;
 }
 inline int32_t PushMsg::speed() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.speed)
@@ -576,7 +578,7 @@ inline int32_t PushMsg::speed() const {
 }
 inline void PushMsg::_internal_set_speed(int32_t value) {
   
-  speed_ = value;
+  _impl_.speed_ = value;
 }
 inline void PushMsg::set_speed(int32_t value) {
   _internal_set_speed(value);
@@ -585,7 +587,7 @@ inline void PushMsg::set_speed(int32_t value) {
 
 // string server = 4;
 inline void PushMsg::clear_server() {
-  server_.ClearToEmpty();
+  _impl_.server_.ClearToEmpty();
 }
 inline const std::string& PushMsg::server() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.server)
@@ -595,7 +597,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void PushMsg::set_server(ArgT0&& arg0, ArgT... args) {
  
- server_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ChatRoom.Job.PushMsg.server)
 }
 inline std::string* PushMsg::mutable_server() {
@@ -604,19 +606,19 @@ inline std::string* PushMsg::mutable_server() {
   return _s;
 }
 inline const std::string& PushMsg::_internal_server() const {
-  return server_.Get();
+  return _impl_.server_.Get();
 }
 inline void PushMsg::_internal_set_server(const std::string& value) {
   
-  server_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.server_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PushMsg::_internal_mutable_server() {
   
-  return server_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.server_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PushMsg::release_server() {
   // @@protoc_insertion_point(field_release:ChatRoom.Job.PushMsg.server)
-  return server_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.server_.Release();
 }
 inline void PushMsg::set_allocated_server(std::string* server) {
   if (server != nullptr) {
@@ -624,11 +626,10 @@ inline void PushMsg::set_allocated_server(std::string* server) {
   } else {
     
   }
-  server_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), server,
-      GetArenaForAllocation());
+  _impl_.server_.SetAllocated(server, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (server_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.server_.IsDefault()) {
+    _impl_.server_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ChatRoom.Job.PushMsg.server)
@@ -636,7 +637,7 @@ inline void PushMsg::set_allocated_server(std::string* server) {
 
 // string room = 5;
 inline void PushMsg::clear_room() {
-  room_.ClearToEmpty();
+  _impl_.room_.ClearToEmpty();
 }
 inline const std::string& PushMsg::room() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.room)
@@ -646,7 +647,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void PushMsg::set_room(ArgT0&& arg0, ArgT... args) {
  
- room_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.room_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ChatRoom.Job.PushMsg.room)
 }
 inline std::string* PushMsg::mutable_room() {
@@ -655,19 +656,19 @@ inline std::string* PushMsg::mutable_room() {
   return _s;
 }
 inline const std::string& PushMsg::_internal_room() const {
-  return room_.Get();
+  return _impl_.room_.Get();
 }
 inline void PushMsg::_internal_set_room(const std::string& value) {
   
-  room_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.room_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PushMsg::_internal_mutable_room() {
   
-  return room_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.room_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PushMsg::release_room() {
   // @@protoc_insertion_point(field_release:ChatRoom.Job.PushMsg.room)
-  return room_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.room_.Release();
 }
 inline void PushMsg::set_allocated_room(std::string* room) {
   if (room != nullptr) {
@@ -675,11 +676,10 @@ inline void PushMsg::set_allocated_room(std::string* room) {
   } else {
     
   }
-  room_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), room,
-      GetArenaForAllocation());
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (room_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    room_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ChatRoom.Job.PushMsg.room)
@@ -687,13 +687,13 @@ inline void PushMsg::set_allocated_room(std::string* room) {
 
 // repeated string keys = 6;
 inline int PushMsg::_internal_keys_size() const {
-  return keys_.size();
+  return _impl_.keys_.size();
 }
 inline int PushMsg::keys_size() const {
   return _internal_keys_size();
 }
 inline void PushMsg::clear_keys() {
-  keys_.Clear();
+  _impl_.keys_.Clear();
 }
 inline std::string* PushMsg::add_keys() {
   std::string* _s = _internal_add_keys();
@@ -701,7 +701,7 @@ inline std::string* PushMsg::add_keys() {
   return _s;
 }
 inline const std::string& PushMsg::_internal_keys(int index) const {
-  return keys_.Get(index);
+  return _impl_.keys_.Get(index);
 }
 inline const std::string& PushMsg::keys(int index) const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.keys)
@@ -709,60 +709,60 @@ inline const std::string& PushMsg::keys(int index) const {
 }
 inline std::string* PushMsg::mutable_keys(int index) {
   // @@protoc_insertion_point(field_mutable:ChatRoom.Job.PushMsg.keys)
-  return keys_.Mutable(index);
+  return _impl_.keys_.Mutable(index);
 }
 inline void PushMsg::set_keys(int index, const std::string& value) {
-  keys_.Mutable(index)->assign(value);
+  _impl_.keys_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:ChatRoom.Job.PushMsg.keys)
 }
 inline void PushMsg::set_keys(int index, std::string&& value) {
-  keys_.Mutable(index)->assign(std::move(value));
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:ChatRoom.Job.PushMsg.keys)
 }
 inline void PushMsg::set_keys(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keys_.Mutable(index)->assign(value);
+  _impl_.keys_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:ChatRoom.Job.PushMsg.keys)
 }
 inline void PushMsg::set_keys(int index, const char* value, size_t size) {
-  keys_.Mutable(index)->assign(
+  _impl_.keys_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:ChatRoom.Job.PushMsg.keys)
 }
 inline std::string* PushMsg::_internal_add_keys() {
-  return keys_.Add();
+  return _impl_.keys_.Add();
 }
 inline void PushMsg::add_keys(const std::string& value) {
-  keys_.Add()->assign(value);
+  _impl_.keys_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:ChatRoom.Job.PushMsg.keys)
 }
 inline void PushMsg::add_keys(std::string&& value) {
-  keys_.Add(std::move(value));
+  _impl_.keys_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:ChatRoom.Job.PushMsg.keys)
 }
 inline void PushMsg::add_keys(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keys_.Add()->assign(value);
+  _impl_.keys_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:ChatRoom.Job.PushMsg.keys)
 }
 inline void PushMsg::add_keys(const char* value, size_t size) {
-  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:ChatRoom.Job.PushMsg.keys)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 PushMsg::keys() const {
   // @@protoc_insertion_point(field_list:ChatRoom.Job.PushMsg.keys)
-  return keys_;
+  return _impl_.keys_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 PushMsg::mutable_keys() {
   // @@protoc_insertion_point(field_mutable_list:ChatRoom.Job.PushMsg.keys)
-  return &keys_;
+  return &_impl_.keys_;
 }
 
 // bytes msg = 7;
 inline void PushMsg::clear_msg() {
-  msg_.ClearToEmpty();
+  _impl_.msg_.ClearToEmpty();
 }
 inline const std::string& PushMsg::msg() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.msg)
@@ -772,7 +772,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void PushMsg::set_msg(ArgT0&& arg0, ArgT... args) {
  
- msg_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.msg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ChatRoom.Job.PushMsg.msg)
 }
 inline std::string* PushMsg::mutable_msg() {
@@ -781,19 +781,19 @@ inline std::string* PushMsg::mutable_msg() {
   return _s;
 }
 inline const std::string& PushMsg::_internal_msg() const {
-  return msg_.Get();
+  return _impl_.msg_.Get();
 }
 inline void PushMsg::_internal_set_msg(const std::string& value) {
   
-  msg_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.msg_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PushMsg::_internal_mutable_msg() {
   
-  return msg_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PushMsg::release_msg() {
   // @@protoc_insertion_point(field_release:ChatRoom.Job.PushMsg.msg)
-  return msg_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.msg_.Release();
 }
 inline void PushMsg::set_allocated_msg(std::string* msg) {
   if (msg != nullptr) {
@@ -801,26 +801,45 @@ inline void PushMsg::set_allocated_msg(std::string* msg) {
   } else {
     
   }
-  msg_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), msg,
-      GetArenaForAllocation());
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (msg_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    msg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ChatRoom.Job.PushMsg.msg)
 }
 
+// int32 attempts = 8;
+inline void PushMsg::clear_attempts() {
+  _impl_.attempts_ = 0;
+}
+inline int32_t PushMsg::_internal_attempts() const {
+  return _impl_.attempts_;
+}
+inline int32_t PushMsg::attempts() const {
+  // @@protoc_insertion_point(field_get:ChatRoom.Job.PushMsg.attempts)
+  return _internal_attempts();
+}
+inline void PushMsg::_internal_set_attempts(int32_t value) {
+  
+  _impl_.attempts_ = value;
+}
+inline void PushMsg::set_attempts(int32_t value) {
+  _internal_set_attempts(value);
+  // @@protoc_insertion_point(field_set:ChatRoom.Job.PushMsg.attempts)
+}
+
 // -------------------------------------------------------------------
 
 // Proto
 
 // int32 ver = 1;
 inline void Proto::clear_ver() {
-  ver_ = 0;
+  _impl_.ver_ = 0;
 }
 inline int32_t Proto::_internal_ver() const {
-  return ver_;
+  return _impl_.ver_;
 }
 inline int32_t Proto::ver() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.Proto.ver)
@@ -828,7 +847,7 @@ inline int32_t Proto::ver() const {
 }
 inline void Proto::_internal_set_ver(int32_t value) {
   
-  ver_ = value;
+  _impl_.ver_ = value;
 }
 inline void Proto::set_ver(int32_t value) {
   _internal_set_ver(value);
@@ -837,10 +856,10 @@ inline void Proto::set_ver(int32_t value) {
 
 // int32 op = 2;
 inline void Proto::clear_op() {
-  op_ = 0;
+  _impl_.op_ = 0;
 }
 inline int32_t Proto::_internal_op() const {
-  return op_;
+  return _impl_.op_;
 }
 inline int32_t Proto::op() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.Proto.op)
@@ -848,7 +867,7 @@ inline int32_t Proto::op() const {
 }
 inline void Proto::_internal_set_op(int32_t value) {
   
-  op_ = value;
+  _impl_.op_ = value;
 }
 inline void Proto::set_op(int32_t value) {
   _internal_set_op(value);
@@ -857,10 +876,10 @@ inline void Proto::set_op(int32_t value) {
 
 // int32 seq = 3;
 inline void Proto::clear_seq() {
-  seq_ = 0;
+  _impl_.seq_ = 0;
 }
 inline int32_t Proto::_internal_seq() const {
-  return seq_;
+  return _impl_.seq_;
 }
 inline int32_t Proto::seq() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.Proto.seq)
@@ -868,7 +887,7 @@ inline int32_t Proto::seq() const {
 }
 inline void Proto::_internal_set_seq(int32_t value) {
   
-  seq_ = value;
+  _impl_.seq_ = value;
 }
 inline void Proto::set_seq(int32_t value) {
   _internal_set_seq(value);
@@ -877,7 +896,7 @@ inline void Proto::set_seq(int32_t value) {
 
 // bytes body = 4;
 inline void Proto::clear_body() {
-  body_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
 }
 inline const std::string& Proto::body() const {
   // @@protoc_insertion_point(field_get:ChatRoom.Job.Proto.body)
@@ -887,7 +906,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Proto::set_body(ArgT0&& arg0, ArgT... args) {
  
- body_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:ChatRoom.Job.Proto.body)
 }
 inline std::string* Proto::mutable_body() {
@@ -896,19 +915,19 @@ inline std::string* Proto::mutable_body() {
   return _s;
 }
 inline const std::string& Proto::_internal_body() const {
-  return body_.Get();
+  return _impl_.body_.Get();
 }
 inline void Proto::_internal_set_body(const std::string& value) {
   
-  body_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Proto::_internal_mutable_body() {
   
-  return body_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Proto::release_body() {
   // @@protoc_insertion_point(field_release:ChatRoom.Job.Proto.body)
-  return body_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.body_.Release();
 }
 inline void Proto::set_allocated_body(std::string* body) {
   if (body != nullptr) {
@@ -916,11 +935,10 @@ inline void Proto::set_allocated_body(std::string* body) {
   } else {
     
   }
-  body_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), body,
-      GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:ChatRoom.Job.Proto.body)
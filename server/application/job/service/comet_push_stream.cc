@@ -0,0 +1,224 @@
+#include "comet_push_stream.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <muduo/base/Logging.h>
+
+CometPushStream::CometPushStream(const std::string& server_address, const PushStreamOptions& options)
+    : server_address_(server_address), options_(options) {
+    if (options_.max_batch_items <= 0) {
+        options_.max_batch_items = 1;
+    }
+    if (options_.max_inflight_batches <= 0) {
+        options_.max_inflight_batches = 1;
+    }
+    // 0 表示不去重, 重启后的 job 换一个 epoch, seq 重新从 1 开始
+    std::random_device rd;
+    std::mt19937_64 gen((static_cast<uint64_t>(rd()) << 32) ^ rd() ^
+                        std::chrono::steady_clock::now().time_since_epoch().count());
+    do {
+        epoch_ = gen();
+    } while (epoch_ == 0);
+    auto channel = grpc::CreateChannel(server_address_, grpc::InsecureChannelCredentials());
+    stub_ = ChatRoom::Comet::Comet::NewStub(channel);
+    writer_ = std::thread(&CometPushStream::writerLoop, this);
+}
+
+CometPushStream::~CometPushStream() {
+    stop();
+}
+
+void CometPushStream::push(const std::string& room_id, int op, const std::string& body, const PushTag& tag,
+                           int speed) {
+    ChatRoom::Comet::PushItem item;
+    item.set_roomid(room_id);
+    item.set_speed(speed);
+    ChatRoom::Protocol::Proto* proto = item.mutable_proto();
+    proto->set_ver(1);
+    proto->set_op(op);
+    proto->set_seq(0);
+    proto->set_body(body);
+    enqueue(std::move(item), tag);
+}
+
+void CometPushStream::pushKeys(const std::vector<std::string>& keys, int op, const std::string& body,
+                               const PushTag& tag) {
+    ChatRoom::Comet::PushItem item;
+    for (const std::string& key : keys) {
+        item.add_keys(key);
+    }
+    ChatRoom::Protocol::Proto* proto = item.mutable_proto();
+    proto->set_ver(1);
+    proto->set_op(op);
+    proto->set_seq(0);
+    proto->set_body(body);
+    enqueue(std::move(item), tag);
+}
+
+void CometPushStream::enqueue(ChatRoom::Comet::PushItem&& item, const PushTag& tag) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // comet 跟不上时阻塞消费线程, 而不是无限堆积
+    size_t limit = static_cast<size_t>(options_.max_batch_items) * options_.max_inflight_batches;
+    cond_.wait(lock, [&]() { return stopping_ || pending_.size() < limit; });
+    pending_.push_back(std::move(item));
+    pending_tags_.push_back(tag);
+    cond_.notify_all();
+}
+
+void CometPushStream::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+        cond_.notify_all();
+    }
+    writer_.join();
+}
+
+void CometPushStream::writerLoop() {
+    int backoff_ms = 100;
+    while (true) {
+        if (runSession()) {
+            backoff_ms = 100;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stopping_) {
+            if (!pending_.empty() || !inflight_.empty()) {
+                LOG_WARN << "PushStream stopped with " << pending_.size() << " pending items and "
+                         << inflight_.size() << " unacked batches";
+            }
+            return;
+        }
+        // 断线重连, 退避上限 5s
+        cond_.wait_for(lock, std::chrono::milliseconds(backoff_ms), [this]() { return stopping_; });
+        backoff_ms = std::min(backoff_ms * 2, 5000);
+    }
+}
+
+bool CometPushStream::runSession() {
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::ClientReaderWriter<ChatRoom::Comet::PushBatch, ChatRoom::Comet::PushAck>> stream(
+        stub_->PushStream(&context));
+
+    std::vector<ChatRoom::Comet::PushBatch> resend;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        broken_ = false;
+        for (const auto& inflight : inflight_) {
+            resend.push_back(inflight.batch);
+        }
+    }
+    int acks = 0;
+    std::thread reader(&CometPushStream::readerLoop, this, stream.get(), &acks);
+
+    // 未应答的批次按原 seq 重发, 旧流上已处理过的由 comet 按 epoch/seq 跳过, 只补应答
+    bool ok = true;
+    for (const auto& batch : resend) {
+        if (!stream->Write(batch)) {
+            ok = false;
+            break;
+        }
+    }
+    if (ok && !resend.empty()) {
+        LOG_INFO << "PushStream resent " << resend.size() << " unacked batches to " << server_address_;
+    }
+
+    ChatRoom::Comet::PushBatch batch;
+    while (ok && takeBatch(batch)) {
+        ok = stream->Write(batch);
+        batch.Clear();
+    }
+
+    bool graceful = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        graceful = ok && stopping_ && !broken_;
+    }
+    if (graceful) {
+        // comet 处理完所有批次后结束流, reader 收完最后的应答
+        stream->WritesDone();
+    }
+    else {
+        context.TryCancel();
+    }
+    reader.join();
+
+    grpc::Status status = stream->Finish();
+    if (!graceful) {
+        LOG_WARN << "PushStream to " << server_address_ << " broken: " << status.error_message();
+    }
+    return acks > 0;
+}
+
+void CometPushStream::readerLoop(
+    grpc::ClientReaderWriter<ChatRoom::Comet::PushBatch, ChatRoom::Comet::PushAck>* stream, int* acks) {
+    ChatRoom::Comet::PushAck ack;
+    std::vector<PushTag> acked;
+    while (stream->Read(&ack)) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            (*acks)++;
+            // 应答按 seq 有序, seq 之前的批次都已投递
+            while (!inflight_.empty() && inflight_.front().seq <= ack.seq()) {
+                if (ack_callback_) {
+                    acked.insert(acked.end(), inflight_.front().tags.begin(), inflight_.front().tags.end());
+                }
+                inflight_.pop_front();
+            }
+            if (ack.failed() > 0) {
+                LOG_WARN << "PushBatch " << ack.seq() << " has " << ack.failed() << " items rejected by comet";
+            }
+            cond_.notify_all();
+        }
+        // comet 拒绝的推送(例如缺少房间id)重试也不会成功, 同样算作完成
+        if (!acked.empty()) {
+            ack_callback_(acked);
+            acked.clear();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    broken_ = true;
+    cond_.notify_all();
+}
+
+bool CometPushStream::takeBatch(ChatRoom::Comet::PushBatch& batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this]() {
+        return stopping_ || broken_ ||
+               (!pending_.empty() && inflight_.size() < static_cast<size_t>(options_.max_inflight_batches));
+    });
+    if (broken_ || pending_.empty()) {
+        return false;
+    }
+
+    // 攒批: 不足一批时最多再等 linger_ms
+    size_t max_items = static_cast<size_t>(options_.max_batch_items);
+    if (pending_.size() < max_items && !stopping_ && options_.linger_ms > 0) {
+        cond_.wait_for(lock, std::chrono::milliseconds(options_.linger_ms), [&]() {
+            return stopping_ || broken_ || pending_.size() >= max_items;
+        });
+        if (broken_) {
+            return false;
+        }
+    }
+
+    size_t n = std::min(pending_.size(), max_items);
+    std::vector<PushTag> tags;
+    tags.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        *batch.add_items() = std::move(pending_.front());
+        pending_.pop_front();
+        tags.push_back(pending_tags_.front());
+        pending_tags_.pop_front();
+    }
+    batch.set_epoch(epoch_);
+    batch.set_seq(next_seq_++);
+    inflight_.push_back({batch.seq(), batch, std::move(tags)});
+    cond_.notify_all();
+    return true;
+}
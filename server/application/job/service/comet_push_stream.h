@@ -0,0 +1,79 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <grpcpp/grpcpp.h>
+#include "ChatRoom.Comet.grpc.pb.h"
+#include "offset_tracker.h"
+
+struct PushStreamOptions {
+    int max_batch_items = 64;       // items per PushBatch
+    int linger_ms = 2;              // wait this long for more items before sending a partial batch
+    int max_inflight_batches = 128; // unacked batches, push() blocks beyond it
+};
+
+/**
+ * job -> comet 的长连接推送通道
+ * 一条 PushStream 双向流, 推送攒成批次发送, comet 按 seq 应答;
+ * 流断开后重连, 未应答的批次按原 epoch/seq 重发, comet 跳过已处理过的 seq, 应答后交回批次内消息的 tag
+ */
+class CometPushStream {
+public:
+    CometPushStream(const std::string& server_address, const PushStreamOptions& options = PushStreamOptions());
+    ~CometPushStream();
+
+    // called with the tags of a batch once the comet acks it, from the reader thread, set before the first push
+    void setAckCallback(const std::function<void(const std::vector<PushTag>& tags)>& callback) {
+        ack_callback_ = callback;
+    }
+
+    // empty room_id broadcasts to every user at speed conns per second (0 at once), thread safe
+    void push(const std::string& room_id, int op, const std::string& body, const PushTag& tag = PushTag(),
+              int speed = 0);
+    // pushes to the users connected to the comet, thread safe
+    void pushKeys(const std::vector<std::string>& keys, int op, const std::string& body,
+                  const PushTag& tag = PushTag());
+
+    // sends what is queued, then closes the stream
+    void stop();
+
+private:
+    // queues an item, blocks while too many are pending
+    void enqueue(ChatRoom::Comet::PushItem&& item, const PushTag& tag);
+
+    struct Inflight {
+        uint64_t seq;
+        ChatRoom::Comet::PushBatch batch;
+        std::vector<PushTag> tags;
+    };
+
+    void writerLoop();
+    // one stream session, returns when it breaks or stop() is called, true if the comet acked anything
+    bool runSession();
+    void readerLoop(grpc::ClientReaderWriter<ChatRoom::Comet::PushBatch, ChatRoom::Comet::PushAck>* stream,
+                    int* acks);
+    // takes up to max_batch_items, waits linger_ms for a partial batch, false when stopping or broken
+    bool takeBatch(ChatRoom::Comet::PushBatch& batch);
+
+    std::string server_address_;
+    PushStreamOptions options_;
+    std::unique_ptr<ChatRoom::Comet::Comet::Stub> stub_;
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<ChatRoom::Comet::PushItem> pending_;     // not batched yet
+    std::deque<PushTag> pending_tags_;                  // one per pending item
+    std::deque<Inflight> inflight_;                     // sent, waiting for the ack
+    uint64_t epoch_;            // random per object, the comet keeps the last seq it applied for it
+    uint64_t next_seq_ = 1;
+    bool broken_ = false;       // the reader saw the stream end
+    bool stopping_ = false;
+    std::thread writer_;
+    std::function<void(const std::vector<PushTag>& tags)> ack_callback_;
+};
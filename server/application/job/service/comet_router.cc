@@ -0,0 +1,315 @@
+#include "comet_router.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <muduo/base/Logging.h>
+
+namespace {
+// how long a comet holds a Rooms call without changes
+const int kWatchWaitMs = 30000;
+}
+
+CometRouter::CometRouter(const std::vector<std::string>& servers, int refresh_ms)
+    : servers_(servers),
+      refresh_ms_(std::max(refresh_ms, 100)),
+      reported_rooms_(servers.size()),
+      reported_(servers.size(), false),
+      rooms_epochs_(servers.size(), 0),
+      rooms_versions_(servers.size(), 0),
+      watches_(servers.size()),
+      user_epochs_(servers.size(), 0),
+      user_versions_(servers.size(), 0),
+      users_reported_(servers.size(), false),
+      presence_(std::make_shared<Presence>()) {
+    for (const std::string& server : servers_) {
+        auto channel = grpc::CreateChannel(server, grpc::InsecureChannelCredentials());
+        stubs_.push_back(ChatRoom::Comet::Comet::NewStub(channel));
+    }
+}
+
+CometRouter::~CometRouter() {
+    stop();
+}
+
+int CometRouter::indexOf(const std::string& server) const {
+    auto it = std::find(servers_.begin(), servers_.end(), server);
+    return it == servers_.end() ? -1 : static_cast<int>(it - servers_.begin());
+}
+
+void CometRouter::route(const std::string& room_id, std::vector<size_t>& comets) const {
+    comets.clear();
+    std::shared_ptr<const Presence> presence;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        presence = presence_;
+    }
+
+    auto it = presence->rooms.find(room_id);
+    if (servers_.size() == 1 || it == presence->rooms.end()) {
+        for (size_t i = 0; i < servers_.size(); i++) {
+            comets.push_back(i);
+        }
+        return;
+    }
+
+    comets = it->second;
+    for (size_t i = 0; i < servers_.size(); i++) {
+        if (!presence->reported[i]) {
+            comets.push_back(i);
+        }
+    }
+}
+
+void CometRouter::routeUsers(const std::vector<std::string>& user_ids,
+                             std::vector<std::pair<size_t, std::vector<std::string>>>& comets) const {
+    comets.clear();
+    if (servers_.size() == 1) {
+        comets.emplace_back(0, user_ids);
+        return;
+    }
+
+    std::vector<std::vector<std::string>> grouped(servers_.size());
+    {
+        std::lock_guard<std::mutex> lock(users_mutex_);
+        for (size_t i = 0; i < servers_.size(); i++) {
+            if (!users_reported_[i]) {
+                grouped[i] = user_ids;
+            }
+        }
+        for (const std::string& user_id : user_ids) {
+            auto it = user_comets_.find(user_id);
+            if (it == user_comets_.end()) {
+                continue;
+            }
+            for (size_t i : it->second) {
+                if (users_reported_[i]) {
+                    grouped[i].push_back(user_id);
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < grouped.size(); i++) {
+        if (!grouped[i].empty()) {
+            comets.emplace_back(i, std::move(grouped[i]));
+        }
+    }
+}
+
+void CometRouter::start() {
+    if (servers_.size() <= 1 || thread_.joinable()) {
+        return;
+    }
+    refresh();
+    // only fires when stop() cancels it
+    stop_alarm_.Set(&watch_cq_, gpr_inf_future(GPR_CLOCK_REALTIME), &stop_alarm_);
+    thread_ = std::thread(&CometRouter::refreshLoop, this);
+}
+
+void CometRouter::stop() {
+    if (thread_.joinable()) {
+        stop_alarm_.Cancel();
+        thread_.join();
+    }
+}
+
+void CometRouter::refresh() {
+    // 各 comet 的 Rooms 和 Users 并行查询, 总耗时取决于最慢的一个
+    struct RoomsCall {
+        grpc::ClientContext context;
+        ChatRoom::Comet::RoomsReply reply;
+        grpc::Status status;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ChatRoom::Comet::RoomsReply>> reader;
+    };
+    struct UsersCall {
+        grpc::ClientContext context;
+        ChatRoom::Comet::UsersReply reply;
+        grpc::Status status;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ChatRoom::Comet::UsersReply>> reader;
+    };
+    grpc::CompletionQueue cq;
+    auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(refresh_ms_);
+    std::vector<std::unique_ptr<RoomsCall>> rooms_calls;
+    std::vector<std::unique_ptr<UsersCall>> users_calls;
+    for (size_t i = 0; i < servers_.size(); i++) {
+        rooms_calls.push_back(std::make_unique<RoomsCall>());
+        RoomsCall* rooms_call = rooms_calls.back().get();
+        rooms_call->context.set_deadline(deadline);
+        ChatRoom::Comet::RoomsReq rooms_req;
+        rooms_req.set_epoch(rooms_epochs_[i]);
+        rooms_req.set_version(rooms_versions_[i]);
+        rooms_call->reader = stubs_[i]->AsyncRooms(&rooms_call->context, rooms_req, &cq);
+        // tag: 2 * comet for Rooms, 2 * comet + 1 for Users
+        rooms_call->reader->Finish(&rooms_call->reply, &rooms_call->status, reinterpret_cast<void*>(2 * i));
+
+        ChatRoom::Comet::UsersReq users_req;
+        users_req.set_epoch(user_epochs_[i]);
+        users_req.set_since(user_versions_[i]);
+        users_calls.push_back(std::make_unique<UsersCall>());
+        UsersCall* users_call = users_calls.back().get();
+        users_call->context.set_deadline(deadline);
+        users_call->reader = stubs_[i]->AsyncUsers(&users_call->context, users_req, &cq);
+        users_call->reader->Finish(&users_call->reply, &users_call->status, reinterpret_cast<void*>(2 * i + 1));
+    }
+    for (size_t n = 0; n < 2 * servers_.size(); n++) {
+        void* tag;
+        bool ok;
+        if (!cq.Next(&tag, &ok)) {
+            break;
+        }
+        size_t i = reinterpret_cast<size_t>(tag) / 2;
+        // 查询失败保留上一次的结果, comet 宕机期间的推送会失败并进入重试
+        if (reinterpret_cast<size_t>(tag) % 2 == 1) {
+            UsersCall* call = users_calls[i].get();
+            if (!ok || !call->status.ok()) {
+                LOG_WARN << "Users of comet " << servers_[i] << " failed: " << call->status.error_message();
+                continue;
+            }
+            applyUsers(i, call->reply);
+            continue;
+        }
+        RoomsCall* call = rooms_calls[i].get();
+        if (!ok || !call->status.ok()) {
+            LOG_WARN << "Rooms of comet " << servers_[i] << " failed: " << call->status.error_message();
+            continue;
+        }
+        applyRooms(i, call->reply);
+    }
+    cq.Shutdown();
+    void* ignored_tag;
+    bool ignored_ok;
+    while (cq.Next(&ignored_tag, &ignored_ok)) {
+    }
+    publish();
+}
+
+void CometRouter::applyRooms(size_t comet, const ChatRoom::Comet::RoomsReply& reply) {
+    // a poll answered before a watch of the same comet may be handled after it
+    if (reply.epoch() != 0 && reply.epoch() == rooms_epochs_[comet] && reply.version() < rooms_versions_[comet]) {
+        return;
+    }
+    std::vector<std::string>& rooms = reported_rooms_[comet];
+    rooms.clear();
+    for (const auto& room : reply.rooms()) {
+        if (room.second) {
+            rooms.push_back(room.first);
+        }
+    }
+    reported_[comet] = true;
+    rooms_epochs_[comet] = reply.epoch();
+    rooms_versions_[comet] = reply.version();
+}
+
+void CometRouter::publish() {
+    auto presence = std::make_shared<Presence>();
+    presence->reported = reported_;
+    for (size_t i = 0; i < reported_rooms_.size(); i++) {
+        for (const std::string& room_id : reported_rooms_[i]) {
+            presence->rooms[room_id].push_back(i);
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    presence_ = std::move(presence);
+}
+
+void CometRouter::applyUsers(size_t comet, const ChatRoom::Comet::UsersReply& reply) {
+    auto remove = [this, comet](const std::string& user_id) {
+        auto it = user_comets_.find(user_id);
+        if (it == user_comets_.end()) {
+            return;
+        }
+        it->second.erase(std::remove(it->second.begin(), it->second.end(), comet), it->second.end());
+        if (it->second.empty()) {
+            user_comets_.erase(it);
+        }
+    };
+    auto add = [this, comet](const std::string& user_id) {
+        std::vector<size_t>& comets = user_comets_[user_id];
+        if (std::find(comets.begin(), comets.end(), comet) == comets.end()) {
+            comets.push_back(comet);
+        }
+    };
+
+    std::lock_guard<std::mutex> lock(users_mutex_);
+    // 全量列表(首次查询或 comet 重启)替换该 comet 之前的登记
+    if (reply.full()) {
+        for (auto it = user_comets_.begin(); it != user_comets_.end();) {
+            std::vector<size_t>& comets = it->second;
+            comets.erase(std::remove(comets.begin(), comets.end(), comet), comets.end());
+            it = comets.empty() ? user_comets_.erase(it) : std::next(it);
+        }
+    }
+    for (const std::string& user_id : reply.offline()) {
+        remove(user_id);
+    }
+    for (const std::string& user_id : reply.online()) {
+        add(user_id);
+    }
+    users_reported_[comet] = true;
+    user_epochs_[comet] = reply.epoch();
+    user_versions_[comet] = reply.version();
+}
+
+void CometRouter::watch(size_t comet) {
+    auto call = std::make_unique<WatchCall>();
+    call->context.set_deadline(std::chrono::system_clock::now() +
+                               std::chrono::milliseconds(kWatchWaitMs + refresh_ms_));
+    ChatRoom::Comet::RoomsReq request;
+    request.set_epoch(rooms_epochs_[comet]);
+    request.set_version(rooms_versions_[comet]);
+    request.set_wait_ms(kWatchWaitMs);
+    call->reader = stubs_[comet]->AsyncRooms(&call->context, request, &watch_cq_);
+    call->reader->Finish(&call->reply, &call->status, reinterpret_cast<void*>(comet));
+    watches_[comet] = std::move(call);
+}
+
+void CometRouter::refreshLoop() {
+    // a comet that never reported an epoch can't hold the call, it's only polled
+    for (size_t i = 0; i < servers_.size(); i++) {
+        if (rooms_epochs_[i] != 0) {
+            watch(i);
+        }
+    }
+
+    auto next_refresh = std::chrono::system_clock::now() + std::chrono::milliseconds(refresh_ms_);
+    while (true) {
+        void* tag;
+        bool ok;
+        grpc::CompletionQueue::NextStatus status = watch_cq_.AsyncNext(&tag, &ok, next_refresh);
+        if (status == grpc::CompletionQueue::SHUTDOWN || (status == grpc::CompletionQueue::GOT_EVENT && tag == &stop_alarm_)) {
+            break;
+        }
+        if (status == grpc::CompletionQueue::GOT_EVENT) {
+            size_t i = reinterpret_cast<size_t>(tag);
+            std::unique_ptr<WatchCall> call = std::move(watches_[i]);
+            // a failed watch is started again after the next refresh
+            if (ok && call->status.ok()) {
+                applyRooms(i, call->reply);
+                publish();
+                if (call->reply.epoch() != 0) {
+                    watch(i);
+                }
+            }
+        }
+        if (std::chrono::system_clock::now() >= next_refresh) {
+            refresh();
+            for (size_t i = 0; i < servers_.size(); i++) {
+                if (!watches_[i] && rooms_epochs_[i] != 0) {
+                    watch(i);
+                }
+            }
+            next_refresh = std::chrono::system_clock::now() + std::chrono::milliseconds(refresh_ms_);
+        }
+    }
+
+    for (auto& call : watches_) {
+        if (call) {
+            call->context.TryCancel();
+        }
+    }
+    watch_cq_.Shutdown();
+    void* ignored_tag;
+    bool ignored_ok;
+    while (watch_cq_.Next(&ignored_tag, &ignored_ok)) {
+    }
+    watches_.clear();
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <grpcpp/alarm.h>
+#include <grpcpp/grpcpp.h>
+#include "ChatRoom.Comet.grpc.pb.h"
+
+/**
+ * job 侧的 comet 节点集合, 房间分布和用户位置
+ * 刷新线程定期向每个 comet 调用 Rooms, 得到 room -> 有成员的 comet 的映射, 整体替换快照;
+ * 同时调用 Users 取回上次之后的上下线变化, 增量维护 user -> comet 的登记表
+ * 房间消息只推给有成员的 comet, 指定用户的推送只推给这些用户所在的 comet, 全局广播推给所有 comet
+ * 房间分布还通过挂起的 Rooms 调用(wait_ms)监听: comet 上某个房间有了第一个成员时立即应答,
+ * job 马上更新快照, 不用等下一次刷新, 新成员最多错过一个往返时间内的消息;
+ * 不支持挂起的 comet 退回到 refresh_ms 的轮询
+ * 还没有任何 comet 上报的房间(新房间)和没有成功上报过的 comet 都按"可能有成员"处理,
+ * 宁可多推不漏推; 登记表里没有的用户按离线处理
+ */
+class CometRouter {
+public:
+    // servers: "host:port" of every comet, the index of a server is its id in route()
+    CometRouter(const std::vector<std::string>& servers, int refresh_ms = 1000);
+    ~CometRouter();
+
+    const std::vector<std::string>& servers() const { return servers_; }
+    // index of the server, -1 if it's not configured
+    int indexOf(const std::string& server) const;
+
+    // comets to push a message of the room to, thread safe
+    void route(const std::string& room_id, std::vector<size_t>& comets) const;
+
+    // (comet, its users) of the users online somewhere, thread safe
+    void routeUsers(const std::vector<std::string>& user_ids,
+                    std::vector<std::pair<size_t, std::vector<std::string>>>& comets) const;
+
+    // refreshes once, then keeps refreshing in a thread; a single comet is never polled
+    void start();
+    void stop();
+
+private:
+    // immutable snapshot, replaced as a whole on every refresh
+    struct Presence {
+        std::unordered_map<std::string, std::vector<size_t>> rooms;     // room_id -> comets with members
+        std::vector<bool> reported;                                     // the comet answered Rooms at least once
+    };
+
+    struct WatchCall {
+        grpc::ClientContext context;
+        ChatRoom::Comet::RoomsReply reply;
+        grpc::Status status;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ChatRoom::Comet::RoomsReply>> reader;
+    };
+
+    void refresh();
+    void refreshLoop();
+    // replaces the rooms of comet with a Rooms reply
+    void applyRooms(size_t comet, const ChatRoom::Comet::RoomsReply& reply);
+    // builds and publishes a new snapshot from reported_rooms_
+    void publish();
+    // holds a Rooms call on the comet, answered when its rooms version moves past ours
+    void watch(size_t comet);
+    // applies a Users reply of comet to user_comets_
+    void applyUsers(size_t comet, const ChatRoom::Comet::UsersReply& reply);
+
+    std::vector<std::string> servers_;
+    std::vector<std::unique_ptr<ChatRoom::Comet::Comet::Stub>> stubs_;
+    int refresh_ms_;
+
+    // last rooms reported by every comet, only touched by the refresh thread
+    std::vector<std::vector<std::string>> reported_rooms_;
+    std::vector<bool> reported_;
+    std::vector<uint64_t> rooms_epochs_;
+    std::vector<uint64_t> rooms_versions_;
+
+    // held Rooms calls, one per comet, polled by the refresh thread together with its timer;
+    // stop() cancels stop_alarm_ to wake it
+    grpc::CompletionQueue watch_cq_;
+    grpc::Alarm stop_alarm_;
+    std::vector<std::unique_ptr<WatchCall>> watches_;
+
+    // user -> comets registry, only written by the refresh thread
+    std::vector<uint64_t> user_epochs_;
+    std::vector<uint64_t> user_versions_;
+    mutable std::mutex users_mutex_;
+    std::unordered_map<std::string, std::vector<size_t>> user_comets_;
+    std::vector<bool> users_reported_;                                  // guarded by users_mutex_
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<const Presence> presence_;
+    std::thread thread_;
+};
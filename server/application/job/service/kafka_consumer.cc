@@ -22,7 +22,10 @@ bool KafkaConsumer::init() {
         // 设置基本配置
         if (conf_->set("bootstrap.servers", brokers_, errstr) != RdKafka::Conf::CONF_OK ||
             conf_->set("group.id", group_id_, errstr) != RdKafka::Conf::CONF_OK ||
-            conf_->set("auto.offset.reset", "earliest", errstr) != RdKafka::Conf::CONF_OK) {
+            conf_->set("auto.offset.reset", "earliest", errstr) != RdKafka::Conf::CONF_OK ||
+            // 手动提交: 推送被 comet 确认(或转入重试 topic)之后才提交 offset
+            conf_->set("enable.auto.commit", "false", errstr) != RdKafka::Conf::CONF_OK ||
+            conf_->set("enable.auto.offset.store", "false", errstr) != RdKafka::Conf::CONF_OK) {
             std::cerr << "Configuration error: " << errstr << std::endl;
             return false;
         }
@@ -96,6 +99,64 @@ std::string KafkaConsumer::consume(int timeout_ms) {
     return message_payload;
 }
 
+size_t KafkaConsumer::consumeBatch(std::vector<KafkaMessage>& messages, size_t max_messages, int timeout_ms) {
+    size_t count = 0;
+    int wait_ms = timeout_ms;
+    while (count < max_messages) {
+        std::unique_ptr<RdKafka::Message> msg(consumer_->consume(wait_ms));
+        // 第一条之后只取本地队列里已有的, 不再等待
+        wait_ms = 0;
+
+        if (msg->err() == RdKafka::ERR__TIMED_OUT) {
+            break;
+        }
+        if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
+            continue;
+        }
+        if (msg->err() != RdKafka::ERR_NO_ERROR) {
+            std::cerr << "Consume error: " << msg->errstr() << std::endl;
+            break;
+        }
+        if (!msg->payload()) {
+            continue;
+        }
+
+        KafkaMessage message;
+        message.payload.assign(static_cast<const char*>(msg->payload()), msg->len());
+        if (msg->key()) {
+            message.key = *msg->key();
+        }
+        message.partition = msg->partition();
+        message.offset = msg->offset();
+        message.timestamp_ms = msg->timestamp().timestamp;
+        messages.push_back(std::move(message));
+        count++;
+    }
+    return count;
+}
+
+bool KafkaConsumer::commitAsync(const std::vector<std::pair<int32_t, int64_t>>& offsets) {
+    if (offsets.empty()) {
+        return true;
+    }
+
+    std::vector<RdKafka::TopicPartition*> partitions;
+    partitions.reserve(offsets.size());
+    for (const auto& offset : offsets) {
+        partitions.push_back(RdKafka::TopicPartition::create(topic_, offset.first, offset.second));
+    }
+    RdKafka::ErrorCode err = consumer_->commitAsync(partitions);
+    for (RdKafka::TopicPartition* partition : partitions) {
+        delete partition;
+    }
+
+    if (err != RdKafka::ERR_NO_ERROR) {
+        std::cerr << "Commit error: " << RdKafka::err2str(err) << std::endl;
+        return false;
+    }
+    return true;
+}
+
 KafkaConsumer::~KafkaConsumer() {
     if (consumer_) {
         consumer_->close();
@@ -1,9 +1,21 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 #include <librdkafka/rdkafkacpp.h>
 #include <memory>
 
+// 消费到的一条消息及其位置
+struct KafkaMessage {
+    std::string payload;
+    std::string key;
+    int32_t partition = -1;
+    int64_t offset = -1;
+    int64_t timestamp_ms = -1;      // 生产时间
+};
+
 class KafkaConsumer {
 public:
     // 构造函数只初始化基本参数
@@ -20,6 +32,13 @@ public:
     // 消费消息，返回消息内容
     std::string consume(int timeout_ms = 1000);
 
+    // 批量消费: 最多等待 timeout_ms 拿到第一条, 再取走已拉取到本地的消息, 最多 max_messages 条
+    // 返回追加到 messages 的条数
+    size_t consumeBatch(std::vector<KafkaMessage>& messages, size_t max_messages, int timeout_ms = 1000);
+
+    // 异步提交 (partition, 下一条要消费的 offset), 不等待 broker 应答
+    bool commitAsync(const std::vector<std::pair<int32_t, int64_t>>& offsets);
+
     // 检查连接状态
     bool is_connected() const { return consumer_ != nullptr; }
 
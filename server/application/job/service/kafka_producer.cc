@@ -0,0 +1,116 @@
+#include "kafka_producer.h"
+#include <muduo/base/Logging.h>
+
+namespace {
+// 消息体和回调, 作为 opaque 交给 librdkafka, 投递回调里释放
+struct PendingMessage {
+    std::string payload;
+    KafkaProducer::DeliveryCallback on_delivery;
+};
+}
+
+KafkaProducer::KafkaProducer() {
+}
+
+KafkaProducer::~KafkaProducer() {
+    close();
+}
+
+bool KafkaProducer::init(const std::string& brokers, const std::string& topic) {
+    if (producer_) {
+        return true;
+    }
+
+    std::string errstr;
+    RdKafka::Conf* conf = RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL);
+    if (conf->set("bootstrap.servers", brokers, errstr) != RdKafka::Conf::CONF_OK ||
+        conf->set("dr_cb", &delivery_report_, errstr) != RdKafka::Conf::CONF_OK) {
+        LOG_ERROR << "Kafka producer configuration error: " << errstr;
+        delete conf;
+        return false;
+    }
+
+    producer_ = RdKafka::Producer::create(conf, errstr);
+    delete conf;
+    if (!producer_) {
+        LOG_ERROR << "Failed to create producer: " << errstr;
+        return false;
+    }
+
+    RdKafka::Conf* tconf = RdKafka::Conf::create(RdKafka::Conf::CONF_TOPIC);
+    tconf->set("partitioner", "consistent_random", errstr);
+    topic_ = RdKafka::Topic::create(producer_, topic, tconf, errstr);
+    delete tconf;
+    if (!topic_) {
+        LOG_ERROR << "Failed to create topic " << topic << ": " << errstr;
+        delete producer_;
+        producer_ = nullptr;
+        return false;
+    }
+
+    polling_ = true;
+    poll_thread_ = std::thread(&KafkaProducer::pollLoop, this);
+    LOG_INFO << "Kafka producer for " << topic << " initialized";
+    return true;
+}
+
+bool KafkaProducer::sendMessage(std::string message, const std::string& key, DeliveryCallback on_delivery) {
+    if (!producer_) {
+        LOG_ERROR << "Kafka producer not initialized";
+        return false;
+    }
+
+    PendingMessage* pending = new PendingMessage{std::move(message), std::move(on_delivery)};
+    RdKafka::ErrorCode resp = producer_->produce(
+        topic_,
+        RdKafka::Topic::PARTITION_UA,
+        RdKafka::Producer::RK_MSG_BLOCK,   // 本地队列满时阻塞, 由 poll 线程腾出空间
+        const_cast<char*>(pending->payload.data()),
+        pending->payload.size(),
+        key.empty() ? nullptr : &key,
+        pending
+    );
+    if (resp != RdKafka::ERR_NO_ERROR) {
+        LOG_ERROR << "Failed to produce message: " << RdKafka::err2str(resp);
+        delete pending;
+        return false;
+    }
+    return true;
+}
+
+void KafkaProducer::pollLoop() {
+    while (polling_) {
+        producer_->poll(100);
+    }
+}
+
+void KafkaProducer::close() {
+    if (!producer_) {
+        return;
+    }
+    producer_->flush(10 * 1000);
+    polling_ = false;
+    if (poll_thread_.joinable()) {
+        poll_thread_.join();
+    }
+    if (producer_->outq_len() > 0) {
+        LOG_WARN << "Kafka producer closed with " << producer_->outq_len() << " messages undelivered";
+    }
+    delete topic_;
+    topic_ = nullptr;
+    delete producer_;
+    producer_ = nullptr;
+}
+
+void KafkaProducer::DeliveryReport::dr_cb(RdKafka::Message& message) {
+    PendingMessage* pending = static_cast<PendingMessage*>(message.msg_opaque());
+    if (message.err()) {
+        LOG_ERROR << "Message delivery failed: " << message.errstr();
+    }
+    if (pending) {
+        if (pending->on_delivery) {
+            pending->on_delivery(!message.err());
+        }
+        delete pending;
+    }
+}
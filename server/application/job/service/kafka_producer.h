@@ -0,0 +1,42 @@
+#pragma once
+
+#include <librdkafka/rdkafkacpp.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+
+/**
+ * job 写重试 topic 用的生产者
+ * 发送只入队, 后台 poll 线程驱动发送和投递回调
+ */
+class KafkaProducer {
+public:
+    // delivered: stored by the broker
+    using DeliveryCallback = std::function<void(bool delivered)>;
+
+    KafkaProducer();
+    ~KafkaProducer();
+
+    bool init(const std::string& brokers, const std::string& topic);
+
+    // key 决定分区; on_delivery 在 poll 线程里调用
+    bool sendMessage(std::string message, const std::string& key, DeliveryCallback on_delivery = DeliveryCallback());
+
+    // 等待队列里的消息发送完成后关闭
+    void close();
+
+private:
+    class DeliveryReport : public RdKafka::DeliveryReportCb {
+    public:
+        void dr_cb(RdKafka::Message& message) override;
+    };
+
+    void pollLoop();
+
+    RdKafka::Producer* producer_ = nullptr;
+    RdKafka::Topic* topic_ = nullptr;
+    DeliveryReport delivery_report_;
+    std::atomic<bool> polling_{false};
+    std::thread poll_thread_;
+};
@@ -0,0 +1,96 @@
+#include "offset_tracker.h"
+#include <algorithm>
+
+PushTag OffsetTracker::track(int32_t partition, int64_t offset, std::string payload) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Partition& p = partitions_[partition];
+    // 再均衡后从已提交的位置重新消费, 旧的跟踪作废, 迟到的 done 会被忽略
+    if (!p.entries.empty() && offset <= p.entries.back().offset) {
+        p.entries.clear();
+    }
+    p.entries.push_back({offset, false, std::move(payload), 1});
+
+    PushTag tag;
+    tag.tracker = this;
+    tag.partition = partition;
+    tag.offset = offset;
+    return tag;
+}
+
+OffsetTracker::Entry* OffsetTracker::find(Partition& partition, int64_t offset) {
+    auto it = std::lower_bound(partition.entries.begin(), partition.entries.end(), offset,
+        [](const Entry& entry, int64_t value) { return entry.offset < value; });
+    if (it == partition.entries.end() || it->offset != offset) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+void OffsetTracker::expect(int32_t partition, int64_t offset, int n) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = partitions_.find(partition);
+    if (it == partitions_.end()) {
+        return;
+    }
+    Entry* entry = find(it->second, offset);
+    if (entry && !entry->done) {
+        entry->remaining = std::max(n, 1);
+    }
+}
+
+void OffsetTracker::done(int32_t partition, int64_t offset) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = partitions_.find(partition);
+    if (it == partitions_.end()) {
+        return;
+    }
+    Partition& p = it->second;
+    Entry* entry = find(p, offset);
+    if (!entry || entry->done) {
+        return;
+    }
+    // 推给多个 comet 的消息全部完成才算完成
+    if (--entry->remaining > 0) {
+        return;
+    }
+    entry->done = true;
+    entry->payload.clear();
+
+    // 前缀全部完成才推进提交位置
+    while (!p.entries.empty() && p.entries.front().done) {
+        p.commit = p.entries.front().offset + 1;
+        p.dirty = true;
+        p.entries.pop_front();
+    }
+}
+
+std::string OffsetTracker::payload(int32_t partition, int64_t offset) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = partitions_.find(partition);
+    if (it == partitions_.end()) {
+        return std::string();
+    }
+    Entry* entry = find(it->second, offset);
+    return entry ? entry->payload : std::string();
+}
+
+std::vector<std::pair<int32_t, int64_t>> OffsetTracker::takeCommits() {
+    std::vector<std::pair<int32_t, int64_t>> commits;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& partition : partitions_) {
+        if (partition.second.dirty) {
+            commits.emplace_back(partition.first, partition.second.commit);
+            partition.second.dirty = false;
+        }
+    }
+    return commits;
+}
+
+size_t OffsetTracker::pending() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& partition : partitions_) {
+        count += partition.second.entries.size();
+    }
+    return count;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class OffsetTracker;
+
+// 推送对应的 Kafka 消息, 推送完成后交回 tracker
+struct PushTag {
+    OffsetTracker* tracker = nullptr;
+    int32_t partition = -1;
+    int64_t offset = -1;
+    int32_t comet = -1;     // index of the comet in CometRouter, a message may be pushed to several
+};
+
+/**
+ * 一个消费者的 offset 跟踪
+ * 每条消息在推送确认(或转入重试 topic)后标记完成, 分区内连续完成的前缀才可以提交,
+ * 保证至少一次; 提交按批次异步进行, 不在每条消息上等待
+ */
+class OffsetTracker {
+public:
+    // consumer thread, offsets of a partition arrive in increasing order, the payload is kept for the retry topic
+    PushTag track(int32_t partition, int64_t offset, std::string payload);
+
+    // the message is pushed to n comets, it's done after n calls of done(), call before the first push
+    void expect(int32_t partition, int64_t offset, int n);
+
+    // one push of the message is done, thread safe
+    void done(int32_t partition, int64_t offset);
+
+    // payload of a tracked message, empty if it's no longer tracked
+    std::string payload(int32_t partition, int64_t offset);
+
+    // (partition, next offset) of the partitions moved since the last call
+    std::vector<std::pair<int32_t, int64_t>> takeCommits();
+
+    // tracked messages not committable yet
+    size_t pending();
+
+private:
+    struct Entry {
+        int64_t offset;
+        bool done;
+        std::string payload;
+        int remaining;          // pushes not done yet
+    };
+
+    struct Partition {
+        std::deque<Entry> entries;
+        int64_t commit = -1;    // next offset to commit
+        bool dirty = false;
+    };
+
+    Entry* find(Partition& partition, int64_t offset);
+
+    std::mutex mutex_;
+    std::unordered_map<int32_t, Partition> partitions_;
+};
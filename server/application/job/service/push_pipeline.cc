@@ -0,0 +1,241 @@
+#include "push_pipeline.h"
+#include <algorithm>
+#include <functional>
+#include <muduo/base/Logging.h>
+
+PushPipeline::PushPipeline(const std::string& server_address, const PushPipelineOptions& options)
+    : options_(options) {
+    options_.lanes = std::max(options_.lanes, 1);
+    options_.lane_queue_size = std::max(options_.lane_queue_size, 1);
+    options_.batch_items = std::max(options_.batch_items, 1);
+    options_.max_inflight = std::max(options_.max_inflight, 1);
+    options_.max_retries = std::max(options_.max_retries, 1);
+
+    auto channel = grpc::CreateChannel(server_address, grpc::InsecureChannelCredentials());
+    stub_ = ChatRoom::Comet::Comet::NewStub(channel);
+
+    completion_thread_ = std::thread(&PushPipeline::completionLoop, this);
+    for (int i = 0; i < options_.lanes; i++) {
+        lanes_.push_back(std::make_unique<Lane>());
+    }
+    for (auto& lane : lanes_) {
+        lane->thread = std::thread(&PushPipeline::laneLoop, this, lane.get());
+    }
+}
+
+PushPipeline::~PushPipeline() {
+    stop();
+}
+
+void PushPipeline::pushRoom(const std::string& room_id, const std::string& body, const PushTag& tag) {
+    LanePush lane_push;
+    lane_push.tag = tag;
+    ChatRoom::Comet::BroadcastRoomReq& push = lane_push.push;
+    push.set_roomid(room_id);
+    ChatRoom::Protocol::Proto* proto = push.mutable_proto();
+    proto->set_ver(1);
+    proto->set_op(4);         // 房间内发送消息
+    proto->set_seq(0);
+    proto->set_body(body);
+
+    // 同一房间总是进同一条 lane, 房间内有序
+    Lane* lane = lanes_[std::hash<std::string>()(room_id) % lanes_.size()].get();
+    std::unique_lock<std::mutex> lock(lane->mutex);
+    size_t limit = static_cast<size_t>(options_.lane_queue_size);
+    lane->cond.wait(lock, [&]() { return lane->stopping || lane->pending < limit; });
+    lane_push.seq = ++lane->next_seq;
+    lane->outstanding.insert(lane_push.seq);
+    RoomQueue& room = lane->rooms[room_id];
+    if (room.pushes.empty() && !room.busy) {
+        lane->ready_rooms.push_back(room_id);
+    }
+    room.pushes.push_back(std::move(lane_push));
+    lane->pending++;
+    lane->changes++;
+    lane->cond.notify_all();
+}
+
+void PushPipeline::drain() {
+    for (auto& lane : lanes_) {
+        std::unique_lock<std::mutex> lock(lane->mutex);
+        uint64_t target = lane->next_seq;
+        lane->cond.wait(lock, [&]() {
+            return lane->outstanding.empty() || *lane->outstanding.begin() > target;
+        });
+    }
+}
+
+void PushPipeline::stop() {
+    if (stopped_) {
+        return;
+    }
+    stopped_ = true;
+
+    for (auto& lane : lanes_) {
+        std::lock_guard<std::mutex> lock(lane->mutex);
+        lane->stopping = true;
+        lane->changes++;
+        lane->cond.notify_all();
+    }
+    // lane 发完队列里的推送, 等在途调用结束后退出
+    for (auto& lane : lanes_) {
+        lane->thread.join();
+    }
+    cq_.Shutdown();
+    completion_thread_.join();
+}
+
+void PushPipeline::laneLoop(Lane* lane) {
+    std::unique_lock<std::mutex> lock(lane->mutex);
+    while (true) {
+        // 到期的调用原样重发, 重试期间房间一直被占用, 后续推送不会越过它
+        auto now = std::chrono::steady_clock::now();
+        auto next_retry = std::chrono::steady_clock::time_point::max();
+        std::vector<BatchCall*> due;
+        for (auto it = lane->retries.begin(); it != lane->retries.end();) {
+            if ((*it)->retry_at <= now) {
+                due.push_back(*it);
+                it = lane->retries.erase(it);
+            }
+            else {
+                next_retry = std::min(next_retry, (*it)->retry_at);
+                ++it;
+            }
+        }
+        if (!due.empty()) {
+            lock.unlock();
+            for (BatchCall* call : due) {
+                startCall(call);
+            }
+            lock.lock();
+            continue;
+        }
+
+        if (lane->stopping && lane->pending == 0 && lane->inflight == 0) {
+            return;
+        }
+
+        size_t batch_items = static_cast<size_t>(options_.batch_items);
+        if (!lane->ready_rooms.empty() && lane->inflight < options_.max_inflight) {
+            // 攒批: 不足一批时最多再等 window_ms
+            if (lane->pending < batch_items && !lane->stopping && options_.window_ms > 0) {
+                auto deadline = std::min(now + std::chrono::milliseconds(options_.window_ms), next_retry);
+                lane->cond.wait_until(lock, deadline, [&]() {
+                    return lane->stopping || lane->pending >= batch_items;
+                });
+            }
+
+            std::unique_ptr<BatchCall> call(new BatchCall());
+            call->lane = lane;
+            if (takeBatch(lane, call.get())) {
+                lane->inflight++;
+                lock.unlock();
+                startCall(call.release());
+                lock.lock();
+                continue;
+            }
+        }
+
+        // 等待新的推送, 调用完成或者下一次重发
+        uint64_t seen = lane->changes;
+        auto changed = [&]() { return lane->changes != seen; };
+        if (next_retry == std::chrono::steady_clock::time_point::max()) {
+            lane->cond.wait(lock, changed);
+        }
+        else {
+            lane->cond.wait_until(lock, next_retry, changed);
+        }
+    }
+}
+
+bool PushPipeline::takeBatch(Lane* lane, BatchCall* call) {
+    // 只取空闲房间的推送, 有调用在途的房间不在 ready_rooms 里, 它的推送留在自己的队列中保持顺序,
+    // 热点房间积压再多也不会被反复扫描
+    size_t batch_items = static_cast<size_t>(options_.batch_items);
+    while (!lane->ready_rooms.empty() && static_cast<size_t>(call->request.rooms_size()) < batch_items) {
+        RoomQueue& room = lane->rooms[lane->ready_rooms.front()];
+        while (!room.pushes.empty() && static_cast<size_t>(call->request.rooms_size()) < batch_items) {
+            LanePush& lane_push = room.pushes.front();
+            *call->request.add_rooms() = std::move(lane_push.push);
+            call->tags.push_back(lane_push.tag);
+            call->seqs.push_back(lane_push.seq);
+            room.pushes.pop_front();
+            lane->pending--;
+        }
+        // 没取完的推送等这次调用结束
+        room.busy = true;
+        lane->ready_rooms.pop_front();
+    }
+    // 队列变短, 唤醒阻塞的 pushRoom
+    lane->cond.notify_all();
+    return call->request.rooms_size() > 0;
+}
+
+void PushPipeline::startCall(BatchCall* call) {
+    call->attempts++;
+    call->context.reset(new grpc::ClientContext());
+    call->context->set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(5));
+    call->reader = stub_->PrepareAsyncBroadcastRoomBatch(call->context.get(), call->request, &cq_);
+    call->reader->StartCall();
+    call->reader->Finish(&call->reply, &call->status, call);
+}
+
+void PushPipeline::completionLoop() {
+    void* tag;
+    bool ok;
+    while (cq_.Next(&tag, &ok)) {
+        onCallDone(static_cast<BatchCall*>(tag), ok);
+    }
+}
+
+void PushPipeline::onCallDone(BatchCall* call, bool ok) {
+    Lane* lane = call->lane;
+    bool delivered = ok && call->status.ok();
+    if (!delivered) {
+        if (call->attempts < options_.max_retries) {
+            LOG_WARN << "BroadcastRoomBatch failed (attempt " << call->attempts << "/" << options_.max_retries
+                     << "): " << call->status.error_message();
+            // 退避后由 lane 线程重发, 不阻塞 completion 线程
+            std::lock_guard<std::mutex> lock(lane->mutex);
+            call->retry_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(100 * call->attempts);
+            lane->retries.push_back(call);
+            lane->changes++;
+            lane->cond.notify_all();
+            return;
+        }
+        LOG_ERROR << "BroadcastRoomBatch failed after " << call->attempts << " attempts, gave up "
+                  << call->request.rooms_size() << " messages: " << call->status.error_message();
+    }
+
+    // 先交回结果再释放房间, drain() 返回时所有回调都已完成
+    if (done_callback_) {
+        for (const PushTag& tag : call->tags) {
+            done_callback_(tag, delivered);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(lane->mutex);
+        for (const auto& room_push : call->request.rooms()) {
+            // 一个调用里同一房间可能有多条推送, 只处理一次
+            auto it = lane->rooms.find(room_push.roomid());
+            if (it == lane->rooms.end() || !it->second.busy) {
+                continue;
+            }
+            it->second.busy = false;
+            if (it->second.pushes.empty()) {
+                lane->rooms.erase(it);
+            }
+            else {
+                lane->ready_rooms.push_back(it->first);
+            }
+        }
+        for (uint64_t seq : call->seqs) {
+            lane->outstanding.erase(seq);
+        }
+        lane->inflight--;
+        lane->changes++;
+        lane->cond.notify_all();
+    }
+    delete call;
+}
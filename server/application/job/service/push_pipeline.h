@@ -0,0 +1,112 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "ChatRoom.Comet.grpc.pb.h"
+#include "offset_tracker.h"
+
+struct PushPipelineOptions {
+    int lanes = 4;                  // ordered worker lanes, a room always goes to the same lane
+    int lane_queue_size = 4096;     // pending pushes per lane, pushRoom() blocks beyond it
+    int batch_items = 32;           // pushes per BroadcastRoomBatch
+    int window_ms = 5;              // wait this long for more pushes before sending a partial batch
+    int max_inflight = 4;           // outstanding BroadcastRoomBatch calls per lane
+    int max_retries = 3;            // attempts of a call before its pushes are given up
+};
+
+// delivered: acked by the comet, otherwise given up after max_retries
+using PushDoneCallback = std::function<void(const PushTag& tag, bool delivered)>;
+
+/**
+ * job -> comet 的单次 RPC 推送流水线
+ * 消费线程按房间哈希把推送分到 N 条有序的 lane, lane 之间并行;
+ * 每条 lane 攒批后异步发送 BroadcastRoomBatch, 最多 max_inflight 个调用同时在途,
+ * 同一房间同时只有一个调用在途, 房间内保持顺序, 慢房间不阻塞其他房间
+ */
+class PushPipeline {
+public:
+    PushPipeline(const std::string& server_address, const PushPipelineOptions& options = PushPipelineOptions());
+    ~PushPipeline();
+
+    // called once per push from the completion thread, set before the first push
+    void setDoneCallback(const PushDoneCallback& callback) { done_callback_ = callback; }
+
+    // blocks when the lane of the room is full
+    void pushRoom(const std::string& room_id, const std::string& body, const PushTag& tag = PushTag());
+
+    // waits until every push queued before the call is acked or given up, e.g. before a global broadcast,
+    // pushes made meanwhile by other threads are not waited for
+    void drain();
+
+    // sends what is queued, then stops the lanes
+    void stop();
+
+private:
+    struct Lane;
+
+    // one BroadcastRoomBatch call, resent with a new context on failure
+    struct BatchCall {
+        Lane* lane;
+        ChatRoom::Comet::BroadcastRoomBatchReq request;
+        std::vector<PushTag> tags;                      // one per entry of request
+        std::vector<uint64_t> seqs;                     // lane seq of every entry
+        ChatRoom::Comet::BroadcastRoomBatchReply reply;
+        std::unique_ptr<grpc::ClientContext> context;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ChatRoom::Comet::BroadcastRoomBatchReply>> reader;
+        grpc::Status status;
+        int attempts = 0;
+        std::chrono::steady_clock::time_point retry_at;
+    };
+
+    struct LanePush {
+        ChatRoom::Comet::BroadcastRoomReq push;
+        PushTag tag;
+        uint64_t seq;
+    };
+
+    struct RoomQueue {
+        std::deque<LanePush> pushes;                    // not batched yet, in order
+        bool busy = false;                              // a call of the room is in flight or waiting to retry
+    };
+
+    struct Lane {
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::unordered_map<std::string, RoomQueue> rooms;   // rooms with pending pushes or a call
+        std::deque<std::string> ready_rooms;            // idle rooms with pending pushes, by when they got ready
+        size_t pending = 0;                             // pushes not batched yet, over all rooms
+        std::vector<BatchCall*> retries;
+        int inflight = 0;                               // calls in flight or waiting to retry
+        uint64_t changes = 0;                           // bumped on every push and completion
+        uint64_t next_seq = 0;
+        std::set<uint64_t> outstanding;                 // seqs pushed but not acked or given up yet
+        bool stopping = false;
+        std::thread thread;
+    };
+
+    void laneLoop(Lane* lane);
+    // moves up to batch_items pushes of the ready rooms into call, in order, lane mutex held
+    bool takeBatch(Lane* lane, BatchCall* call);
+    void startCall(BatchCall* call);
+    void completionLoop();
+    void onCallDone(BatchCall* call, bool ok);
+
+    PushPipelineOptions options_;
+    PushDoneCallback done_callback_;
+    std::unique_ptr<ChatRoom::Comet::Comet::Stub> stub_;
+    grpc::CompletionQueue cq_;
+    std::thread completion_thread_;
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    bool stopped_ = false;
+};
@@ -0,0 +1,136 @@
+#include "retry_worker.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <muduo/base/Logging.h>
+#include "ChatRoom.Job.pb.h"
+
+RetryWorker::RetryWorker(const std::string& brokers, const std::string& group_id, const RetryOptions& options)
+    : options_(options), consumer_(brokers, options.topic, group_id) {
+    producer_.init(brokers, options_.topic);
+}
+
+RetryWorker::~RetryWorker() {
+    stop();
+}
+
+bool RetryWorker::start(const Dispatch& dispatch) {
+    if (!consumer_.init() || !consumer_.subscribe()) {
+        LOG_ERROR << "Failed to subscribe retry topic " << options_.topic;
+        return false;
+    }
+    dispatch_ = dispatch;
+    last_commit_ = std::chrono::steady_clock::now();
+    thread_ = std::thread(&RetryWorker::run, this);
+    LOG_INFO << "Retry worker started on " << options_.topic << ", max attempts: " << options_.max_attempts;
+    return true;
+}
+
+void RetryWorker::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+        cond_.notify_all();
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    producer_.close();
+}
+
+void RetryWorker::schedule(const std::string& payload, const std::string& server,
+                           const std::function<void()>& on_parked) {
+    ChatRoom::Job::PushMsg pushMsg;
+    if (!pushMsg.ParseFromString(payload)) {
+        LOG_ERROR << "Failed to parse PushMsg for retry, message dropped";
+        on_parked();
+        return;
+    }
+
+    int attempts = pushMsg.attempts() + 1;
+    if (attempts > options_.max_attempts) {
+        LOG_ERROR << "Push to room " << pushMsg.room() << " failed " << pushMsg.attempts()
+                  << " retries, message dropped";
+        on_parked();
+        return;
+    }
+    pushMsg.set_attempts(attempts);
+    // 已经推送成功的 comet 不再重复推送
+    if (!server.empty()) {
+        pushMsg.set_server(server);
+    }
+
+    std::string serialized;
+    pushMsg.SerializeToString(&serialized);
+    std::string room = pushMsg.room();
+    // 写入重试 topic 之后原消息才算完成; 写入失败时 librdkafka 已经重试过, 只能记录并放弃
+    bool queued = producer_.sendMessage(std::move(serialized), room, [on_parked, room](bool delivered) {
+        if (!delivered) {
+            LOG_ERROR << "Failed to park push to room " << room << " in retry topic, message dropped";
+        }
+        on_parked();
+    });
+    if (!queued) {
+        LOG_ERROR << "Failed to park push to room " << room << " in retry topic, message dropped";
+        on_parked();
+    }
+}
+
+int RetryWorker::backoffMs(int attempts) const {
+    int64_t backoff = options_.backoff_ms;
+    for (int i = 1; i < attempts && backoff < options_.max_backoff_ms; i++) {
+        backoff *= 2;
+    }
+    return static_cast<int>(std::min<int64_t>(backoff, options_.max_backoff_ms));
+}
+
+void RetryWorker::maybeCommit(bool force) {
+    auto now = std::chrono::steady_clock::now();
+    if (force || now - last_commit_ >= std::chrono::milliseconds(options_.commit_interval_ms)) {
+        consumer_.commitAsync(tracker_.takeCommits());
+        last_commit_ = now;
+    }
+}
+
+void RetryWorker::run() {
+    std::vector<KafkaMessage> messages;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_) {
+                break;
+            }
+        }
+
+        messages.clear();
+        consumer_.consumeBatch(messages, 64, 200);
+        for (const auto& message : messages) {
+            ChatRoom::Job::PushMsg pushMsg;
+            int attempts = pushMsg.ParseFromString(message.payload) ? std::max(pushMsg.attempts(), 1) : 1;
+
+            // 从写入重试 topic 的时间开始退避, 等待期间不占用主消费线程
+            auto due = std::chrono::system_clock::now();
+            if (message.timestamp_ms >= 0) {
+                due = std::chrono::system_clock::time_point(std::chrono::milliseconds(message.timestamp_ms)) +
+                      std::chrono::milliseconds(backoffMs(attempts));
+            }
+            maybeCommit(false);
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait_until(lock, due, [this]() { return stopping_; });
+                if (stopping_) {
+                    // 未推送的消息不提交, 重启后重新消费
+                    break;
+                }
+            }
+
+            PushTag tag = tracker_.track(message.partition, message.offset, message.payload);
+            dispatch_(message.payload, tag);
+        }
+        maybeCommit(false);
+    }
+    maybeCommit(true);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "kafka_consumer.h"
+#include "kafka_producer.h"
+#include "offset_tracker.h"
+
+struct RetryOptions {
+    std::string topic = "my-topic-retry";
+    int max_attempts = 5;           // times a message is parked before it's given up
+    int backoff_ms = 1000;          // delay of the first retry, doubled per attempt
+    int max_backoff_ms = 30000;
+    int commit_interval_ms = 1000;  // offsets of the retry topic are committed at most this often
+};
+
+/**
+ * 推送失败的消息转入重试 topic, 由单独的线程按退避时间重新推送
+ * 主消费线程不在重试上等待, 消息写入重试 topic 后原 offset 即可提交;
+ * 重试 topic 同样在推送完成后才提交 offset, 超过次数的消息记录日志后放弃
+ */
+class RetryWorker {
+public:
+    // the job's push path, called in the worker thread, the push reports back through tag
+    using Dispatch = std::function<void(const std::string& payload, const PushTag& tag)>;
+
+    RetryWorker(const std::string& brokers, const std::string& group_id, const RetryOptions& options);
+    ~RetryWorker();
+
+    bool start(const Dispatch& dispatch);
+    void stop();
+
+    // parks a failed push (a serialized PushMsg), on_parked runs once it's stored or given up, thread safe
+    // server: the comet the push failed on, the retry goes to it only; empty for every comet
+    void schedule(const std::string& payload, const std::string& server, const std::function<void()>& on_parked);
+
+private:
+    void run();
+    void maybeCommit(bool force);
+    int backoffMs(int attempts) const;
+
+    RetryOptions options_;
+    KafkaProducer producer_;
+    KafkaConsumer consumer_;
+    OffsetTracker tracker_;
+    Dispatch dispatch_;
+    std::chrono::steady_clock::time_point last_commit_;
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
@@ -1,7 +1,12 @@
 #include "api_auth.h"
+#include <time.h>
 #include "muduo/base/Logging.h"
+#include "session_token.h"
 #include <json/json.h>
 
+// token_id -> expire of revoked session tokens, shared by all logic instances
+static const char kRevokedSessionsKey[] = "session:revoked";
+
 /**
  * 通过cookie验证用户身份
  */
@@ -15,6 +20,23 @@ AuthResult ApiVerifyUserByCookie(const string& cookie) {
         return result;
     }
     
+    // 签名 token 本地校验, 不查 redis/mysql
+    CSessionTokenCodec& codec = CSessionTokenCodec::GetInstance();
+    if (codec.Enabled() && CSessionTokenCodec::LooksLikeToken(cookie)) {
+        SessionClaims claims;
+        SessionTokenResult ret = codec.Verify(cookie, claims);
+        if (ret != kTokenOk) {
+            result.error_message = CSessionTokenCodec::ResultString(ret);
+            LOG_WARN << "User auth failed, " << result.error_message << ", kid: " << claims.key_id;
+            return result;
+        }
+        result.success = true;
+        result.user_id = claims.user_id;
+        result.username = claims.username;
+        LOG_INFO << "User auth success by token, user_id: " << claims.user_id << ", username: " << claims.username;
+        return result;
+    }
+
     // 调用现有的cookie验证函数
     string username, email;
     string user_id;
@@ -96,4 +118,83 @@ int ApiVerifyAuth(const string& post_data, string& response_data) {
     EncodeAuthResultJson(result, response_data);
     
     return result.success ? 0 : -1;
-}
\ No newline at end of file
+}
+
+/**
+ * 注销登录
+ */
+int ApiLogoutUser(const string& post_data, bool& revoked_token) {
+    revoked_token = false;
+    string cookie;
+    if (DecodeAuthRequestJson(post_data, cookie) < 0) {
+        return -1;
+    }
+
+    CacheManager* cache_manager = CacheManager::getInstance();
+    CacheConn* cache_conn = cache_manager->GetCacheConn("token");
+    AUTO_REL_CACHECONN(cache_manager, cache_conn);
+    if (!cache_conn) {
+        LOG_ERROR << "get cache conn failed";
+        return -1;
+    }
+
+    CSessionTokenCodec& codec = CSessionTokenCodec::GetInstance();
+    if (!CSessionTokenCodec::LooksLikeToken(cookie)) {
+        // legacy session, the redis key is the session
+        cache_conn->Del(cookie);
+        return 0;
+    }
+    if (!codec.Enabled()) {
+        return -1;
+    }
+
+    SessionClaims claims;
+    SessionTokenResult ret = codec.Verify(cookie, claims);
+    if (ret == kTokenExpired || ret == kTokenRevoked) {
+        return 0;
+    }
+    if (ret != kTokenOk) {
+        LOG_WARN << "logout with invalid token, " << CSessionTokenCodec::ResultString(ret);
+        return -1;
+    }
+
+    // 其他 logic 实例启动时和周期推送前从 redis 加载
+    cache_conn->Hset(kRevokedSessionsKey, claims.token_id, std::to_string(claims.expire));
+    codec.Revoke(claims.token_id, claims.expire);
+    revoked_token = true;
+    LOG_INFO << "session revoked, user_id: " << claims.user_id << ", token_id: " << claims.token_id;
+    return 0;
+}
+
+/**
+ * 启动时和每次推送会话状态前加载吊销列表, 顺便清理已过期的条目
+ */
+int ApiLoadRevokedSessions() {
+    CacheManager* cache_manager = CacheManager::getInstance();
+    CacheConn* cache_conn = cache_manager->GetCacheConn("token");
+    AUTO_REL_CACHECONN(cache_manager, cache_conn);
+    if (!cache_conn) {
+        LOG_ERROR << "get cache conn failed";
+        return -1;
+    }
+
+    std::map<string, string> revoked;
+    if (!cache_conn->HgetAll(kRevokedSessionsKey, revoked)) {
+        return 0;
+    }
+
+    CSessionTokenCodec& codec = CSessionTokenCodec::GetInstance();
+    int64_t now = static_cast<int64_t>(::time(nullptr));
+    int loaded = 0;
+    for (const auto& kv : revoked) {
+        int64_t expire = strtoll(kv.second.c_str(), nullptr, 10);
+        if (expire <= now) {
+            cache_conn->Hdel(kRevokedSessionsKey, kv.first);
+            continue;
+        }
+        codec.Revoke(kv.first, expire);
+        loaded++;
+    }
+    LOG_INFO << "revoked sessions loaded: " << loaded;
+    return 0;
+}
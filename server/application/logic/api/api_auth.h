@@ -48,4 +48,18 @@ int DecodeAuthRequestJson(const string& json_str, string& cookie);
  */
 int ApiVerifyAuth(const string& post_data, string& response_data);
 
+/**
+ * 注销登录, legacy cookie 删除 redis 会话, 签名 token 加入吊销列表
+ * @param post_data {"cookie":"..."}
+ * @param revoked_token 输出, 吊销了签名 token, 需要推送给 comet
+ * @return 0成功，-1失败
+ */
+int ApiLogoutUser(const string& post_data, bool& revoked_token);
+
+/**
+ * 从 redis 加载签名 token 的吊销列表
+ * @return 0成功，-1失败
+ */
+int ApiLoadRevokedSessions();
+
 #endif // API_AUTH_H
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "api_common.h"
 #include<uuid/uuid.h>
+#include "session_token.h"
 
 /**
  * 1. to cookie ==> the key of redis
@@ -41,8 +42,20 @@ string RandomString(const int len) {
 
 /**
  *  set cookie for login user and store in redis==> (key, values) = (cookie, email)
+ *  with session tokens enabled, the cookie is a signed token instead
  */
 int ApiSetCookie(string email, string& cookie) {
+    // signed token mode: the cookie carries the user itself, nothing is stored
+    CSessionTokenCodec& codec = CSessionTokenCodec::GetInstance();
+    if (codec.Enabled()) {
+        string username, user_id;
+        if (GetUserNameAndUseridByEmail(email, username, user_id) < 0) {
+            LOG_ERROR << "get user failed, email: " << email;
+            return -1;
+        }
+        return codec.Issue(user_id, username, cookie) ? 0 : -1;
+    }
+
     // get redis connection pool
     CacheManager* cache_manager = CacheManager::getInstance();
     CacheConn* cache_conn = cache_manager->GetCacheConn("token");
@@ -1,5 +1,6 @@
 #include "api_register.h"
 #include "api_common.h"
+#include "session_token.h"
 #include "muduo/base/Logging.h"
 #include "muduo/base/md5.h"
 #include <json/json.h>
@@ -27,6 +28,11 @@ int DecodeRegisterJson(const string& str_json, string& username,
         return -1;
     }
     username = root["username"].asString();
+    // 用户名会写进会话 token, 不接受控制字符
+    if (username.empty() || ContainsControlChars(username)) {
+        LOG_ERROR << "register username empty or contains control characters";
+        return -1;
+    }
 
     if (root["email"].isNull()) {
         LOG_ERROR << "register email null";
@@ -5,8 +5,9 @@
 #include <string>
 #include <map>
 #include <sstream>
+#include <thread>
 #include <json/json.h>
-#include "proto/ChatRoom.Job.pb.h"
+#include <grpcpp/grpcpp.h>
 #include "service/http_parser.h"
 #include "service/kafka_producer.h"
 #include "api/api_types.h"
@@ -16,6 +17,8 @@
 #include "service/message_service.h"
 #include "service/room_service.h"
 #include "base/config_file_reader.h"
+#include "session_token.h"
+#include "rpc/logic_service.h"
 
 using namespace muduo;
 using namespace muduo::net;
@@ -24,12 +27,22 @@ using namespace muduo::net;
 struct ServerConfig {
     std::string bind_ip = "0.0.0.0";
     uint16_t http_port = 8090;
+    std::string grpc_bind_ip = "0.0.0.0";
+    uint16_t grpc_port = 50052;
     int num_event_loops = 1;
+    bool reuseport_acceptors = false;   // one SO_REUSEPORT acceptor per io loop
     int num_threads = 0;
     int timeout_ms = 1000;
     Logger::LogLevel log_level = Logger::INFO;
     std::string kafka_brokers = "localhost:9092";
     std::string kafka_topic = "my-topic";
+    KafkaProducerOptions kafka_options;
+    bool session_token_enable = false;
+    std::string session_token_keys;
+    std::string session_token_active_key;
+    int session_token_ttl = 86400;
+    double session_state_interval = 30.0;
+    int room_broadcast_speed = 0;
 
     bool loadFromFile(const std::string& config_path) {
         try {
@@ -40,9 +53,18 @@ struct ServerConfig {
             if (const char* v = config_file.GetConfigName("http_bind_port")) {
                 http_port = static_cast<uint16_t>(atoi(v));
             }
+            if (const char* v = config_file.GetConfigName("grpc_bind_ip")) {
+                grpc_bind_ip = v;
+            }
+            if (const char* v = config_file.GetConfigName("grpc_bind_port")) {
+                grpc_port = static_cast<uint16_t>(atoi(v));
+            }
             if (const char* v = config_file.GetConfigName("num_event_loops")) {
                 num_event_loops = atoi(v);
             }
+            if (const char* v = config_file.GetConfigName("reuseport_acceptors")) {
+                reuseport_acceptors = atoi(v) != 0;
+            }
             if (const char* v = config_file.GetConfigName("num_threads")) {
                 num_threads = atoi(v);
             }
@@ -58,6 +80,39 @@ struct ServerConfig {
             if (const char* v = config_file.GetConfigName("kafka_topic")) {
                 kafka_topic = v;
             }
+            if (const char* v = config_file.GetConfigName("kafka_linger_ms")) {
+                kafka_options.linger_ms = atoi(v);
+            }
+            if (const char* v = config_file.GetConfigName("kafka_batch_num_messages")) {
+                kafka_options.batch_num_messages = atoi(v);
+            }
+            if (const char* v = config_file.GetConfigName("kafka_batch_size")) {
+                kafka_options.batch_size = atoi(v);
+            }
+            if (const char* v = config_file.GetConfigName("kafka_compression")) {
+                kafka_options.compression = v;
+            }
+            if (const char* v = config_file.GetConfigName("kafka_queue_max_messages")) {
+                kafka_options.queue_max_messages = atoi(v);
+            }
+            if (const char* v = config_file.GetConfigName("session_token_enable")) {
+                session_token_enable = atoi(v) != 0;
+            }
+            if (const char* v = config_file.GetConfigName("session_token_keys")) {
+                session_token_keys = v;
+            }
+            if (const char* v = config_file.GetConfigName("session_token_active_key")) {
+                session_token_active_key = v;
+            }
+            if (const char* v = config_file.GetConfigName("session_token_ttl")) {
+                session_token_ttl = atoi(v);
+            }
+            if (const char* v = config_file.GetConfigName("session_state_interval")) {
+                session_state_interval = atof(v);
+            }
+            if (const char* v = config_file.GetConfigName("room_broadcast_speed")) {
+                room_broadcast_speed = atoi(v);
+            }
             return true;
         } catch (const std::exception& e) {
             LOG_ERROR << "Failed to load config: " << e.what();
@@ -79,7 +134,8 @@ std::string wrapJsonInHttpResponse(const std::string& jsonContent) {
 class HttpServer {
 public:
     HttpServer(EventLoop* loop, const InetAddress& listenAddr, const ServerConfig& config)
-        : server_(loop, listenAddr, "HttpServer"),
+        : server_(loop, listenAddr, "HttpServer",
+                  config.reuseport_acceptors ? TcpServer::kReusePortPerLoop : TcpServer::kNoReusePort),
           loop_(loop),
           config_(config) {
         server_.setConnectionCallback(
@@ -89,7 +145,7 @@ public:
         server_.setThreadNum(config_.num_event_loops);     
         
         // 初始化Kafka连接（从配置传入）
-        if (!producer_.init(config_.kafka_brokers, config_.kafka_topic)) {
+        if (!producer_.init(config_.kafka_brokers, config_.kafka_topic, config_.kafka_options)) {
             LOG_ERROR << "Failed to initialize Kafka producer";
         }
     }
@@ -102,6 +158,9 @@ public:
         server_.start();
     }
 
+    // shared with the gRPC service
+    KafkaProducer& producer() { return producer_; }
+
 private:
     void onConnection(const TcpConnectionPtr& conn) {
         if (conn->connected()) {
@@ -113,8 +172,16 @@ private:
 
     void onMessage(const TcpConnectionPtr& conn, Buffer* buf,
                   Timestamp receiveTime) {
-        string msg = buf->retrieveAllAsString();
+        // comet 在长连接上流水线发送请求, 按 Content-Length 切分, 按顺序逐个应答
+        while (size_t len = HttpParser::requestLength(buf->peek(), buf->readableBytes())) {
+            string msg(buf->peek(), len);
+            buf->retrieve(len);
+            handleRequest(conn, msg);
+        }
+    }
 
+    // 每个请求都必须有且只有一个应答, 否则流水线上后面的应答会错位
+    void handleRequest(const TcpConnectionPtr& conn, const string& msg) {
         LOG_INFO << "Received message: " << msg;
 
         // parse http request
@@ -127,6 +194,9 @@ private:
         else if (msg.find("POST /logic/verify") != string::npos) {
             handleVerifyAuth(conn, msg);
         }
+        else if (msg.find("POST /logic/logout") != string::npos) {
+            handleLogout(conn, msg);
+        }
         else if (msg.find("POST /logic/hello") != string::npos) {
             handleHello(conn, msg);
         }
@@ -258,6 +328,28 @@ private:
         }
     }
 
+    void handleLogout(const TcpConnectionPtr& conn, const string& request) {
+        string method, path, body;
+        if (!HttpParser::parseHttpRequest(request, method, path, body)) {
+            LOG_ERROR << "Failed to parse HTTP request";
+            sendErrorResponse(conn, 400, "Bad Request");
+            return;
+        }
+
+        bool revoked_token = false;
+        if (ApiLogoutUser(body, revoked_token) < 0) {
+            sendErrorResponse(conn, 400, "Bad Request");
+            return;
+        }
+        // 立即推送吊销, 不等下一个周期
+        if (revoked_token) {
+            ChatRoom::LogicServiceImpl::broadcastSessionState(producer_);
+        }
+
+        conn->send(wrapJsonInHttpResponse("{\"status\": \"success\"}"));
+        LOG_INFO << "User logout handled";
+    }
+
     void handleHello(const TcpConnectionPtr& conn, const string& request) {
         // 解析HTTP请求
         string method, path, body;
@@ -298,7 +390,7 @@ private:
         // 从内存中获取房间信息
         Json::Value rooms;
         RoomService& room_service = RoomService::getInstance();
-        std::vector<Room>& room_list = room_service.getRoomList();
+        std::vector<Room> room_list = room_service.getRoomList();
         
         int it_index = 0;
         for (const auto& room_item : room_list) {
@@ -371,7 +463,7 @@ private:
 
         // 直接从内存中获取房间信息，避免重复数据库查询
         RoomService& room_service = RoomService::getInstance();
-        std::vector<Room>& room_list = room_service.getRoomList();
+        std::vector<Room> room_list = room_service.getRoomList();
         
         // 构造响应JSON
         Json::Value response_root;
@@ -409,6 +501,7 @@ private:
         string method, path, body;
         if (!HttpParser::parseHttpRequest(request, method, path, body)) {
             LOG_ERROR << "Failed to parse HTTP request";
+            sendErrorResponse(conn, 400, "Bad Request");
             return;
         }
 
@@ -416,6 +509,7 @@ private:
         Json::Value json;
         if (!HttpParser::parseJsonBody(body, json)) {
             LOG_ERROR << "Failed to parse JSON body";
+            sendErrorResponse(conn, 400, "Invalid JSON");
             return;
         }
 
@@ -423,112 +517,28 @@ private:
         if (!json.isMember("roomId") || !json.isMember("userId") || 
             !json.isMember("username") || !json.isMember("messages")) {
             LOG_ERROR << "Missing required fields in request";
+            sendErrorResponse(conn, 400, "Missing required fields");
             return;
         }
 
-        // 创建并填充PushMsg消息
-        ChatRoom::Job::PushMsg pushMsg;  //protobuf
-        pushMsg.set_type(ChatRoom::Job::PushMsg_Type_PUSH);
-        pushMsg.set_operation(4);  // 房间内消息推送
-        pushMsg.set_room(json["roomId"].asString());
-
-        // 构造完整的serverMessages格式
-        Json::Value messageWrapper;
-        messageWrapper["type"] = "serverMessages";
-        
-        Json::Value payload;
-        payload["roomId"] = json["roomId"].asString();
-        
-        Json::Value messagesArray(Json::arrayValue);
-        
-        // 准备存储到数据库的消息列表
-        std::vector<Message> msgs_to_store;
-        
-        // 遍历所有消息，将它们添加到同一个消息数组中
-        int messageIndex = 0;
+        std::vector<string> contents;
         for (const auto& message : json["messages"]) {
             if (!message.isMember("content")) {
                 LOG_ERROR << "Message missing content field";
                 continue;
             }
-
-            Json::Value messageObj;
-            // 生成消息ID
-            uint64_t timestamp = Timestamp::now().microSecondsSinceEpoch() / 1000;
-            std::string messageId = std::to_string(timestamp) + "-" + std::to_string(messageIndex++);
-            messageObj["id"] = messageId;
-            messageObj["content"] = message["content"].asString();
-            
-            Json::Value userObj;
-            userObj["id"] = json["userId"].asString();
-            userObj["username"] = json["username"].asString();
-            messageObj["user"] = userObj;
-            
-            // 设置时间戳
-            messageObj["timestamp"] = (Json::UInt64)timestamp;
-            
-            messagesArray.append(messageObj);
-            
-            // 存储到数据库
-            Message msg_to_store;
-            msg_to_store.id = messageId;
-            msg_to_store.content = message["content"].asString();
-            msg_to_store.user_id = json["userId"].asString();
-            msg_to_store.username = json["username"].asString();
-            msg_to_store.timestamp = timestamp;
-            msgs_to_store.push_back(msg_to_store);
-        }
-        
-        // 存储消息到Redis和MySQL
-        MessageStorageManager& storage_mgr = MessageStorageManager::getInstance();
-        if (!msgs_to_store.empty()) {
-            int cache_result = storage_mgr.storeMessagesToCache(json["roomId"].asString(),
-             msgs_to_store);
-            bool cache_success = (cache_result == 0);
-            
-            bool db_success = storage_mgr.storeMessagesToDB(json["roomId"].asString(),
-             msgs_to_store);
-            
-            
-            if (!db_success || !cache_success) {
-                //存储失败，仍发送到Kafka
-                LOG_ERROR << "Failed to store messages - DB: " << (db_success ? "OK" : "FAILED") 
-                         << ", Cache: " << (cache_success ? "OK" : "FAILED");
-            } else {
-                LOG_INFO << "Successfully stored " << msgs_to_store.size() << " messages to database and cache";
-            }
+            contents.push_back(message["content"].asString());
         }
 
-        payload["messages"] = messagesArray;
-        messageWrapper["payload"] = payload;
-
-        // 将整个消息对象序列化并设置到protobuf消息中
-        Json::FastWriter writer;
-        std::string jsonString = writer.write(messageWrapper); 
-        LOG_INFO << "Constructed serverMessages: " << jsonString;
-        pushMsg.set_msg(jsonString);
-
-        // 序列化protobuf消息
-        std::string serialized_msg;
-        if (!pushMsg.SerializeToString(&serialized_msg)) {
-            LOG_ERROR << "Failed to serialize message";
+        // 存储并发送到Kafka, 与 gRPC Send 共用
+        std::vector<Message> sent;
+        if (ChatRoom::LogicServiceImpl::publishRoomMessages(producer_, json["roomId"].asString(),
+                json["userId"].asString(), json["username"].asString(), contents, sent) < 0) {
+            string failed_json = "{\"status\": \"send failed\"}";
             string response = "HTTP/1.1 500 Internal Server Error\r\n";
             response += "Content-Type: application/json\r\n";
-            response += "Content-Length: 31\r\n\r\n";
-            response += "{\"status\": \"send failed\"}\r\n";
-            conn->send(response);
-            return;
-        }
-        
-        LOG_INFO << "Serialized protobuf message length: " << serialized_msg.length();
-        
-        // 发送序列化后的消息到Kafka
-        if (!producer_.sendMessage(serialized_msg)) {
-            LOG_ERROR << "Failed to send message to Kafka";
-            string response = "HTTP/1.1 500 Internal Server Error\r\n";
-            response += "Content-Type: application/json\r\n";
-            response += "Content-Length: 31\r\n\r\n";
-            response += "{\"status\": \"send failed\"}\r\n";
+            response += "Content-Length: " + std::to_string(failed_json.length()) + "\r\n\r\n";
+            response += failed_json;
             conn->send(response);
             return;
         }
@@ -700,18 +710,8 @@ private:
             if (room_service.roomExistByName(room_name)) {
                 LOG_WARN << "Room name already exists: " << room_name;
                 
-                Json::Value failed_response;
-                failed_response["type"] = "serverCreateRoom";
-                
-                Json::Value response_payload;
-                response_payload["roomId"] = ""; // roomId = "" 表示房间名已存在
-                response_payload["roomName"] = "";
-                response_payload["creatorId"] = "";
-                response_payload["creatorUsername"] = "";
-                failed_response["payload"] = response_payload;
-                
-                Json::FastWriter writer;
-                string failed_json = writer.write(failed_response);
+                // roomId = "" 表示房间名已存在
+                string failed_json = ChatRoom::LogicServiceImpl::encodeCreateRoomJson("", room_name, "", "");
                 
                 string response = "HTTP/1.1 200 OK\r\n";
                 response += "Content-Type: application/json\r\n";
@@ -730,18 +730,8 @@ private:
             bool success = (ret == 0);
             
             if (success) {
-                Json::Value success_response;
-                success_response["type"] = "serverCreateRoom";
-                
-                Json::Value response_payload;
-                response_payload["roomId"] = room_id;
-                response_payload["roomName"] = room_name;
-                response_payload["creatorId"] = creator_id;
-                response_payload["creatorUsername"] = creator_username;
-                success_response["payload"] = response_payload;
-                
-                Json::FastWriter writer;
-                string success_json = writer.write(success_response);
+                string success_json = ChatRoom::LogicServiceImpl::encodeCreateRoomJson(room_id, room_name,
+                    creator_id, creator_username);
                 
                 string response = "HTTP/1.1 200 OK\r\n";
                 response += "Content-Type: application/json\r\n";
@@ -752,30 +742,7 @@ private:
                 conn->send(response);
                 
                 // kafka 广播房间创建消息
-                ChatRoom::Job::PushMsg pushMsg;
-                pushMsg.set_type(ChatRoom::Job::PushMsg_Type_BROADCAST);
-                pushMsg.set_operation(5);  // 5: 创建房间
-                pushMsg.set_room("global");  // 全局广播
-                pushMsg.set_msg(success_json);
-                
-                LOG_INFO << "Preparing Kafka broadcast message:";
-                LOG_INFO << "  Room: " << pushMsg.room();
-                LOG_INFO << "  Message: " << pushMsg.msg();
-                
-                // 序列化protobuf消息
-                std::string serialized_msg;
-                if (pushMsg.SerializeToString(&serialized_msg)) {
-                    // 发送到Kafka
-                    if (producer_.sendMessage(serialized_msg)) {
-                        LOG_INFO << "Room creation broadcast sent to Kafka successfully";
-                    }
-                    else {
-                        LOG_ERROR << "Failed to send room creation broadcast to Kafka";
-                    }
-                }
-                else {
-                    LOG_ERROR << "Failed to serialize room creation broadcast message";
-                }
+                ChatRoom::LogicServiceImpl::broadcastRoomCreated(producer_, room_id, success_json);
 
                 LOG_INFO << "Room created successfully: " << room_id;
 
@@ -855,6 +822,17 @@ int main() {
         return -1;
     }
     LOG_INFO << "Room service initialized successfully.";
+    ChatRoom::LogicServiceImpl::setRoomBroadcastSpeed(config.room_broadcast_speed);
+
+    // 签名会话 token, comet 用同一组密钥本地校验
+    if (config.session_token_enable) {
+        if (!CSessionTokenCodec::GetInstance().Init(config.session_token_keys,
+                config.session_token_active_key, config.session_token_ttl)) {
+            LOG_ERROR << "Failed to initialize session token";
+            return -1;
+        }
+        ApiLoadRevokedSessions();
+    }
 
     // 启动HTTP服务器
     LOG_INFO << "HTTP server starting on " << config.bind_ip << ":" << config.http_port;
@@ -863,6 +841,39 @@ int main() {
     HttpServer server(&loop, listenAddr, config);
     
     server.start();
+
+    // 启动时推送一次, 切换 active key 后 comet 马上接受新 kid;
+    // 之后周期性推送, 新启动的 comet 和丢了消息的 comet 也能收敛;
+    // 推送前从 redis 重新加载吊销列表, 其他实例吊销的 token 本实例也会拒绝
+    if (config.session_token_enable && config.session_state_interval > 0) {
+        ChatRoom::LogicServiceImpl::broadcastSessionState(server.producer());
+        loop.runEvery(config.session_state_interval, [&server]() {
+            ApiLoadRevokedSessions();
+            ChatRoom::LogicServiceImpl::broadcastSessionState(server.producer());
+        });
+    }
+
+    // comet 默认走 gRPC, HTTP 接口保留作兼容
+    std::string grpc_server_address = config.grpc_bind_ip + ":" + std::to_string(config.grpc_port);
+    ChatRoom::LogicServiceImpl logic_service(server.producer());
+
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(grpc_server_address, grpc::InsecureServerCredentials());
+    builder.RegisterService(&logic_service);
+    std::unique_ptr<grpc::Server> grpc_server(builder.BuildAndStart());
+    if (!grpc_server) {
+        LOG_ERROR << "Failed to start gRPC server on " << grpc_server_address;
+        return -1;
+    }
+    LOG_INFO << "gRPC Server listening on " << grpc_server_address;
+
+    std::thread grpc_thread([&grpc_server]() {
+        grpc_server->Wait();
+    });
+
     loop.loop();
+
+    grpc_server->Shutdown();
+    grpc_thread.join();
     return 0;
 }
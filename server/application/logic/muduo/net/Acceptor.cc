@@ -55,24 +55,34 @@ void Acceptor::listen()
 void Acceptor::handleRead()
 {
   loop_->assertInLoopThread();
-  InetAddress peerAddr;
-  //FIXME loop until no more
-  int connfd = acceptSocket_.accept(&peerAddr);
-  if (connfd >= 0)
+  // accept until the queue is empty, one wakeup serves a burst of connections
+  while (true)
   {
-    // string hostport = peerAddr.toIpPort();
-    // LOG_TRACE << "Accepts of " << hostport;
-    if (newConnectionCallback_)
+    InetAddress peerAddr;
+    int connfd = acceptSocket_.accept(&peerAddr);
+    if (connfd >= 0)
     {
-      newConnectionCallback_(connfd, peerAddr);
+      // string hostport = peerAddr.toIpPort();
+      // LOG_TRACE << "Accepts of " << hostport;
+      if (newConnectionCallback_)
+      {
+        newConnectionCallback_(connfd, peerAddr);
+      }
+      else
+      {
+        sockets::close(connfd);
+      }
+      continue;
     }
-    else
+
+    if (errno == EAGAIN || errno == EWOULDBLOCK)
     {
-      sockets::close(connfd);
+      break;
+    }
+    if (errno == EINTR || errno == ECONNABORTED)
+    {
+      continue;
     }
-  }
-  else
-  {
     LOG_SYSERR << "in Acceptor::handleRead";
     // Read the section named "The special problem of
     // accept()ing when you can't" in libev's doc.
@@ -84,6 +94,6 @@ void Acceptor::handleRead()
       ::close(idleFd_);
       idleFd_ = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
     }
+    break;
   }
 }
-
@@ -25,7 +25,7 @@ const size_t Buffer::kInitialSize;
 ssize_t Buffer::readFd(int fd, int* savedErrno)
 {
   // saved an ioctl()/FIONREAD call to tell how much to read
-  char extrabuf[65536];
+  char extrabuf[kExtraBufSize];
   struct iovec vec[2];
   const size_t writable = writableBytes();
   vec[0].iov_base = begin()+writerIndex_;
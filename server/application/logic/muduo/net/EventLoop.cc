@@ -224,6 +224,17 @@ bool EventLoop::hasChannel(Channel* channel)
   return poller_->hasChannel(channel);
 }
 
+bool EventLoop::supportsEdgeTriggered() const
+{
+  return poller_->supportsEdgeTriggered();
+}
+
+bool EventLoop::submitSend(int fd, const void* data, size_t len, const TcpConnectionPtr& conn)
+{
+  assertInLoopThread();
+  return poller_->submitSend(fd, data, len, conn);
+}
+
 void EventLoop::abortNotInLoopThread()
 {
   LOG_FATAL << "EventLoop::abortNotInLoopThread - EventLoop " << this
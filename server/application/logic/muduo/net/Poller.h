@@ -50,6 +50,19 @@ class Poller : noncopyable
 
   virtual bool hasChannel(Channel* channel) const;
 
+  /// Whether Channel::setEdgeTriggered() is honored, the others report level-triggered.
+  virtual bool supportsEdgeTriggered() const { return false; }
+
+  /// Queues a send of data on fd, which conn keeps alive until it completes,
+  /// then conn->handleSendComplete() runs in the loop thread with the result.
+  /// Returns false if the poller can't, the caller writes it itself.
+  /// Must be called in the loop thread.
+  virtual bool submitSend(int /* fd */, const void* /* data */, size_t /* len */,
+                          const TcpConnectionPtr& /* conn */)
+  {
+    return false;
+  }
+
   static Poller* newDefaultPoller(EventLoop* loop);
 
   void assertInLoopThread() const
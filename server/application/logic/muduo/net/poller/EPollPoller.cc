@@ -174,6 +174,10 @@ void EPollPoller::update(int operation, Channel* channel)
   struct epoll_event event;
   memZero(&event, sizeof event);
   event.events = channel->events();
+  if (channel->isEdgeTriggered())
+  {
+    event.events |= EPOLLET;
+  }
   event.data.ptr = channel;
   int fd = channel->fd();
   LOG_TRACE << "epoll_ctl op = " << operationToString(operation)
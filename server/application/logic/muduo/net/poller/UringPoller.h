@@ -0,0 +1,114 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is an internal header file, you should not include this.
+
+#ifndef MUDUO_NET_POLLER_URINGPOLLER_H
+#define MUDUO_NET_POLLER_URINGPOLLER_H
+
+#include "muduo/net/Poller.h"
+
+#include <utility>
+#include <vector>
+
+struct io_uring_params;
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace muduo
+{
+namespace net
+{
+
+///
+/// IO Multiplexing with io_uring(7).
+///
+/// Readiness is polled with one-shot IORING_OP_POLL_ADD, re-armed before
+/// every wait for the channels still interested, so it's level-triggered
+/// like EPollPoller. Sends queued by submitSend() reach the kernel together
+/// with the next wait, a fan-out to N connections costs one io_uring_enter()
+/// per kSqEntries sends instead of N write()s.
+class UringPoller : public Poller
+{
+ public:
+  /// returns nullptr if the kernel doesn't support it
+  static UringPoller* create(EventLoop* loop);
+  ~UringPoller() override;
+
+  Timestamp poll(int timeoutMs, ChannelList* activeChannels) override;
+  void updateChannel(Channel* channel) override;
+  void removeChannel(Channel* channel) override;
+  bool submitSend(int fd, const void* data, size_t len,
+                  const TcpConnectionPtr& conn) override;
+
+ private:
+  static const unsigned kSqEntries = 4096;
+  static const unsigned kCqEntries = 16384;
+
+  // per fd, the generation tells a completion of the current registration
+  // from one of a removed or re-armed poll on the same fd
+  struct FdState
+  {
+    Channel* channel = nullptr;
+    uint32_t gen = 0;
+    uint32_t armedEvents = 0;
+    bool armed = false;
+    bool queued = false;   // in toArm_
+  };
+
+  struct Ready
+  {
+    int fd;
+    uint32_t gen;
+    int revents;
+  };
+
+  UringPoller(EventLoop* loop, int ringFd);
+  bool init(const struct io_uring_params& params);
+
+  FdState& stateOf(int fd);
+  void sync(Channel* channel);
+  void cancel(int fd, FdState& state);
+  void armAll();
+  struct io_uring_sqe* getSqe();
+  // submits the queued SQEs, reaps the completions,
+  // waits up to timeoutMs (forever if < 0) for one if wait
+  void enter(bool wait, int timeoutMs);
+  void reap();
+  void deliverSends();
+
+  EventLoop* loop_;
+  int ringFd_;
+  void* sqRing_;
+  size_t sqRingSize_;
+  void* cqRing_;
+  size_t cqRingSize_;
+  struct io_uring_sqe* sqes_;
+  size_t sqesSize_;
+  unsigned* sqHead_;
+  unsigned* sqTail_;
+  unsigned sqMask_;
+  unsigned sqEntries_;
+  unsigned sqLocalTail_;
+  unsigned* cqHead_;
+  unsigned* cqTail_;
+  unsigned cqMask_;
+  struct io_uring_cqe* cqes_;
+
+  std::vector<FdState> states_;
+  std::vector<int> toArm_;
+  std::vector<Ready> ready_;
+  // the connection holds the buffer of a submitted send until it completes
+  std::vector<TcpConnectionPtr> sendSlots_;
+  std::vector<uint32_t> freeSlots_;
+  std::vector<std::pair<TcpConnectionPtr, int>> completedSends_;
+};
+
+}  // namespace net
+}  // namespace muduo
+#endif  // MUDUO_NET_POLLER_URINGPOLLER_H
@@ -13,42 +13,48 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace ChatRoom {
 namespace Job {
-constexpr PushMsg::PushMsg(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : keys_()
-  , server_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , room_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , msg_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , type_(0)
-
-  , operation_(0)
-  , speed_(0){}
+PROTOBUF_CONSTEXPR PushMsg::PushMsg(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.server_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.speed_)*/0
+  , /*decltype(_impl_.attempts_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct PushMsgDefaultTypeInternal {
-  constexpr PushMsgDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR PushMsgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~PushMsgDefaultTypeInternal() {}
   union {
     PushMsg _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PushMsgDefaultTypeInternal _PushMsg_default_instance_;
-constexpr Proto::Proto(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : body_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , ver_(0)
-  , op_(0)
-  , seq_(0){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PushMsgDefaultTypeInternal _PushMsg_default_instance_;
+PROTOBUF_CONSTEXPR Proto::Proto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ver_)*/0
+  , /*decltype(_impl_.op_)*/0
+  , /*decltype(_impl_.seq_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ProtoDefaultTypeInternal {
-  constexpr ProtoDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR ProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~ProtoDefaultTypeInternal() {}
   union {
     Proto _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ProtoDefaultTypeInternal _Proto_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProtoDefaultTypeInternal _Proto_default_instance_;
 }  // namespace Job
 }  // namespace ChatRoom
 namespace ChatRoom {
@@ -125,89 +131,103 @@ class PushMsg::_Internal {
 
 PushMsg::PushMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
-  keys_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:ChatRoom.Job.PushMsg)
 }
 PushMsg::PushMsg(const PushMsg& from)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      keys_(from.keys_) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  PushMsg* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.server_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.speed_){}
+    , decltype(_impl_.attempts_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  server_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.server_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.server_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_server().empty()) {
-    server_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_server(), 
-      GetArenaForAllocation());
+    _this->_impl_.server_.Set(from._internal_server(), 
+      _this->GetArenaForAllocation());
   }
-  room_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.room_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    room_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.room_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_room().empty()) {
-    room_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_room(), 
-      GetArenaForAllocation());
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
   }
-  msg_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.msg_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    msg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.msg_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_msg().empty()) {
-    msg_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_msg(), 
-      GetArenaForAllocation());
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&type_, &from.type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&speed_) -
-    reinterpret_cast<char*>(&type_)) + sizeof(speed_));
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.attempts_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.attempts_));
   // @@protoc_insertion_point(copy_constructor:ChatRoom.Job.PushMsg)
 }
 
-inline void PushMsg::SharedCtor() {
-server_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  server_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-room_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  room_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-msg_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  msg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&type_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&speed_) -
-    reinterpret_cast<char*>(&type_)) + sizeof(speed_));
+inline void PushMsg::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , decltype(_impl_.server_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.operation_){0}
+    , decltype(_impl_.speed_){0}
+    , decltype(_impl_.attempts_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.server_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PushMsg::~PushMsg() {
   // @@protoc_insertion_point(destructor:ChatRoom.Job.PushMsg)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<std::string>();
 }
 
 inline void PushMsg::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  server_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  room_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  msg_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.server_.Destroy();
+  _impl_.room_.Destroy();
+  _impl_.msg_.Destroy();
 }
 
-void PushMsg::ArenaDtor(void* object) {
-  PushMsg* _this = reinterpret_cast< PushMsg* >(object);
-  (void)_this;
-}
-void PushMsg::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void PushMsg::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void PushMsg::Clear() {
@@ -216,21 +236,21 @@ void PushMsg::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  keys_.Clear();
-  server_.ClearToEmpty();
-  room_.ClearToEmpty();
-  msg_.ClearToEmpty();
-  ::memset(&type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&speed_) -
-      reinterpret_cast<char*>(&type_)) + sizeof(speed_));
+  _impl_.keys_.Clear();
+  _impl_.server_.ClearToEmpty();
+  _impl_.room_.ClearToEmpty();
+  _impl_.msg_.ClearToEmpty();
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.attempts_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.attempts_));
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* PushMsg::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PushMsg::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .ChatRoom.Job.PushMsg.Type type = 1;
       case 1:
@@ -244,7 +264,7 @@ const char* PushMsg::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
       // int32 operation = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          operation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.operation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -252,7 +272,7 @@ const char* PushMsg::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
       // int32 speed = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -261,9 +281,9 @@ const char* PushMsg::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_server();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, nullptr));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
         } else
           goto handle_unusual;
         continue;
@@ -271,9 +291,9 @@ const char* PushMsg::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           auto str = _internal_mutable_room();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, nullptr));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
         } else
           goto handle_unusual;
         continue;
@@ -284,9 +304,9 @@ const char* PushMsg::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
           do {
             ptr += 1;
             auto str = _internal_add_keys();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, nullptr));
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, nullptr));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
         } else
@@ -296,7 +316,15 @@ const char* PushMsg::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
       case 7:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
           auto str = _internal_mutable_msg();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 attempts = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.attempts_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -333,20 +361,20 @@ uint8_t* PushMsg::_InternalSerialize(
   // .ChatRoom.Job.PushMsg.Type type = 1;
   if (this->_internal_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_type(), target);
   }
 
   // int32 operation = 2;
   if (this->_internal_operation() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_operation(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_operation(), target);
   }
 
   // int32 speed = 3;
   if (this->_internal_speed() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_speed(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_speed(), target);
   }
 
   // string server = 4;
@@ -385,6 +413,12 @@ uint8_t* PushMsg::_InternalSerialize(
         7, this->_internal_msg(), target);
   }
 
+  // int32 attempts = 8;
+  if (this->_internal_attempts() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_attempts(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -403,10 +437,10 @@ size_t PushMsg::ByteSizeLong() const {
 
   // repeated string keys = 6;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(keys_.size());
-  for (int i = 0, n = keys_.size(); i < n; i++) {
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
     total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      keys_.Get(i));
+      _impl_.keys_.Get(i));
   }
 
   // string server = 4;
@@ -433,59 +467,68 @@ size_t PushMsg::ByteSizeLong() const {
   // .ChatRoom.Job.PushMsg.Type type = 1;
   if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
   // int32 operation = 2;
   if (this->_internal_operation() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_operation());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_operation());
   }
 
   // int32 speed = 3;
   if (this->_internal_speed() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_speed());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_speed());
+  }
+
+  // int32 attempts = 8;
+  if (this->_internal_attempts() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_attempts());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void PushMsg::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const PushMsg*>(
+  MergeFrom(*::_pbi::DownCast<const PushMsg*>(
       &from));
 }
 
 void PushMsg::MergeFrom(const PushMsg& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Job.PushMsg)
-  GOOGLE_DCHECK_NE(&from, this);
+  PushMsg* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Job.PushMsg)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  keys_.MergeFrom(from.keys_);
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
   if (!from._internal_server().empty()) {
-    _internal_set_server(from._internal_server());
+    _this->_internal_set_server(from._internal_server());
   }
   if (!from._internal_room().empty()) {
-    _internal_set_room(from._internal_room());
+    _this->_internal_set_room(from._internal_room());
   }
   if (!from._internal_msg().empty()) {
-    _internal_set_msg(from._internal_msg());
+    _this->_internal_set_msg(from._internal_msg());
   }
   if (from._internal_type() != 0) {
-    _internal_set_type(from._internal_type());
+    _this->_internal_set_type(from._internal_type());
   }
   if (from._internal_operation() != 0) {
-    _internal_set_operation(from._internal_operation());
+    _this->_internal_set_operation(from._internal_operation());
   }
   if (from._internal_speed() != 0) {
-    _internal_set_speed(from._internal_speed());
+    _this->_internal_set_speed(from._internal_speed());
   }
-  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_attempts() != 0) {
+    _this->_internal_set_attempts(from._internal_attempts());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void PushMsg::CopyFrom(const PushMsg& from) {
@@ -504,28 +547,25 @@ void PushMsg::InternalSwap(PushMsg* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  keys_.InternalSwap(&other->keys_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &server_, lhs_arena,
-      &other->server_, rhs_arena
+      &_impl_.server_, lhs_arena,
+      &other->_impl_.server_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &room_, lhs_arena,
-      &other->room_, rhs_arena
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &msg_, lhs_arena,
-      &other->msg_, rhs_arena
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(PushMsg, speed_)
-      + sizeof(PushMsg::speed_)
-      - PROTOBUF_FIELD_OFFSET(PushMsg, type_)>(
-          reinterpret_cast<char*>(&type_),
-          reinterpret_cast<char*>(&other->type_));
+      PROTOBUF_FIELD_OFFSET(PushMsg, _impl_.attempts_)
+      + sizeof(PushMsg::_impl_.attempts_)
+      - PROTOBUF_FIELD_OFFSET(PushMsg, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
 }
 
 std::string PushMsg::GetTypeName() const {
@@ -542,60 +582,67 @@ class Proto::_Internal {
 Proto::Proto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:ChatRoom.Job.Proto)
 }
 Proto::Proto(const Proto& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Proto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.body_){}
+    , decltype(_impl_.ver_){}
+    , decltype(_impl_.op_){}
+    , decltype(_impl_.seq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  body_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.body_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.body_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_body().empty()) {
-    body_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_body(), 
-      GetArenaForAllocation());
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&ver_, &from.ver_,
-    static_cast<size_t>(reinterpret_cast<char*>(&seq_) -
-    reinterpret_cast<char*>(&ver_)) + sizeof(seq_));
+  ::memcpy(&_impl_.ver_, &from._impl_.ver_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.seq_) -
+    reinterpret_cast<char*>(&_impl_.ver_)) + sizeof(_impl_.seq_));
   // @@protoc_insertion_point(copy_constructor:ChatRoom.Job.Proto)
 }
 
-inline void Proto::SharedCtor() {
-body_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&ver_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&seq_) -
-    reinterpret_cast<char*>(&ver_)) + sizeof(seq_));
+inline void Proto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.body_){}
+    , decltype(_impl_.ver_){0}
+    , decltype(_impl_.op_){0}
+    , decltype(_impl_.seq_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Proto::~Proto() {
   // @@protoc_insertion_point(destructor:ChatRoom.Job.Proto)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<std::string>();
 }
 
 inline void Proto::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  body_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.body_.Destroy();
 }
 
-void Proto::ArenaDtor(void* object) {
-  Proto* _this = reinterpret_cast< Proto* >(object);
-  (void)_this;
-}
-void Proto::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Proto::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Proto::Clear() {
@@ -604,23 +651,23 @@ void Proto::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  body_.ClearToEmpty();
-  ::memset(&ver_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&seq_) -
-      reinterpret_cast<char*>(&ver_)) + sizeof(seq_));
+  _impl_.body_.ClearToEmpty();
+  ::memset(&_impl_.ver_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.seq_) -
+      reinterpret_cast<char*>(&_impl_.ver_)) + sizeof(_impl_.seq_));
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* Proto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Proto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 ver = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          ver_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.ver_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -628,7 +675,7 @@ const char* Proto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       // int32 op = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          op_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.op_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -636,7 +683,7 @@ const char* Proto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       // int32 seq = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -645,7 +692,7 @@ const char* Proto::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_body();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -682,19 +729,19 @@ uint8_t* Proto::_InternalSerialize(
   // int32 ver = 1;
   if (this->_internal_ver() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_ver(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_ver(), target);
   }
 
   // int32 op = 2;
   if (this->_internal_op() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_op(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_op(), target);
   }
 
   // int32 seq = 3;
   if (this->_internal_seq() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_seq(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_seq(), target);
   }
 
   // bytes body = 4;
@@ -728,52 +775,53 @@ size_t Proto::ByteSizeLong() const {
 
   // int32 ver = 1;
   if (this->_internal_ver() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_ver());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ver());
   }
 
   // int32 op = 2;
   if (this->_internal_op() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_op());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_op());
   }
 
   // int32 seq = 3;
   if (this->_internal_seq() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_seq());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_seq());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void Proto::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const Proto*>(
+  MergeFrom(*::_pbi::DownCast<const Proto*>(
       &from));
 }
 
 void Proto::MergeFrom(const Proto& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Job.Proto)
-  GOOGLE_DCHECK_NE(&from, this);
+  Proto* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Job.Proto)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_body().empty()) {
-    _internal_set_body(from._internal_body());
+    _this->_internal_set_body(from._internal_body());
   }
   if (from._internal_ver() != 0) {
-    _internal_set_ver(from._internal_ver());
+    _this->_internal_set_ver(from._internal_ver());
   }
   if (from._internal_op() != 0) {
-    _internal_set_op(from._internal_op());
+    _this->_internal_set_op(from._internal_op());
   }
   if (from._internal_seq() != 0) {
-    _internal_set_seq(from._internal_seq());
+    _this->_internal_set_seq(from._internal_seq());
   }
-  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void Proto::CopyFrom(const Proto& from) {
@@ -793,16 +841,15 @@ void Proto::InternalSwap(Proto* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &body_, lhs_arena,
-      &other->body_, rhs_arena
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Proto, seq_)
-      + sizeof(Proto::seq_)
-      - PROTOBUF_FIELD_OFFSET(Proto, ver_)>(
-          reinterpret_cast<char*>(&ver_),
-          reinterpret_cast<char*>(&other->ver_));
+      PROTOBUF_FIELD_OFFSET(Proto, _impl_.seq_)
+      + sizeof(Proto::_impl_.seq_)
+      - PROTOBUF_FIELD_OFFSET(Proto, _impl_.ver_)>(
+          reinterpret_cast<char*>(&_impl_.ver_),
+          reinterpret_cast<char*>(&other->_impl_.ver_));
 }
 
 std::string Proto::GetTypeName() const {
@@ -814,10 +861,12 @@ std::string Proto::GetTypeName() const {
 }  // namespace Job
 }  // namespace ChatRoom
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::ChatRoom::Job::PushMsg* Arena::CreateMaybeMessage< ::ChatRoom::Job::PushMsg >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Job::PushMsg*
+Arena::CreateMaybeMessage< ::ChatRoom::Job::PushMsg >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Job::PushMsg >(arena);
 }
-template<> PROTOBUF_NOINLINE ::ChatRoom::Job::Proto* Arena::CreateMaybeMessage< ::ChatRoom::Job::Proto >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ChatRoom::Job::Proto*
+Arena::CreateMaybeMessage< ::ChatRoom::Job::Proto >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ChatRoom::Job::Proto >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
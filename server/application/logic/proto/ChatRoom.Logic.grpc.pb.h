@@ -0,0 +1,1045 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: ChatRoom.Logic.proto
+#ifndef GRPC_ChatRoom_2eLogic_2eproto__INCLUDED
+#define GRPC_ChatRoom_2eLogic_2eproto__INCLUDED
+
+#include "ChatRoom.Logic.pb.h"
+
+#include <functional>
+#include <grpcpp/impl/codegen/async_generic_service.h>
+#include <grpcpp/impl/codegen/async_stream.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+#include <grpcpp/impl/codegen/client_callback.h>
+#include <grpcpp/impl/codegen/client_context.h>
+#include <grpcpp/impl/codegen/completion_queue.h>
+#include <grpcpp/impl/codegen/message_allocator.h>
+#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/codegen/rpc_method.h>
+#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_context.h>
+#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/impl/codegen/status.h>
+#include <grpcpp/impl/codegen/stub_options.h>
+#include <grpcpp/impl/codegen/sync_stream.h>
+
+namespace ChatRoom {
+namespace Logic {
+
+class Logic final {
+ public:
+  static constexpr char const* service_full_name() {
+    return "ChatRoom.Logic.Logic";
+  }
+  class StubInterface {
+   public:
+    virtual ~StubInterface() {}
+    // Verify resolve the user of a login cookie
+    virtual ::grpc::Status Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::ChatRoom::Logic::VerifyReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::VerifyReply>> AsyncVerify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::VerifyReply>>(AsyncVerifyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::VerifyReply>> PrepareAsyncVerify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::VerifyReply>>(PrepareAsyncVerifyRaw(context, request, cq));
+    }
+    // Hello rooms with their latest messages for a new websocket conn
+    virtual ::grpc::Status Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::ChatRoom::Logic::HelloReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::HelloReply>> AsyncHello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::HelloReply>>(AsyncHelloRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::HelloReply>> PrepareAsyncHello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::HelloReply>>(PrepareAsyncHelloRaw(context, request, cq));
+    }
+    // Send store messages and push them to the room via kafka
+    virtual ::grpc::Status Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::ChatRoom::Logic::SendReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::SendReply>> AsyncSend(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::SendReply>>(AsyncSendRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::SendReply>> PrepareAsyncSend(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::SendReply>>(PrepareAsyncSendRaw(context, request, cq));
+    }
+    // RoomHistory page of messages older than firstMessageID
+    virtual ::grpc::Status RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::ChatRoom::Logic::RoomHistoryReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomHistoryReply>> AsyncRoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomHistoryReply>>(AsyncRoomHistoryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomHistoryReply>> PrepareAsyncRoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomHistoryReply>>(PrepareAsyncRoomHistoryRaw(context, request, cq));
+    }
+    // CreateRoom create a room and broadcast it via kafka
+    virtual ::grpc::Status CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::ChatRoom::Logic::CreateRoomReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::CreateRoomReply>> AsyncCreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::CreateRoomReply>>(AsyncCreateRoomRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::CreateRoomReply>> PrepareAsyncCreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::CreateRoomReply>>(PrepareAsyncCreateRoomRaw(context, request, cq));
+    }
+    // Rooms get all rooms
+    virtual ::grpc::Status Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::ChatRoom::Logic::RoomsReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomsReply>> AsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomsReply>>(AsyncRoomsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomsReply>> PrepareAsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomsReply>>(PrepareAsyncRoomsRaw(context, request, cq));
+    }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      // Verify resolve the user of a login cookie
+      virtual void Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Hello rooms with their latest messages for a new websocket conn
+      virtual void Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Send store messages and push them to the room via kafka
+      virtual void Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // RoomHistory page of messages older than firstMessageID
+      virtual void RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // CreateRoom create a room and broadcast it via kafka
+      virtual void CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Rooms get all rooms
+      virtual void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::VerifyReply>* AsyncVerifyRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::VerifyReply>* PrepareAsyncVerifyRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::HelloReply>* AsyncHelloRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::HelloReply>* PrepareAsyncHelloRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::SendReply>* AsyncSendRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::SendReply>* PrepareAsyncSendRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomHistoryReply>* AsyncRoomHistoryRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomHistoryReply>* PrepareAsyncRoomHistoryRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::CreateRoomReply>* AsyncCreateRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::CreateRoomReply>* PrepareAsyncCreateRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomsReply>* AsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ChatRoom::Logic::RoomsReply>* PrepareAsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) = 0;
+  };
+  class Stub final : public StubInterface {
+   public:
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    ::grpc::Status Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::ChatRoom::Logic::VerifyReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>> AsyncVerify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>>(AsyncVerifyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>> PrepareAsyncVerify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>>(PrepareAsyncVerifyRaw(context, request, cq));
+    }
+    ::grpc::Status Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::ChatRoom::Logic::HelloReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>> AsyncHello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>>(AsyncHelloRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>> PrepareAsyncHello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>>(PrepareAsyncHelloRaw(context, request, cq));
+    }
+    ::grpc::Status Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::ChatRoom::Logic::SendReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>> AsyncSend(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>>(AsyncSendRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>> PrepareAsyncSend(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>>(PrepareAsyncSendRaw(context, request, cq));
+    }
+    ::grpc::Status RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::ChatRoom::Logic::RoomHistoryReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>> AsyncRoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>>(AsyncRoomHistoryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>> PrepareAsyncRoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>>(PrepareAsyncRoomHistoryRaw(context, request, cq));
+    }
+    ::grpc::Status CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::ChatRoom::Logic::CreateRoomReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>> AsyncCreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>>(AsyncCreateRoomRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>> PrepareAsyncCreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>>(PrepareAsyncCreateRoomRaw(context, request, cq));
+    }
+    ::grpc::Status Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::ChatRoom::Logic::RoomsReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>> AsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>>(AsyncRoomsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>> PrepareAsyncRooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>>(PrepareAsyncRoomsRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response, std::function<void(::grpc::Status)>) override;
+      void Verify(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response, std::function<void(::grpc::Status)>) override;
+      void Hello(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response, std::function<void(::grpc::Status)>) override;
+      void Send(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response, std::function<void(::grpc::Status)>) override;
+      void RoomHistory(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response, std::function<void(::grpc::Status)>) override;
+      void CreateRoom(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response, std::function<void(::grpc::Status)>) override;
+      void Rooms(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
+
+   private:
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>* AsyncVerifyRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::VerifyReply>* PrepareAsyncVerifyRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::VerifyReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>* AsyncHelloRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::HelloReply>* PrepareAsyncHelloRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::HelloReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>* AsyncSendRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::SendReply>* PrepareAsyncSendRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::SendReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>* AsyncRoomHistoryRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomHistoryReply>* PrepareAsyncRoomHistoryRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomHistoryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>* AsyncCreateRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::CreateRoomReply>* PrepareAsyncCreateRoomRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::CreateRoomReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>* AsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ChatRoom::Logic::RoomsReply>* PrepareAsyncRoomsRaw(::grpc::ClientContext* context, const ::ChatRoom::Logic::RoomsReq& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_Verify_;
+    const ::grpc::internal::RpcMethod rpcmethod_Hello_;
+    const ::grpc::internal::RpcMethod rpcmethod_Send_;
+    const ::grpc::internal::RpcMethod rpcmethod_RoomHistory_;
+    const ::grpc::internal::RpcMethod rpcmethod_CreateRoom_;
+    const ::grpc::internal::RpcMethod rpcmethod_Rooms_;
+  };
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+
+  class Service : public ::grpc::Service {
+   public:
+    Service();
+    virtual ~Service();
+    // Verify resolve the user of a login cookie
+    virtual ::grpc::Status Verify(::grpc::ServerContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response);
+    // Hello rooms with their latest messages for a new websocket conn
+    virtual ::grpc::Status Hello(::grpc::ServerContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response);
+    // Send store messages and push them to the room via kafka
+    virtual ::grpc::Status Send(::grpc::ServerContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response);
+    // RoomHistory page of messages older than firstMessageID
+    virtual ::grpc::Status RoomHistory(::grpc::ServerContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response);
+    // CreateRoom create a room and broadcast it via kafka
+    virtual ::grpc::Status CreateRoom(::grpc::ServerContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response);
+    // Rooms get all rooms
+    virtual ::grpc::Status Rooms(::grpc::ServerContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response);
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Verify : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Verify() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_Verify() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Verify(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::VerifyReq* /*request*/, ::ChatRoom::Logic::VerifyReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestVerify(::grpc::ServerContext* context, ::ChatRoom::Logic::VerifyReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Logic::VerifyReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Hello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Hello() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_Hello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Hello(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::HelloReq* /*request*/, ::ChatRoom::Logic::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHello(::grpc::ServerContext* context, ::ChatRoom::Logic::HelloReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Logic::HelloReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Send() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_Send() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Send(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::SendReq* /*request*/, ::ChatRoom::Logic::SendReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSend(::grpc::ServerContext* context, ::ChatRoom::Logic::SendReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Logic::SendReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_RoomHistory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_RoomHistory() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_RoomHistory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RoomHistory(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomHistoryReq* /*request*/, ::ChatRoom::Logic::RoomHistoryReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRoomHistory(::grpc::ServerContext* context, ::ChatRoom::Logic::RoomHistoryReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Logic::RoomHistoryReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_CreateRoom : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_CreateRoom() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_CreateRoom() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CreateRoom(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::CreateRoomReq* /*request*/, ::ChatRoom::Logic::CreateRoomReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCreateRoom(::grpc::ServerContext* context, ::ChatRoom::Logic::CreateRoomReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Logic::CreateRoomReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Rooms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Rooms() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_Rooms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Rooms(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomsReq* /*request*/, ::ChatRoom::Logic::RoomsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRooms(::grpc::ServerContext* context, ::ChatRoom::Logic::RoomsReq* request, ::grpc::ServerAsyncResponseWriter< ::ChatRoom::Logic::RoomsReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Verify<WithAsyncMethod_Hello<WithAsyncMethod_Send<WithAsyncMethod_RoomHistory<WithAsyncMethod_CreateRoom<WithAsyncMethod_Rooms<Service > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_Verify : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Verify() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Logic::VerifyReq* request, ::ChatRoom::Logic::VerifyReply* response) { return this->Verify(context, request, response); }));}
+    void SetMessageAllocatorFor_Verify(
+        ::grpc::MessageAllocator< ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Verify() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Verify(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::VerifyReq* /*request*/, ::ChatRoom::Logic::VerifyReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Verify(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Logic::VerifyReq* /*request*/, ::ChatRoom::Logic::VerifyReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Hello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Hello() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Logic::HelloReq* request, ::ChatRoom::Logic::HelloReply* response) { return this->Hello(context, request, response); }));}
+    void SetMessageAllocatorFor_Hello(
+        ::grpc::MessageAllocator< ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Hello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Hello(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::HelloReq* /*request*/, ::ChatRoom::Logic::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Hello(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Logic::HelloReq* /*request*/, ::ChatRoom::Logic::HelloReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Send() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Logic::SendReq* request, ::ChatRoom::Logic::SendReply* response) { return this->Send(context, request, response); }));}
+    void SetMessageAllocatorFor_Send(
+        ::grpc::MessageAllocator< ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Send() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Send(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::SendReq* /*request*/, ::ChatRoom::Logic::SendReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Send(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Logic::SendReq* /*request*/, ::ChatRoom::Logic::SendReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_RoomHistory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_RoomHistory() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Logic::RoomHistoryReq* request, ::ChatRoom::Logic::RoomHistoryReply* response) { return this->RoomHistory(context, request, response); }));}
+    void SetMessageAllocatorFor_RoomHistory(
+        ::grpc::MessageAllocator< ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_RoomHistory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RoomHistory(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomHistoryReq* /*request*/, ::ChatRoom::Logic::RoomHistoryReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* RoomHistory(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Logic::RoomHistoryReq* /*request*/, ::ChatRoom::Logic::RoomHistoryReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_CreateRoom : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_CreateRoom() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Logic::CreateRoomReq* request, ::ChatRoom::Logic::CreateRoomReply* response) { return this->CreateRoom(context, request, response); }));}
+    void SetMessageAllocatorFor_CreateRoom(
+        ::grpc::MessageAllocator< ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_CreateRoom() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CreateRoom(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::CreateRoomReq* /*request*/, ::ChatRoom::Logic::CreateRoomReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CreateRoom(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Logic::CreateRoomReq* /*request*/, ::ChatRoom::Logic::CreateRoomReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Rooms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Rooms() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ChatRoom::Logic::RoomsReq* request, ::ChatRoom::Logic::RoomsReply* response) { return this->Rooms(context, request, response); }));}
+    void SetMessageAllocatorFor_Rooms(
+        ::grpc::MessageAllocator< ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Rooms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Rooms(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomsReq* /*request*/, ::ChatRoom::Logic::RoomsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Rooms(
+      ::grpc::CallbackServerContext* /*context*/, const ::ChatRoom::Logic::RoomsReq* /*request*/, ::ChatRoom::Logic::RoomsReply* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Verify<WithCallbackMethod_Hello<WithCallbackMethod_Send<WithCallbackMethod_RoomHistory<WithCallbackMethod_CreateRoom<WithCallbackMethod_Rooms<Service > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_Verify : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Verify() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_Verify() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Verify(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::VerifyReq* /*request*/, ::ChatRoom::Logic::VerifyReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Hello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Hello() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_Hello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Hello(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::HelloReq* /*request*/, ::ChatRoom::Logic::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Send() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_Send() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Send(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::SendReq* /*request*/, ::ChatRoom::Logic::SendReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_RoomHistory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_RoomHistory() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_RoomHistory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RoomHistory(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomHistoryReq* /*request*/, ::ChatRoom::Logic::RoomHistoryReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_CreateRoom : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_CreateRoom() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_CreateRoom() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CreateRoom(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::CreateRoomReq* /*request*/, ::ChatRoom::Logic::CreateRoomReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Rooms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Rooms() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_Rooms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Rooms(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomsReq* /*request*/, ::ChatRoom::Logic::RoomsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Verify : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Verify() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_Verify() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Verify(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::VerifyReq* /*request*/, ::ChatRoom::Logic::VerifyReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestVerify(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Hello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Hello() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_Hello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Hello(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::HelloReq* /*request*/, ::ChatRoom::Logic::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHello(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Send() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_Send() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Send(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::SendReq* /*request*/, ::ChatRoom::Logic::SendReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSend(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_RoomHistory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RoomHistory() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_RoomHistory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RoomHistory(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomHistoryReq* /*request*/, ::ChatRoom::Logic::RoomHistoryReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRoomHistory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CreateRoom : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CreateRoom() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_CreateRoom() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CreateRoom(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::CreateRoomReq* /*request*/, ::ChatRoom::Logic::CreateRoomReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCreateRoom(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Rooms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Rooms() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_Rooms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Rooms(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomsReq* /*request*/, ::ChatRoom::Logic::RoomsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRooms(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Verify : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Verify() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Verify(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Verify() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Verify(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::VerifyReq* /*request*/, ::ChatRoom::Logic::VerifyReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Verify(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Hello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Hello() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Hello(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Hello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Hello(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::HelloReq* /*request*/, ::ChatRoom::Logic::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Hello(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Send() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Send(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Send() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Send(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::SendReq* /*request*/, ::ChatRoom::Logic::SendReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Send(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_RoomHistory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_RoomHistory() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RoomHistory(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_RoomHistory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RoomHistory(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomHistoryReq* /*request*/, ::ChatRoom::Logic::RoomHistoryReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* RoomHistory(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CreateRoom : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CreateRoom() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CreateRoom(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CreateRoom() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CreateRoom(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::CreateRoomReq* /*request*/, ::ChatRoom::Logic::CreateRoomReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CreateRoom(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Rooms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Rooms() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Rooms(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Rooms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Rooms(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomsReq* /*request*/, ::ChatRoom::Logic::RoomsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Rooms(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Verify : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Verify() {
+      ::grpc::Service::MarkMethodStreamed(0,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Logic::VerifyReq, ::ChatRoom::Logic::VerifyReply>* streamer) {
+                       return this->StreamedVerify(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Verify() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Verify(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::VerifyReq* /*request*/, ::ChatRoom::Logic::VerifyReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedVerify(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Logic::VerifyReq,::ChatRoom::Logic::VerifyReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Hello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Hello() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Logic::HelloReq, ::ChatRoom::Logic::HelloReply>* streamer) {
+                       return this->StreamedHello(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Hello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Hello(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::HelloReq* /*request*/, ::ChatRoom::Logic::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedHello(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Logic::HelloReq,::ChatRoom::Logic::HelloReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Send() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Logic::SendReq, ::ChatRoom::Logic::SendReply>* streamer) {
+                       return this->StreamedSend(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Send() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Send(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::SendReq* /*request*/, ::ChatRoom::Logic::SendReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSend(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Logic::SendReq,::ChatRoom::Logic::SendReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_RoomHistory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_RoomHistory() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Logic::RoomHistoryReq, ::ChatRoom::Logic::RoomHistoryReply>* streamer) {
+                       return this->StreamedRoomHistory(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_RoomHistory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status RoomHistory(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomHistoryReq* /*request*/, ::ChatRoom::Logic::RoomHistoryReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedRoomHistory(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Logic::RoomHistoryReq,::ChatRoom::Logic::RoomHistoryReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_CreateRoom : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_CreateRoom() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Logic::CreateRoomReq, ::ChatRoom::Logic::CreateRoomReply>* streamer) {
+                       return this->StreamedCreateRoom(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_CreateRoom() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CreateRoom(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::CreateRoomReq* /*request*/, ::ChatRoom::Logic::CreateRoomReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCreateRoom(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Logic::CreateRoomReq,::ChatRoom::Logic::CreateRoomReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Rooms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Rooms() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ChatRoom::Logic::RoomsReq, ::ChatRoom::Logic::RoomsReply>* streamer) {
+                       return this->StreamedRooms(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Rooms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Rooms(::grpc::ServerContext* /*context*/, const ::ChatRoom::Logic::RoomsReq* /*request*/, ::ChatRoom::Logic::RoomsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedRooms(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ChatRoom::Logic::RoomsReq,::ChatRoom::Logic::RoomsReply>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Verify<WithStreamedUnaryMethod_Hello<WithStreamedUnaryMethod_Send<WithStreamedUnaryMethod_RoomHistory<WithStreamedUnaryMethod_CreateRoom<WithStreamedUnaryMethod_Rooms<Service > > > > > > StreamedUnaryService;
+  typedef Service SplitStreamedService;
+  typedef WithStreamedUnaryMethod_Verify<WithStreamedUnaryMethod_Hello<WithStreamedUnaryMethod_Send<WithStreamedUnaryMethod_RoomHistory<WithStreamedUnaryMethod_CreateRoom<WithStreamedUnaryMethod_Rooms<Service > > > > > > StreamedService;
+};
+
+}  // namespace Logic
+}  // namespace ChatRoom
+
+
+#endif  // GRPC_ChatRoom_2eLogic_2eproto__INCLUDED
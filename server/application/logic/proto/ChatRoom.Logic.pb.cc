@@ -0,0 +1,4355 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ChatRoom.Logic.proto
+
+#include "ChatRoom.Logic.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace ChatRoom {
+namespace Logic {
+PROTOBUF_CONSTEXPR User::User(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserDefaultTypeInternal() {}
+  union {
+    User _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserDefaultTypeInternal _User_default_instance_;
+PROTOBUF_CONSTEXPR ChatMessage::ChatMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChatMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChatMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChatMessageDefaultTypeInternal() {}
+  union {
+    ChatMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChatMessageDefaultTypeInternal _ChatMessage_default_instance_;
+PROTOBUF_CONSTEXPR RoomInfo::RoomInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.creatorid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.createtime_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.updatetime_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomInfoDefaultTypeInternal() {}
+  union {
+    RoomInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomInfoDefaultTypeInternal _RoomInfo_default_instance_;
+PROTOBUF_CONSTEXPR RoomMessages::RoomMessages(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_.room_)*/nullptr
+  , /*decltype(_impl_.hasmoremessages_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomMessagesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomMessagesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomMessagesDefaultTypeInternal() {}
+  union {
+    RoomMessages _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomMessagesDefaultTypeInternal _RoomMessages_default_instance_;
+PROTOBUF_CONSTEXPR VerifyReq::VerifyReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cookie_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VerifyReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyReqDefaultTypeInternal() {}
+  union {
+    VerifyReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyReqDefaultTypeInternal _VerifyReq_default_instance_;
+PROTOBUF_CONSTEXPR VerifyReply::VerifyReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.email_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VerifyReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VerifyReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VerifyReplyDefaultTypeInternal() {}
+  union {
+    VerifyReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerifyReplyDefaultTypeInternal _VerifyReply_default_instance_;
+PROTOBUF_CONSTEXPR HelloReq::HelloReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HelloReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HelloReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HelloReqDefaultTypeInternal() {}
+  union {
+    HelloReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HelloReqDefaultTypeInternal _HelloReq_default_instance_;
+PROTOBUF_CONSTEXPR HelloReply::HelloReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HelloReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HelloReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HelloReplyDefaultTypeInternal() {}
+  union {
+    HelloReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HelloReplyDefaultTypeInternal _HelloReply_default_instance_;
+PROTOBUF_CONSTEXPR SendReq::SendReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contents_)*/{}
+  , /*decltype(_impl_.roomid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendReqDefaultTypeInternal() {}
+  union {
+    SendReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendReqDefaultTypeInternal _SendReq_default_instance_;
+PROTOBUF_CONSTEXPR SendReply::SendReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendReplyDefaultTypeInternal() {}
+  union {
+    SendReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendReplyDefaultTypeInternal _SendReply_default_instance_;
+PROTOBUF_CONSTEXPR RoomHistoryReq::RoomHistoryReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.roomid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.firstmessageid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_.count_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomHistoryReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomHistoryReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomHistoryReqDefaultTypeInternal() {}
+  union {
+    RoomHistoryReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomHistoryReqDefaultTypeInternal _RoomHistoryReq_default_instance_;
+PROTOBUF_CONSTEXPR RoomHistoryReply::RoomHistoryReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.history_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomHistoryReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomHistoryReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomHistoryReplyDefaultTypeInternal() {}
+  union {
+    RoomHistoryReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomHistoryReplyDefaultTypeInternal _RoomHistoryReply_default_instance_;
+PROTOBUF_CONSTEXPR CreateRoomReq::CreateRoomReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.roomname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.creator_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateRoomReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateRoomReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateRoomReqDefaultTypeInternal() {}
+  union {
+    CreateRoomReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateRoomReqDefaultTypeInternal _CreateRoomReq_default_instance_;
+PROTOBUF_CONSTEXPR CreateRoomReply::CreateRoomReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.room_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateRoomReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateRoomReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateRoomReplyDefaultTypeInternal() {}
+  union {
+    CreateRoomReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateRoomReplyDefaultTypeInternal _CreateRoomReply_default_instance_;
+PROTOBUF_CONSTEXPR RoomsReq::RoomsReq(
+    ::_pbi::ConstantInitialized) {}
+struct RoomsReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomsReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomsReqDefaultTypeInternal() {}
+  union {
+    RoomsReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomsReqDefaultTypeInternal _RoomsReq_default_instance_;
+PROTOBUF_CONSTEXPR RoomsReply::RoomsReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomsReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomsReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomsReplyDefaultTypeInternal() {}
+  union {
+    RoomsReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomsReplyDefaultTypeInternal _RoomsReply_default_instance_;
+}  // namespace Logic
+}  // namespace ChatRoom
+static ::_pb::Metadata file_level_metadata_ChatRoom_2eLogic_2eproto[16];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ChatRoom_2eLogic_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ChatRoom_2eLogic_2eproto = nullptr;
+
+const uint32_t TableStruct_ChatRoom_2eLogic_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::User, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::User, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::User, _impl_.username_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::ChatMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::ChatMessage, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::ChatMessage, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::ChatMessage, _impl_.user_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::ChatMessage, _impl_.timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomInfo, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomInfo, _impl_.creatorid_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomInfo, _impl_.createtime_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomInfo, _impl_.updatetime_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomMessages, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomMessages, _impl_.room_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomMessages, _impl_.hasmoremessages_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomMessages, _impl_.messages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::VerifyReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::VerifyReq, _impl_.cookie_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::VerifyReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::VerifyReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::VerifyReply, _impl_.user_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::VerifyReply, _impl_.email_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::VerifyReply, _impl_.error_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::HelloReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::HelloReq, _impl_.user_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::HelloReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::HelloReply, _impl_.rooms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::SendReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::SendReq, _impl_.roomid_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::SendReq, _impl_.user_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::SendReq, _impl_.contents_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::SendReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::SendReply, _impl_.messages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomHistoryReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomHistoryReq, _impl_.roomid_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomHistoryReq, _impl_.firstmessageid_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomHistoryReq, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomHistoryReq, _impl_.user_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomHistoryReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomHistoryReply, _impl_.history_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::CreateRoomReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::CreateRoomReq, _impl_.roomname_),
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::CreateRoomReq, _impl_.creator_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::CreateRoomReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::CreateRoomReply, _impl_.room_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomsReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomsReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ChatRoom::Logic::RoomsReply, _impl_.rooms_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::ChatRoom::Logic::User)},
+  { 8, -1, -1, sizeof(::ChatRoom::Logic::ChatMessage)},
+  { 18, -1, -1, sizeof(::ChatRoom::Logic::RoomInfo)},
+  { 29, -1, -1, sizeof(::ChatRoom::Logic::RoomMessages)},
+  { 38, -1, -1, sizeof(::ChatRoom::Logic::VerifyReq)},
+  { 45, -1, -1, sizeof(::ChatRoom::Logic::VerifyReply)},
+  { 55, -1, -1, sizeof(::ChatRoom::Logic::HelloReq)},
+  { 62, -1, -1, sizeof(::ChatRoom::Logic::HelloReply)},
+  { 69, -1, -1, sizeof(::ChatRoom::Logic::SendReq)},
+  { 78, -1, -1, sizeof(::ChatRoom::Logic::SendReply)},
+  { 85, -1, -1, sizeof(::ChatRoom::Logic::RoomHistoryReq)},
+  { 95, -1, -1, sizeof(::ChatRoom::Logic::RoomHistoryReply)},
+  { 102, -1, -1, sizeof(::ChatRoom::Logic::CreateRoomReq)},
+  { 110, -1, -1, sizeof(::ChatRoom::Logic::CreateRoomReply)},
+  { 117, -1, -1, sizeof(::ChatRoom::Logic::RoomsReq)},
+  { 123, -1, -1, sizeof(::ChatRoom::Logic::RoomsReply)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::ChatRoom::Logic::_User_default_instance_._instance,
+  &::ChatRoom::Logic::_ChatMessage_default_instance_._instance,
+  &::ChatRoom::Logic::_RoomInfo_default_instance_._instance,
+  &::ChatRoom::Logic::_RoomMessages_default_instance_._instance,
+  &::ChatRoom::Logic::_VerifyReq_default_instance_._instance,
+  &::ChatRoom::Logic::_VerifyReply_default_instance_._instance,
+  &::ChatRoom::Logic::_HelloReq_default_instance_._instance,
+  &::ChatRoom::Logic::_HelloReply_default_instance_._instance,
+  &::ChatRoom::Logic::_SendReq_default_instance_._instance,
+  &::ChatRoom::Logic::_SendReply_default_instance_._instance,
+  &::ChatRoom::Logic::_RoomHistoryReq_default_instance_._instance,
+  &::ChatRoom::Logic::_RoomHistoryReply_default_instance_._instance,
+  &::ChatRoom::Logic::_CreateRoomReq_default_instance_._instance,
+  &::ChatRoom::Logic::_CreateRoomReply_default_instance_._instance,
+  &::ChatRoom::Logic::_RoomsReq_default_instance_._instance,
+  &::ChatRoom::Logic::_RoomsReply_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ChatRoom_2eLogic_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024ChatRoom.Logic.proto\022\016ChatRoom.Logic\"$"
+  "\n\004User\022\n\n\002id\030\001 \001(\t\022\020\n\010username\030\002 \001(\t\"a\n\013"
+  "ChatMessage\022\n\n\002id\030\001 \001(\t\022\017\n\007content\030\002 \001(\t"
+  "\022\"\n\004user\030\003 \001(\0132\024.ChatRoom.Logic.User\022\021\n\t"
+  "timestamp\030\004 \001(\004\"_\n\010RoomInfo\022\n\n\002id\030\001 \001(\t\022"
+  "\014\n\004name\030\002 \001(\t\022\021\n\tcreatorID\030\003 \001(\t\022\022\n\ncrea"
+  "teTime\030\004 \001(\t\022\022\n\nupdateTime\030\005 \001(\t\"~\n\014Room"
+  "Messages\022&\n\004room\030\001 \001(\0132\030.ChatRoom.Logic."
+  "RoomInfo\022\027\n\017hasMoreMessages\030\002 \001(\010\022-\n\010mes"
+  "sages\030\003 \003(\0132\033.ChatRoom.Logic.ChatMessage"
+  "\"\033\n\tVerifyReq\022\016\n\006cookie\030\001 \001(\t\"`\n\013VerifyR"
+  "eply\022\017\n\007success\030\001 \001(\010\022\"\n\004user\030\002 \001(\0132\024.Ch"
+  "atRoom.Logic.User\022\r\n\005email\030\003 \001(\t\022\r\n\005erro"
+  "r\030\004 \001(\t\".\n\010HelloReq\022\"\n\004user\030\001 \001(\0132\024.Chat"
+  "Room.Logic.User\"9\n\nHelloReply\022+\n\005rooms\030\001"
+  " \003(\0132\034.ChatRoom.Logic.RoomMessages\"O\n\007Se"
+  "ndReq\022\016\n\006roomID\030\001 \001(\t\022\"\n\004user\030\002 \001(\0132\024.Ch"
+  "atRoom.Logic.User\022\020\n\010contents\030\003 \003(\t\":\n\tS"
+  "endReply\022-\n\010messages\030\001 \003(\0132\033.ChatRoom.Lo"
+  "gic.ChatMessage\"k\n\016RoomHistoryReq\022\016\n\006roo"
+  "mID\030\001 \001(\t\022\026\n\016firstMessageID\030\002 \001(\t\022\r\n\005cou"
+  "nt\030\003 \001(\005\022\"\n\004user\030\004 \001(\0132\024.ChatRoom.Logic."
+  "User\"A\n\020RoomHistoryReply\022-\n\007history\030\001 \001("
+  "\0132\034.ChatRoom.Logic.RoomMessages\"H\n\rCreat"
+  "eRoomReq\022\020\n\010roomName\030\001 \001(\t\022%\n\007creator\030\002 "
+  "\001(\0132\024.ChatRoom.Logic.User\"9\n\017CreateRoomR"
+  "eply\022&\n\004room\030\001 \001(\0132\030.ChatRoom.Logic.Room"
+  "Info\"\n\n\010RoomsReq\"5\n\nRoomsReply\022\'\n\005rooms\030"
+  "\001 \003(\0132\030.ChatRoom.Logic.RoomInfo2\242\003\n\005Logi"
+  "c\022@\n\006Verify\022\031.ChatRoom.Logic.VerifyReq\032\033"
+  ".ChatRoom.Logic.VerifyReply\022=\n\005Hello\022\030.C"
+  "hatRoom.Logic.HelloReq\032\032.ChatRoom.Logic."
+  "HelloReply\022:\n\004Send\022\027.ChatRoom.Logic.Send"
+  "Req\032\031.ChatRoom.Logic.SendReply\022O\n\013RoomHi"
+  "story\022\036.ChatRoom.Logic.RoomHistoryReq\032 ."
+  "ChatRoom.Logic.RoomHistoryReply\022L\n\nCreat"
+  "eRoom\022\035.ChatRoom.Logic.CreateRoomReq\032\037.C"
+  "hatRoom.Logic.CreateRoomReply\022=\n\005Rooms\022\030"
+  ".ChatRoom.Logic.RoomsReq\032\032.ChatRoom.Logi"
+  "c.RoomsReplyb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_ChatRoom_2eLogic_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ChatRoom_2eLogic_2eproto = {
+    false, false, 1580, descriptor_table_protodef_ChatRoom_2eLogic_2eproto,
+    "ChatRoom.Logic.proto",
+    &descriptor_table_ChatRoom_2eLogic_2eproto_once, nullptr, 0, 16,
+    schemas, file_default_instances, TableStruct_ChatRoom_2eLogic_2eproto::offsets,
+    file_level_metadata_ChatRoom_2eLogic_2eproto, file_level_enum_descriptors_ChatRoom_2eLogic_2eproto,
+    file_level_service_descriptors_ChatRoom_2eLogic_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ChatRoom_2eLogic_2eproto_getter() {
+  return &descriptor_table_ChatRoom_2eLogic_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ChatRoom_2eLogic_2eproto(&descriptor_table_ChatRoom_2eLogic_2eproto);
+namespace ChatRoom {
+namespace Logic {
+
+// ===================================================================
+
+class User::_Internal {
+ public:
+};
+
+User::User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.User)
+}
+User::User(const User& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  User* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.username_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.User)
+}
+
+inline void User::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.username_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+User::~User() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.User)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void User::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.username_.Destroy();
+}
+
+void User::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void User::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.User)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* User::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.User.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string username = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.User.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* User::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.User)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.User.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.User.username");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.User)
+  return target;
+}
+
+size_t User::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.User)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData User::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    User::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*User::GetClassData() const { return &_class_data_; }
+
+
+void User::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<User*>(&to_msg);
+  auto& from = static_cast<const User&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.User)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void User::CopyFrom(const User& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.User)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool User::IsInitialized() const {
+  return true;
+}
+
+void User::InternalSwap(User* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata User::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[0]);
+}
+
+// ===================================================================
+
+class ChatMessage::_Internal {
+ public:
+  static const ::ChatRoom::Logic::User& user(const ChatMessage* msg);
+};
+
+const ::ChatRoom::Logic::User&
+ChatMessage::_Internal::user(const ChatMessage* msg) {
+  return *msg->_impl_.user_;
+}
+ChatMessage::ChatMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.ChatMessage)
+}
+ChatMessage::ChatMessage(const ChatMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChatMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.timestamp_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_content().empty()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::ChatRoom::Logic::User(*from._impl_.user_);
+  }
+  _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.ChatMessage)
+}
+
+inline void ChatMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChatMessage::~ChatMessage() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.ChatMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChatMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.content_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.user_;
+}
+
+void ChatMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChatMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.ChatMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+  _impl_.timestamp_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChatMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.ChatMessage.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.ChatMessage.content"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Logic.User user = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 timestamp = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChatMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.ChatMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.ChatMessage.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.ChatMessage.content");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_content(), target);
+  }
+
+  // .ChatRoom.Logic.User user = 3;
+  if (this->_internal_has_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 timestamp = 4;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.ChatMessage)
+  return target;
+}
+
+size_t ChatMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.ChatMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content());
+  }
+
+  // .ChatRoom.Logic.User user = 3;
+  if (this->_internal_has_user()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  // uint64 timestamp = 4;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChatMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChatMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChatMessage::GetClassData() const { return &_class_data_; }
+
+
+void ChatMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChatMessage*>(&to_msg);
+  auto& from = static_cast<const ChatMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.ChatMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  if (from._internal_has_user()) {
+    _this->_internal_mutable_user()->::ChatRoom::Logic::User::MergeFrom(
+        from._internal_user());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChatMessage::CopyFrom(const ChatMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.ChatMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChatMessage::IsInitialized() const {
+  return true;
+}
+
+void ChatMessage::InternalSwap(ChatMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChatMessage, _impl_.timestamp_)
+      + sizeof(ChatMessage::_impl_.timestamp_)
+      - PROTOBUF_FIELD_OFFSET(ChatMessage, _impl_.user_)>(
+          reinterpret_cast<char*>(&_impl_.user_),
+          reinterpret_cast<char*>(&other->_impl_.user_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChatMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[1]);
+}
+
+// ===================================================================
+
+class RoomInfo::_Internal {
+ public:
+};
+
+RoomInfo::RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.RoomInfo)
+}
+RoomInfo::RoomInfo(const RoomInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.creatorid_){}
+    , decltype(_impl_.createtime_){}
+    , decltype(_impl_.updatetime_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.creatorid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.creatorid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_creatorid().empty()) {
+    _this->_impl_.creatorid_.Set(from._internal_creatorid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.createtime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.createtime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_createtime().empty()) {
+    _this->_impl_.createtime_.Set(from._internal_createtime(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.updatetime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.updatetime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_updatetime().empty()) {
+    _this->_impl_.updatetime_.Set(from._internal_updatetime(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.RoomInfo)
+}
+
+inline void RoomInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.creatorid_){}
+    , decltype(_impl_.createtime_){}
+    , decltype(_impl_.updatetime_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.creatorid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.creatorid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.createtime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.createtime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.updatetime_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.updatetime_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RoomInfo::~RoomInfo() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.RoomInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.creatorid_.Destroy();
+  _impl_.createtime_.Destroy();
+  _impl_.updatetime_.Destroy();
+}
+
+void RoomInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.RoomInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.creatorid_.ClearToEmpty();
+  _impl_.createtime_.ClearToEmpty();
+  _impl_.updatetime_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.RoomInfo.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.RoomInfo.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string creatorID = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_creatorid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.RoomInfo.creatorID"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string createTime = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_createtime();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.RoomInfo.createTime"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string updateTime = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_updatetime();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.RoomInfo.updateTime"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.RoomInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.RoomInfo.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.RoomInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // string creatorID = 3;
+  if (!this->_internal_creatorid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_creatorid().data(), static_cast<int>(this->_internal_creatorid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.RoomInfo.creatorID");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_creatorid(), target);
+  }
+
+  // string createTime = 4;
+  if (!this->_internal_createtime().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_createtime().data(), static_cast<int>(this->_internal_createtime().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.RoomInfo.createTime");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_createtime(), target);
+  }
+
+  // string updateTime = 5;
+  if (!this->_internal_updatetime().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_updatetime().data(), static_cast<int>(this->_internal_updatetime().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.RoomInfo.updateTime");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_updatetime(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.RoomInfo)
+  return target;
+}
+
+size_t RoomInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.RoomInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string creatorID = 3;
+  if (!this->_internal_creatorid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_creatorid());
+  }
+
+  // string createTime = 4;
+  if (!this->_internal_createtime().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_createtime());
+  }
+
+  // string updateTime = 5;
+  if (!this->_internal_updatetime().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_updatetime());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomInfo::GetClassData() const { return &_class_data_; }
+
+
+void RoomInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomInfo*>(&to_msg);
+  auto& from = static_cast<const RoomInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.RoomInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_creatorid().empty()) {
+    _this->_internal_set_creatorid(from._internal_creatorid());
+  }
+  if (!from._internal_createtime().empty()) {
+    _this->_internal_set_createtime(from._internal_createtime());
+  }
+  if (!from._internal_updatetime().empty()) {
+    _this->_internal_set_updatetime(from._internal_updatetime());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomInfo::CopyFrom(const RoomInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.RoomInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomInfo::IsInitialized() const {
+  return true;
+}
+
+void RoomInfo::InternalSwap(RoomInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.creatorid_, lhs_arena,
+      &other->_impl_.creatorid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.createtime_, lhs_arena,
+      &other->_impl_.createtime_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.updatetime_, lhs_arena,
+      &other->_impl_.updatetime_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[2]);
+}
+
+// ===================================================================
+
+class RoomMessages::_Internal {
+ public:
+  static const ::ChatRoom::Logic::RoomInfo& room(const RoomMessages* msg);
+};
+
+const ::ChatRoom::Logic::RoomInfo&
+RoomMessages::_Internal::room(const RoomMessages* msg) {
+  return *msg->_impl_.room_;
+}
+RoomMessages::RoomMessages(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.RoomMessages)
+}
+RoomMessages::RoomMessages(const RoomMessages& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomMessages* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , decltype(_impl_.room_){nullptr}
+    , decltype(_impl_.hasmoremessages_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_room()) {
+    _this->_impl_.room_ = new ::ChatRoom::Logic::RoomInfo(*from._impl_.room_);
+  }
+  _this->_impl_.hasmoremessages_ = from._impl_.hasmoremessages_;
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.RoomMessages)
+}
+
+inline void RoomMessages::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , decltype(_impl_.room_){nullptr}
+    , decltype(_impl_.hasmoremessages_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoomMessages::~RoomMessages() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.RoomMessages)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomMessages::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.room_;
+}
+
+void RoomMessages::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomMessages::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.RoomMessages)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.room_ != nullptr) {
+    delete _impl_.room_;
+  }
+  _impl_.room_ = nullptr;
+  _impl_.hasmoremessages_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomMessages::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .ChatRoom.Logic.RoomInfo room = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool hasMoreMessages = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.hasmoremessages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ChatRoom.Logic.ChatMessage messages = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomMessages::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.RoomMessages)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .ChatRoom.Logic.RoomInfo room = 1;
+  if (this->_internal_has_room()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::room(this),
+        _Internal::room(this).GetCachedSize(), target, stream);
+  }
+
+  // bool hasMoreMessages = 2;
+  if (this->_internal_hasmoremessages() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_hasmoremessages(), target);
+  }
+
+  // repeated .ChatRoom.Logic.ChatMessage messages = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.RoomMessages)
+  return target;
+}
+
+size_t RoomMessages::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.RoomMessages)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Logic.ChatMessage messages = 3;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .ChatRoom.Logic.RoomInfo room = 1;
+  if (this->_internal_has_room()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.room_);
+  }
+
+  // bool hasMoreMessages = 2;
+  if (this->_internal_hasmoremessages() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomMessages::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomMessages::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomMessages::GetClassData() const { return &_class_data_; }
+
+
+void RoomMessages::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomMessages*>(&to_msg);
+  auto& from = static_cast<const RoomMessages&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.RoomMessages)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  if (from._internal_has_room()) {
+    _this->_internal_mutable_room()->::ChatRoom::Logic::RoomInfo::MergeFrom(
+        from._internal_room());
+  }
+  if (from._internal_hasmoremessages() != 0) {
+    _this->_internal_set_hasmoremessages(from._internal_hasmoremessages());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomMessages::CopyFrom(const RoomMessages& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.RoomMessages)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomMessages::IsInitialized() const {
+  return true;
+}
+
+void RoomMessages::InternalSwap(RoomMessages* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomMessages, _impl_.hasmoremessages_)
+      + sizeof(RoomMessages::_impl_.hasmoremessages_)
+      - PROTOBUF_FIELD_OFFSET(RoomMessages, _impl_.room_)>(
+          reinterpret_cast<char*>(&_impl_.room_),
+          reinterpret_cast<char*>(&other->_impl_.room_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomMessages::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[3]);
+}
+
+// ===================================================================
+
+class VerifyReq::_Internal {
+ public:
+};
+
+VerifyReq::VerifyReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.VerifyReq)
+}
+VerifyReq::VerifyReq(const VerifyReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VerifyReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cookie_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cookie_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cookie_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cookie().empty()) {
+    _this->_impl_.cookie_.Set(from._internal_cookie(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.VerifyReq)
+}
+
+inline void VerifyReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cookie_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.cookie_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cookie_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VerifyReq::~VerifyReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.VerifyReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VerifyReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cookie_.Destroy();
+}
+
+void VerifyReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VerifyReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.VerifyReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cookie_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VerifyReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string cookie = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_cookie();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.VerifyReq.cookie"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VerifyReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.VerifyReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string cookie = 1;
+  if (!this->_internal_cookie().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cookie().data(), static_cast<int>(this->_internal_cookie().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.VerifyReq.cookie");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_cookie(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.VerifyReq)
+  return target;
+}
+
+size_t VerifyReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.VerifyReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string cookie = 1;
+  if (!this->_internal_cookie().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cookie());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VerifyReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VerifyReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VerifyReq::GetClassData() const { return &_class_data_; }
+
+
+void VerifyReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VerifyReq*>(&to_msg);
+  auto& from = static_cast<const VerifyReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.VerifyReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_cookie().empty()) {
+    _this->_internal_set_cookie(from._internal_cookie());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyReq::CopyFrom(const VerifyReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.VerifyReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VerifyReq::IsInitialized() const {
+  return true;
+}
+
+void VerifyReq::InternalSwap(VerifyReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cookie_, lhs_arena,
+      &other->_impl_.cookie_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VerifyReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[4]);
+}
+
+// ===================================================================
+
+class VerifyReply::_Internal {
+ public:
+  static const ::ChatRoom::Logic::User& user(const VerifyReply* msg);
+};
+
+const ::ChatRoom::Logic::User&
+VerifyReply::_Internal::user(const VerifyReply* msg) {
+  return *msg->_impl_.user_;
+}
+VerifyReply::VerifyReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.VerifyReply)
+}
+VerifyReply::VerifyReply(const VerifyReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VerifyReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.email_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_email().empty()) {
+    _this->_impl_.email_.Set(from._internal_email(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error().empty()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::ChatRoom::Logic::User(*from._impl_.user_);
+  }
+  _this->_impl_.success_ = from._impl_.success_;
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.VerifyReply)
+}
+
+inline void VerifyReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.email_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.email_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.email_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VerifyReply::~VerifyReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.VerifyReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VerifyReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.email_.Destroy();
+  _impl_.error_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.user_;
+}
+
+void VerifyReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VerifyReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.VerifyReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.email_.ClearToEmpty();
+  _impl_.error_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VerifyReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Logic.User user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string email = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_email();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.VerifyReply.email"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string error = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.VerifyReply.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VerifyReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.VerifyReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // .ChatRoom.Logic.User user = 2;
+  if (this->_internal_has_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  // string email = 3;
+  if (!this->_internal_email().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_email().data(), static_cast<int>(this->_internal_email().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.VerifyReply.email");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_email(), target);
+  }
+
+  // string error = 4;
+  if (!this->_internal_error().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.VerifyReply.error");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.VerifyReply)
+  return target;
+}
+
+size_t VerifyReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.VerifyReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string email = 3;
+  if (!this->_internal_email().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_email());
+  }
+
+  // string error = 4;
+  if (!this->_internal_error().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .ChatRoom.Logic.User user = 2;
+  if (this->_internal_has_user()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VerifyReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VerifyReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VerifyReply::GetClassData() const { return &_class_data_; }
+
+
+void VerifyReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VerifyReply*>(&to_msg);
+  auto& from = static_cast<const VerifyReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.VerifyReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_email().empty()) {
+    _this->_internal_set_email(from._internal_email());
+  }
+  if (!from._internal_error().empty()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_has_user()) {
+    _this->_internal_mutable_user()->::ChatRoom::Logic::User::MergeFrom(
+        from._internal_user());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VerifyReply::CopyFrom(const VerifyReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.VerifyReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VerifyReply::IsInitialized() const {
+  return true;
+}
+
+void VerifyReply::InternalSwap(VerifyReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.email_, lhs_arena,
+      &other->_impl_.email_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VerifyReply, _impl_.success_)
+      + sizeof(VerifyReply::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(VerifyReply, _impl_.user_)>(
+          reinterpret_cast<char*>(&_impl_.user_),
+          reinterpret_cast<char*>(&other->_impl_.user_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VerifyReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[5]);
+}
+
+// ===================================================================
+
+class HelloReq::_Internal {
+ public:
+  static const ::ChatRoom::Logic::User& user(const HelloReq* msg);
+};
+
+const ::ChatRoom::Logic::User&
+HelloReq::_Internal::user(const HelloReq* msg) {
+  return *msg->_impl_.user_;
+}
+HelloReq::HelloReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.HelloReq)
+}
+HelloReq::HelloReq(const HelloReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HelloReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::ChatRoom::Logic::User(*from._impl_.user_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.HelloReq)
+}
+
+inline void HelloReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HelloReq::~HelloReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.HelloReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HelloReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.user_;
+}
+
+void HelloReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HelloReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.HelloReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HelloReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .ChatRoom.Logic.User user = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HelloReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.HelloReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .ChatRoom.Logic.User user = 1;
+  if (this->_internal_has_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.HelloReq)
+  return target;
+}
+
+size_t HelloReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.HelloReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .ChatRoom.Logic.User user = 1;
+  if (this->_internal_has_user()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HelloReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HelloReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HelloReq::GetClassData() const { return &_class_data_; }
+
+
+void HelloReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HelloReq*>(&to_msg);
+  auto& from = static_cast<const HelloReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.HelloReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_user()) {
+    _this->_internal_mutable_user()->::ChatRoom::Logic::User::MergeFrom(
+        from._internal_user());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HelloReq::CopyFrom(const HelloReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.HelloReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HelloReq::IsInitialized() const {
+  return true;
+}
+
+void HelloReq::InternalSwap(HelloReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.user_, other->_impl_.user_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HelloReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[6]);
+}
+
+// ===================================================================
+
+class HelloReply::_Internal {
+ public:
+};
+
+HelloReply::HelloReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.HelloReply)
+}
+HelloReply::HelloReply(const HelloReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HelloReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){from._impl_.rooms_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.HelloReply)
+}
+
+inline void HelloReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HelloReply::~HelloReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.HelloReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HelloReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
+}
+
+void HelloReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HelloReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.HelloReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rooms_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HelloReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ChatRoom.Logic.RoomMessages rooms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rooms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HelloReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.HelloReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Logic.RoomMessages rooms = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rooms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rooms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.HelloReply)
+  return target;
+}
+
+size_t HelloReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.HelloReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Logic.RoomMessages rooms = 1;
+  total_size += 1UL * this->_internal_rooms_size();
+  for (const auto& msg : this->_impl_.rooms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HelloReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HelloReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HelloReply::GetClassData() const { return &_class_data_; }
+
+
+void HelloReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HelloReply*>(&to_msg);
+  auto& from = static_cast<const HelloReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.HelloReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HelloReply::CopyFrom(const HelloReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.HelloReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HelloReply::IsInitialized() const {
+  return true;
+}
+
+void HelloReply::InternalSwap(HelloReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HelloReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[7]);
+}
+
+// ===================================================================
+
+class SendReq::_Internal {
+ public:
+  static const ::ChatRoom::Logic::User& user(const SendReq* msg);
+};
+
+const ::ChatRoom::Logic::User&
+SendReq::_Internal::user(const SendReq* msg) {
+  return *msg->_impl_.user_;
+}
+SendReq::SendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.SendReq)
+}
+SendReq::SendReq(const SendReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){from._impl_.contents_}
+    , decltype(_impl_.roomid_){}
+    , decltype(_impl_.user_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_roomid().empty()) {
+    _this->_impl_.roomid_.Set(from._internal_roomid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::ChatRoom::Logic::User(*from._impl_.user_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.SendReq)
+}
+
+inline void SendReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contents_){arena}
+    , decltype(_impl_.roomid_){}
+    , decltype(_impl_.user_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SendReq::~SendReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.SendReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SendReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contents_.~RepeatedPtrField();
+  _impl_.roomid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.user_;
+}
+
+void SendReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SendReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.SendReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contents_.Clear();
+  _impl_.roomid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SendReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string roomID = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_roomid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.SendReq.roomID"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Logic.User user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string contents = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.SendReq.contents"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SendReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.SendReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_roomid().data(), static_cast<int>(this->_internal_roomid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.SendReq.roomID");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_roomid(), target);
+  }
+
+  // .ChatRoom.Logic.User user = 2;
+  if (this->_internal_has_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated string contents = 3;
+  for (int i = 0, n = this->_internal_contents_size(); i < n; i++) {
+    const auto& s = this->_internal_contents(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.SendReq.contents");
+    target = stream->WriteString(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.SendReq)
+  return target;
+}
+
+size_t SendReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.SendReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string contents = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contents_.size());
+  for (int i = 0, n = _impl_.contents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.contents_.Get(i));
+  }
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_roomid());
+  }
+
+  // .ChatRoom.Logic.User user = 2;
+  if (this->_internal_has_user()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendReq::GetClassData() const { return &_class_data_; }
+
+
+void SendReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendReq*>(&to_msg);
+  auto& from = static_cast<const SendReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.SendReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contents_.MergeFrom(from._impl_.contents_);
+  if (!from._internal_roomid().empty()) {
+    _this->_internal_set_roomid(from._internal_roomid());
+  }
+  if (from._internal_has_user()) {
+    _this->_internal_mutable_user()->::ChatRoom::Logic::User::MergeFrom(
+        from._internal_user());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SendReq::CopyFrom(const SendReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.SendReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SendReq::IsInitialized() const {
+  return true;
+}
+
+void SendReq::InternalSwap(SendReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.contents_.InternalSwap(&other->_impl_.contents_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.roomid_, lhs_arena,
+      &other->_impl_.roomid_, rhs_arena
+  );
+  swap(_impl_.user_, other->_impl_.user_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[8]);
+}
+
+// ===================================================================
+
+class SendReply::_Internal {
+ public:
+};
+
+SendReply::SendReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.SendReply)
+}
+SendReply::SendReply(const SendReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.SendReply)
+}
+
+inline void SendReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SendReply::~SendReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.SendReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SendReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void SendReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SendReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.SendReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SendReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ChatRoom.Logic.ChatMessage messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SendReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.SendReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Logic.ChatMessage messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.SendReply)
+  return target;
+}
+
+size_t SendReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.SendReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Logic.ChatMessage messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendReply::GetClassData() const { return &_class_data_; }
+
+
+void SendReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendReply*>(&to_msg);
+  auto& from = static_cast<const SendReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.SendReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SendReply::CopyFrom(const SendReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.SendReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SendReply::IsInitialized() const {
+  return true;
+}
+
+void SendReply::InternalSwap(SendReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[9]);
+}
+
+// ===================================================================
+
+class RoomHistoryReq::_Internal {
+ public:
+  static const ::ChatRoom::Logic::User& user(const RoomHistoryReq* msg);
+};
+
+const ::ChatRoom::Logic::User&
+RoomHistoryReq::_Internal::user(const RoomHistoryReq* msg) {
+  return *msg->_impl_.user_;
+}
+RoomHistoryReq::RoomHistoryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.RoomHistoryReq)
+}
+RoomHistoryReq::RoomHistoryReq(const RoomHistoryReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomHistoryReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roomid_){}
+    , decltype(_impl_.firstmessageid_){}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_roomid().empty()) {
+    _this->_impl_.roomid_.Set(from._internal_roomid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.firstmessageid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.firstmessageid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_firstmessageid().empty()) {
+    _this->_impl_.firstmessageid_.Set(from._internal_firstmessageid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::ChatRoom::Logic::User(*from._impl_.user_);
+  }
+  _this->_impl_.count_ = from._impl_.count_;
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.RoomHistoryReq)
+}
+
+inline void RoomHistoryReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roomid_){}
+    , decltype(_impl_.firstmessageid_){}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.count_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.roomid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.firstmessageid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.firstmessageid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RoomHistoryReq::~RoomHistoryReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.RoomHistoryReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomHistoryReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.roomid_.Destroy();
+  _impl_.firstmessageid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.user_;
+}
+
+void RoomHistoryReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomHistoryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.RoomHistoryReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.roomid_.ClearToEmpty();
+  _impl_.firstmessageid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+  _impl_.count_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomHistoryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string roomID = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_roomid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.RoomHistoryReq.roomID"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string firstMessageID = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_firstmessageid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.RoomHistoryReq.firstMessageID"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Logic.User user = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomHistoryReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.RoomHistoryReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_roomid().data(), static_cast<int>(this->_internal_roomid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.RoomHistoryReq.roomID");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_roomid(), target);
+  }
+
+  // string firstMessageID = 2;
+  if (!this->_internal_firstmessageid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_firstmessageid().data(), static_cast<int>(this->_internal_firstmessageid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.RoomHistoryReq.firstMessageID");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_firstmessageid(), target);
+  }
+
+  // int32 count = 3;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_count(), target);
+  }
+
+  // .ChatRoom.Logic.User user = 4;
+  if (this->_internal_has_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.RoomHistoryReq)
+  return target;
+}
+
+size_t RoomHistoryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.RoomHistoryReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string roomID = 1;
+  if (!this->_internal_roomid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_roomid());
+  }
+
+  // string firstMessageID = 2;
+  if (!this->_internal_firstmessageid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_firstmessageid());
+  }
+
+  // .ChatRoom.Logic.User user = 4;
+  if (this->_internal_has_user()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  // int32 count = 3;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomHistoryReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomHistoryReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomHistoryReq::GetClassData() const { return &_class_data_; }
+
+
+void RoomHistoryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomHistoryReq*>(&to_msg);
+  auto& from = static_cast<const RoomHistoryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.RoomHistoryReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_roomid().empty()) {
+    _this->_internal_set_roomid(from._internal_roomid());
+  }
+  if (!from._internal_firstmessageid().empty()) {
+    _this->_internal_set_firstmessageid(from._internal_firstmessageid());
+  }
+  if (from._internal_has_user()) {
+    _this->_internal_mutable_user()->::ChatRoom::Logic::User::MergeFrom(
+        from._internal_user());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomHistoryReq::CopyFrom(const RoomHistoryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.RoomHistoryReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomHistoryReq::IsInitialized() const {
+  return true;
+}
+
+void RoomHistoryReq::InternalSwap(RoomHistoryReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.roomid_, lhs_arena,
+      &other->_impl_.roomid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.firstmessageid_, lhs_arena,
+      &other->_impl_.firstmessageid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomHistoryReq, _impl_.count_)
+      + sizeof(RoomHistoryReq::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(RoomHistoryReq, _impl_.user_)>(
+          reinterpret_cast<char*>(&_impl_.user_),
+          reinterpret_cast<char*>(&other->_impl_.user_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomHistoryReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[10]);
+}
+
+// ===================================================================
+
+class RoomHistoryReply::_Internal {
+ public:
+  static const ::ChatRoom::Logic::RoomMessages& history(const RoomHistoryReply* msg);
+};
+
+const ::ChatRoom::Logic::RoomMessages&
+RoomHistoryReply::_Internal::history(const RoomHistoryReply* msg) {
+  return *msg->_impl_.history_;
+}
+RoomHistoryReply::RoomHistoryReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.RoomHistoryReply)
+}
+RoomHistoryReply::RoomHistoryReply(const RoomHistoryReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomHistoryReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.history_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_history()) {
+    _this->_impl_.history_ = new ::ChatRoom::Logic::RoomMessages(*from._impl_.history_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.RoomHistoryReply)
+}
+
+inline void RoomHistoryReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.history_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoomHistoryReply::~RoomHistoryReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.RoomHistoryReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomHistoryReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.history_;
+}
+
+void RoomHistoryReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomHistoryReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.RoomHistoryReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.history_ != nullptr) {
+    delete _impl_.history_;
+  }
+  _impl_.history_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomHistoryReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .ChatRoom.Logic.RoomMessages history = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_history(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomHistoryReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.RoomHistoryReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .ChatRoom.Logic.RoomMessages history = 1;
+  if (this->_internal_has_history()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::history(this),
+        _Internal::history(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.RoomHistoryReply)
+  return target;
+}
+
+size_t RoomHistoryReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.RoomHistoryReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .ChatRoom.Logic.RoomMessages history = 1;
+  if (this->_internal_has_history()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.history_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomHistoryReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomHistoryReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomHistoryReply::GetClassData() const { return &_class_data_; }
+
+
+void RoomHistoryReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomHistoryReply*>(&to_msg);
+  auto& from = static_cast<const RoomHistoryReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.RoomHistoryReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_history()) {
+    _this->_internal_mutable_history()->::ChatRoom::Logic::RoomMessages::MergeFrom(
+        from._internal_history());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomHistoryReply::CopyFrom(const RoomHistoryReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.RoomHistoryReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomHistoryReply::IsInitialized() const {
+  return true;
+}
+
+void RoomHistoryReply::InternalSwap(RoomHistoryReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.history_, other->_impl_.history_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomHistoryReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[11]);
+}
+
+// ===================================================================
+
+class CreateRoomReq::_Internal {
+ public:
+  static const ::ChatRoom::Logic::User& creator(const CreateRoomReq* msg);
+};
+
+const ::ChatRoom::Logic::User&
+CreateRoomReq::_Internal::creator(const CreateRoomReq* msg) {
+  return *msg->_impl_.creator_;
+}
+CreateRoomReq::CreateRoomReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.CreateRoomReq)
+}
+CreateRoomReq::CreateRoomReq(const CreateRoomReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CreateRoomReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roomname_){}
+    , decltype(_impl_.creator_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.roomname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_roomname().empty()) {
+    _this->_impl_.roomname_.Set(from._internal_roomname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_creator()) {
+    _this->_impl_.creator_ = new ::ChatRoom::Logic::User(*from._impl_.creator_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.CreateRoomReq)
+}
+
+inline void CreateRoomReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roomname_){}
+    , decltype(_impl_.creator_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.roomname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.roomname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CreateRoomReq::~CreateRoomReq() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.CreateRoomReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CreateRoomReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.roomname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.creator_;
+}
+
+void CreateRoomReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CreateRoomReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.CreateRoomReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.roomname_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.creator_ != nullptr) {
+    delete _impl_.creator_;
+  }
+  _impl_.creator_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CreateRoomReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string roomName = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_roomname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ChatRoom.Logic.CreateRoomReq.roomName"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ChatRoom.Logic.User creator = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_creator(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CreateRoomReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.CreateRoomReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string roomName = 1;
+  if (!this->_internal_roomname().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_roomname().data(), static_cast<int>(this->_internal_roomname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ChatRoom.Logic.CreateRoomReq.roomName");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_roomname(), target);
+  }
+
+  // .ChatRoom.Logic.User creator = 2;
+  if (this->_internal_has_creator()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::creator(this),
+        _Internal::creator(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.CreateRoomReq)
+  return target;
+}
+
+size_t CreateRoomReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.CreateRoomReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string roomName = 1;
+  if (!this->_internal_roomname().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_roomname());
+  }
+
+  // .ChatRoom.Logic.User creator = 2;
+  if (this->_internal_has_creator()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.creator_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CreateRoomReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CreateRoomReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CreateRoomReq::GetClassData() const { return &_class_data_; }
+
+
+void CreateRoomReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CreateRoomReq*>(&to_msg);
+  auto& from = static_cast<const CreateRoomReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.CreateRoomReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_roomname().empty()) {
+    _this->_internal_set_roomname(from._internal_roomname());
+  }
+  if (from._internal_has_creator()) {
+    _this->_internal_mutable_creator()->::ChatRoom::Logic::User::MergeFrom(
+        from._internal_creator());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CreateRoomReq::CopyFrom(const CreateRoomReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.CreateRoomReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateRoomReq::IsInitialized() const {
+  return true;
+}
+
+void CreateRoomReq::InternalSwap(CreateRoomReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.roomname_, lhs_arena,
+      &other->_impl_.roomname_, rhs_arena
+  );
+  swap(_impl_.creator_, other->_impl_.creator_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CreateRoomReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[12]);
+}
+
+// ===================================================================
+
+class CreateRoomReply::_Internal {
+ public:
+  static const ::ChatRoom::Logic::RoomInfo& room(const CreateRoomReply* msg);
+};
+
+const ::ChatRoom::Logic::RoomInfo&
+CreateRoomReply::_Internal::room(const CreateRoomReply* msg) {
+  return *msg->_impl_.room_;
+}
+CreateRoomReply::CreateRoomReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.CreateRoomReply)
+}
+CreateRoomReply::CreateRoomReply(const CreateRoomReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CreateRoomReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_room()) {
+    _this->_impl_.room_ = new ::ChatRoom::Logic::RoomInfo(*from._impl_.room_);
+  }
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.CreateRoomReply)
+}
+
+inline void CreateRoomReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CreateRoomReply::~CreateRoomReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.CreateRoomReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CreateRoomReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.room_;
+}
+
+void CreateRoomReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CreateRoomReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.CreateRoomReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.room_ != nullptr) {
+    delete _impl_.room_;
+  }
+  _impl_.room_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CreateRoomReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .ChatRoom.Logic.RoomInfo room = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CreateRoomReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.CreateRoomReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .ChatRoom.Logic.RoomInfo room = 1;
+  if (this->_internal_has_room()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::room(this),
+        _Internal::room(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.CreateRoomReply)
+  return target;
+}
+
+size_t CreateRoomReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.CreateRoomReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .ChatRoom.Logic.RoomInfo room = 1;
+  if (this->_internal_has_room()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.room_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CreateRoomReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CreateRoomReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CreateRoomReply::GetClassData() const { return &_class_data_; }
+
+
+void CreateRoomReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CreateRoomReply*>(&to_msg);
+  auto& from = static_cast<const CreateRoomReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.CreateRoomReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_room()) {
+    _this->_internal_mutable_room()->::ChatRoom::Logic::RoomInfo::MergeFrom(
+        from._internal_room());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CreateRoomReply::CopyFrom(const CreateRoomReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.CreateRoomReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateRoomReply::IsInitialized() const {
+  return true;
+}
+
+void CreateRoomReply::InternalSwap(CreateRoomReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.room_, other->_impl_.room_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CreateRoomReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[13]);
+}
+
+// ===================================================================
+
+class RoomsReq::_Internal {
+ public:
+};
+
+RoomsReq::RoomsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.RoomsReq)
+}
+RoomsReq::RoomsReq(const RoomsReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  RoomsReq* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.RoomsReq)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomsReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomsReq::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomsReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[14]);
+}
+
+// ===================================================================
+
+class RoomsReply::_Internal {
+ public:
+};
+
+RoomsReply::RoomsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ChatRoom.Logic.RoomsReply)
+}
+RoomsReply::RoomsReply(const RoomsReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomsReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){from._impl_.rooms_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ChatRoom.Logic.RoomsReply)
+}
+
+inline void RoomsReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoomsReply::~RoomsReply() {
+  // @@protoc_insertion_point(destructor:ChatRoom.Logic.RoomsReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomsReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
+}
+
+void RoomsReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomsReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:ChatRoom.Logic.RoomsReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rooms_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomsReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .ChatRoom.Logic.RoomInfo rooms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rooms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomsReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ChatRoom.Logic.RoomsReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Logic.RoomInfo rooms = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rooms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rooms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ChatRoom.Logic.RoomsReply)
+  return target;
+}
+
+size_t RoomsReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ChatRoom.Logic.RoomsReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .ChatRoom.Logic.RoomInfo rooms = 1;
+  total_size += 1UL * this->_internal_rooms_size();
+  for (const auto& msg : this->_impl_.rooms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomsReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomsReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomsReply::GetClassData() const { return &_class_data_; }
+
+
+void RoomsReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomsReply*>(&to_msg);
+  auto& from = static_cast<const RoomsReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ChatRoom.Logic.RoomsReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomsReply::CopyFrom(const RoomsReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ChatRoom.Logic.RoomsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomsReply::IsInitialized() const {
+  return true;
+}
+
+void RoomsReply::InternalSwap(RoomsReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomsReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChatRoom_2eLogic_2eproto_getter, &descriptor_table_ChatRoom_2eLogic_2eproto_once,
+      file_level_metadata_ChatRoom_2eLogic_2eproto[15]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Logic
+}  // namespace ChatRoom
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::User*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::User >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::User >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::ChatMessage*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::ChatMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::ChatMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::RoomInfo*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::RoomInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::RoomInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::RoomMessages*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::RoomMessages >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::RoomMessages >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::VerifyReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::VerifyReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::VerifyReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::VerifyReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::VerifyReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::VerifyReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::HelloReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::HelloReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::HelloReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::HelloReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::HelloReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::HelloReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::SendReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::SendReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::SendReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::SendReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::SendReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::SendReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::RoomHistoryReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::RoomHistoryReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::RoomHistoryReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::RoomHistoryReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::RoomHistoryReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::RoomHistoryReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::CreateRoomReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::CreateRoomReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::CreateRoomReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::CreateRoomReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::CreateRoomReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::CreateRoomReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::RoomsReq*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::RoomsReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::RoomsReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ChatRoom::Logic::RoomsReply*
+Arena::CreateMaybeMessage< ::ChatRoom::Logic::RoomsReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ChatRoom::Logic::RoomsReply >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,304 @@
+#include "logic_service.h"
+#include <atomic>
+#include <json/json.h>
+#include "muduo/base/Logging.h"
+#include "muduo/base/Timestamp.h"
+#include "../api/api_auth.h"
+#include "session_token.h"
+#include "ChatRoom.Job.pb.h"
+#include "../service/message_service.h"
+#include "../service/room_service.h"
+
+namespace ChatRoom {
+
+static void FillChatMessage(const Message& msg, Logic::ChatMessage* out) {
+    out->set_id(msg.id);
+    out->set_content(msg.content);
+    out->mutable_user()->set_id(msg.user_id);
+    out->mutable_user()->set_username(msg.username);
+    out->set_timestamp(msg.timestamp);
+}
+
+static void FillRoomInfo(const Room& room, Logic::RoomInfo* out) {
+    out->set_id(room.room_id);
+    out->set_name(room.room_name);
+    out->set_creatorid(room.creator_id);
+    out->set_createtime(room.create_time);
+    out->set_updatetime(room.update_time);
+}
+
+grpc::Status LogicServiceImpl::Verify(grpc::ServerContext* context,
+    const Logic::VerifyReq* request,
+    Logic::VerifyReply* response) {
+    AuthResult result = ApiVerifyUserByCookie(request->cookie());
+    response->set_success(result.success);
+    if (result.success) {
+        response->mutable_user()->set_id(result.user_id);
+        response->mutable_user()->set_username(result.username);
+        response->set_email(result.email);
+    }
+    else {
+        response->set_error(result.error_message);
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status LogicServiceImpl::Hello(grpc::ServerContext* context,
+    const Logic::HelloReq* request,
+    Logic::HelloReply* response) {
+    if (request->user().id().empty()) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Missing user info");
+    }
+
+    // 从内存中获取房间信息
+    std::vector<Room> room_list = RoomService::getInstance().getRoomList();
+    MessageStorageManager& storage_mgr = MessageStorageManager::getInstance();
+    for (const auto& room_item : room_list) {
+        Room room_copy = room_item;
+        MessageBatch message_batch;
+        if (storage_mgr.getRoomHistory(room_copy, message_batch) < 0) {
+            LOG_ERROR << "getRoomHistory failed for room: " << room_item.room_id;
+            continue;
+        }
+
+        Logic::RoomMessages* room = response->add_rooms();
+        FillRoomInfo(room_item, room->mutable_room());
+        room->set_hasmoremessages(message_batch.has_more);
+        for (const auto& msg : message_batch.messages) {
+            FillChatMessage(msg, room->add_messages());
+        }
+    }
+
+    LOG_INFO << "Hello handled for user: " << request->user().id() << ", rooms: " << response->rooms_size();
+    return grpc::Status::OK;
+}
+
+grpc::Status LogicServiceImpl::Send(grpc::ServerContext* context,
+    const Logic::SendReq* request,
+    Logic::SendReply* response) {
+    if (request->roomid().empty() || request->user().id().empty() || request->contents().empty()) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Missing required fields");
+    }
+
+    std::vector<string> contents(request->contents().begin(), request->contents().end());
+    std::vector<Message> sent;
+    if (publishRoomMessages(producer_, request->roomid(), request->user().id(),
+            request->user().username(), contents, sent) < 0) {
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE, "send failed");
+    }
+
+    for (const auto& msg : sent) {
+        FillChatMessage(msg, response->add_messages());
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status LogicServiceImpl::RoomHistory(grpc::ServerContext* context,
+    const Logic::RoomHistoryReq* request,
+    Logic::RoomHistoryReply* response) {
+    if (request->roomid().empty() || request->user().id().empty()) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Missing required fields");
+    }
+
+    Room room;
+    room.room_id = request->roomid();
+    room.history_last_message_id = request->firstmessageid();
+    int count = request->count() > 0 ? request->count() : 10;
+
+    MessageBatch message_batch;
+    if (MessageStorageManager::getInstance().getRoomHistory(room, message_batch, count) != 0) {
+        LOG_ERROR << "Failed to get room history from storage, room: " << room.room_id;
+        return grpc::Status(grpc::StatusCode::INTERNAL, "Failed to get room history");
+    }
+
+    Logic::RoomMessages* history = response->mutable_history();
+    history->mutable_room()->set_id(room.room_id);
+    history->set_hasmoremessages(message_batch.has_more);
+    for (const auto& msg : message_batch.messages) {
+        FillChatMessage(msg, history->add_messages());
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status LogicServiceImpl::CreateRoom(grpc::ServerContext* context,
+    const Logic::CreateRoomReq* request,
+    Logic::CreateRoomReply* response) {
+    const string& room_name = request->roomname();
+    const string& creator_id = request->creator().id();
+    const string& creator_username = request->creator().username();
+    if (room_name.empty() || creator_id.empty()) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Missing required fields");
+    }
+
+    LOG_INFO << "Creating room: " << room_name << " by user: " << creator_username << " (ID: " << creator_id << ")";
+
+    RoomService& room_service = RoomService::getInstance();
+    if (room_service.roomExistByName(room_name)) {
+        LOG_WARN << "Room name already exists: " << room_name;
+        return grpc::Status(grpc::StatusCode::ALREADY_EXISTS, "Room name already exists: " + room_name);
+    }
+
+    string room_id;
+    string error_msg;
+    if (room_service.createRoom(room_name, creator_id, creator_username, room_id, error_msg) != 0) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, "Failed to create room: " + error_msg);
+    }
+
+    Logic::RoomInfo* room = response->mutable_room();
+    room->set_id(room_id);
+    room->set_name(room_name);
+    room->set_creatorid(creator_id);
+
+    broadcastRoomCreated(producer_, room_id, encodeCreateRoomJson(room_id, room_name, creator_id, creator_username));
+    LOG_INFO << "Room created successfully: " << room_id;
+    return grpc::Status::OK;
+}
+
+grpc::Status LogicServiceImpl::Rooms(grpc::ServerContext* context,
+    const Logic::RoomsReq* request,
+    Logic::RoomsReply* response) {
+    std::vector<Room> room_list = RoomService::getInstance().getRoomList();
+    for (const auto& room : room_list) {
+        FillRoomInfo(room, response->add_rooms());
+    }
+    return grpc::Status::OK;
+}
+
+int LogicServiceImpl::publishRoomMessages(KafkaProducer& producer, const string& room_id,
+    const string& user_id, const string& username, const std::vector<string>& contents,
+    std::vector<Message>& sent) {
+    // 构造完整的serverMessages格式
+    Json::Value messageWrapper;
+    messageWrapper["type"] = "serverMessages";
+
+    Json::Value payload;
+    payload["roomId"] = room_id;
+
+    Json::Value messagesArray(Json::arrayValue);
+    int messageIndex = 0;
+    for (const auto& content : contents) {
+        // 生成消息ID
+        uint64_t timestamp = muduo::Timestamp::now().microSecondsSinceEpoch() / 1000;
+        Message msg;
+        msg.id = std::to_string(timestamp) + "-" + std::to_string(messageIndex++);
+        msg.content = content;
+        msg.user_id = user_id;
+        msg.username = username;
+        msg.timestamp = timestamp;
+
+        Json::Value messageObj;
+        messageObj["id"] = msg.id;
+        messageObj["content"] = msg.content;
+        Json::Value userObj;
+        userObj["id"] = user_id;
+        userObj["username"] = username;
+        messageObj["user"] = userObj;
+        messageObj["timestamp"] = (Json::UInt64)timestamp;
+        messagesArray.append(messageObj);
+
+        sent.push_back(std::move(msg));
+    }
+
+    // 存储消息到Redis和MySQL, 存储失败仍发送到Kafka
+    MessageStorageManager& storage_mgr = MessageStorageManager::getInstance();
+    if (!sent.empty()) {
+        bool cache_success = (storage_mgr.storeMessagesToCache(room_id, sent) == 0);
+        bool db_success = storage_mgr.storeMessagesToDB(room_id, sent);
+        if (!db_success || !cache_success) {
+            LOG_ERROR << "Failed to store messages - DB: " << (db_success ? "OK" : "FAILED")
+                     << ", Cache: " << (cache_success ? "OK" : "FAILED");
+        } else {
+            LOG_INFO << "Successfully stored " << sent.size() << " messages to database and cache";
+        }
+    }
+
+    payload["messages"] = messagesArray;
+    messageWrapper["payload"] = payload;
+
+    ChatRoom::Job::PushMsg pushMsg;
+    pushMsg.set_type(ChatRoom::Job::PushMsg_Type_ROOM);
+    pushMsg.set_operation(4);  // 房间内消息推送
+    pushMsg.set_room(room_id);
+    Json::FastWriter writer;
+    pushMsg.set_msg(writer.write(messageWrapper));
+
+    std::string serialized_msg;
+    if (!pushMsg.SerializeToString(&serialized_msg)) {
+        LOG_ERROR << "Failed to serialize message";
+        return -1;
+    }
+    // 房间id作为分区 key, 房间内有序, 房间之间分散到各分区并行消费
+    if (!producer.sendMessage(std::move(serialized_msg), room_id)) {
+        LOG_ERROR << "Failed to send message to Kafka";
+        return -1;
+    }
+    return 0;
+}
+
+string LogicServiceImpl::encodeCreateRoomJson(const string& room_id, const string& room_name,
+    const string& creator_id, const string& creator_username) {
+    Json::Value root;
+    root["type"] = "serverCreateRoom";
+
+    Json::Value payload;
+    payload["roomId"] = room_id;
+    payload["roomName"] = room_name;
+    payload["creatorId"] = creator_id;
+    payload["creatorUsername"] = creator_username;
+    root["payload"] = payload;
+
+    Json::FastWriter writer;
+    return writer.write(root);
+}
+
+static std::atomic<int> s_room_broadcast_speed{0};
+
+void LogicServiceImpl::setRoomBroadcastSpeed(int speed) {
+    s_room_broadcast_speed.store(speed > 0 ? speed : 0, std::memory_order_relaxed);
+}
+
+bool LogicServiceImpl::broadcastRoomCreated(KafkaProducer& producer, const string& room_id,
+    const string& create_json) {
+    // kafka 广播房间创建消息
+    ChatRoom::Job::PushMsg pushMsg;
+    pushMsg.set_type(ChatRoom::Job::PushMsg_Type_BROADCAST);
+    pushMsg.set_operation(5);  // 5: 创建房间
+    pushMsg.set_speed(s_room_broadcast_speed.load(std::memory_order_relaxed));
+    pushMsg.set_room("global");  // 全局广播
+    pushMsg.set_msg(create_json);
+
+    std::string serialized_msg;
+    if (!pushMsg.SerializeToString(&serialized_msg)) {
+        LOG_ERROR << "Failed to serialize room creation broadcast message";
+        return false;
+    }
+    // 分区 key 用房间id而不是 "global": 与该房间的消息同一分区, 创建通知先于房间消息到达 job,
+    // comet 先为在线用户订阅新房间, 之后的房间消息才不会因为没有订阅者被丢弃
+    if (!producer.sendMessage(std::move(serialized_msg), room_id)) {
+        LOG_ERROR << "Failed to send room creation broadcast to Kafka";
+        return false;
+    }
+    LOG_INFO << "Room creation broadcast sent to Kafka successfully";
+    return true;
+}
+
+bool LogicServiceImpl::broadcastSessionState(KafkaProducer& producer) {
+    ChatRoom::Job::PushMsg pushMsg;
+    pushMsg.set_type(ChatRoom::Job::PushMsg_Type_BROADCAST);
+    pushMsg.set_operation(kOpSessionState);
+    pushMsg.set_room("global");
+    pushMsg.set_msg(CSessionTokenCodec::GetInstance().EncodeState());
+
+    std::string serialized_msg;
+    if (!pushMsg.SerializeToString(&serialized_msg)) {
+        LOG_ERROR << "Failed to serialize session state message";
+        return false;
+    }
+    if (!producer.sendMessage(std::move(serialized_msg), pushMsg.room())) {
+        LOG_ERROR << "Failed to send session state to Kafka";
+        return false;
+    }
+    return true;
+}
+
+} // namespace ChatRoom
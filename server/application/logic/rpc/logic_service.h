@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "ChatRoom.Logic.grpc.pb.h"
+#include "../api/api_types.h"
+#include "../service/kafka_producer.h"
+
+namespace ChatRoom {
+
+// typed twin of the /logic/* http api, comet calls it by default
+class LogicServiceImpl final : public Logic::Logic::Service {
+public:
+    explicit LogicServiceImpl(KafkaProducer& producer) : producer_(producer) {}
+
+    grpc::Status Verify(grpc::ServerContext* context,
+                        const Logic::VerifyReq* request,
+                        Logic::VerifyReply* response) override;
+
+    grpc::Status Hello(grpc::ServerContext* context,
+                       const Logic::HelloReq* request,
+                       Logic::HelloReply* response) override;
+
+    grpc::Status Send(grpc::ServerContext* context,
+                      const Logic::SendReq* request,
+                      Logic::SendReply* response) override;
+
+    grpc::Status RoomHistory(grpc::ServerContext* context,
+                             const Logic::RoomHistoryReq* request,
+                             Logic::RoomHistoryReply* response) override;
+
+    grpc::Status CreateRoom(grpc::ServerContext* context,
+                            const Logic::CreateRoomReq* request,
+                            Logic::CreateRoomReply* response) override;
+
+    grpc::Status Rooms(grpc::ServerContext* context,
+                       const Logic::RoomsReq* request,
+                       Logic::RoomsReply* response) override;
+
+    // the following are shared with the http api, so both paths push the same json through kafka
+
+    // store the messages of one user and push them to the room, 0 success, -1 kafka failed
+    static int publishRoomMessages(KafkaProducer& producer, const string& room_id, const string& user_id,
+                                   const string& username, const std::vector<string>& contents,
+                                   std::vector<Message>& sent);
+
+    // {"type":"serverCreateRoom","payload":{...}}, empty room_id means the name is taken
+    static string encodeCreateRoomJson(const string& room_id, const string& room_name,
+                                       const string& creator_id, const string& creator_username);
+
+    // tell every comet about a new room, at the speed set below
+    // keyed by room_id like the room's messages, so the notice reaches the job first
+    static bool broadcastRoomCreated(KafkaProducer& producer, const string& room_id, const string& create_json);
+    // users per second the comets write the room creation to, 0 at once
+    static void setRoomBroadcastSpeed(int speed);
+
+    // push the accepted session keys and revoked tokens to every comet, consumed there, never forwarded
+    static bool broadcastSessionState(KafkaProducer& producer);
+
+private:
+    KafkaProducer& producer_;
+};
+
+} // namespace ChatRoom
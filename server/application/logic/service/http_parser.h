@@ -1,5 +1,8 @@
 #pragma once
+#include <stdlib.h>
+#include <strings.h>
 #include <string>
+#include <string_view>
 #include <json/json.h>
 
 class HttpParser {
@@ -26,6 +29,32 @@ public:
         return true;
     }
 
+    // 一个完整请求(头部 + Content-Length 指定的body)的长度, 不完整返回0
+    // keep-alive 连接上的多个请求可能在同一次读取中到达(pipelining)
+    static size_t requestLength(const char* data, size_t len) {
+        std::string_view buf(data, len);
+        size_t headerEnd = buf.find("\r\n\r\n");
+        if (headerEnd == std::string_view::npos) return 0;
+        headerEnd += 4;
+
+        size_t contentLength = 0;
+        size_t pos = buf.find("\r\n");
+        while (pos + 2 < headerEnd) {
+            size_t lineStart = pos + 2;
+            size_t lineEnd = buf.find("\r\n", lineStart);
+            std::string_view line = buf.substr(lineStart, lineEnd - lineStart);
+            static const char kName[] = "content-length:";
+            if (line.size() > sizeof(kName) - 1 &&
+                strncasecmp(line.data(), kName, sizeof(kName) - 1) == 0) {
+                contentLength = strtoul(std::string(line.substr(sizeof(kName) - 1)).c_str(), nullptr, 10);
+            }
+            pos = lineEnd;
+        }
+
+        if (len < headerEnd + contentLength) return 0;
+        return headerEnd + contentLength;
+    }
+
     static bool parseJsonBody(const std::string& body, Json::Value& json) {
         Json::CharReaderBuilder builder;
         Json::CharReader* reader = builder.newCharReader();
@@ -4,14 +4,24 @@
 KafkaProducer::KafkaProducer() 
     : producer_(nullptr)
     , topic_(nullptr)
-    , is_initialized_(false) {
+    , is_initialized_(false)
+    , delivery_report_(this) {
 }
 
 KafkaProducer::~KafkaProducer() {
     close();
 }
 
-bool KafkaProducer::init(const std::string& brokers, const std::string& topic) {
+// 可选的调优参数, 旧版本 librdkafka 不认识时只告警
+static void setOptionalConf(RdKafka::Conf* conf, const std::string& name, const std::string& value) {
+    std::string errstr;
+    if (conf->set(name, value, errstr) != RdKafka::Conf::CONF_OK) {
+        LOG_WARN << "Kafka producer ignores " << name << "=" << value << ": " << errstr;
+    }
+}
+
+bool KafkaProducer::init(const std::string& brokers, const std::string& topic,
+                         const KafkaProducerOptions& options) {
     if (is_initialized_) {
         return true;
     }
@@ -27,6 +37,22 @@ bool KafkaProducer::init(const std::string& brokers, const std::string& topic) {
         return false;
     }
 
+    // 投递报告由 poll 线程回调, 消息攒批压缩后发送
+    if (conf->set("dr_cb", &delivery_report_, errstr) != RdKafka::Conf::CONF_OK) {
+        std::cerr << "Failed to set dr_cb: " << errstr << std::endl;
+        delete conf;
+        return false;
+    }
+    setOptionalConf(conf, "linger.ms", std::to_string(options.linger_ms));
+    setOptionalConf(conf, "batch.num.messages", std::to_string(options.batch_num_messages));
+    if (options.batch_size > 0) {
+        setOptionalConf(conf, "batch.size", std::to_string(options.batch_size));
+    }
+    if (!options.compression.empty()) {
+        setOptionalConf(conf, "compression.codec", options.compression);
+    }
+    setOptionalConf(conf, "queue.buffering.max.messages", std::to_string(options.queue_max_messages));
+
     // 创建producer实例
     producer_ = RdKafka::Producer::create(conf, errstr);
     delete conf;
@@ -36,8 +62,9 @@ bool KafkaProducer::init(const std::string& brokers, const std::string& topic) {
         return false;
     }
 
-    // 创建topic配置
+    // 创建topic配置, 按 key 哈希分区, 同一房间的消息有序
     RdKafka::Conf* tconf = RdKafka::Conf::create(RdKafka::Conf::CONF_TOPIC);
+    setOptionalConf(tconf, "partitioner", "consistent_random");
     
     // 创建topic
     topic_ = RdKafka::Topic::create(producer_, topic, tconf, errstr);
@@ -52,50 +79,64 @@ bool KafkaProducer::init(const std::string& brokers, const std::string& topic) {
 
     topic_name_ = topic;
     is_initialized_ = true;
-    LOG_INFO << "Kafka producer initialized successfully";
+    polling_ = true;
+    poll_thread_ = std::thread(&KafkaProducer::pollLoop, this);
+    LOG_INFO << "Kafka producer initialized successfully, linger.ms: " << options.linger_ms
+             << ", compression: " << options.compression;
     return true;
 }
 
-bool KafkaProducer::sendMessage(const std::string& message) {
-    LOG_INFO << "Sending protobuf message to Kafka (size: " << message.size() << " bytes)";
+bool KafkaProducer::sendMessage(std::string message, const std::string& key) {
     if (!is_initialized_) {
         std::cerr << "Kafka producer not initialized" << std::endl;
         return false;
     }
-    LOG_INFO << "producer_->produce"; 
+
+    // 消息体交给 librdkafka 直接引用, 不再复制, 投递回调里释放
+    std::string* payload = new std::string(std::move(message));
     RdKafka::ErrorCode resp = producer_->produce(
         topic_,
-        RdKafka::Topic::PARTITION_UA,  // 使用自动分区分配
-        RdKafka::Producer::RK_MSG_COPY,  // 复制消息
-        const_cast<char*>(message.c_str()),
-        message.size(),
-        nullptr,  // 可选key
-        nullptr   // 消息opaque
+        RdKafka::Topic::PARTITION_UA,      // 由 partitioner 按 key 选分区
+        RdKafka::Producer::RK_MSG_BLOCK,   // 本地队列满时阻塞, 由 poll 线程腾出空间
+        const_cast<char*>(payload->data()),
+        payload->size(),
+        key.empty() ? nullptr : &key,
+        payload                            // 消息opaque
     );
-    LOG_INFO << "producer_->produce done";
     if (resp != RdKafka::ERR_NO_ERROR) {
-        std::cerr << "Failed to produce message: " 
-                  << RdKafka::err2str(resp) << std::endl;
+        delete payload;
+        failed_++;
+        LOG_ERROR << "Failed to produce message: " << RdKafka::err2str(resp);
         return false;
     }
-
-    // 确保消息被发送
-    producer_->poll(0);
-    LOG_INFO << "producer_->poll done";
     return true;
 }
 
+void KafkaProducer::pollLoop() {
+    while (polling_) {
+        producer_->poll(100);
+    }
+}
+
 void KafkaProducer::close() {
+    if (producer_) {
+        // 等待所有消息发送完成, 再停 poll 线程
+        producer_->flush(10 * 1000);
+        polling_ = false;
+        if (poll_thread_.joinable()) {
+            poll_thread_.join();
+        }
+        if (producer_->outq_len() > 0) {
+            LOG_WARN << "Kafka producer closed with " << producer_->outq_len() << " messages undelivered";
+        }
+    }
+
     if (topic_) {
         delete topic_;
         topic_ = nullptr;
     }
     
     if (producer_) {
-        // 等待所有消息发送完成
-        while (producer_->outq_len() > 0) {
-            producer_->poll(100);
-        }
         delete producer_;
         producer_ = nullptr;
     }
@@ -103,8 +144,12 @@ void KafkaProducer::close() {
     is_initialized_ = false;
 }
 
-void KafkaProducer::deliveryCallback(RdKafka::Message& message, void* opaque) {
+void KafkaProducer::DeliveryReport::dr_cb(RdKafka::Message& message) {
+    delete static_cast<std::string*>(message.msg_opaque());
     if (message.err()) {
-        std::cerr << "Message delivery failed: " << message.errstr() << std::endl;
+        owner_->failed_++;
+        LOG_ERROR << "Message delivery failed: " << message.errstr();
+        return;
     }
-} 
\ No newline at end of file
+    owner_->delivered_++;
+}
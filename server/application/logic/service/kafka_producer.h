@@ -1,9 +1,19 @@
 #pragma once
 
 #include <librdkafka/rdkafkacpp.h>
+#include <atomic>
 #include <string>
 #include <memory>
 #include <iostream>
+#include <thread>
+
+struct KafkaProducerOptions {
+    int linger_ms = 5;                  // linger.ms, wait this long to fill a batch
+    int batch_num_messages = 10000;     // batch.num.messages
+    int batch_size = 0;                 // batch.size in bytes (librdkafka >= 1.5), 0 keeps the default
+    std::string compression = "lz4";    // compression.codec: none, gzip, snappy, lz4, zstd
+    int queue_max_messages = 100000;    // queue.buffering.max.messages, sendMessage blocks beyond it
+};
 
 class KafkaProducer {
 public:
@@ -11,19 +21,38 @@ public:
     ~KafkaProducer();
 
     // 初始化并连接到Kafka
-    bool init(const std::string& brokers, const std::string& topic);
-    
-    // 发送消息到Kafka
-    bool sendMessage(const std::string& message);
-    
+    bool init(const std::string& brokers, const std::string& topic,
+              const KafkaProducerOptions& options = KafkaProducerOptions());
+
+    // 发送消息到Kafka, 入队即返回, 投递结果由 poll 线程的回调处理
+    // key 决定分区, 同一 key (房间id) 的消息落在同一分区, 保持顺序
+    bool sendMessage(std::string message, const std::string& key);
+
     // 关闭连接
     void close();
 
+    uint64_t deliveredCount() const { return delivered_.load(std::memory_order_relaxed); }
+    uint64_t failedCount() const { return failed_.load(std::memory_order_relaxed); }
+
 private:
-    static void deliveryCallback(RdKafka::Message& message, void* opaque);
+    class DeliveryReport : public RdKafka::DeliveryReportCb {
+    public:
+        explicit DeliveryReport(KafkaProducer* owner) : owner_(owner) {}
+        void dr_cb(RdKafka::Message& message) override;
+    private:
+        KafkaProducer* owner_;
+    };
+
+    // 投递回调和批量发送都在 poll 里完成
+    void pollLoop();
 
     std::string topic_name_;
     RdKafka::Producer* producer_;
     RdKafka::Topic* topic_;
     bool is_initialized_;
-}; 
\ No newline at end of file
+    DeliveryReport delivery_report_;
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> failed_{0};
+    std::atomic<bool> polling_{false};
+    std::thread poll_thread_;
+};
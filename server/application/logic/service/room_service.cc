@@ -10,8 +10,7 @@ using namespace muduo;
 int RoomService::initialize() {
     std::string err_msg;
 
-    // 1. 将默认房间插入数据库
-    std::lock_guard<std::mutex> lock(m_room_list_mtx);
+    // 1. 将默认房间插入数据库, 不碰 m_room_list, 下面的 refreshRoomList 自己加锁
     for (const Room& room : m_default_rooms) {
         string room_id = room.room_id;
         string existing_room_name;
@@ -40,7 +39,7 @@ int RoomService::initialize() {
         return -1;
     }
 
-    LOG_INFO << "RoomService initialization completed, total rooms: " << m_room_list.size();
+    LOG_INFO << "RoomService initialization completed, total rooms: " << getRoomList().size();
 
     return 0;
 }
@@ -79,7 +78,7 @@ bool RoomService::getAllRoomsFromDB(std::vector<Room>& rooms, string& error_msg,
     return dbGetAllRooms(rooms, error_msg, order_by);
 }
 
-std::vector<Room>& RoomService::getRoomList() {
+std::vector<Room> RoomService::getRoomList() const {
     std::lock_guard<std::mutex> lock(m_room_list_mtx);
     return m_room_list;
 }
@@ -110,18 +109,19 @@ int RoomService::refreshRoomList() {
         LOG_ERROR << "Failed to get all rooms from database: " << err_msg;
         return -1;
     }
-    m_room_list.clear();
-
-    for (const auto& room : all_rooms) {
-        m_room_list.push_back(room);
+    size_t room_count = all_rooms.size();
+    {
+        std::lock_guard<std::mutex> lock(m_room_list_mtx);
+        m_room_list.swap(all_rooms);
     }
 
-    LOG_INFO << "Room cache refreshed, total rooms: " << m_room_list.size();
+    LOG_INFO << "Room cache refreshed, total rooms: " << room_count;
     return 0;
 }
 
 bool RoomService::roomExistByName(const string& room_name){
-    for (auto& room : m_room_list) {
+    std::lock_guard<std::mutex> lock(m_room_list_mtx);
+    for (const auto& room : m_room_list) {
         if (room.room_name == room_name) {
             return true;
         }
@@ -63,9 +63,9 @@ public:
 
     /**
      * 获取内存中的房间列表（用于快速访问）
-     * @return 房间列表引用
+     * @return 加锁拷贝出的房间列表, addRoomToList 可能同时在其他线程 push_back
      */
-    std::vector<Room>& getRoomList();
+    std::vector<Room> getRoomList() const;
 
     /**
      * 添加房间到内存缓存